@@ -1,5 +1,6 @@
 #pragma once
 
+#include "audio/SampleConvert.hpp"
 #include <atomic>
 #include <cstddef>
 #include <cstring>
@@ -35,12 +36,16 @@ public:
         write_pos_.store(0, std::memory_order_relaxed);
         read_pos_.store(0, std::memory_order_relaxed);
         total_consumed_frames_.store(0, std::memory_order_relaxed);
+        cached_read_pos_ = 0;
+        cached_write_pos_ = 0;
     }
 
     // Flush all data. Only safe when consumer is paused (no concurrent reads).
     void reset() {
         write_pos_.store(0, std::memory_order_relaxed);
         read_pos_.store(0, std::memory_order_relaxed);
+        cached_read_pos_ = 0;
+        cached_write_pos_ = 0;
     }
 
     // Producer: write interleaved frames into ring buffer.
@@ -48,8 +53,14 @@ public:
     size_t write(const float* data, size_t frames) {
         size_t samples = frames * channels_;
         size_t w = write_pos_.load(std::memory_order_relaxed);
-        size_t r = read_pos_.load(std::memory_order_acquire);
-        size_t available = capacity_samples_ - (w - r);
+        // A stale consumer position only under-reports free space, so the
+        // cross-core read_pos_ load is paid only when the ring looks too
+        // full to take the whole request
+        size_t available = capacity_samples_ - (w - cached_read_pos_);
+        if (available < samples) {
+            cached_read_pos_ = read_pos_.load(std::memory_order_acquire);
+            available = capacity_samples_ - (w - cached_read_pos_);
+        }
         size_t to_write = std::min(samples, available);
 
         if (to_write == 0) return 0;
@@ -66,13 +77,70 @@ public:
         return to_write / channels_;
     }
 
-    // Consumer: read interleaved frames from ring buffer.
+    // Writable region handed out by reserve(). The ring wraps, so a
+    // reservation spans at most two segments; fill front to back.
+    struct WriteRegion {
+        float* first = nullptr;
+        size_t first_frames = 0;
+        float* second = nullptr;
+        size_t second_frames = 0;
+
+        size_t total_frames() const { return first_frames + second_frames; }
+    };
+
+    // Producer: reserve ring memory for up to max_frames of in-place
+    // writing (zero-copy: decoders can synthesize samples straight into
+    // the ring instead of staging + write()). Nothing is visible to the
+    // consumer until commit(); an uncommitted reservation holds no state,
+    // so bailing out after reserve() is fine. If the region is smaller
+    // than needed, fall back to write(), which handles the wrap split.
+    WriteRegion reserve(size_t max_frames) {
+        WriteRegion region;
+        size_t samples = max_frames * channels_;
+        size_t w = write_pos_.load(std::memory_order_relaxed);
+        size_t available = capacity_samples_ - (w - cached_read_pos_);
+        if (available < samples) {
+            cached_read_pos_ = read_pos_.load(std::memory_order_acquire);
+            available = capacity_samples_ - (w - cached_read_pos_);
+        }
+        size_t to_reserve = std::min(samples, available);
+        to_reserve = (to_reserve / channels_) * channels_;  // whole frames
+        if (to_reserve == 0) return region;
+
+        size_t pos = w & mask_;
+        size_t first = std::min(to_reserve, capacity_samples_ - pos);
+        region.first = buffer_ + pos;
+        region.first_frames = first / channels_;
+        // Expose the post-wrap segment only when the boundary lands on a
+        // frame edge (always true when channels divides the capacity)
+        if (to_reserve > first && first == region.first_frames * channels_) {
+            region.second = buffer_;
+            region.second_frames = (to_reserve - first) / channels_;
+        }
+        return region;
+    }
+
+    // Producer: publish frames written into the region returned by
+    // reserve(). frames must not exceed the region's total_frames().
+    void commit(size_t frames) {
+        size_t w = write_pos_.load(std::memory_order_relaxed);
+        write_pos_.store(w + frames * channels_, std::memory_order_release);
+    }
+
+    // Consumer: read interleaved frames from ring buffer, applying a
+    // constant gain during the copy (the copy touches every sample
+    // anyway, so the gain is bandwidth-free; 1.0 degrades to memcpy).
     // Returns number of frames actually read.
-    size_t read(float* dst, size_t frames) {
+    size_t read(float* dst, size_t frames, float gain = 1.0f) {
         size_t samples = frames * channels_;
-        size_t w = write_pos_.load(std::memory_order_acquire);
         size_t r = read_pos_.load(std::memory_order_relaxed);
-        size_t available = w - r;
+        // Mirror of the producer's trick: only touch the producer's line
+        // when the cached position can't satisfy the whole request
+        size_t available = cached_write_pos_ - r;
+        if (available < samples) {
+            cached_write_pos_ = write_pos_.load(std::memory_order_acquire);
+            available = cached_write_pos_ - r;
+        }
         size_t to_read = std::min(samples, available);
 
         if (to_read == 0) return 0;
@@ -81,12 +149,12 @@ public:
         to_read = (to_read / channels_) * channels_;
         if (to_read == 0) return 0;
 
-        // Wrap-aware copy
+        // Wrap-aware copy with the gain folded in
         size_t pos = r & mask_;
         size_t first = std::min(to_read, capacity_samples_ - pos);
-        std::memcpy(dst, buffer_ + pos, first * sizeof(float));
+        copy_with_gain(buffer_ + pos, dst, first, gain);
         if (to_read > first) {
-            std::memcpy(dst + first, buffer_, (to_read - first) * sizeof(float));
+            copy_with_gain(buffer_, dst + first, to_read - first, gain);
         }
 
         read_pos_.store(r + to_read, std::memory_order_release);
@@ -112,14 +180,27 @@ public:
 
     int channels() const { return channels_; }
 
+    size_t capacity_frames() const {
+        return channels_ ? capacity_samples_ / channels_ : 0;
+    }
+
 private:
     float* buffer_ = nullptr;
     size_t capacity_samples_ = 0;
     size_t mask_ = 0;
     int channels_ = 0;
 
-    alignas(64) std::atomic<size_t> write_pos_{0};
-    alignas(64) std::atomic<size_t> read_pos_{0};
+    // Hot fields grouped per thread on separate cache lines so the RT
+    // consumer and the decode-thread producer never false-share. Each
+    // side keeps a cached copy of its peer's position (plain, only
+    // touched by the owning thread) and re-reads the real atomic only
+    // when the cached value can't satisfy the request.
+    alignas(64) std::atomic<size_t> write_pos_{0};  // Producer line
+    size_t cached_read_pos_ = 0;
+
+    alignas(64) std::atomic<size_t> read_pos_{0};   // Consumer line
+    size_t cached_write_pos_ = 0;
+
     alignas(64) std::atomic<size_t> total_consumed_frames_{0};
 };
 
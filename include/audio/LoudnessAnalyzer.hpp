@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace audio {
+
+// EBU R128 / ITU-R BS.1770-4 integrated loudness measurement.
+//
+// Feed interleaved float PCM through process(); integrated_lufs() runs
+// the two-stage gating (absolute -70 LUFS, then relative -10 LU) over
+// the accumulated 400ms blocks. The K-weighting biquads are derived
+// from the analog prototype for the actual sample rate, so 44.1kHz and
+// hi-res material measure correctly, not just the 48kHz the spec
+// tabulates.
+//
+// All channels are weighted 1.0; library content is overwhelmingly
+// mono/stereo, where that matches the spec exactly.
+class LoudnessAnalyzer {
+public:
+    // ReplayGain 2.0 reference level; gain_db = REFERENCE_LUFS - measured
+    static constexpr double REFERENCE_LUFS = -18.0;
+
+    void init(int sample_rate, int channels);
+
+    // Accumulate interleaved frames. Cheap: two biquads and a running
+    // energy sum per sample.
+    void process(const float* interleaved, size_t frames);
+
+    // Gated integrated loudness of everything processed so far.
+    // Returns -HUGE_VAL when no block passed the absolute gate
+    // (e.g. digital silence).
+    [[nodiscard]] double integrated_lufs() const;
+
+private:
+    struct BiquadState {
+        double z1 = 0.0;
+        double z2 = 0.0;
+    };
+
+    int channels_ = 0;
+    size_t subblock_samples_ = 0;  // 100ms of frames
+
+    // K-weighting: stage 1 shelf, stage 2 high-pass (per channel state)
+    double b0_[2] = {}, b1_[2] = {}, b2_[2] = {}, a1_[2] = {}, a2_[2] = {};
+    std::vector<BiquadState> state_;  // channels * 2 stages
+
+    // 100ms sub-block energies; a gating block is 4 consecutive
+    // sub-blocks (400ms with 75% overlap)
+    std::vector<double> subblock_energy_;
+    double current_energy_ = 0.0;
+    size_t current_frames_ = 0;
+};
+
+}  // namespace audio
@@ -2,6 +2,7 @@
 
 #include "AudioDecoder.hpp"
 #include <mpg123.h>
+#include <filesystem>
 
 namespace audio {
 
@@ -24,11 +25,22 @@ public:
     [[nodiscard]] bool is_open() const override { return handle_ != nullptr; }
 
 private:
+    // VBR seek index cache: mpg123 records MPEG frame offsets as it
+    // decodes, which is what makes seeks in Xing-less VBR files cheap.
+    // The index is persisted per file (keyed by mtime+size) on close and
+    // restored on open, so only the first-ever playback pays the
+    // frame-walk; later sessions seek in O(log n) straight away.
+    void try_load_seek_index();
+    void try_save_seek_index();
+    static std::filesystem::path index_path_for(const std::string& filepath);
+
     mpg123_handle* handle_ = nullptr;
     int sample_rate_ = 0;
     int channels_ = 0;
     long total_frames_ = 0;
     long position_frames_ = 0;
+    std::string filepath_;
+    size_t loaded_index_fill_ = 0;  // Entries restored from cache; save only if grown
 };
 
 } // namespace audio
@@ -2,9 +2,12 @@
 
 #include "audio/PipeWireContext.hpp"
 #include "audio/AudioRingBuffer.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
-#include <atomic>
+#include <mutex>
 
 struct pw_thread_loop;
 struct pw_stream;
@@ -18,6 +21,19 @@ public:
 
     // Now requires the shared context
     [[nodiscard]] bool init(PipeWireContext& context, int sample_rate, int channels);
+
+    // Connect + negotiate the stream at startup but leave it corked, so
+    // the first play-press pays a pw_stream_set_active flip instead of
+    // the full connect/negotiation round-trip (several hundred ms on
+    // some graphs). pause(false) or reconfigure() wakes the stream.
+    [[nodiscard]] bool prewarm(PipeWireContext& context, int sample_rate, int channels);
+
+    // Fast-path format switch: cork, resize the ring, renegotiate via
+    // pw_stream_update_params and uncork - no stream teardown. Returns
+    // false (stream intact, corked) if the graph refuses the params;
+    // callers fall back to close() + init().
+    [[nodiscard]] bool reconfigure(int sample_rate, int channels);
+
     void close();
 
     // Ring buffer: producer (PlaybackCollector) writes decoded PCM here.
@@ -27,8 +43,20 @@ public:
     // Flush ring buffer (for seek/clear). Only call when stream is paused.
     void flush_ring();
 
+    // Blocks the decode thread (up to `timeout`) until the RT callback
+    // drains the ring below the low watermark. The timeout keeps the
+    // decode loop responsive to pause/seek/stop even when playback is
+    // inactive. Never call on the RT thread.
+    void wait_until_writable(std::chrono::milliseconds timeout);
+
     void pause(bool paused);
 
+    // Best-effort wait for the ring (and the device's queued buffers)
+    // to play out, bounded by `timeout`. Used before a stream handover
+    // at a natural track boundary so the outgoing tail isn't chopped;
+    // manual skips don't drain. Never call on the RT thread.
+    void drain(std::chrono::milliseconds timeout);
+
     bool is_initialized() const { return stream_ != nullptr; }
 
     int get_sample_rate() const { return sample_rate_; }
@@ -42,6 +70,9 @@ public:
 private:
     friend void on_process_callback(void* userdata);
 
+    [[nodiscard]] bool init_stream(PipeWireContext& context, int sample_rate,
+                                   int channels, bool start_active);
+
     uint32_t device_id_ = 0;
     int sample_rate_ = 0;
     int channels_ = 0;
@@ -50,6 +81,15 @@ private:
 
     AudioRingBuffer ring_;
 
+    // Low-watermark wake: on_process raises the flag and notifies (no
+    // mutex held, so the RT thread never blocks) once occupancy drops
+    // below the watermark; the decode thread waits on the cv instead of
+    // polling in a 1ms sleep loop
+    std::atomic<size_t> low_watermark_frames_{0};
+    std::atomic<bool> writable_signal_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+
     // Per-stream state
     struct pw_stream* stream_ = nullptr;
     PipeWireContext* context_ = nullptr; // Non-owning
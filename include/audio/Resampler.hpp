@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace audio {
+
+/**
+ * Resampler: streaming polyphase windowed-sinc sample rate converter.
+ *
+ * Backs the pinned-rate output mode (config pin_sample_rate): the
+ * PipeWire stream stays at one device rate and every track is converted
+ * into it, so mixed-rate queues never renegotiate the stream. Each
+ * output frame is a TAPS-tap FIR over the source window, evaluated per
+ * channel with the SIMD dot_product kernel from SampleConvert;
+ * coefficients are precomputed for PHASES fractional positions
+ * (Blackman-Harris windowed sinc, cutoff below the narrower Nyquist),
+ * so the per-frame work is a table lookup plus one dot product per
+ * channel.
+ *
+ * Streaming: source history carries across process() calls, so chunk
+ * and gapless track boundaries are seamless. reset() after a seek or
+ * ring flush.
+ */
+class Resampler {
+public:
+    // Rebuilds the filter bank when the rate pair or channel count
+    // changed; a no-op otherwise, preserving streaming state so a
+    // same-format gapless boundary stays seamless
+    void configure(int src_rate, int dst_rate, int channels);
+    void reset();
+
+    [[nodiscard]] bool active() const { return src_rate_ != dst_rate_ && src_rate_ > 0; }
+
+    // Converts in_frames interleaved frames, appending interleaved
+    // output to out. Returns the number of output frames appended.
+    size_t process(const float* in, size_t in_frames, std::vector<float>& out);
+
+    // Upper bound on the frames one process(in_frames) call can append
+    // (ring-space check before decoding a chunk)
+    [[nodiscard]] size_t max_output_frames(size_t in_frames) const;
+
+private:
+    static constexpr int TAPS = 32;     // FIR length per output frame
+    static constexpr int PHASES = 256;  // Fractional positions in the bank
+
+    void build_filter_bank();
+
+    int src_rate_ = 0;
+    int dst_rate_ = 0;
+    int channels_ = 0;
+    double step_ = 1.0;  // Source frames advanced per output frame
+
+    std::vector<float> bank_;  // PHASES x TAPS coefficients
+    // Deinterleaved source history per channel; dot_product needs each
+    // window contiguous, and deinterleaving once per chunk is cheaper
+    // than strided loads per tap
+    std::vector<std::vector<float>> history_;
+    double pos_ = 0.0;  // Fractional read position into history_
+};
+
+}  // namespace audio
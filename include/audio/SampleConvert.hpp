@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+
+namespace audio {
+
+/**
+ * SampleConvert: vectorized PCM conversion kernels shared by the
+ * decoders.
+ *
+ * Integer-to-float conversion and channel interleaving sit on the
+ * decode thread's hot path (at 192kHz/2ch the scalar loops are a
+ * measurable slice of it). These kernels process 8-16 samples per
+ * iteration: AVX2 when the CPU has it, SSE2 otherwise on x86-64, NEON
+ * on aarch64, with a scalar fallback everywhere else. All variants
+ * produce bit-identical results to the scalar loops they replace.
+ */
+
+/**
+ * Converts signed 16-bit PCM to float in [-1.0, 1.0) (divides by 32768).
+ *
+ * @param in Input samples
+ * @param out Output buffer (may not alias in)
+ * @param count Number of samples (not frames)
+ */
+void convert_s16_to_float(const short* in, float* out, size_t count);
+
+/**
+ * Interleaves planar float channels into one interleaved buffer
+ * (out[frame * channels + ch] = planes[ch][frame]). Stereo takes a
+ * vectorized path; other channel counts fall back to scalar.
+ *
+ * @param planes Per-channel sample pointers (channels entries)
+ * @param channels Number of channels
+ * @param out Output buffer, frames * channels floats
+ * @param frames Number of frames
+ */
+void interleave_planar_float(const float* const* planes, int channels,
+                             float* out, size_t frames);
+
+/**
+ * Copies samples while applying a constant gain
+ * (out[i] = in[i] * gain). A gain of exactly 1.0 degrades to memcpy.
+ * Runs on the PipeWire RT callback via AudioRingBuffer::read - the
+ * copy is touching every sample anyway, so folding the gain in here
+ * replaces a separate scaling pass over the same data.
+ *
+ * @param in Input samples (may not alias out)
+ * @param out Output buffer
+ * @param count Number of samples (not frames)
+ * @param gain Linear gain factor
+ */
+void copy_with_gain(const float* in, float* out, size_t count, float gain);
+
+/**
+ * Dense float dot product (FIR convolution inner loop). FMA under
+ * AVX2, 16 lanes per iteration; the accumulation order differs from a
+ * scalar loop, so results can differ in the last ulps.
+ *
+ * @param a First operand (e.g. filter taps)
+ * @param b Second operand (e.g. sample window)
+ * @param count Number of elements
+ * @return Sum of a[i] * b[i]
+ */
+float dot_product(const float* a, const float* b, size_t count);
+
+/**
+ * Equal-power crossfade: out[i] = out[i]*sqrt(1-t) + in[i]*sqrt(t),
+ * with t advancing by t_step per element and clamped to [0, 1]. The
+ * sqrt law keeps perceived loudness flat through the overlap where a
+ * linear fade of uncorrelated material would dip ~3dB at the midpoint.
+ *
+ * @param out Outgoing samples, mixed in place
+ * @param in Incoming samples
+ * @param count Number of samples (not frames)
+ * @param t_start Fade position of the first element, 0 = all out, 1 = all in
+ * @param t_step Fade advance per element (per sample, not per frame)
+ */
+void crossfade_mix(float* out, const float* in, size_t count,
+                   float t_start, float t_step);
+
+}  // namespace audio
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "audio/AudioRingBuffer.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace audio {
+
+/**
+ * Real-time spectrum tap feeding the NowPlaying visualizer.
+ *
+ * The decode thread offers each decoded chunk to feed(), which
+ * downmixes to mono, decimates 2:1 and writes into a small SPSC
+ * analysis ring - wait-free, and samples that do not fit are simply
+ * dropped, so audio never waits on visualization. A low-priority
+ * worker drains the ring, runs a Hann-windowed radix-2 FFT with
+ * precomputed twiddles and bit-reversal tables, folds the magnitude
+ * spectrum into log-spaced bands and stores smoothed 0-100 levels in
+ * relaxed atomics.
+ *
+ * NowPlaying reads band_levels() directly at render time (the same
+ * pattern the perf HUD uses for PerfCounters) rather than through
+ * snapshot publishes: the steady-state write path stays silent, and a
+ * stalled worker only freezes the visualization.
+ */
+class SpectrumAnalyzer {
+public:
+    static constexpr size_t BANDS = 16;
+    static constexpr size_t FFT_SIZE = 1024;
+
+    static SpectrumAnalyzer& instance();
+
+    // Decode thread: offer `frames` interleaved frames. Wait-free;
+    // drops whatever the analysis ring cannot take.
+    void feed(const float* interleaved, size_t frames, int channels,
+              int sample_rate);
+
+    // Render thread: current band levels, 0-100, low to high frequency
+    [[nodiscard]] std::array<int, BANDS> band_levels() const;
+
+    // True once feed() has seen samples (hides the row until playback
+    // has actually produced audio)
+    [[nodiscard]] bool active() const {
+        return active_.load(std::memory_order_relaxed);
+    }
+
+    // Stop and join the worker. Idempotent.
+    void shutdown();
+
+    ~SpectrumAnalyzer();
+
+private:
+    SpectrumAnalyzer();
+    void run_worker(std::stop_token stop_token);
+
+    AudioRingBuffer ring_;          // Mono samples, decimated 2:1
+    std::vector<float> feed_buf_;   // Decode-thread staging (downmix/decimate)
+    std::array<std::atomic<uint8_t>, BANDS> levels_{};
+    std::atomic<bool> active_{false};
+    std::atomic<int> source_rate_{44100};  // Pre-decimation sample rate
+    std::atomic<bool> stopped_{false};
+    std::jthread worker_;
+};
+
+}  // namespace audio
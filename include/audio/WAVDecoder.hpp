@@ -0,0 +1,62 @@
+#pragma once
+
+#include "AudioDecoder.hpp"
+#include "util/MappedFile.hpp"
+#include <cstdint>
+#include <memory>
+
+namespace audio {
+
+/**
+ * WAVDecoder: mmap direct-read playback for RIFF/WAVE PCM.
+ *
+ * Uncompressed audio needs no decode work, so the buffered read
+ * syscalls libsndfile makes are pure overhead. This decoder maps the
+ * whole file (madvise SEQUENTIAL so the kernel prefetches ahead of the
+ * cursor) and feeds the SampleConvert kernels straight from the data
+ * chunk - zero read syscalls and zero staging copies on the playback
+ * path.
+ *
+ * Handles integer PCM (16/24/32-bit) and 32-bit float, plain or
+ * WAVE_FORMAT_EXTENSIBLE. Anything else (ADPCM, a-law, 64-bit float,
+ * odd alignment) silently falls back to the libsndfile path, so
+ * nothing that played before stops playing.
+ */
+class WAVDecoder : public AudioDecoder {
+public:
+    WAVDecoder();
+    ~WAVDecoder() override;
+
+    [[nodiscard]] bool open(const std::string& filepath) override;
+    void close() override;
+
+    [[nodiscard]] int read_pcm(float* buffer, int max_frames) override;
+
+    [[nodiscard]] int get_sample_rate() const override;
+    [[nodiscard]] int get_channels() const override;
+    [[nodiscard]] long get_total_frames() const override;
+    [[nodiscard]] long get_position_frames() const override;
+
+    [[nodiscard]] bool seek(long frame) override;
+    [[nodiscard]] bool is_open() const override;
+
+private:
+    enum class SampleFormat { S16, S24, S32, F32 };
+
+    // Parses the RIFF chunks out of the mapping; false = use fallback
+    bool parse_riff();
+
+    ouroboros::util::MappedFile map_;
+    SampleFormat format_ = SampleFormat::S16;
+    int sample_rate_ = 0;
+    int channels_ = 0;
+    int block_align_ = 0;
+    uint64_t data_offset_ = 0;
+    long total_frames_ = 0;
+    long position_frames_ = 0;
+
+    // libsndfile fallback for WAV variants the mmap path rejects
+    std::unique_ptr<AudioDecoder> fallback_;
+};
+
+}  // namespace audio
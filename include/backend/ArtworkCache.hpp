@@ -11,14 +11,25 @@
 namespace ouroboros::backend {
 
 struct RawArtworkEntry {
-    std::vector<uint8_t> data;  // Raw JPEG/PNG bytes (compressed)
+    // Image bytes live in one of two places: artwork stored this session
+    // owns a heap copy; artwork loaded from disk is a span into the
+    // cache file's mmap, so startup touches only the index and cold
+    // images page in on first use (and page out under memory pressure).
+    std::vector<uint8_t> owned;     // Raw JPEG/PNG bytes (compressed)
+    const uint8_t* mapped = nullptr;  // Span into the cache mapping
+    size_t mapped_size = 0;
     std::string mime_type;       // "image/jpeg" or "image/png"
     std::string source_dir;      // Album directory this artwork came from
     size_t ref_count = 0;        // Number of tracks referencing this artwork
 
+    [[nodiscard]] const uint8_t* bytes() const { return mapped ? mapped : owned.data(); }
+    [[nodiscard]] size_t size() const { return mapped ? mapped_size : owned.size(); }
+
     RawArtworkEntry() = default;
     RawArtworkEntry(std::vector<uint8_t> d, std::string mime, std::string dir, size_t refs = 0)
-        : data(std::move(d)), mime_type(std::move(mime)), source_dir(std::move(dir)), ref_count(refs) {}
+        : owned(std::move(d)), mime_type(std::move(mime)), source_dir(std::move(dir)), ref_count(refs) {}
+    RawArtworkEntry(const uint8_t* span, size_t span_size, std::string mime, std::string dir)
+        : mapped(span), mapped_size(span_size), mime_type(std::move(mime)), source_dir(std::move(dir)) {}
 };
 
 /**
@@ -71,12 +82,18 @@ public:
     [[nodiscard]] size_t size() const;
     [[nodiscard]] size_t memory_usage() const;  // Total bytes in cache
 
+    // Global memory budget hook (see util::MemoryBudget): drop the
+    // resident pages of the cache-file mapping via MADV_DONTNEED.
+    // Mapped entries refault from disk on next use; nothing is lost.
+    // Returns the mapping size (an upper bound on bytes released).
+    size_t release_mapped_pages();
+
     // Clear all entries (used for testing)
     void clear();
 
 private:
     ArtworkCache() = default;
-    ~ArtworkCache() = default;
+    ~ArtworkCache();
 
     // Prevent copy/move
     ArtworkCache(const ArtworkCache&) = delete;
@@ -89,6 +106,13 @@ private:
     std::unordered_set<std::string> verified_tracks_;  // Track paths with verified artwork hash
     bool dirty_ = false;  // Track if cache needs saving
 
+    // Read-only mapping of the cache file that loaded entries point
+    // into. Lives until the cache is cleared or destroyed; save()
+    // replaces the file via rename so the mapped inode stays valid.
+    void* map_base_ = nullptr;
+    size_t map_size_ = 0;
+    void unmap_locked();
+
     // Cache file format magic/version
     static constexpr uint64_t CACHE_MAGIC = 0x4F55524F41525431ULL;  // 'OUROART1'
     static constexpr uint32_t CACHE_VERSION = 5;  // Added explicit dir_to_hash_ persistence
@@ -12,6 +12,16 @@ struct Config {
     int default_volume = 50;
     bool shuffle = false;
     std::string repeat = "all";
+    // ReplayGain mode: "album" (default, preserves intra-album dynamics),
+    // "track", or "off". Gains come from the background loudness scanner.
+    std::string replaygain = "album";
+    // Crossfade overlap at track boundaries in ms; 0 keeps pure gapless.
+    // Only applies when both tracks share the output format.
+    int crossfade_ms = 0;
+    // Pin the output device at one sample rate and resample every track
+    // into it (see audio::Resampler); 0 follows each track's native
+    // rate, renegotiating the stream at rate boundaries.
+    int pin_sample_rate = 0;
 
     // UI settings
     std::string layout = "default";
@@ -34,6 +44,8 @@ struct Config {
     int artwork_prefetch_items = 100;   // Items to prefetch beyond viewport
     int artwork_spawn_threshold = 10;   // Queue depth per worker to spawn new worker
     int artwork_memory_limit_mb = 3072; // Memory pressure limit for artwork cache (MB)
+    int memory_budget_mb = 0;           // Total cache budget (MB); 0 = auto (cgroup limit or half of RAM)
+    int audio_cpu_affinity = -1;        // Pin the audio decode thread to this CPU (-1 = off)
 
     // O(1) accessors - return by reference, no allocation
     const std::vector<std::filesystem::path>& get_music_directories() const { return music_directories; }
@@ -41,6 +53,8 @@ struct Config {
     int get_artwork_prefetch_items() const { return artwork_prefetch_items; }
     int get_artwork_spawn_threshold() const { return artwork_spawn_threshold; }
     int get_artwork_memory_limit_mb() const { return artwork_memory_limit_mb; }
+    int get_memory_budget_mb() const { return memory_budget_mb; }
+    int get_audio_cpu_affinity() const { return audio_cpu_affinity; }
 
     static Config& instance();
 };
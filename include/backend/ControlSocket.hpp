@@ -0,0 +1,59 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ouroboros::backend {
+
+/**
+ * Line-oriented control server on a unix stream socket, used by daemon
+ * mode for queue/transport commands (`echo next | nc -U $SOCK`).
+ *
+ * Deliberately tiny: newline-terminated command in, one reply line out,
+ * no framing, no auth beyond the socket's 0600 mode. service() polls
+ * the listen socket and connected clients for up to a timeout and
+ * dispatches each complete line to the handler on the calling thread,
+ * so the daemon loop stays single-threaded.
+ */
+class ControlSocket {
+public:
+    /// Returns the reply line (without trailing newline) for a command
+    using CommandHandler = std::function<std::string(const std::string&)>;
+
+    ~ControlSocket();
+
+    /// $XDG_RUNTIME_DIR/ouroboros.sock, or /tmp/ouroboros-<uid>.sock
+    /// when the session has no runtime dir
+    [[nodiscard]] static std::filesystem::path default_path();
+
+    /// Binds and listens. A stale socket file from a crashed instance
+    /// is unlinked first; a second live daemon therefore steals the
+    /// path rather than failing - running two is operator error.
+    [[nodiscard]] bool open(const std::filesystem::path& path);
+    void close();
+
+    /// Waits up to timeout_ms for activity, then accepts new clients,
+    /// reads available bytes, and dispatches complete lines. Returns
+    /// the number of commands dispatched.
+    int service(int timeout_ms, const CommandHandler& on_command);
+
+private:
+    struct Client {
+        int fd = -1;
+        std::string inbuf;
+    };
+
+    // A runaway writer gets disconnected rather than growing the buffer
+    static constexpr size_t MAX_LINE_BYTES = 4096;
+    static constexpr size_t MAX_CLIENTS = 16;
+
+    void drop_client(size_t index);
+
+    int listen_fd_ = -1;
+    std::filesystem::path path_;
+    std::vector<Client> clients_;
+};
+
+}  // namespace ouroboros::backend
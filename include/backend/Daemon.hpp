@@ -0,0 +1,17 @@
+#pragma once
+
+namespace ouroboros::backend {
+
+/**
+ * Headless `--daemon` mode: the snapshot core, LibraryCollector and
+ * PlaybackCollector with no terminal, renderer, or artwork machinery,
+ * plus a ControlSocket for queue/transport commands. Intended for boxes
+ * that only decode - a NAS feeding PipeWire - where the UI's 30FPS loop
+ * and image caches are pure overhead.
+ *
+ * Runs until SIGINT/SIGTERM or a `quit` command; returns the process
+ * exit code.
+ */
+int run_daemon();
+
+}  // namespace ouroboros::backend
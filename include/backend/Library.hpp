@@ -2,10 +2,12 @@
 
 #include "model/Snapshot.hpp"
 #include "util/DirectoryScanner.hpp"
+#include "util/FlatMap.hpp"
 #include <filesystem>
 #include <vector>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <functional>
 #include <memory>
 
@@ -18,19 +20,46 @@ public:
     [[deprecated("use set_music_directories() instead")]]
     void set_music_directory(const std::filesystem::path& dir);
     void set_music_directories(const std::vector<std::filesystem::path>& dirs);
-    void scan_directory(const std::function<void(int scanned, int total)>& progress_callback = nullptr);
+    // Streaming scan: when partial_callback is set, batches of freshly
+    // parsed tracks are delivered (on the calling thread) every few
+    // thousand files while the parallel parse is still running, so a
+    // first-ever scan can publish a usable partial library long before
+    // the full parse completes. Batches are disjoint; tracks already
+    // reused from cache are not delivered.
+    void scan_directory(
+        const std::function<void(int scanned, int total)>& progress_callback = nullptr,
+        const std::function<void(std::vector<model::Track>&&)>& partial_callback = nullptr);
 
+    // Deep copy of every configured-directory track; only for building
+    // a state that owns (and re-orders) its vector. Read-only passes
+    // should use for_each_track, which visits the live storage without
+    // materializing a copy of the library.
     [[nodiscard]] std::vector<model::Track> get_all_tracks() const;
+    void for_each_track(const std::function<void(const model::Track&)>& fn) const;
     [[nodiscard]] std::optional<model::Track> get_track_by_path(const std::filesystem::path& path) const;
 
     [[nodiscard]] size_t get_track_count() const;
     [[nodiscard]] bool is_scanning() const;
 
-    // Persistence (monolithic .bin cache)
-    [[nodiscard]] bool save_to_cache(const std::filesystem::path& cache_path) const;
+    // Persistence: .bin snapshot plus an append-only .bin.journal of
+    // change records. Routine saves after an incremental rescan append
+    // only the delta; the snapshot is rewritten (and the journal
+    // truncated) when the whole library changed or the journal grows
+    // past its compaction threshold.
+    [[nodiscard]] bool save_to_cache(const std::filesystem::path& cache_path);
     [[nodiscard]] bool load_from_cache(const std::filesystem::path& cache_path);
     void set_tracks(const std::vector<model::Track>& tracks);
 
+    // Persisted sort order (CACHE_VERSION 7): the collector records its
+    // published track order plus a fingerprint of the comparator config,
+    // the snapshot write persists it, and the next clean start replays
+    // the stored order instead of re-sorting the whole library. The
+    // order is dropped when journal replay changed any track or the
+    // fingerprint no longer matches.
+    void set_sort_order(std::vector<std::string> sorted_paths, uint64_t fingerprint);
+    [[nodiscard]] std::optional<std::vector<model::Track>> get_tracks_in_saved_order(
+        uint64_t fingerprint) const;
+
     // Multi-tier cache validation
     enum class CacheValidationResult {
         Valid,
@@ -51,23 +80,54 @@ public:
         const std::function<void(int, int)>& progress_callback = nullptr
     );
 
+    // Loudness scanner results: record a track's measured gain (marks it
+    // scanned) and refresh album gains for directories whose tracks are
+    // all measured. Both only touch the journal delta, so the following
+    // save is an append, not a snapshot rewrite.
+    void set_track_loudness(const std::string& path, float track_gain_db);
+    void recompute_album_gains();
+
     // Accessors for optimization fields
     [[nodiscard]] const std::unordered_map<std::string, std::time_t>& get_dir_mtimes() const { return dir_mtimes_; }
     [[nodiscard]] uint64_t get_tree_hash() const { return last_tree_hash_; }
 
 private:
     std::vector<std::filesystem::path> music_dirs_;  // Multiple directories
-    // Map path -> Track for O(1) lookup
-    std::unordered_map<std::string, model::Track> tracks_;
+    // Map path -> Track for O(1) lookup. Flat open-addressing storage:
+    // no per-track node allocation on load, no pointer chase per probe
+    // in the validation passes
+    util::FlatMap<std::string, model::Track> tracks_;
     bool is_scanning_ = false;
 
     // Multi-tier optimization (CACHE_VERSION 3)
     std::unordered_map<std::string, std::time_t> dir_mtimes_;  // Directory → mtime
-    uint64_t last_tree_hash_ = 0;                               // Tree hash from last scan
+    std::unordered_map<std::string, uint64_t> dir_hashes_;     // Directory → hash of its audio paths (v5)
+    uint64_t last_tree_hash_ = 0;                               // XOR of dir_hashes_ from last scan
     std::time_t cache_timestamp_ = 0;                           // When cache was built
 
     // Performance: reuse scan results from TIER 0 validation to avoid double scanning
     std::optional<util::DirectoryScanner::ScanResult> cached_scan_result_;
+
+    // Journal bookkeeping: paths changed/removed since the last full
+    // snapshot write. When only these moved, save_to_cache appends
+    // change records instead of rewriting the snapshot.
+    std::unordered_set<std::string> journal_dirty_;
+    std::unordered_set<std::string> journal_deleted_;
+    bool full_save_needed_ = true;
+
+    // Persisted sort order (v7): track paths in display order and the
+    // comparator fingerprint they were sorted under. sort_order_dirty_
+    // means the on-disk snapshot lacks this order; an otherwise-clean
+    // save rewrites the snapshot once to persist it.
+    std::vector<std::string> sorted_paths_;
+    uint64_t sort_fingerprint_ = 0;
+    bool sort_order_dirty_ = false;
+
+    bool write_full_snapshot(const std::filesystem::path& cache_path);
+
+    // Rebuild dir_mtimes_/dir_hashes_/last_tree_hash_ from a finished
+    // scan's directory records
+    void adopt_scan_dirs(const util::DirectoryScanner::ScanResult& scan_result);
 };
 
 }  // namespace ouroboros::backend
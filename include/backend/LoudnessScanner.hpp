@@ -0,0 +1,64 @@
+#pragma once
+
+#include "model/Snapshot.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace audio {
+class AudioDecoder;
+}
+
+namespace ouroboros::backend {
+
+// Background EBU R128 loudness scanning over library files.
+//
+// One track is analyzed per TaskPool Low task, and the next task is only
+// submitted when the previous one finishes, so at most one pool worker is
+// ever occupied and UI-facing High work preempts at task granularity.
+// Results accumulate under a mutex; LibraryCollector drains them on its
+// watcher cadence, persists gains into the library cache and republishes.
+// Because gains are persisted per track, a 200k-track backlog simply
+// resumes where it left off on the next session.
+class LoudnessScanner {
+public:
+    struct Result {
+        std::string path;
+        double integrated_lufs = 0.0;
+        float track_gain_db = 0.0f;
+    };
+
+    ~LoudnessScanner();
+
+    // Queue tracks for analysis and kick off the task chain. Tracks
+    // already scanned should be filtered out by the caller.
+    void start(std::vector<model::Track> pending);
+
+    // Stop after the in-flight track (checked between decode chunks)
+    // and wait for the chain to go quiet.
+    void stop();
+
+    // Completed measurements since the last drain.
+    [[nodiscard]] std::vector<Result> drain_results();
+
+    // True when the queue is empty and nothing is in flight.
+    [[nodiscard]] bool idle() const;
+
+private:
+    void schedule_next();
+    void analyze_one(const model::Track& track);
+    static std::unique_ptr<audio::AudioDecoder> create_decoder(const model::Track& track);
+
+    mutable std::mutex mutex_;
+    std::condition_variable quiesced_cv_;
+    std::deque<model::Track> queue_;       // Guarded by mutex_
+    std::vector<Result> results_;          // Guarded by mutex_
+    bool in_flight_ = false;               // Guarded by mutex_
+    std::atomic<bool> stop_requested_{false};
+};
+
+}  // namespace ouroboros::backend
@@ -1,30 +1,102 @@
 #pragma once
 
 #include "model/Snapshot.hpp"
-#include <unordered_map>
+#include <array>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
 
 namespace ouroboros::backend {
 
+/**
+ * MetadataCache: parsed-track cache with an mtime-validated disk tier.
+ *
+ * The in-memory map alone died with the process, so a restart after a
+ * partial scan re-parsed everything the monolithic library cache had
+ * not captured yet. With open_disk_cache() enabled, every
+ * cache_metadata() call also appends a record to metadata.bin, and the
+ * file is replayed on open — parse work survives crashes and partial
+ * scans. Entries are validated against the file's current mtime at
+ * lookup, so a retagged file misses and gets re-parsed.
+ *
+ * Thread-safe via shard striping: paths hash to one of NUM_SHARDS
+ * independent map+mutex pairs, so the parallel parse workers in
+ * Library only contend when two land on the same shard, and
+ * cleanup_expired sweeps shard by shard instead of stopping the world.
+ * The disk append handle is guarded separately.
+ */
 class MetadataCache {
 public:
+    /// Shared instance used by the parse paths. Standalone instances
+    /// (memory-only, TTL-based) remain constructible for tests.
+    static MetadataCache& instance();
+
     MetadataCache(std::chrono::seconds ttl = std::chrono::seconds(3600));
 
+    /**
+     * Attach the disk tier. Replays existing records into memory and
+     * appends subsequent inserts. Compacts the file when replay finds
+     * mostly superseded records.
+     */
+    bool open_disk_cache(const std::filesystem::path& cache_file);
+
     void cache_metadata(const std::string& file_path, const model::Track& metadata);
+
+    /**
+     * Lookup validated against the file's current mtime (from the scan
+     * result). Returns nullopt if absent or if the file changed since
+     * the entry was cached.
+     */
+    [[nodiscard]] std::optional<model::Track> get_cached_metadata(
+        const std::string& file_path, std::time_t current_mtime) const;
+
+    /// TTL-only lookup (no disk validation); kept for memory-only use.
     [[nodiscard]] std::optional<model::Track> get_cached_metadata(const std::string& file_path) const;
     [[nodiscard]] bool has_cached_metadata(const std::string& file_path) const;
-    
+
     void clear();
     void cleanup_expired();
 
+    // Global memory budget hooks (see util::MemoryBudget). Resident
+    // bytes are an estimate (keys + entry structs + owned strings);
+    // shrink() sweeps entries older than half the TTL - the disk tier
+    // keeps the parse work, so eviction only costs a replay or a
+    // re-parse on the next miss. Returns the estimated bytes freed.
+    [[nodiscard]] size_t resident_bytes() const;
+    size_t shrink(size_t bytes_needed);
+
 private:
     struct CacheEntry {
         model::Track metadata;
         std::chrono::steady_clock::time_point timestamp;
     };
 
-    std::unordered_map<std::string, CacheEntry> cache_;
+    static constexpr size_t NUM_SHARDS = 16;  // Power of two for mask selection
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, CacheEntry> map;
+    };
+
+    static size_t shard_index(const std::string& path) {
+        return std::hash<std::string>{}(path) & (NUM_SHARDS - 1);
+    }
+
+    /// Sum of shard sizes (locks each shard in turn)
+    [[nodiscard]] size_t total_entries() const;
+
+    /// Caller holds disk_mutex_
+    void rewrite_disk_cache();
+
+    std::array<Shard, NUM_SHARDS> shards_;
     std::chrono::seconds ttl_;
+
+    // Disk tier, serialized independently of the shards
+    mutable std::mutex disk_mutex_;
+    std::filesystem::path disk_path_;
+    std::ofstream disk_out_;   // Append handle; open while the disk tier is active
 };
 
 }  // namespace ouroboros::backend
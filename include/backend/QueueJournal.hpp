@@ -0,0 +1,69 @@
+#pragma once
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ouroboros::backend {
+
+/**
+ * Append-only persistence for the play queue.
+ *
+ * Every AddTrackToQueue appends one record, ClearQueue truncates the
+ * file; at startup the surviving records are replayed against the
+ * loaded library to rebuild the queue. record_add/record_clear only
+ * push an op onto an in-memory list under a short lock - O(1), no
+ * disk I/O on the caller (UI) thread; a writer thread drains the list
+ * and does the appends.
+ *
+ * Records hold track paths, not indices: display order and library
+ * contents can change between sessions, so replay resolves paths
+ * against whatever library loads next time (entries whose file is gone
+ * are silently dropped).
+ *
+ * Journal file: ~/.cache/ouroboros/queue.journal
+ */
+class QueueJournal {
+public:
+    static QueueJournal& instance();
+
+    // Replays an existing journal into memory and starts the writer
+    // thread. Call once at startup before any record_* calls.
+    void open(const std::filesystem::path& journal_path);
+
+    // Queue contents to restore: every add since the last clear, in
+    // add order. Valid after open().
+    [[nodiscard]] std::vector<std::string> restored_paths() const;
+
+    // O(1) asynchronous appends (safe from any thread)
+    void record_add(std::string track_path);
+    void record_clear();
+
+    // Flush pending ops and join the writer. Idempotent.
+    void shutdown();
+
+    ~QueueJournal();
+
+private:
+    QueueJournal() = default;
+
+    struct Op {
+        bool clear = false;
+        std::string path;  // Empty for clear ops
+    };
+
+    void run_writer();
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Op> pending_;          // Guarded by mutex_
+    std::vector<std::string> loaded_;  // Filled by open(), then read-only
+    std::filesystem::path path_;
+    std::thread writer_;
+    bool stop_ = false;  // Guarded by mutex_
+};
+
+}  // namespace ouroboros::backend
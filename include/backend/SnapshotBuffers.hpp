@@ -20,18 +20,38 @@ public:
     // Publish: swap front/back buffers and increment sequence
     void publish();
 
+    // Bracket the WHOLE producer critical section (back-buffer mutation
+    // through publish). The seqlock version goes odd in begin_write and
+    // even in end_write; SnapshotPublisher calls these under its mutex.
+    void begin_write();
+    void end_write();
+
     // Get the front buffer for reading (consumer)
+    //
+    // SINGLE-READER ONLY: safe for the one UI thread that raced publish()
+    // historically. A second reader can observe the old front mid-re-sync.
+    // New reader threads must use read_consistent().
     [[nodiscard]] const model::Snapshot& front() const;
 
+    // Seqlock read path: returns a consistent copy, safe from ANY number
+    // of reader threads. Retries while a writer is inside
+    // begin_write/end_write or if one completed mid-copy (torn read).
+    [[nodiscard]] model::Snapshot read_consistent() const;
+
     // Helper to get current sequence
     [[nodiscard]] uint64_t seq() const;
 
 private:
     model::Snapshot a_;
     model::Snapshot b_;
-    
+
     std::atomic<model::Snapshot*> front_;
     model::Snapshot* back_;
+
+    // Seqlock version: odd while a writer is active. Readers that hold a
+    // stale front pointer (the buffer may have swapped roles and be
+    // mid-overwrite) detect it by the version changing during their copy.
+    std::atomic<uint64_t> version_{0};
 };
 
 }  // namespace ouroboros::backend
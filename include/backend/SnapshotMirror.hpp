@@ -0,0 +1,99 @@
+#pragma once
+
+#include "model/Snapshot.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace ouroboros::backend {
+
+/**
+ * Cross-process mirror of the player state over POSIX shared memory.
+ *
+ * External tools (status bars, dashboards) read playback state with a
+ * plain mmap and two atomic loads - no syscalls, no serialization, no
+ * IPC round trip. The segment holds a fixed-size POD projection of the
+ * snapshot (the full Snapshot owns strings and shared_ptrs, so it
+ * cannot cross a process boundary raw) behind the same ping-pong + seq
+ * discipline SnapshotBuffers uses in-process, read as a seqlock:
+ *
+ *   writer: fill slots[(seq + 1) & 1], then seq.store(seq + 1, release)
+ *   reader: s1 = seq; copy slots[s1 & 1]; retry if seq != s1
+ *
+ * A reader only retries when the writer published twice during its
+ * copy, which at snapshot publish rates means never in practice.
+ *
+ * The segment lives at /dev/shm/ouroboros-state-<uid>, 0600, created
+ * by the writer (daemon or UI) and unlinked on clean shutdown so a
+ * dead segment does not masquerade as a live player.
+ */
+class SnapshotMirror {
+public:
+    static constexpr uint32_t MAGIC = 0x4F524253;  // "ORBS"
+    // Bump when MirrorState changes layout; readers must check
+    static constexpr uint32_t VERSION = 1;
+
+    /// Fixed-size projection of Snapshot. Plain bytes only - readers
+    /// may be built from just this header.
+    struct MirrorState {
+        // model::PlaybackState as int: 0 stopped, 1 playing, 2 paused
+        int32_t playback_state = 0;
+        int32_t volume_percent = 0;
+        int32_t shuffle_enabled = 0;
+        // model::RepeatMode as int: 0 off, 1 one, 2 all
+        int32_t repeat_mode = 0;
+        int32_t current_track_index = -1;  // -1 = nothing current
+        int32_t duration_ms = 0;
+        // Anchored position (see PlayerState::display_position_ms):
+        // while playing, display position = position_ms +
+        // (CLOCK_MONOTONIC ms - position_anchor_steady_ms)
+        int64_t position_ms = 0;
+        int64_t position_anchor_steady_ms = 0;
+        uint64_t snapshot_seq = 0;
+        uint32_t queue_upcoming = 0;
+        uint32_t library_tracks = 0;
+        int32_t is_scanning = 0;
+        char title[256] = {};
+        char artist[256] = {};
+        char album[256] = {};
+    };
+
+    struct Segment {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        std::atomic<uint64_t> seq{0};
+        MirrorState slots[2];
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "seqlock word must be address-free for cross-process use");
+
+    ~SnapshotMirror();
+
+    [[nodiscard]] static std::string default_name();
+
+    /// Writer side: create (or take over) the segment. Returns false on
+    /// shm/mmap failure - the player runs fine without the mirror.
+    [[nodiscard]] bool open_writer(const std::string& name = default_name());
+
+    /// Reader side: map an existing segment read-only. Fails when no
+    /// writer is up or the layout version does not match.
+    [[nodiscard]] bool open_reader(const std::string& name = default_name());
+
+    void close();
+
+    /// Writer: project and publish one snapshot. Cheap enough to call
+    /// on every seq change (a few hundred bytes of memcpy).
+    void publish(const model::Snapshot& snap);
+
+    /// Reader: seqlock-copy the current state. Returns false when no
+    /// segment is mapped or nothing has been published yet.
+    [[nodiscard]] bool read(MirrorState& out) const;
+
+private:
+    Segment* segment_ = nullptr;
+    std::string name_;
+    bool writer_ = false;
+};
+
+}  // namespace ouroboros::backend
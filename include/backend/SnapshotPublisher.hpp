@@ -2,6 +2,7 @@
 
 #include "model/Snapshot.hpp"
 #include "backend/SnapshotBuffers.hpp"
+#include <chrono>
 #include <memory>
 #include <functional>
 #include <mutex>
@@ -10,16 +11,67 @@ namespace ouroboros::backend {
 
 class SnapshotPublisher {
 public:
+    // Batched updates publish at most once per frame (main loop runs ~30 FPS)
+    static constexpr std::chrono::milliseconds kBatchInterval{33};
+
+    // Which snapshot sections an update touches. Tagged updates let the
+    // renderer skip widgets whose inputs did not change; the untagged
+    // overloads mark everything dirty, which is always correct (at worst
+    // a full frame, exactly what every frame was before the mask).
+    enum Section : uint32_t {
+        SectionPlayer  = 1u << 0,  // PlayerState (position, volume, modes)
+        SectionLibrary = 1u << 1,  // LibraryState / albums / scan progress
+        SectionQueue   = 1u << 2,  // QueueState
+        SectionUI      = 1u << 3,  // UIState, alerts
+        SectionAll     = 0xFFFFFFFFu,
+    };
+
     SnapshotPublisher();
     ~SnapshotPublisher();
 
     void publish(model::Snapshot snap);
     void update(std::function<void(model::Snapshot&)> updater);
+    void update(uint32_t sections, std::function<void(model::Snapshot&)> updater);
+
+    // Coalescing variant for high-frequency callers (position ticks):
+    // applies the updater to the back buffer immediately but defers the
+    // buffer swap + re-sync until kBatchInterval has passed since the
+    // last publish. N updates inside one frame cost one swap, not N.
+    // Pending changes are picked up by the next update()/publish() call,
+    // or by flush_batched() from the main loop.
+    void update_batched(std::function<void(model::Snapshot&)> updater);
+    void update_batched(uint32_t sections, std::function<void(model::Snapshot&)> updater);
+
+    // Publish any batched changes still pending (called once per frame).
+    void flush_batched();
+
+    // Sections published since the last call (renderer only). Batched
+    // sections become visible here with the publish that carries them,
+    // never before, so a consumer that skips work for clean sections
+    // cannot miss a deferred change.
+    [[nodiscard]] uint32_t consume_dirty_sections();
+
+    // Wakeup fd for the main loop's poll(): becomes readable whenever a
+    // buffer swap lands, so an idle loop can block on a long timeout
+    // without adding latency to snapshot changes from collector threads.
+    // The consumer clears it with drain_notify() once woken.
+    [[nodiscard]] int notify_fd() const { return notify_fd_; }
+    void drain_notify();
+
     std::shared_ptr<const model::Snapshot> get_current() const;
 
 private:
+    void wake();  // Signal notify_fd_ (called under mutex_ after a swap)
+
     mutable SnapshotBuffers buffers_;
     std::mutex mutex_;
+    int notify_fd_ = -1;  // eventfd, non-blocking
+
+    // Guarded by mutex_
+    bool batch_dirty_ = false;
+    uint32_t batch_sections_ = 0;               // Applied to back buffer, not yet published
+    uint32_t published_sections_ = SectionAll;  // Published, not yet consumed
+    std::chrono::steady_clock::time_point last_publish_{};
 };
 
 }  // namespace ouroboros::backend
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <mutex>
+#include <filesystem>
+#include <cstdint>
+
+namespace ouroboros::backend {
+
+struct ThumbnailEntry {
+    // Like RawArtworkEntry: tiers stored this session own a heap copy,
+    // tiers loaded from disk are spans into the store file's mmap
+    std::vector<uint8_t> owned;       // Raw RGB pixels (width * height * 3)
+    const uint8_t* mapped = nullptr;  // Span into the store mapping
+    size_t mapped_size = 0;
+    uint16_t width = 0;
+    uint16_t height = 0;
+
+    [[nodiscard]] const uint8_t* bytes() const { return mapped ? mapped : owned.data(); }
+    [[nodiscard]] size_t size() const { return mapped ? mapped_size : owned.size(); }
+    [[nodiscard]] bool valid() const { return width > 0 && height > 0 && size() > 0; }
+};
+
+/**
+ * Persistent pre-scaled thumbnail tiers for album art.
+ *
+ * ArtworkCache stores the original compressed images; decoding a
+ * 3000x3000 JPEG and downscaling it to a ~200px grid cell every session
+ * costs far more than the cell will ever show. This store keeps raw RGB
+ * scaled-down copies at a few fixed tiers, keyed by the same content
+ * hash, so steady-state browsing resizes a small cached thumb instead
+ * of a megapixel original. Tiers are generated once, the first time a
+ * hash is decoded at full resolution.
+ *
+ * Store persistence: ~/.cache/ouroboros/thumbs.cache (next to artwork.cache)
+ */
+class ThumbnailStore {
+public:
+    // Max dimension of each tier; the aspect ratio of the original is
+    // preserved within it
+    static constexpr std::array<int, 3> TIERS = {128, 256, 512};
+    static constexpr size_t NUM_TIERS = TIERS.size();
+
+    static ThumbnailStore& instance();
+
+    // Smallest stored tier whose max dimension covers min_px, so the
+    // final resize only ever shrinks. Returns nullptr when no stored
+    // tier is big enough (caller decodes the original).
+    [[nodiscard]] const ThumbnailEntry* get(const std::string& hash, int min_px) const;
+
+    // True if any tier exists for this hash (tiers are generated as a
+    // batch, so one present means generation already ran)
+    [[nodiscard]] bool has(const std::string& hash) const;
+
+    // Store one tier of pre-scaled RGB pixels (width * height * 3)
+    void store(const std::string& hash, int tier, int width, int height,
+               std::vector<uint8_t> rgb);
+
+    // Persist store to disk (only if dirty)
+    [[nodiscard]] bool save(const std::filesystem::path& store_path);
+
+    // Load store from disk
+    [[nodiscard]] bool load(const std::filesystem::path& store_path);
+
+    [[nodiscard]] bool is_dirty() const;
+
+    // Statistics
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t memory_usage() const;
+
+    // Clear all entries (used for testing)
+    void clear();
+
+private:
+    ThumbnailStore() = default;
+    ~ThumbnailStore();
+
+    ThumbnailStore(const ThumbnailStore&) = delete;
+    ThumbnailStore& operator=(const ThumbnailStore&) = delete;
+
+    static int tier_index(int tier);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::array<ThumbnailEntry, NUM_TIERS>> store_;
+
+    bool dirty_ = false;
+
+    // Read-only mapping loaded entries point into (same lifetime rules
+    // as ArtworkCache: save() replaces the file via rename)
+    void* map_base_ = nullptr;
+    size_t map_size_ = 0;
+    void unmap_locked();
+
+    static constexpr uint64_t STORE_MAGIC = 0x4F55524F54484D31ULL;  // 'OUROTHM1'
+    static constexpr uint32_t STORE_VERSION = 1;
+    static_assert(sizeof(STORE_MAGIC) == 8);
+    static_assert(sizeof(STORE_VERSION) == 4);
+};
+
+}  // namespace ouroboros::backend
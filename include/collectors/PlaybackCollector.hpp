@@ -7,6 +7,8 @@
 #include <string>
 #include <thread>
 #include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <chrono>
 
@@ -40,9 +42,34 @@ private:
     void update_position_anchor(audio::PipeWireOutput& output);
     int64_t get_interpolated_position_ms() const;
     void reset_position_anchor(int64_t position_ms, audio::PipeWireOutput& output);
+    int64_t anchor_steady_ms() const;
 
     std::unique_ptr<audio::AudioDecoder> create_decoder_for_track(const model::Track& track);
     std::string format_to_string(model::AudioFormat format);
+
+    // Decoder pool: one warm instance per format, handed back closed
+    // after each track. The decoders keep their codec contexts across
+    // close()/open() (mpg123 handle in particular), so rapid queue
+    // skips stop paying allocation plus context setup per track. Only
+    // touched from the decode thread; no lock needed.
+    std::unique_ptr<audio::AudioDecoder> acquire_decoder(const model::Track& track);
+    void release_decoder(model::AudioFormat format,
+                         std::unique_ptr<audio::AudioDecoder> decoder);
+    std::unordered_map<model::AudioFormat, std::unique_ptr<audio::AudioDecoder>> decoder_pool_;
+
+    // Next-track decoder prefetch: shortly before the current track
+    // drains, a background thread pre-opens the next queue entry's
+    // decoder so the switch at the ring-buffer boundary doesn't pay
+    // file-open plus header-parse latency.
+    const model::Track* peek_next_track(const model::Snapshot& snap) const;
+    void start_prefetch(const model::Track& next);
+    std::unique_ptr<audio::AudioDecoder> take_prefetched(const std::string& path);
+
+    std::thread prefetch_thread_;
+    std::mutex prefetch_mutex_;
+    std::unique_ptr<audio::AudioDecoder> prefetched_decoder_;  // Guarded by prefetch_mutex_
+    std::string prefetched_path_;                              // Guarded by prefetch_mutex_
+    model::AudioFormat prefetched_format_{};                   // Guarded by prefetch_mutex_
 };
 
 }  // namespace ouroboros::collectors
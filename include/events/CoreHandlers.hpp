@@ -0,0 +1,23 @@
+#pragma once
+
+#include "backend/QueueJournal.hpp"
+#include "backend/SnapshotPublisher.hpp"
+
+#include <memory>
+
+namespace ouroboros::events {
+
+/**
+ * Registers the queue and transport event handlers on the EventBus:
+ * AddTrackToQueue, Next/PrevTrack, ClearQueue, seeking, volume, repeat
+ * and shuffle. This is the snapshot-mutation logic shared by the UI and
+ * the headless daemon front ends - anything both must agree on (the Two
+ * Stacks queue model, journal appends) lives here, not in a main loop.
+ *
+ * Handlers run on whichever thread drains the EventBus; call this once
+ * during startup, before the first drain().
+ */
+void register_core_handlers(std::shared_ptr<backend::SnapshotPublisher> publisher,
+                            backend::QueueJournal& queue_journal);
+
+}  // namespace ouroboros::events
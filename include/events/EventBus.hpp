@@ -1,7 +1,12 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <mutex>
@@ -35,11 +40,30 @@ struct Event {
     int volume_delta = 5;     // For volume (default 5%)
 };
 
+/// Multi-producer, single-consumer event bus.
+///
+/// publish() is a lock-free bounded-ring enqueue (Vyukov-style sequenced
+/// slots), safe to call from the render thread and the collector threads
+/// concurrently: it never takes the subscriber mutex, never blocks on a
+/// slow handler, and never allocates (Event is moved into a pre-sized
+/// slot; short Event::data strings stay in SSO storage).
+///
+/// Handlers run on the CONSUMER side: the main loop calls drain() once
+/// per iteration, which dequeues everything queued so far and dispatches
+/// in publish order. The subscriber table is copy-on-write: dispatch
+/// grabs a shared_ptr snapshot and invokes without any lock or per-event
+/// handler copy, while subscribe()/unsubscribe() (cold-path setup calls)
+/// serialize on a writer mutex, build a new table, and swap it in - a
+/// handler can therefore subscribe re-entrantly; the in-flight dispatch
+/// just finishes on the old snapshot.
 class EventBus {
 public:
     using Handler = std::function<void(const Event&)>;
     using SubscriptionId = uint64_t;
 
+    // Power of two; sized for worst-case input bursts (key repeat storms).
+    static constexpr size_t kQueueCapacity = 1024;
+
     static EventBus& instance() {
         static EventBus instance;
         return instance;
@@ -47,17 +71,59 @@ public:
 
     SubscriptionId subscribe(Event::Type type, Handler handler);
     void unsubscribe(SubscriptionId id);
-    void publish(const Event& event);
+
+    // Lock-free MPSC enqueue. If the ring is full the event is dropped
+    // and counted rather than blocking the producer. The rvalue overload
+    // moves the payload into the slot, so even an Event::data string too
+    // long for SSO publishes without touching the allocator.
+    void publish(const Event& event) { publish(Event(event)); }
+    void publish(Event&& event);
+
+    // Dequeue and dispatch all pending events. Single consumer only
+    // (the main loop). Returns the number of events dispatched.
+    size_t drain();
+
+    // Events discarded because the ring was full (diagnostics).
+    [[nodiscard]] uint64_t dropped_count() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
 
 private:
-    EventBus() = default;
+    EventBus();
+
+    void dispatch(const Event& event);
+
     struct Subscription {
         SubscriptionId id;
         Handler handler;
     };
-    std::map<Event::Type, std::vector<Subscription>> subscribers_;
-    std::mutex mutex_;
+    // RCU-style table: readers (dispatch) load a snapshot atomically,
+    // writers clone-mutate-swap under mutex_. A snapshot is immutable
+    // once published, so it outlives any dispatch iterating it.
+    using SubscriberTable = std::map<Event::Type, std::vector<Subscription>>;
+    std::atomic<std::shared_ptr<const SubscriberTable>> subscribers_;
+    std::mutex mutex_;  // Serializes writers only
     SubscriptionId next_id_ = 1;
+
+    // Writer-side reverse index: unsubscribe jumps straight to the one
+    // vector holding the id instead of scanning every type's list (a
+    // collector tearing down ~15 subscriptions used to pay
+    // O(types x handlers) per id). Only the type is recorded - an index
+    // into the vector would go stale the moment an earlier entry is
+    // erased, and the per-type lists hold a handful of handlers anyway.
+    std::unordered_map<SubscriptionId, Event::Type> id_types_;
+
+    // Bounded MPSC ring. Each slot carries a sequence number so producers
+    // can claim slots with a single fetch_add and the consumer can tell
+    // when a claimed slot has been fully written.
+    struct Slot {
+        std::atomic<uint64_t> seq;
+        Event event;
+    };
+    std::array<Slot, kQueueCapacity> slots_;
+    alignas(64) std::atomic<uint64_t> enqueue_pos_{0};
+    alignas(64) std::atomic<uint64_t> dequeue_pos_{0};
+    std::atomic<uint64_t> dropped_{0};
 };
 
-}  // namespace ouroboros::events
\ No newline at end of file
+}  // namespace ouroboros::events
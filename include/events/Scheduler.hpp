@@ -1,11 +1,27 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <queue>
+#include <string>
+#include <vector>
 
 namespace ouroboros::events {
 
+/// Periodic task scheduler driven from the main loop.
+///
+/// process() is called every loop iteration (~30 FPS), so it must not
+/// scale with the number of registered tasks. Due times live in a
+/// min-heap keyed on next-fire time: an iteration where nothing is due
+/// costs one now() call and one heap-top peek. Tasks that come due in
+/// the same iteration are coalesced into one batch sharing that single
+/// now() reading.
+///
+/// unschedule()/re-schedule() use lazy deletion: each registration gets
+/// a generation number, and stale heap entries are discarded when popped
+/// rather than searched for eagerly.
 class Scheduler {
 public:
     using Task = std::function<void()>;
@@ -15,13 +31,26 @@ public:
     void process();
 
 private:
+    using Clock = std::chrono::steady_clock;
+
     struct ScheduledTask {
         Task task;
         std::chrono::milliseconds interval;
-        std::chrono::steady_clock::time_point last_run;
+        uint64_t generation = 0;  // Matches the live heap entry for this name
+    };
+
+    struct HeapEntry {
+        Clock::time_point due;
+        std::string name;
+        uint64_t generation;
+
+        // std::priority_queue is a max-heap; invert for earliest-first.
+        bool operator<(const HeapEntry& other) const { return due > other.due; }
     };
 
     std::map<std::string, ScheduledTask> tasks_;
+    std::priority_queue<HeapEntry> due_heap_;
+    uint64_t next_generation_ = 1;
 };
 
 }  // namespace ouroboros::events
@@ -1,12 +1,18 @@
 #pragma once
 
+#include "util/InternPool.hpp"
+#include "util/PagedVector.hpp"
+
 #include <string>
 #include <vector>
 #include <chrono>
+#include <memory>
 #include <optional>
 
 static_assert(sizeof(size_t) >= 8, "64-bit platform required");
 
+namespace ouroboros::util { class TrigramIndex; }
+
 namespace ouroboros::model {
 
 enum class PlaybackState {
@@ -34,10 +40,13 @@ enum class AudioFormat {
 struct Track {
     std::string path;
     std::string title;
-    std::string artist;
-    std::string album;
-    std::string genre;
-    std::string date;
+    // Interned: repeated values (all tracks of an album share artist/
+    // album/genre/date) point at one pooled allocation, so snapshot
+    // copies bump refcounts instead of duplicating strings.
+    util::InternedString artist;
+    util::InternedString album;
+    util::InternedString genre;
+    util::InternedString date;
     int track_number = 0;
     int duration_ms = 0;
 
@@ -52,6 +61,12 @@ struct Track {
     // Empty string if no artwork or not yet computed
     std::string artwork_hash;
 
+    // Normalized search key: "artist\nalbum\ntitle" lowercased with
+    // diacritics stripped, precomputed by LibraryCollector so the track
+    // filter does one plain byte scan per row instead of per-query ICU
+    // work. Empty until the enriched library state is published.
+    std::string search_key;
+
     // Optimization fields for multi-tier caching (CACHE_VERSION 3)
     std::time_t file_mtime = 0;     // File modification time when cached
     uint64_t file_inode = 0;         // Inode for move/rename detection
@@ -63,6 +78,12 @@ struct Track {
     // Compilation flag (TCMP from ID3v2)
     bool is_compilation = false;
 
+    // ReplayGain (CACHE_VERSION 6): dB offsets to the -18 LUFS reference,
+    // measured by the background loudness scanner. Zero until scanned.
+    float track_gain_db = 0.0f;
+    float album_gain_db = 0.0f;
+    bool loudness_scanned = false;
+
     bool operator==(const Track&) const = default;
 };
 
@@ -75,6 +96,21 @@ struct PlayerState {
     std::optional<int> current_track_index;  // Index into LibraryState::tracks, not full Track copy
     int64_t seek_request_ms = -1;
 
+    // steady_clock timestamp (ms) at which playback_position_ms was
+    // sampled, or 0 when the position is exact (paused, stopped). While
+    // Playing the UI extrapolates display position from this anchor and
+    // the wall clock, so steady playback needs no per-tick publishes.
+    int64_t position_anchor_steady_ms = 0;
+
+    // Display position at `now_steady_ms` (steady_clock milliseconds):
+    // the anchored position plus wall-clock time elapsed while playing.
+    [[nodiscard]] int64_t display_position_ms(int64_t now_steady_ms) const {
+        if (state != PlaybackState::Playing || position_anchor_steady_ms == 0) {
+            return playback_position_ms;
+        }
+        return playback_position_ms + (now_steady_ms - position_anchor_steady_ms);
+    }
+
     bool operator==(const PlayerState&) const = default;
 };
 
@@ -98,11 +134,17 @@ struct AlbumGroup {
 };
 
 struct LibraryState {
-    std::vector<Track> tracks;
+    // Paged, not flat: snapshot generations share unchanged track pages,
+    // so a COW copy that edits a few tracks (e.g. a loudness patch)
+    // copies a few pages instead of the whole library
+    util::PagedVector<Track> tracks;
     std::vector<AlbumGroup> albums;  // Pre-computed album groups
-    bool is_scanning = false;
-    int scanned_count = 0;
-    int total_count = 0;
+
+    // Trigram index over Track::search_key, built with the keys during
+    // background enrichment. Null until the enriched state is published
+    // (search falls back to a linear scan). Shared, never mutated after
+    // publish - snapshot copies alias the same index.
+    std::shared_ptr<const util::TrigramIndex> track_search_index;
 
     // Hierarchical cache: directory browsing support
     std::optional<std::string> current_directory;
@@ -111,6 +153,17 @@ struct LibraryState {
     bool operator==(const LibraryState&) const = default;
 };
 
+// Scan progress lives OUTSIDE LibraryState so per-tick progress updates
+// stay O(1): mutating a counter must not force a copy-on-write of the
+// (potentially huge) track vector behind Snapshot::library.
+struct ScanProgress {
+    bool is_scanning = false;
+    int scanned_count = 0;
+    int total_count = 0;
+
+    bool operator==(const ScanProgress&) const = default;
+};
+
 struct QueueState {
     std::vector<int> history;      // Played tracks (oldest at front)
     std::optional<int> current;    // Currently playing (library index)
@@ -171,6 +224,7 @@ struct Snapshot {
     uint64_t seq = 0;
     
     PlayerState player;
+    ScanProgress scan_progress;
     std::shared_ptr<const LibraryState> library;
     std::shared_ptr<const QueueState> queue;
     UIState ui;
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <vector>
+#include <array>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -34,6 +35,7 @@ struct WindowRequest {
     int target_width;    // Decode target dimensions
     int target_height;
     bool force_extract;  // If true, always extract to get per-track hash (for NowPlaying)
+    uint64_t generation; // Cancellation token: reset() bumps the counter, stale decodes abort
 };
 
 // Comparator: lower priority value = higher queue priority
@@ -59,12 +61,18 @@ public:
     static ArtworkWindow& instance();
 
     // Request artwork loading with priority (lower = higher priority)
-    // If notify=false, call flush_requests() after batching all requests
-    // If force_extract=true, always extract to get per-track hash (for NowPlaying)
+    // If notify=false the request is only staged - no lock, no cache
+    // lookup - and flush_requests() must follow; a frame's worth of
+    // staged requests is then diffed against slot state in one locked
+    // pass. If force_extract=true, always extract to get per-track
+    // hash (for NowPlaying).
     void request(const std::string& path, int priority, int width_cols, int height_rows,
                  bool notify = true, bool force_extract = false);
 
-    // Notify workers after batching requests (call after multiple request() calls with notify=false)
+    // Flush the staged frame: dedup within the batch, drop requests a
+    // Ready/Failed slot already answers (one cache_mutex_ pass), queue
+    // the survivors (one queue_mutex_ pass), wake the workers. Dozens
+    // of per-request lock round-trips per scroll frame become three.
     void flush_requests();
 
     // Get decoded pixels (nullptr if not ready)
@@ -84,6 +92,19 @@ public:
     size_t get_total_bytes() const { return total_bytes_.load(); }
     size_t get_entry_count() const;
 
+    // Requests queued or decoding right now. Zero means the workers are
+    // idle - the probe the speculative warm stage gates on.
+    size_t pending_count();
+
+    // Global memory budget hooks (see util::MemoryBudget): resident
+    // bytes covering decoded entries plus the recycled pixel pool, and
+    // targeted eviction that frees toward bytes_needed and reports what
+    // it actually released. The pool drains first - that's pure
+    // ballast - then Ready entries go LRU-first, pixels freed outright
+    // rather than recycled (the point is giving memory back).
+    [[nodiscard]] size_t resident_bytes();
+    size_t shrink(size_t bytes_needed);
+
     ~ArtworkWindow();
 
 private:
@@ -140,9 +161,56 @@ private:
     std::atomic<size_t> total_bytes_{0};
     size_t memory_limit_bytes_;
 
+    // Size-classed pool of decoded-pixel buffers. Eviction clears
+    // multi-megabyte vectors and the very next scroll-back re-decodes
+    // into an identically sized one; recycling through the pool hands
+    // re-decodes warm, already-faulted memory instead of churning the
+    // allocator. Classes are power-of-two capacities, so a recycled
+    // buffer never reallocates for any request in its class.
+    class PixelBufferPool {
+    public:
+        [[nodiscard]] std::vector<uint8_t> acquire(size_t size);
+        void release(std::vector<uint8_t>&& buf);
+
+        [[nodiscard]] size_t pooled();
+        size_t shrink(size_t bytes_needed);  // Free pooled buffers, return bytes released
+
+    private:
+        static constexpr size_t MAX_PER_CLASS = 4;
+        static constexpr size_t MIN_POOL_BYTES = 16 * 1024;   // Tiny buffers aren't worth keeping
+        static constexpr size_t MAX_POOL_BYTES = 32 * 1024 * 1024;
+        static constexpr size_t NUM_CLASSES = 32;
+
+        std::array<std::vector<std::vector<uint8_t>>, NUM_CLASSES> classes_;
+        size_t pooled_bytes_ = 0;
+        std::mutex mutex_;
+    };
+    PixelBufferPool pixel_pool_;
+
+    // Frame batching: request(notify=false) appends here and defers
+    // every cache/queue lookup to flush_requests(). Duplicate keys in
+    // one frame (assign + prefetch of the same album) are collapsed
+    // before any CacheKey is hashed.
+    struct StagedRequest {
+        std::string path;
+        std::string album_dir;
+        std::string pending_key;  // Filled during the flush dedup pass
+        int priority;
+        int width_cols;
+        int height_rows;
+        bool force_extract;
+        uint64_t timestamp;
+    };
+    std::vector<StagedRequest> staged_;
+    std::mutex staging_mutex_;
+
     // Request queue
     std::priority_queue<WindowRequest, std::vector<WindowRequest>, WindowRequestComparator> request_queue_;
-    std::unordered_set<std::string> pending_paths_;  // Deduplication
+    // Dedup plus best queued priority per key. A re-request at better
+    // (lower) priority pushes a duplicate queue entry and lowers the
+    // value here; workers discard popped entries that are worse than
+    // the recorded best, so the duplicate effectively re-prioritizes.
+    std::unordered_map<std::string, int> pending_paths_;
     std::unordered_set<std::string> verified_tracks_;  // Tracks verified to match album artwork (prevents re-extraction)
     std::mutex queue_mutex_;
     std::condition_variable queue_cv_;
@@ -152,6 +220,19 @@ private:
     std::atomic<bool> should_stop_{false};
     std::atomic<bool> has_updates_{false};
 
+    // Cancellation token for in-flight decodes. reset() clears the
+    // queue, but a worker already inside a megapixel stb decode used to
+    // run to completion; requests carry the counter value from when
+    // they were queued, and the decode pipeline aborts between phases
+    // once it no longer matches. Same stale-rejection idiom as
+    // NowPlayingSlot::generation.
+    std::atomic<uint64_t> cancel_generation_{0};
+
+    [[nodiscard]] bool decode_cancelled(uint64_t request_generation) const {
+        return should_stop_.load(std::memory_order_relaxed) ||
+               request_generation != cancel_generation_.load(std::memory_order_relaxed);
+    }
+
     // Terminal cell size for pixel calculations
     int cell_width_ = 8;
     int cell_height_ = 16;
@@ -172,7 +253,17 @@ private:
         CachedFormat format;
         bool valid;
     };
-    DecodeResult decode_jpeg(const std::vector<uint8_t>& jpeg_data, int target_w, int target_h);
+    // Serves from a ThumbnailStore tier when one covers the target,
+    // otherwise decodes the original (and generates the tiers so the
+    // next session never touches the megapixel image again). Checks
+    // the cancellation token between phases (decode / tier generation /
+    // resize) and returns invalid once it goes stale.
+    DecodeResult decode_artwork(const std::string& hash,
+                                const std::vector<uint8_t>& jpeg_data,
+                                int target_w, int target_h,
+                                uint64_t request_generation);
+    DecodeResult scale_to_target(const unsigned char* rgb, int w, int h,
+                                 int target_w, int target_h);
 };
 
 } // namespace ouroboros::ui
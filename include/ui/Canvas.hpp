@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ui/Color.hpp"
+#include <cstdint>
+#include <utility>
 #include <vector>
 #include <string>
 #include <string_view>
@@ -9,7 +11,8 @@ namespace ouroboros::ui {
 
 /**
  * A single cell on the terminal grid.
- * Represents what is visually displayed at one coordinate.
+ * Value type for the drawing API (fill_rect, clear); the canvas itself
+ * stores cells structure-of-arrays, not Cell objects.
  */
 struct Cell {
     std::string content = " "; // UTF-8 grapheme (usually 1-4 bytes)
@@ -18,15 +21,24 @@ struct Cell {
     bool operator==(const Cell& other) const {
         return content == other.content && style == other.style;
     }
-    
+
     bool operator!=(const Cell& other) const {
         return !(*this == other);
     }
 };
 
 /**
- * A 2D grid of Cells representing a rendering surface.
+ * A 2D grid of cells representing a rendering surface.
  * Origin (0,0) is top-left.
+ *
+ * Storage is SoA: a flat array of 4-byte glyph words plus a parallel
+ * Style array. Nearly every grapheme fits its UTF-8 bytes inline in
+ * the word (NUL-padded); longer clusters (ZWJ emoji, flags) spill to a
+ * small overflow table. The frame diff in Renderer::flush_canvas is
+ * then two word compares per cell instead of a std::string compare,
+ * and clear/resize never touch the allocator - the old per-cell
+ * std::string layout put 24,000 heap-owning strings on a 300x80
+ * terminal and copied them all on every prev_canvas_ snapshot.
  */
 class Canvas {
 public:
@@ -35,21 +47,68 @@ public:
     int width() const { return width_; }
     int height() const { return height_; }
 
-    // Direct access (O(1))
-    Cell& at(int x, int y);
-    const Cell& at(int x, int y) const;
+    // Read access: materializes a Cell from the packed arrays
+    Cell cell_at(int x, int y) const;
+
+    // Zero-copy read access for the flush path. The glyph view points
+    // into this canvas's storage: valid until the cell is overwritten.
+    std::string_view glyph_at(int x, int y) const;
+    Style style_at(int x, int y) const;
+
+    // Frame diff: does this cell differ from other's cell at (x, y)?
+    // One word compare for the glyph, one for the style; only overflow
+    // glyphs (whose table indices aren't stable across canvases) fall
+    // back to a text compare.
+    bool cell_differs(const Canvas& other, int x, int y) const;
+
+    // Row-level damage check: one memcmp over the row's glyph words
+    // plus one over its styles. Clean rows are dismissed without ever
+    // visiting a cell, so the flush diff only walks damaged rows.
+    bool row_differs(const Canvas& other, int y) const;
+
+    // Damage spans for the flush diff: appends [begin, end) column
+    // ranges of cells in row y that differ from other's row. Clean
+    // stretches are skipped 16 cells at a time with block memcmps over
+    // the contiguous glyph/style arrays (vector compares after
+    // inlining), so a mostly-clean row costs a handful of wide compares
+    // instead of a cell_differs call per column. An empty result means
+    // the row is clean.
+    void changed_spans(const Canvas& other, int y,
+                       std::vector<std::pair<int, int>>& spans) const;
+
+    // Cross-row equality over columns [x0, x1) for the scrolled-region
+    // fast path: does this canvas's row y_this equal other's row y_other
+    // within the span? Same block-compare + overflow-aware fallback
+    // discipline as row_differs.
+    bool span_matches(const Canvas& other, int y_this, int y_other,
+                      int x0, int x1) const;
+
+    // Mirror of the terminal's scroll-region escape: shift rows
+    // [top, bottom) by delta (positive = content moves up), blank-
+    // filling the rows the shift exposes. Rows are contiguous in the
+    // SoA arrays, so the shift is one memmove per array; overflow
+    // indices stay valid (same canvas, same table). Keeps prev_canvas_
+    // aligned with a CSI S/T the flush emitted.
+    void scroll_rows(int top, int bottom, int delta);
+
+    // Adopt other's row y into this canvas. Lets the flush path commit
+    // prev_canvas_ one row at a time instead of a whole-canvas
+    // assignment, so rows a partial flush never emitted stay dirty for
+    // the next diff. Overflow glyphs are re-encoded against this
+    // canvas's table (their indices aren't stable across canvases).
+    void copy_row_from(const Canvas& other, int y);
 
     // Drawing primitives
     void clear(const Cell& fill_cell = Cell{" ", {}});
-    void put(int x, int y, const std::string& grapheme, Style style = {});
-    
+    void put(int x, int y, std::string_view grapheme, Style style = {});
+
     // Advanced drawing
     // returns the x-coordinate after the last character drawn
     int draw_text(int x, int y, std::string_view text, Style style = {});
-    
+
     // Draw a box/rect
     void draw_rect(int x, int y, int w, int h, Style style = {});
-    
+
     // Fill a rect
     void fill_rect(int x, int y, int w, int h, const Cell& cell);
 
@@ -61,9 +120,26 @@ public:
     void resize(int width, int height);
 
 private:
+    // A glyph word is the grapheme's UTF-8 bytes memcpy'd into a
+    // uint32_t (shorter sequences NUL-padded), so the word's memory is
+    // the UTF-8 text and glyph_at can return a view straight into the
+    // array. Overflow references put OVERFLOW_TAG in the first byte -
+    // 0xFF can never begin a UTF-8 sequence - followed by a 24-bit
+    // index into overflow_.
+    static constexpr unsigned char OVERFLOW_TAG = 0xFF;
+
+    static bool is_overflow(const uint32_t& word) {
+        return reinterpret_cast<const unsigned char*>(&word)[0] == OVERFLOW_TAG;
+    }
+
+    uint32_t encode_glyph(std::string_view grapheme);
+    std::string_view decode_glyph(const uint32_t& word) const;
+
     int width_ = 0;
     int height_ = 0;
-    std::vector<Cell> buffer_;
+    std::vector<uint32_t> glyphs_;
+    std::vector<Style> styles_;
+    std::vector<std::string> overflow_;  // Rare >4-byte grapheme clusters
 
     bool is_in_bounds(int x, int y) const {
         return x >= 0 && y >= 0 && x < width_ && y < height_;
@@ -1,10 +1,41 @@
 #pragma once
 
+#include "ui/Color.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
 
 namespace ouroboros::ui {
 
+/**
+ * A pre-built SGR escape sequence: the exact bytes that select a Style,
+ * ready to memcpy into an output buffer. len == 0 means the style is
+ * the terminal default and needs no escape (and no trailing reset).
+ */
+struct SgrSequence {
+    char text[24];  // Worst case: bright fg + bright bg + bold/dim/underline
+    uint8_t len;
+};
+
+/**
+ * Compile-time SGR lookup for the enumerable style space (17 named
+ * colors squared times the bold/dim/underline combinations - 2312
+ * entries, built constexpr). Emitting a style change is then a table
+ * index and a memcpy instead of digit formatting per escape. Returns
+ * nullptr for truecolor styles, whose 24-bit space can't be tabled;
+ * callers keep a runtime path for those.
+ */
+const SgrSequence* sgr_lookup(const Style& style);
+
+/**
+ * Display width of a single codepoint (wcwidth semantics, including the
+ * -1 for non-printables), served from a process-wide cache: a flat table
+ * for the Latin hot range plus a lock-free direct-mapped cache for the
+ * long tail (CJK, emoji). wcwidth walks locale tables on every call and
+ * rendering asks about the same codepoints every frame.
+ */
+int codepoint_width(wchar_t wc);
+
 /**
  * Calculate the display width of a string, accounting for:
  * - ANSI escape sequences (which don't take visual space)
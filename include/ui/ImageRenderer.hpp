@@ -2,8 +2,8 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <deque>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace ouroboros::ui {
 
@@ -70,6 +70,9 @@ public:
     // Helper to write data to a temporary file in /dev/shm (RAM)
     [[nodiscard]] std::string write_to_temp_file(const unsigned char* data, size_t len);
 
+    // Helper to write data to a POSIX shared memory object (Kitty t=s)
+    [[nodiscard]] std::string write_to_shm(const unsigned char* data, size_t len);
+
     // Cell size accessors
     [[nodiscard]] int get_cell_width() const { return cell_width_; }
     [[nodiscard]] int get_cell_height() const { return cell_height_; }
@@ -87,6 +90,7 @@ private:
     TerminalType terminal_type_ = TerminalType::Other;
     bool terminal_respects_image_ids_ = true;      // false for Ghostty (Issue #6711)
     bool terminal_supports_temp_file_ = true;      // false for Ghostty (Issue #5774)
+    bool terminal_supports_shm_ = false;           // t=s: Kitty/Ghostty, local sessions only
 
     // Detect cell size from terminal
     void detect_cell_size();
@@ -100,19 +104,40 @@ private:
     // Render Logic
     std::string render_kitty(const unsigned char* data, size_t len, int cols, int rows, size_t data_hash, const std::string& content_hash, uint32_t& out_id, CachedFormat format);
     std::string render_iterm2(const unsigned char* rgba, int w, int h, int cols, int rows);
-    std::string render_sixel(const unsigned char* rgba, int w, int h, int cols, int rows);
+    std::string render_sixel(const unsigned char* rgba, int w, int h, int cols, int rows,
+                             const std::string& content_hash);
 
     // Utilities
     std::string encode_base64(const unsigned char* data, size_t len);
     std::vector<unsigned char> resize_image(const unsigned char* pixels, int w, int h, int target_w, int target_h, int channels);
     std::string rgb_to_sixel(const unsigned char* rgb, int w, int h);
 
-    // Track IDs transmitted to terminal (for placement optimization)
-    std::unordered_set<uint32_t> transmitted_ids_;
+    // Kitty keeps transmitted pixel data resident terminal-side, keyed
+    // by image id. Re-showing one of these after a scroll or filter
+    // change costs an a=p placement escape (~40 bytes) instead of
+    // re-uploading the pixels; delete_image_by_id removes placements
+    // only (d=i), so the data stays reusable. Value packs the resident
+    // size (cols << 16 | rows): a placement must match it, a different
+    // target size retransmits. Bounded by evicting the oldest
+    // not-on-screen ids with d=I (frees terminal memory).
+    std::unordered_map<uint32_t, uint32_t> transmitted_data_;
+    std::deque<uint32_t> transmitted_order_;  // Oldest first
+    static constexpr size_t KITTY_DATA_CACHE_ENTRIES = 256;
+
+    void note_transmitted(uint32_t id, int cols, int rows);
+    std::string place_kitty(uint32_t image_id, int cols, int rows);
 
     // Track what's currently displayed at each position to skip redundant renders
     // Key: (x << 16 | y), Value: image_id
     std::unordered_map<uint32_t, uint32_t> displayed_at_position_;
+
+    // Encoded sixel payloads keyed by content hash + size, evicted
+    // oldest-first. Sixel has no terminal-side image store, so the same
+    // artwork is re-transmitted on every redraw - replaying the encoded
+    // bytes skips the quantize+encode pass entirely.
+    std::unordered_map<std::string, std::string> sixel_cache_;
+    std::deque<std::string> sixel_cache_order_;
+    static constexpr size_t SIXEL_CACHE_ENTRIES = 16;
 };
 
 } // namespace ouroboros::ui
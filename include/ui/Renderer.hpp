@@ -8,6 +8,8 @@
 #include "ui/widgets/SearchBox.hpp"
 #include "ui/widgets/AlbumBrowser.hpp"
 #include "ui/widgets/HelpOverlay.hpp"
+#include "ui/widgets/PerfHud.hpp"
+#include <chrono>
 
 namespace ouroboros::ui {
 
@@ -21,6 +23,7 @@ public:
     void handle_input_event(const InputEvent& event);
     [[nodiscard]] bool should_quit() const;
     [[nodiscard]] bool is_album_view_active() const { return show_album_view_; }
+    [[nodiscard]] bool spectrum_visible() const { return header_ && header_->spectrum_visible(); }
 
 private:
     std::shared_ptr<backend::SnapshotPublisher> publisher_;
@@ -30,25 +33,62 @@ private:
     Canvas canvas_;
     Canvas prev_canvas_;  // For diffing (reduces flicker)
 
-    // Widget rectangles (computed each frame based on terminal size)
+    // Widget rectangles (recomputed only when the layout inputs change)
     LayoutRect browser_rect_;
     LayoutRect header_rect_;
     LayoutRect queue_rect_;
 
+    // Layout memoization key: the flex pass only depends on terminal
+    // size and the album-view flag (widget constraints are constant),
+    // so steady-state frames reuse the cached rects. A SIGWINCH shows
+    // up here as a cols/rows change.
+    int layout_cols_ = -1;
+    int layout_rows_ = -1;
+    bool layout_album_view_ = false;
+
     // Widgets
     std::unique_ptr<widgets::NowPlaying> header_;
     std::unique_ptr<widgets::Browser> browser_;
     std::unique_ptr<widgets::Queue> queue_;
     std::unique_ptr<widgets::AlbumBrowser> album_browser_;
     std::unique_ptr<widgets::HelpOverlay> help_overlay_;
+    std::unique_ptr<widgets::PerfHud> perf_hud_;
 
     bool show_album_view_ = false;
 
+    // Set by handle_input_event, cleared by render: input can change
+    // widget-internal state (selection, scroll, focus, filters) that the
+    // snapshot dirty-mask knows nothing about, so the next frame must be
+    // a full one.
+    bool input_since_render_ = false;
+
+    // Partial-flush carryover: when a frame blows its deadline mid-
+    // flush, the rows never emitted keep their old cells in prev_canvas_
+    // (row-wise commit, see flush_canvas) and the next frame resumes
+    // here, even if nothing else is dirty.
+    int flush_resume_row_ = 0;
+    bool flush_incomplete_ = false;
+
+    // Scroll hints from this frame's widgets: a list whose viewport
+    // moved reports its region and row delta, and flush_canvas tries to
+    // re-express the region as one terminal scroll (DECSTBM + CSI S/T)
+    // plus the newly exposed rows instead of re-emitting every line.
+    struct ScrollHint {
+        int top;     // Canvas rows [top, bottom) of the widget's list area
+        int bottom;
+        int left;    // Columns [left, right) the widget owns (verification span)
+        int right;
+        int delta;   // Rows moved: positive = content moved up (CSI S)
+    };
+    std::vector<ScrollHint> scroll_hints_;
+
     // Layout computation
     void compute_layout(int width, int height);
 
-    // Canvas → Terminal rendering
-    void flush_canvas();
+    // Canvas → Terminal rendering. Emits changed rows until the frame
+    // deadline, then defers the rest: perceived latency beats atomic
+    // frames. The search box (the one input-echo region) always ships.
+    void flush_canvas(std::chrono::steady_clock::time_point deadline);
 
     // Focus Management
     enum class Focus {
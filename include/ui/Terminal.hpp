@@ -7,6 +7,7 @@
 #include <condition_variable>
 #include <deque>
 #include <atomic>
+#include <string_view>
 
 #ifdef __linux__
 #include <termios.h>
@@ -24,11 +25,11 @@ public:
 
     void clear_screen();
     void move_cursor(int x, int y);
-    void print(int x, int y, const std::string& text);
+    void print(int x, int y, std::string_view text);
     void flush();
 
     // Enqueue raw data for asynchronous writing to stdout
-    void write_raw(const std::string& text);
+    void write_raw(std::string_view text);
 
     InputEvent read_input();
     [[nodiscard]] int get_terminal_width() const;
@@ -40,6 +41,14 @@ private:
 
     void writer_loop();
 
+    // Buffered input: one read() pulls the entire pending backlog (a
+    // held arrow key queues many 3-byte CSI sequences), read_input()
+    // then parses byte-wise from the buffer with no further syscalls
+    bool fill_input_buffer();
+    char input_buf_[512];
+    size_t input_len_ = 0;
+    size_t input_pos_ = 0;
+
     bool initialized_ = false;
     int width_ = 80;
     int height_ = 24;
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "model/Snapshot.hpp"
+#include "ui/Color.hpp"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ouroboros::ui {
+
+/**
+ * Shared formatted-row cache for track lists.
+ *
+ * Browser and Queue draw the same tracks with the same
+ * "Artist Album: NN Title" layout; formatting a row (number padding,
+ * truncation, per-segment width math) costs far more than drawing it,
+ * and a track in both panes used to be formatted twice. Rows are cached
+ * per (track index, width) for the current library state - widths are
+ * part of the key, so differently sized panes share the cache without
+ * evicting each other - and replayed until the library state changes.
+ *
+ * Render-thread only (every widget renders from the same loop), so no
+ * locking.
+ */
+class TrackRowCache {
+public:
+    static TrackRowCache& instance();
+
+    struct Row {
+        std::string body;  // untruncated line text, without the 2-col prefix
+        struct Part {
+            int x_offset;
+            std::string text;  // pre-truncated for the cached width
+            Style style;
+        };
+        std::vector<Part> parts;  // normal (unhighlighted) row segments
+    };
+
+    // Fetch or format the row for a track at the given pane width.
+    // library_identity is the snapshot's LibraryState pointer; a new
+    // state invalidates every cached row.
+    const Row& row_for(const model::Track& track, int track_index, int width,
+                       const void* library_identity);
+
+private:
+    TrackRowCache() = default;
+    TrackRowCache(const TrackRowCache&) = delete;
+    TrackRowCache& operator=(const TrackRowCache&) = delete;
+
+    // Key packs (track index, width): panes are never wider than a
+    // terminal row, so 16 bits of width is plenty
+    static uint64_t make_key(int track_index, int width) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(track_index)) << 16) |
+               static_cast<uint16_t>(width);
+    }
+
+    std::unordered_map<uint64_t, Row> cache_;
+    const void* library_identity_ = nullptr;
+    static constexpr size_t MAX_ROWS = 8192;
+};
+
+}  // namespace ouroboros::ui
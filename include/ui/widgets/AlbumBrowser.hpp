@@ -3,6 +3,7 @@
 #include "ui/Component.hpp"
 #include "model/Snapshot.hpp"
 #include "ui/ImageRenderer.hpp"  // For CachedFormat
+#include "util/Platform.hpp"
 #include <string>
 #include <vector>
 #include <array>
@@ -52,22 +53,6 @@ struct AlbumBrowserSlot {
     int rendered_y = -1;
 };
 
-struct AlbumGroup {
-    std::string title;
-    std::string artist;
-    std::string year;
-    std::vector<int> track_indices; // Indices into the main library vector
-    std::string representative_track_path; // First track path for artwork lookup via ArtworkWindow
-    std::string album_directory; // Directory containing the album's tracks
-
-    // Pre-computed normalized strings for fast searching (computed once in refresh_cache)
-    std::string normalized_title;
-    std::string normalized_artist;
-
-    // Scattered = compilation (multiple artists in directory)
-    bool is_scattered = false;
-};
-
 class AlbumBrowser : public Component {
 public:
     // NEW INTERFACE: Canvas-based rendering
@@ -93,8 +78,43 @@ public:
 private:
     void update_filtered_albums();
 
-    std::vector<AlbumGroup> albums_;
-    std::vector<size_t> filtered_album_indices_; // Indices into albums_
+    // Jump-to-letter index: first filtered index of each run of album
+    // initials, in display order. Built alongside the filter from the
+    // pre-computed normalized strings, so a jump is a binary search for
+    // the current section plus an O(1) hop - no per-keypress scan of a
+    // 20k-album grid. Initials outside a-z share the '#' bucket.
+    struct LetterSection {
+        char initial;
+        int first_index;  // Filtered index of the section's first album
+    };
+    std::vector<LetterSection> letter_sections_;
+    void rebuild_letter_index();
+    void jump_to_adjacent_letter(int direction);
+
+    // Virtualized album source: the snapshot's pre-computed, immutable
+    // album vector (normalized strings included) is referenced through a
+    // retained shared_ptr, never copied — opening the album view with
+    // 30k albums adopts one pointer instead of materializing per-album
+    // state. With no filter the identity index vector is not
+    // materialized either; filtered_count()/filtered_index() virtualize
+    // both cases, so all per-album work (layout slots, image requests)
+    // stays bounded by the viewport.
+    std::shared_ptr<const model::LibraryState> album_source_;
+    std::vector<size_t> filtered_album_indices_; // Indices into albums(); unused when identity
+    bool filter_identity_ = true;
+
+    [[nodiscard]] const std::vector<model::AlbumGroup>& albums() const {
+        static const std::vector<model::AlbumGroup> kEmpty;
+        return album_source_ ? album_source_->albums : kEmpty;
+    }
+    [[nodiscard]] int filtered_count() const {
+        return filter_identity_ ? util::narrow_cast<int>(albums().size())
+                                : util::narrow_cast<int>(filtered_album_indices_.size());
+    }
+    [[nodiscard]] size_t filtered_index(int i) const {
+        return filter_identity_ ? static_cast<size_t>(i) : filtered_album_indices_[i];
+    }
+
     int cols_ = 1;
     int scroll_offset_ = 0;
     int selected_index_ = 0;
@@ -108,6 +128,26 @@ private:
     std::chrono::steady_clock::time_point last_request_time_{};
     static constexpr auto SCROLL_DEBOUNCE_MS = std::chrono::milliseconds(35);
     static constexpr auto PREFETCH_DELAY_MS = std::chrono::milliseconds(150);
+
+    // Deep idle: once the directional prefetch has landed and the
+    // decode workers have gone quiet, warm the albums the next page
+    // movements would reveal. Memory stays bounded by ArtworkWindow's
+    // eviction limit; the high priority value keeps these behind every
+    // visible and prefetch request in the queue.
+    static constexpr auto SPECULATIVE_DELAY_MS = std::chrono::milliseconds(1000);
+    static constexpr int SPECULATIVE_PAGES = 2;  // Viewports warmed each side
+
+    // Scroll velocity state for adaptive decode/prefetch. Direction and
+    // velocity are updated live during a scroll session and retained
+    // when it ends, so the post-scroll prefetch can lean in the
+    // direction we were moving.
+    int scroll_direction_ = 0;      // +1 down, -1 up, 0 unknown
+    double scroll_velocity_ = 0.0;  // Rows/sec over the current/last session
+    // Above this, decoding what we're flying past is wasted work;
+    // requests resume when the user slows down or stops
+    static constexpr double FAST_SCROLL_ROWS_PER_SEC = 10.0;
+    // Sustained movement widens the leading edge of the prefetch window
+    static constexpr double SUSTAINED_SCROLL_ROWS_PER_SEC = 4.0;
     static constexpr int BIG_JUMP_ROWS = 10;  // Velocity-based: 10+ rows in under 2s
     static constexpr int HUGE_JUMP_ROWS = 25; // Distance-based: 25+ rows always triggers
     static constexpr auto BIG_JUMP_TIME_LIMIT = std::chrono::milliseconds(2000);
@@ -116,6 +156,7 @@ private:
     bool filter_dirty_ = false;
     bool content_changed_ = false; // Flag to force clear images on filter change
     bool prefetch_completed_ = false; // Skip redundant prefetch when viewport hasn't changed
+    bool speculative_completed_ = false; // One speculative warm per idle period
     bool search_active_ = false;     // When true, render search bar at top of widget
 
     // Atomic slots for flicker-free rendering (holds decoded pixel data)
@@ -6,6 +6,11 @@
 #include <vector>
 #include <set>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <optional>
+#include <cstdint>
+#include <unordered_map>
 
 namespace ouroboros::ui::widgets {
 
@@ -19,13 +24,20 @@ public:
 
     SizeConstraints get_constraints() const override;
 
-    void set_filter(const std::string& query) {
-        if (filter_query_ != query) {
-            filter_query_ = query;
-            filter_dirty_ = true;
-            selected_index_ = 0;
-            scroll_offset_ = 0;
-        }
+    void set_filter(const std::string& query);
+
+    // True while an async filter job is in flight; the renderer must
+    // keep calling render() so update_filtered_indices can adopt the
+    // result when it lands
+    [[nodiscard]] bool has_pending_filter() const { return filter_job_pending_; }
+
+    // Rows the list viewport moved since the previous rendered frame;
+    // consumed once per frame by the renderer, which turns it into a
+    // scroll hint for the flush fast path
+    [[nodiscard]] int take_scroll_delta() {
+        int delta = render_scroll_delta_;
+        render_scroll_delta_ = 0;
+        return delta;
     }
 
     // Multi-select support
@@ -43,13 +55,59 @@ private:
 
     int selected_index_ = 0;
     int scroll_offset_ = 0;
-    
+
+    // Scroll-hint state: viewport offset as of the last rendered frame,
+    // and the delta the renderer hasn't consumed yet
+    int render_scroll_base_ = -1;
+    int render_scroll_delta_ = 0;
+
+
     std::string filter_query_;
     bool filter_dirty_ = true;
     size_t last_library_size_ = 0; // To detect library updates
-    
+
     std::vector<int> filtered_indices_; // Indices into snap.library.tracks
+
+    // Incremental filtering: an appended character only narrows the
+    // result set, so the next update refines filtered_indices_ in
+    // place instead of rescanning the library. Each refinement first
+    // snapshots the current result so backspace restores it directly.
+    struct FilterSnapshot {
+        std::string query;
+        std::vector<int> indices;
+    };
+    std::vector<FilterSnapshot> filter_history_;
+    bool filter_refine_ = false;
+    // Current results came from the fuzzy fallback (score-ranked, not
+    // literal matches), so they cannot be refined or snapshotted
+    bool filter_fuzzy_ = false;
+    static constexpr size_t MAX_FILTER_HISTORY = 16;
+
+    // Async filtering: searches run on a TaskPool worker against the
+    // snapshot's immutable library state and publish into the slot; the
+    // UI thread adopts a result next frame only if its generation is
+    // still current (every keystroke bumps it), so keystrokes never
+    // block and slow stale searches are discarded. The slot is shared
+    // with the worker so a task outliving the widget stays harmless.
+    struct FilterResult {
+        uint64_t generation = 0;
+        size_t library_size = 0;   // tracks.size() the search ran against
+        std::vector<int> indices;
+        bool fuzzy = false;
+    };
+    struct FilterSlot {
+        std::mutex mutex;
+        std::atomic<uint64_t> generation{0};
+        std::optional<FilterResult> result;
+    };
+    std::shared_ptr<FilterSlot> filter_slot_ = std::make_shared<FilterSlot>();
+    bool filter_job_pending_ = false;
+    std::string inflight_query_;
     std::set<int> selected_indices_;    // Multi-select: tracks selected for batch operations
+
+    // Row formatting lives in the shared ui::TrackRowCache: Queue draws
+    // the same layout, so a track visible in both panes is formatted
+    // once per library state, not once per widget
 };
 
 }  // namespace ouroboros::ui::widgets
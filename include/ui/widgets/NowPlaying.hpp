@@ -20,6 +20,10 @@ public:
 
     void render_image_if_needed(const LayoutRect& widget_rect, bool force_render = false);
 
+    // Whether the last frame drew the spectrum row (frame pacing: the
+    // analyzer bands are the only reason playback needs ~30fps frames)
+    [[nodiscard]] bool spectrum_visible() const { return spectrum_row_visible_; }
+
 private:
     std::string cached_path_;
     std::string pending_render_path_;  // Track path waiting for decode
@@ -41,6 +45,10 @@ private:
     // Cache the actual widget rect for dynamic calculations
     LayoutRect cached_rect_ = {0, 0, 0, 0};
 
+    // Whether render() reserved a spectrum row this frame; the artwork
+    // placement in render_image_if_needed must reserve the same lines
+    bool spectrum_row_visible_ = false;
+
     std::vector<std::string> make_art_box(int width, int height);
     std::vector<std::string> combine_horizontal(
         const std::vector<std::string>& left,
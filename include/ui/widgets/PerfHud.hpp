@@ -0,0 +1,25 @@
+#pragma once
+
+#include "ui/Component.hpp"
+
+namespace ouroboros::ui::widgets {
+
+/// Live performance HUD rendered in a small corner box.
+///
+/// Reads the wait-free util::PerfCounters probes (frame time, publish
+/// hold time, audio ring fill, image decode queue depth) with relaxed
+/// loads; it never touches a lock, so opening it cannot perturb the
+/// threads it is observing. Toggled with the `perf_hud` keybind.
+class PerfHud : public Component {
+public:
+    void render(Canvas& canvas, const LayoutRect& rect, const model::Snapshot& snap) override;
+    SizeConstraints get_constraints() const override;
+
+    bool is_visible() const { return visible_; }
+    void set_visible(bool v) { visible_ = v; }
+
+private:
+    bool visible_ = false;
+};
+
+}  // namespace ouroboros::ui::widgets
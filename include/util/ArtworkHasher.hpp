@@ -17,6 +17,31 @@ public:
     // SHA-256 raw bytes (for general-purpose hashing, e.g., directory tree hash)
     [[nodiscard]] static std::vector<uint8_t> sha256(const uint8_t* data, size_t len);
 
+    // Streaming SHA-256 over the same compression core. Lets callers
+    // hash data as it arrives (or as it is copied) instead of making a
+    // second pass over the finished buffer.
+    class Sha256 {
+    public:
+        Sha256();
+        void update(const uint8_t* data, size_t len);
+        // Finalize: 32 raw bytes / 64-char hex. The stream is spent
+        // afterwards; construct a new one for the next digest.
+        [[nodiscard]] std::vector<uint8_t> finish();
+        [[nodiscard]] std::string finish_hex();
+
+    private:
+        uint32_t state_[8];
+        uint8_t buffer_[64];
+        size_t buffered_ = 0;
+        uint64_t total_len_ = 0;
+    };
+
+    // Copies src into out while hashing it in cache-sized chunks, so
+    // the bytes are hashed while their lines are still warm from the
+    // copy. Returns the hex digest.
+    [[nodiscard]] static std::string hash_and_copy(const uint8_t* src, size_t len,
+                                                   std::vector<uint8_t>& out);
+
 private:
     // SHA-256 internal implementation
     static constexpr size_t SHA256_BLOCK_SIZE = 64;
@@ -26,6 +51,12 @@ private:
 
     static std::string to_hex(const std::vector<uint8_t>& bytes);
 
+    // Compression over whole 64-byte blocks: SHA-NI on x86-64 and the
+    // ARMv8 sha2 extension on aarch64 when the CPU has them (runtime
+    // dispatch), scalar otherwise. All variants are bit-identical.
+    static void compress(uint32_t* state, const uint8_t* blocks, size_t count);
+    static void compress_scalar(uint32_t* state, const uint8_t* blocks, size_t count);
+
     // SHA-256 internal functions
     static constexpr uint32_t rotr(uint32_t x, uint32_t n);
     static constexpr uint32_t ch(uint32_t x, uint32_t y, uint32_t z);
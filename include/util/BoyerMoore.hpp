@@ -1,6 +1,9 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <functional>
+#include <vector>
 #include <cstdint>
 #include <cstddef>
 
@@ -32,7 +35,23 @@ public:
      */
     [[nodiscard]] int search(const std::string& text, int start_pos = 0) const;
 
+    /**
+     * Batch containment test across many short strings (track rows).
+     * Keeps only the indices whose text contains the pattern,
+     * compacting in place and preserving order; one call amortizes the
+     * setup and validation of search() across the whole batch.
+     * @param indices Candidate indices, filtered in place
+     * @param text_at Returns the text for an index
+     */
+    void search_batch(std::vector<int>& indices,
+                      const std::function<std::string_view(int)>& text_at) const;
+
 private:
+    // Shared core over raw bytes; the case-sensitive path is the
+    // memchr-accelerated Horspool (SIMD scan for the pattern's last
+    // byte, verify on hit), the case-insensitive path the scalar BMH
+    int search_impl(const char* text, int n, int start_pos) const;
+
     static constexpr int ALPHABET_SIZE = 256;
     static constexpr int MAX_PATTERN = 256;
     static_assert(ALPHABET_SIZE == 256, "BMH requires full byte alphabet");
@@ -40,6 +59,10 @@ private:
     // Bad character skip table (no heap allocation)
     int bad_char_[ALPHABET_SIZE];
 
+    // Horspool shift when the window's last byte equals the pattern's
+    // last byte (constant, so hoisted out of the skip loop)
+    int last_char_shift_ = 1;
+
     // Pattern information
     std::string pattern_;
     int pattern_len_;
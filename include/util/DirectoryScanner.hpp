@@ -1,8 +1,10 @@
 #pragma once
 
 #include <filesystem>
+#include <deque>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <array>
 #include <unordered_map>
 #include <cstdint>
@@ -10,6 +12,8 @@
 
 namespace ouroboros::util {
 
+class UringStatBatcher;
+
 /**
  * DirectoryScanner: High-performance directory scanning using getdents64 syscall.
  *
@@ -25,13 +29,63 @@ namespace ouroboros::util {
 class DirectoryScanner {
 public:
     /**
-     * Result of a complete directory scan.
+     * Result of a complete directory scan, backed by a bump arena.
+     *
+     * The old layout held one heap std::string per path plus two
+     * unordered_maps over the same keys — hundreds of thousands of
+     * allocations per scan, all copied and re-hashed again when results
+     * were merged or cached in Library. Path bytes now live back to
+     * back in one buffer; records reference them as (offset, length),
+     * and lookups binary-search the records once finalize() has sorted
+     * them. Moving or caching a result moves a handful of buffers.
      */
     struct ScanResult {
-        std::vector<std::string> audio_files;                    // All audio file paths (absolute)
-        std::unordered_map<std::string, std::time_t> file_mtimes;  // Path → modification time
-        std::unordered_map<std::string, std::time_t> dir_mtimes;   // Directory → modification time
-        uint64_t tree_hash;                                        // Hash of all file paths (for TIER 0)
+        struct FileRecord {
+            uint32_t path_off = 0;  // Into arena (absolute path)
+            uint32_t path_len = 0;
+            std::time_t mtime = 0;  // 0 = stat failed / unknown
+        };
+        struct DirRecord {
+            uint32_t path_off = 0;  // Into arena (root-relative path)
+            uint32_t path_len = 0;
+            std::time_t mtime = 0;
+            uint64_t hash = 0;      // Hash of the dir's own audio paths, 0 = no audio
+        };
+
+        std::string arena;  // All path bytes, bump-allocated
+
+        // Deques, not vectors: UringStatBatcher keeps a pointer to a
+        // record's mtime until flush(), and deque growth never
+        // relocates existing elements.
+        std::deque<FileRecord> files;  // Audio files (TIER 0/2 keys)
+        std::deque<DirRecord> dirs;    // Directories (TIER 0/1 keys)
+
+        uint64_t tree_hash = 0;  // XOR of DirRecord hashes (for TIER 0)
+
+        [[nodiscard]] std::string_view path_of(const FileRecord& r) const {
+            return {arena.data() + r.path_off, r.path_len};
+        }
+        [[nodiscard]] std::string_view path_of(const DirRecord& r) const {
+            return {arena.data() + r.path_off, r.path_len};
+        }
+
+        /// Append a path to the arena, returning its offset
+        uint32_t add_path(std::string_view path) {
+            uint32_t off = static_cast<uint32_t>(arena.size());
+            arena.append(path);
+            return off;
+        }
+
+        /// Append another result: one buffer append plus offset
+        /// rebasing, no per-path work. Breaks sort order; finalize()
+        /// again before looking anything up.
+        void merge(ScanResult&& other);
+
+        /// Sort records by path so find_file/find_dir can binary search
+        void finalize();
+
+        [[nodiscard]] const FileRecord* find_file(std::string_view abs_path) const;
+        [[nodiscard]] const DirRecord* find_dir(std::string_view rel_path) const;
     };
 
     /**
@@ -61,27 +115,64 @@ public:
      */
     [[nodiscard]] static bool is_audio_extension(const char* filename);
 
+    /**
+     * Batch extension classifier for a whole getdents64 buffer of
+     * names. Packs the last 8 bytes of each name into a word and
+     * matches all extensions with masked compares — branch-free per
+     * name, so the compiler vectorizes the loop. Equivalent to calling
+     * is_audio_extension per name.
+     *
+     * @param names Filename pointers (count entries)
+     * @param name_lens Matching strlen of each name
+     * @param count Number of names
+     * @param out_is_audio Output flags, one per name
+     */
+    static void match_audio_extensions(
+        const char* const* names,
+        const size_t* name_lens,
+        size_t count,
+        uint8_t* out_is_audio
+    );
+
+    /**
+     * Hashes the audio file paths directly inside one directory
+     * (non-recursive). Produces the same value as the dir_hashes entry
+     * a full scan would compute, so TIER 0 validation can re-hash just
+     * the directories whose mtime moved instead of re-walking the tree.
+     *
+     * @param dir_path Directory to list
+     * @return Hash of the directory's audio paths, 0 if it has none
+     */
+    [[nodiscard]] static uint64_t hash_directory_files(const std::string& dir_path);
+
 private:
     static constexpr size_t BUFFER_SIZE = 256 * 1024;  // 256KB buffer for getdents64
 
     /**
-     * Supported audio file extensions.
+     * Supported audio file extensions. Keep in sync with EXT_PATTERNS
+     * in DirectoryScanner.cpp (the SWAR matcher derives from this list).
      */
     static constexpr std::array<std::string_view, 6> AUDIO_EXTENSIONS = {
         ".dsf", ".flac", ".m4a", ".mp3", ".ogg", ".wav"
     };
 
     /**
-     * Recursively scan directory using getdents64 syscall.
+     * Scan a single directory (non-recursive) using getdents64.
+     * Discovered subdirectories are appended to `subdirs` so the caller
+     * can feed them back into the parallel work queue.
      *
      * @param dir_path Directory to scan
      * @param root_path Root path for making relative paths
-     * @param result Output ScanResult to populate
+     * @param result Output ScanResult shard to populate
+     * @param stat_batcher Batches mtime statx calls via io_uring
+     * @param subdirs Output: subdirectories discovered in dir_path
      */
-    static void scan_directory_recursive(
+    static void scan_one_directory(
         const std::string& dir_path,
         const std::string& root_path,
-        ScanResult& result
+        ScanResult& result,
+        UringStatBatcher& stat_batcher,
+        std::vector<std::string>& subdirs
     );
 
     /**
@@ -104,6 +195,17 @@ private:
      * @return 64-bit truncated hash
      */
     static uint64_t compute_tree_hash(const std::vector<std::string>& paths);
+
+    /**
+     * Hash a set of paths (sorted internally, so the result is
+     * order-independent). Shared by compute_tree_hash and the
+     * per-directory hashing in scan_one_directory. Takes views so
+     * arena-backed callers don't copy path bytes.
+     *
+     * @param paths Path views (taken by value; sorted in place)
+     * @return 64-bit truncated SHA-256 of the sorted paths
+     */
+    static uint64_t hash_paths(std::vector<std::string_view> paths);
 };
 
 }  // namespace ouroboros::util
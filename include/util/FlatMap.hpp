@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ouroboros::util {
+
+/**
+ * Open-addressing hash map (robin-hood probing, backward-shift
+ * deletion) for hot path->value indexes.
+ *
+ * std::unordered_map is node-based: one allocation per entry and a
+ * pointer chase per lookup, which dominates cache-validation passes
+ * over six-figure track counts. FlatMap keeps entries in one
+ * contiguous slot array (plus flat distance/hash side arrays), so a
+ * lookup touches at most a couple of adjacent cache lines and a bulk
+ * load with reserve() does no per-entry allocation beyond the keys
+ * and values themselves.
+ *
+ * Covers the subset of the unordered_map interface the backend uses:
+ * operator[], find, erase(key), clear, reserve, size and forward
+ * iteration (entries expose .first/.second and structured bindings).
+ * Iteration order is unspecified. Any insert or erase invalidates
+ * iterators and references; erase while iterating is not supported -
+ * collect keys first, then erase.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>>
+class FlatMap {
+public:
+    struct Slot {
+        K first{};
+        V second{};
+    };
+
+private:
+    // dist_ holds probe distance + 1; 0 marks an empty slot. Load is
+    // capped at 75%, which keeps robin-hood probe distances tiny.
+    std::vector<Slot> slots_;
+    std::vector<size_t> hashes_;
+    std::vector<uint8_t> dist_;
+    size_t size_ = 0;
+    size_t mask_ = 0;
+
+    static constexpr size_t MIN_CAPACITY = 16;
+    static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+    [[nodiscard]] size_t find_index(const K& key) const {
+        if (size_ == 0) return NPOS;
+        const size_t h = Hash{}(key);
+        size_t idx = h & mask_;
+        uint8_t d = 1;
+        while (dist_[idx] != 0) {
+            // A resident poorer than our probe means the key is absent:
+            // robin-hood would have displaced it during insert
+            if (dist_[idx] < d) return NPOS;
+            if (hashes_[idx] == h && slots_[idx].first == key) return idx;
+            idx = (idx + 1) & mask_;
+            ++d;
+        }
+        return NPOS;
+    }
+
+    // Place (key, value) starting at idx with probe distance d,
+    // displacing richer residents as robin-hood requires. The key must
+    // not already be present.
+    void place(size_t idx, uint8_t d, size_t h, K&& key, V&& value) {
+        K cur_key = std::move(key);
+        V cur_val = std::move(value);
+        size_t cur_hash = h;
+        uint8_t cur_d = d;
+
+        for (;;) {
+            if (dist_[idx] == 0) {
+                slots_[idx].first = std::move(cur_key);
+                slots_[idx].second = std::move(cur_val);
+                hashes_[idx] = cur_hash;
+                dist_[idx] = cur_d;
+                ++size_;
+                return;
+            }
+            if (dist_[idx] < cur_d) {
+                std::swap(slots_[idx].first, cur_key);
+                std::swap(slots_[idx].second, cur_val);
+                std::swap(hashes_[idx], cur_hash);
+                std::swap(dist_[idx], cur_d);
+            }
+            idx = (idx + 1) & mask_;
+            ++cur_d;
+            if (cur_d == UINT8_MAX) {
+                // Pathological clustering (never reached at 75% load):
+                // rehash larger and restart with the carried entry
+                grow(capacity() * 2);
+                place(cur_hash & mask_, 1, cur_hash,
+                      std::move(cur_key), std::move(cur_val));
+                return;
+            }
+        }
+    }
+
+    [[nodiscard]] size_t capacity() const { return dist_.size(); }
+
+    void grow(size_t min_slots) {
+        size_t new_cap = MIN_CAPACITY;
+        while (new_cap < min_slots) new_cap *= 2;
+
+        std::vector<Slot> old_slots = std::move(slots_);
+        std::vector<size_t> old_hashes = std::move(hashes_);
+        std::vector<uint8_t> old_dist = std::move(dist_);
+
+        slots_.assign(new_cap, Slot{});
+        hashes_.assign(new_cap, 0);
+        dist_.assign(new_cap, 0);
+        mask_ = new_cap - 1;
+        size_ = 0;
+
+        for (size_t i = 0; i < old_dist.size(); ++i) {
+            if (old_dist[i] == 0) continue;
+            const size_t h = old_hashes[i];
+            place(h & mask_, 1, h,
+                  std::move(old_slots[i].first), std::move(old_slots[i].second));
+        }
+    }
+
+    void grow_if_needed() {
+        // Grow past 75% load
+        if (capacity() == 0 || (size_ + 1) * 4 > capacity() * 3) {
+            grow(capacity() == 0 ? MIN_CAPACITY : capacity() * 2);
+        }
+    }
+
+    template<bool Const>
+    class basic_iterator {
+        using MapPtr = std::conditional_t<Const, const FlatMap*, FlatMap*>;
+        MapPtr map_ = nullptr;
+        size_t idx_ = 0;
+
+        void skip_empty() {
+            while (idx_ < map_->capacity() && map_->dist_[idx_] == 0) ++idx_;
+        }
+
+        friend class FlatMap;
+        basic_iterator(MapPtr map, size_t idx) : map_(map), idx_(idx) { skip_empty(); }
+
+    public:
+        using value_type = Slot;
+        using reference = std::conditional_t<Const, const Slot&, Slot&>;
+        using pointer = std::conditional_t<Const, const Slot*, Slot*>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        basic_iterator() = default;
+
+        // iterator converts to const_iterator
+        template<bool C = Const, typename = std::enable_if_t<C>>
+        basic_iterator(const basic_iterator<false>& other)
+            : map_(other.map_), idx_(other.idx_) {}
+
+        reference operator*() const { return map_->slots_[idx_]; }
+        pointer operator->() const { return &map_->slots_[idx_]; }
+
+        basic_iterator& operator++() {
+            ++idx_;
+            skip_empty();
+            return *this;
+        }
+        basic_iterator operator++(int) {
+            basic_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const basic_iterator& other) const { return idx_ == other.idx_; }
+        bool operator!=(const basic_iterator& other) const { return idx_ != other.idx_; }
+
+    private:
+        template<bool> friend class basic_iterator;
+    };
+
+public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    FlatMap() = default;
+
+    [[nodiscard]] size_t size() const { return size_; }
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+
+    void reserve(size_t n) {
+        // Size the table so n entries stay under the load cap
+        size_t needed = n * 4 / 3 + 1;
+        if (needed > capacity()) grow(needed);
+    }
+
+    void clear() {
+        slots_.assign(slots_.size(), Slot{});
+        hashes_.assign(hashes_.size(), 0);
+        dist_.assign(dist_.size(), 0);
+        size_ = 0;
+    }
+
+    V& operator[](const K& key) {
+        grow_if_needed();
+        const size_t h = Hash{}(key);
+        size_t idx = h & mask_;
+        uint8_t d = 1;
+        while (dist_[idx] != 0 && dist_[idx] >= d) {
+            if (hashes_[idx] == h && slots_[idx].first == key) {
+                return slots_[idx].second;
+            }
+            idx = (idx + 1) & mask_;
+            ++d;
+        }
+        place(idx, d, h, K(key), V{});
+        return slots_[find_index(key)].second;
+    }
+
+    /// Single-probe upsert that moves the value into place. Unlike
+    /// operator[] (probe + default-construct + assign + re-probe for
+    /// the reference), this walks the cluster once and never copies V;
+    /// batch apply paths that don't need the slot back should use it.
+    template <typename VV>
+    void insert_or_assign(const K& key, VV&& value) {
+        grow_if_needed();
+        const size_t h = Hash{}(key);
+        size_t idx = h & mask_;
+        uint8_t d = 1;
+        while (dist_[idx] != 0 && dist_[idx] >= d) {
+            if (hashes_[idx] == h && slots_[idx].first == key) {
+                slots_[idx].second = std::forward<VV>(value);
+                return;
+            }
+            idx = (idx + 1) & mask_;
+            ++d;
+        }
+        place(idx, d, h, K(key), V(std::forward<VV>(value)));
+    }
+
+    [[nodiscard]] iterator find(const K& key) {
+        size_t idx = find_index(key);
+        return (idx == NPOS) ? end() : iterator(this, idx);
+    }
+    [[nodiscard]] const_iterator find(const K& key) const {
+        size_t idx = find_index(key);
+        return (idx == NPOS) ? end() : const_iterator(this, idx);
+    }
+
+    size_t erase(const K& key) {
+        size_t idx = find_index(key);
+        if (idx == NPOS) return 0;
+
+        // Backward shift: pull the rest of the cluster one slot left so
+        // no tombstones accumulate
+        size_t next = (idx + 1) & mask_;
+        while (dist_[next] > 1) {
+            slots_[idx] = std::move(slots_[next]);
+            hashes_[idx] = hashes_[next];
+            dist_[idx] = static_cast<uint8_t>(dist_[next] - 1);
+            idx = next;
+            next = (next + 1) & mask_;
+        }
+        slots_[idx] = Slot{};  // Release the entry's own allocations
+        dist_[idx] = 0;
+        --size_;
+        return 1;
+    }
+
+    [[nodiscard]] iterator begin() { return iterator(this, 0); }
+    [[nodiscard]] iterator end() { return iterator(this, capacity()); }
+    [[nodiscard]] const_iterator begin() const { return const_iterator(this, 0); }
+    [[nodiscard]] const_iterator end() const { return const_iterator(this, capacity()); }
+};
+
+}  // namespace ouroboros::util
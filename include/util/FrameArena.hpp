@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ouroboros::util {
+
+/// Frame-scoped monotonic arena.
+///
+/// The steady-state render loop used to malloc/free thousands of
+/// short-lived strings per second (escape-sequence composition, row
+/// text). Allocations from this arena are a pointer bump; reset() at
+/// end of frame recycles all blocks in O(1) without running any
+/// destructors, so only trivially-destructible payloads (char buffers,
+/// POD scratch) belong here.
+///
+/// One arena per thread that renders: use frame_arena() from the render
+/// thread and call reset() once per frame after flush_canvas().
+class FrameArena {
+public:
+    explicit FrameArena(size_t block_size = 64 * 1024)
+        : block_size_(block_size) {
+        add_block(block_size_);
+    }
+
+    void* alloc(size_t size, size_t align = alignof(std::max_align_t)) {
+        Block& b = blocks_[block_];
+        uintptr_t base = reinterpret_cast<uintptr_t>(b.data.get());
+        uintptr_t aligned = (base + offset_ + align - 1) & ~(align - 1);
+        size_t new_offset = (aligned - base) + size;
+        if (new_offset > b.size) {
+            return alloc_slow(size, align);
+        }
+        offset_ = new_offset;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    // Recycle everything allocated this frame. O(1); keeps the blocks.
+    void reset() {
+        block_ = 0;
+        offset_ = 0;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+    };
+
+    void add_block(size_t size) {
+        blocks_.push_back({std::make_unique<std::byte[]>(size), size});
+    }
+
+    void* alloc_slow(size_t size, size_t align) {
+        // Advance to the next block, growing the chain if needed.
+        // Oversized requests get a dedicated larger block.
+        size_t needed = std::max(block_size_, size + align);
+        block_++;
+        if (block_ >= blocks_.size()) {
+            add_block(needed);
+        } else if (blocks_[block_].size < size + align) {
+            blocks_[block_] = {std::make_unique<std::byte[]>(needed), needed};
+        }
+        offset_ = 0;
+
+        Block& b = blocks_[block_];
+        uintptr_t base = reinterpret_cast<uintptr_t>(b.data.get());
+        uintptr_t aligned = (base + align - 1) & ~(align - 1);
+        offset_ = (aligned - base) + size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    size_t block_size_;
+    std::vector<Block> blocks_;
+    size_t block_ = 0;
+    size_t offset_ = 0;
+};
+
+// The render thread's arena (valid between frames; reset per frame).
+inline FrameArena& frame_arena() {
+    thread_local FrameArena arena;
+    return arena;
+}
+
+/// Minimal std-compatible allocator over a FrameArena. deallocate is a
+/// no-op; memory returns on arena reset.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena& arena) noexcept : arena_(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(arena_->alloc(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T*, size_t) noexcept {}  // Freed wholesale on reset()
+
+    [[nodiscard]] FrameArena* arena() const noexcept { return arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena();
+    }
+
+private:
+    FrameArena* arena_;
+};
+
+// Scratch string living in the frame arena. Build escape sequences /
+// row text with this inside the render loop; never store one past the
+// arena reset.
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+inline ArenaString make_arena_string() {
+    return ArenaString(ArenaAllocator<char>(frame_arena()));
+}
+
+// Append an integer without the std::to_string temporary.
+inline void append_int(ArenaString& out, long value) {
+    char buf[24];
+    auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+    (void)ec;  // Cannot fail: buffer covers the full range of long
+    out.append(buf, end);
+}
+
+}  // namespace ouroboros::util
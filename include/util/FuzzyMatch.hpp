@@ -0,0 +1,57 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace ouroboros::util {
+
+/**
+ * fzf-style scored subsequence matcher.
+ *
+ * A pattern matches when its bytes appear in the text in order, not
+ * necessarily adjacent, so "blckstr" finds "blackstar". Matching is a
+ * single greedy left-to-right pass: a 256-bit pattern charset mask
+ * rejects most non-matching rows in one vectorizable sweep, and the
+ * alignment itself jumps between occurrences with memchr, so the inner
+ * loop runs at SIMD scan speed rather than byte-at-a-time.
+ *
+ * Scoring favours consecutive runs and matches that start a word
+ * (after a space, '/' or field separator), and charges for the gaps in
+ * between, so tighter alignments rank first. The greedy alignment is
+ * not the optimal one fzf v2 computes, but it is linear in the text and
+ * more than close enough to rank track rows.
+ */
+class FuzzyMatcher {
+public:
+    /// @param pattern Query normalized the same way as the texts it
+    ///                will be scored against
+    explicit FuzzyMatcher(std::string_view pattern);
+
+    /**
+     * Score text against the pattern.
+     * @return Alignment score (higher is better, may be negative), or
+     *         nullopt when the pattern is not a subsequence of text
+     */
+    [[nodiscard]] std::optional<int> score(std::string_view text) const;
+
+    [[nodiscard]] bool empty() const { return pattern_.empty(); }
+
+private:
+    // Scoring weights (fzy-like): a consecutive byte extends a run, a
+    // word-boundary start beats a mid-word one, gaps cost up to
+    // MAX_GAP_PENALTY each so one bad gap cannot drown the bonuses
+    static constexpr int SCORE_CONSECUTIVE = 16;
+    static constexpr int SCORE_BOUNDARY = 8;
+    static constexpr int SCORE_MATCH = 4;
+    static constexpr int MAX_GAP_PENALTY = 16;
+
+    // charset_[c >> 6] bit (c & 63): byte c occurs in the pattern
+    bool charset_contains_all(std::string_view text) const;
+    uint64_t charset_[4] = {0, 0, 0, 0};
+
+    std::string pattern_;
+};
+
+}  // namespace ouroboros::util
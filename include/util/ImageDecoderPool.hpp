@@ -1,56 +1,84 @@
 #pragma once
 
-#include <vector>
-#include <queue>
-#include <thread>
-#include <mutex>
-#include <condition_variable>
+#include <array>
+#include <cstdint>
+#include <deque>
 #include <functional>
-#include <atomic>
-#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace ouroboros::util {
 
-// Parallel image decoding pool using fixed thread pool across CPU cores
-// Similar to library scanner parallel metadata parsing pattern
+// Image decode front-end over the shared TaskPool.
+//
+// Historically this owned its own hardware_concurrency() worker set,
+// which oversubscribed the machine 2x whenever the library scanner's
+// threads were also running. It is now a thin facade: jobs are queued
+// here (bounded, so fast scrolling can't explode memory) and executed
+// on TaskPool, so artwork decodes share cores with background work
+// instead of fighting it.
+//
+// Jobs are keyed and lane-scheduled: Visible decodes drain ahead of
+// Prefetch, which drains ahead of Speculative, and within a lane order
+// is FIFO. Re-submitting a queued key moves the job to the new lane, so
+// the album that just scrolled under the cursor overtakes its own
+// earlier speculative request instead of queueing behind 49 stale ones.
+// When the queue is full, admitting a more urgent job evicts the oldest
+// job from the least urgent backlogged lane; only a queue full of
+// equally-or-more urgent work rejects a submission.
 class ImageDecoderPool {
 public:
     // Job type: function that returns void
     using DecodeJob = std::function<void()>;
 
+    // Scheduling lanes, most to least urgent
+    enum class Lane : uint8_t { Visible = 0, Prefetch = 1, Speculative = 2 };
+
     // Singleton pattern (like ImageRenderer)
     static ImageDecoderPool& instance();
 
-    // Submit a job to the pool (non-blocking)
-    // Returns false if queue is full (prevents memory explosion)
+    // Submit or re-prioritize a keyed job (non-blocking). A key already
+    // queued keeps its original job but moves to the new lane.
+    // Returns false if the queue is full of work at least as urgent.
+    [[nodiscard]] bool submit_job(const std::string& key, Lane lane, DecodeJob job);
+
+    // Legacy unkeyed submit: auto-keyed, Prefetch lane
     [[nodiscard]] bool submit_job(DecodeJob job);
 
+    // Drop a queued job by key (stale off-screen decode). Jobs already
+    // executing are unaffected. Returns true if something was removed.
+    bool cancel(const std::string& key);
+
     // Get queue size for monitoring
     [[nodiscard]] size_t get_queue_size() const;
 
-    // Destructor waits for all jobs to complete
-    ~ImageDecoderPool();
-
 private:
-    ImageDecoderPool();
+    ImageDecoderPool() = default;
     ImageDecoderPool(const ImageDecoderPool&) = delete;
     ImageDecoderPool& operator=(const ImageDecoderPool&) = delete;
 
-    // Worker thread function
-    void worker_thread();
+    struct QueuedJob {
+        std::string key;
+        DecodeJob job;
+    };
 
-    // Thread pool
-    std::vector<std::thread> workers_;
+    static constexpr size_t NUM_LANES = 3;
 
-    // Job queue with mutex
-    std::queue<DecodeJob> job_queue_;
-    mutable std::mutex queue_mutex_;
-    std::condition_variable cv_;
+    // Runs on a TaskPool worker: pop and execute the most urgent job
+    void run_one();
 
-    // Control flags
-    std::atomic<bool> stop_{false};
+    size_t total_queued_locked() const;
+    bool evict_below_locked(Lane lane);
+
+    // One FIFO per lane plus a key index for re-prioritize/cancel
+    std::array<std::deque<QueuedJob>, NUM_LANES> lanes_;
+    std::unordered_map<std::string, Lane> queued_keys_;
+    uint64_t unkeyed_seq_ = 0;
+    mutable std::mutex queue_mutex_;
 
-    // Maximum queue size to prevent memory explosion during fast scrolling
+    // Maximum total queue size to prevent memory explosion during fast
+    // scrolling
     static constexpr size_t MAX_QUEUE_SIZE = 50;
 };
 
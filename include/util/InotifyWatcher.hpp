@@ -0,0 +1,64 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ouroboros::util {
+
+/**
+ * InotifyWatcher: recursive inotify watch over the music directories.
+ *
+ * Lets the library pick up added/changed/removed files while the app
+ * runs, with zero directory traversal per event — the kernel tells us
+ * exactly which paths moved, and LibraryCollector feeds them straight
+ * into Library::scan_for_changes instead of requiring a restart and a
+ * full TIER-0 revalidation.
+ *
+ * inotify watches are per-directory, so construction walks each root
+ * once to register them and new subdirectories are registered as their
+ * creation events arrive. If inotify is unavailable (or the fd limit is
+ * hit), available() returns false and callers keep the old
+ * scan-at-startup-only behavior.
+ *
+ * Not thread-safe: poll from one thread.
+ */
+class InotifyWatcher {
+public:
+    struct Changes {
+        std::vector<std::string> changed_files;   // Created/modified/moved-in audio files
+        std::vector<std::string> deleted_files;   // Removed/moved-out audio files
+        std::vector<std::string> deleted_dirs;    // Removed directory subtrees (absolute)
+
+        [[nodiscard]] bool empty() const {
+            return changed_files.empty() && deleted_files.empty() && deleted_dirs.empty();
+        }
+    };
+
+    explicit InotifyWatcher(const std::vector<std::filesystem::path>& roots);
+    ~InotifyWatcher();
+
+    InotifyWatcher(const InotifyWatcher&) = delete;
+    InotifyWatcher& operator=(const InotifyWatcher&) = delete;
+
+    /// False if inotify could not be initialized.
+    [[nodiscard]] bool available() const { return fd_ >= 0; }
+
+    /**
+     * Wait up to timeout_ms for filesystem events and append them to
+     * `out`. Returns true if any events were appended. Newly created
+     * directories are watched immediately and their existing contents
+     * reported as changed (files may land before the watch is active).
+     */
+    bool poll(Changes& out, int timeout_ms);
+
+private:
+    void add_watch_recursive(const std::string& dir, Changes* report_contents);
+    void remove_watches_under(const std::string& dir);
+
+    int fd_ = -1;
+    std::unordered_map<int, std::string> wd_to_dir_;
+};
+
+}  // namespace ouroboros::util
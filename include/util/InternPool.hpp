@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ouroboros::util {
+
+/// Process-wide string intern pool.
+///
+/// Track metadata is massively repetitive: an album of 20 tracks stores
+/// 20 identical artist/album/genre/date values, and with copy-on-write
+/// snapshots every one of those is a separate heap allocation. The pool
+/// maps each distinct value to a single shared allocation, so assigning
+/// the same artist to 20 tracks costs 19 refcount bumps instead of 19
+/// string copies.
+///
+/// Interned strings are never evicted - the pool is bounded by the number
+/// of DISTINCT metadata values in the library, which is small compared to
+/// the track count. Lookups are striped across 16 shards so the parallel
+/// metadata parsers can intern concurrently without serializing.
+class InternPool {
+public:
+    static std::shared_ptr<const std::string> intern(std::string_view value) {
+        static InternPool pool;
+        if (value.empty()) return empty_string();
+
+        Shard& shard = pool.shards_[std::hash<std::string_view>{}(value) % kShardCount];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.entries.find(value);
+        if (it != shard.entries.end()) {
+            return it->second;
+        }
+
+        auto owned = std::make_shared<const std::string>(value);
+        // Key views into the pooled string itself; the shared_ptr in the
+        // value keeps that storage alive for the life of the process.
+        shard.entries.emplace(std::string_view(*owned), owned);
+        return owned;
+    }
+
+    static const std::shared_ptr<const std::string>& empty_string() {
+        static const auto empty = std::make_shared<const std::string>();
+        return empty;
+    }
+
+private:
+    InternPool() = default;
+
+    static constexpr size_t kShardCount = 16;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string_view, std::shared_ptr<const std::string>> entries;
+    };
+    std::array<Shard, kShardCount> shards_;
+};
+
+/// Value type for interned metadata fields. Behaves like a read-only
+/// std::string (converts implicitly, forwards the common accessors) but
+/// copies are refcount bumps and equality of identical values is a
+/// pointer comparison. Assignment re-interns through the pool.
+class InternedString {
+public:
+    InternedString() : str_(InternPool::empty_string()) {}
+    InternedString(std::string_view value) : str_(InternPool::intern(value)) {}
+    InternedString(const std::string& value) : str_(InternPool::intern(value)) {}
+    InternedString(const char* value) : str_(InternPool::intern(value)) {}
+
+    InternedString& operator=(std::string_view value) {
+        str_ = InternPool::intern(value);
+        return *this;
+    }
+    InternedString& operator=(const std::string& value) { return *this = std::string_view(value); }
+    InternedString& operator=(const char* value) { return *this = std::string_view(value); }
+
+    operator const std::string&() const { return *str_; }
+    [[nodiscard]] const std::string& str() const { return *str_; }
+    [[nodiscard]] std::string_view view() const { return *str_; }
+
+    // Forwarded read-only accessors used by the UI/sort/search paths
+    [[nodiscard]] bool empty() const { return str_->empty(); }
+    [[nodiscard]] size_t size() const { return str_->size(); }
+    [[nodiscard]] size_t length() const { return str_->length(); }
+    [[nodiscard]] const char* c_str() const { return str_->c_str(); }
+    [[nodiscard]] const char* data() const { return str_->data(); }
+    [[nodiscard]] std::string substr(size_t pos = 0, size_t len = std::string::npos) const {
+        return str_->substr(pos, len);
+    }
+    [[nodiscard]] size_t find(std::string_view needle, size_t pos = 0) const {
+        return str_->find(needle, pos);
+    }
+    char operator[](size_t i) const { return (*str_)[i]; }
+    [[nodiscard]] auto begin() const { return str_->begin(); }
+    [[nodiscard]] auto end() const { return str_->end(); }
+
+    // Identical interned values share one allocation, so equality is a
+    // pointer compare in the common case.
+    bool operator==(const InternedString& other) const {
+        return str_ == other.str_ || *str_ == *other.str_;
+    }
+    std::strong_ordering operator<=>(const InternedString& other) const {
+        if (str_ == other.str_) return std::strong_ordering::equal;
+        return str_->compare(*other.str_) <=> 0;
+    }
+
+    bool operator==(std::string_view other) const { return *str_ == other; }
+    std::strong_ordering operator<=>(std::string_view other) const {
+        return str_->compare(other) <=> 0;
+    }
+
+private:
+    std::shared_ptr<const std::string> str_;
+};
+
+inline std::string operator+(const InternedString& a, const std::string& b) { return a.str() + b; }
+inline std::string operator+(const std::string& a, const InternedString& b) { return a + b.str(); }
+inline std::string operator+(const InternedString& a, const char* b) { return a.str() + b; }
+inline std::string operator+(const char* a, const InternedString& b) { return a + b.str(); }
+inline std::string operator+(const InternedString& a, const InternedString& b) { return a.str() + b.str(); }
+
+inline std::ostream& operator<<(std::ostream& os, const InternedString& s) { return os << s.str(); }
+
+}  // namespace ouroboros::util
@@ -9,6 +9,11 @@ public:
     enum class Level { Debug, Info, Warn, Error };
 
     static void init();
+
+    /// Messages below this level are discarded on a single atomic
+    /// branch - no timestamp lookup, formatting or queueing
+    static void set_min_level(Level level);
+
     static void log(Level level, const std::string& message);
     static void debug(const std::string& message);
     static void info(const std::string& message);
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ouroboros::util::lz4 {
+
+/**
+ * Self-contained LZ4 block codec (the standard block format: token,
+ * literals, little-endian 16-bit offset, match run) for the library
+ * cache. The cache payload is highly redundant - paths share long
+ * directory prefixes and record structs repeat byte patterns - so even
+ * this greedy single-pass encoder cuts it several-fold, and decode is a
+ * straight memcpy loop. Kept in-tree because the codec is ~100 lines
+ * and the build takes no new dependency for it.
+ *
+ * compress_block appends to `out`; decompress_block writes exactly
+ * `dst_size` bytes or returns false (truncated/corrupt input never
+ * writes out of bounds).
+ */
+
+namespace detail {
+
+inline uint32_t read32(const char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint16_t read16(const char* p) {
+    uint16_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+constexpr int HASH_BITS = 14;
+constexpr size_t MIN_MATCH = 4;
+// Spec: the last match must end at least 5 bytes before the end and may
+// not start within the last 12 bytes; those bytes go out as literals
+constexpr size_t END_LITERALS = 5;
+constexpr size_t MATCH_START_MARGIN = 12;
+constexpr size_t MAX_OFFSET = 65535;
+
+inline uint32_t hash4(const char* p) {
+    return (read32(p) * 2654435761u) >> (32 - HASH_BITS);
+}
+
+inline void append_length(std::string& out, size_t len) {
+    while (len >= 255) {
+        out += static_cast<char>(0xFF);
+        len -= 255;
+    }
+    out += static_cast<char>(len);
+}
+
+}  // namespace detail
+
+inline void compress_block(std::string_view src, std::string& out) {
+    using namespace detail;
+    const char* base = src.data();
+    const size_t n = src.size();
+
+    // Position+1 of the last occurrence of each 4-byte hash (0 = none)
+    std::vector<uint32_t> table(size_t{1} << HASH_BITS, 0);
+
+    size_t anchor = 0;
+    size_t i = 0;
+    const size_t match_limit = n > MATCH_START_MARGIN ? n - MATCH_START_MARGIN : 0;
+    const size_t end_limit = n > END_LITERALS ? n - END_LITERALS : 0;
+
+    while (i < match_limit) {
+        const uint32_t h = hash4(base + i);
+        const size_t candidate = table[h];
+        table[h] = static_cast<uint32_t>(i + 1);
+
+        if (candidate == 0 || i - (candidate - 1) > MAX_OFFSET ||
+            read32(base + candidate - 1) != read32(base + i)) {
+            ++i;
+            continue;
+        }
+
+        const size_t match = candidate - 1;
+        size_t len = MIN_MATCH;
+        while (i + len < end_limit && base[match + len] == base[i + len]) {
+            ++len;
+        }
+
+        // Sequence: token, literal run, offset, extended match length
+        const size_t literals = i - anchor;
+        const size_t match_code = len - MIN_MATCH;
+        out += static_cast<char>(
+            (literals >= 15 ? 15u : static_cast<unsigned>(literals)) << 4 |
+            (match_code >= 15 ? 15u : static_cast<unsigned>(match_code)));
+        if (literals >= 15) append_length(out, literals - 15);
+        out.append(base + anchor, literals);
+        const uint16_t offset = static_cast<uint16_t>(i - match);
+        out += static_cast<char>(offset & 0xFF);
+        out += static_cast<char>(offset >> 8);
+        if (match_code >= 15) append_length(out, match_code - 15);
+
+        i += len;
+        anchor = i;
+    }
+
+    // Trailing literals (token with match nibble 0, no offset)
+    const size_t literals = n - anchor;
+    out += static_cast<char>(
+        (literals >= 15 ? 15u : static_cast<unsigned>(literals)) << 4);
+    if (literals >= 15) append_length(out, literals - 15);
+    out.append(base + anchor, literals);
+}
+
+[[nodiscard]] inline bool decompress_block(std::string_view src, char* dst,
+                                           size_t dst_size) {
+    using namespace detail;
+    const char* in = src.data();
+    const char* in_end = in + src.size();
+    char* out = dst;
+    char* out_end = dst + dst_size;
+
+    auto read_extended = [&](size_t base_len) -> size_t {
+        size_t len = base_len;
+        while (in < in_end) {
+            const uint8_t b = static_cast<uint8_t>(*in++);
+            len += b;
+            if (b != 255) return len;
+        }
+        return SIZE_MAX;  // Truncated length run
+    };
+
+    while (in < in_end) {
+        const uint8_t token = static_cast<uint8_t>(*in++);
+
+        size_t literals = token >> 4;
+        if (literals == 15) {
+            literals = read_extended(15);
+            if (literals == SIZE_MAX) return false;
+        }
+        if (literals > static_cast<size_t>(in_end - in) ||
+            literals > static_cast<size_t>(out_end - out)) {
+            return false;
+        }
+        std::memcpy(out, in, literals);
+        in += literals;
+        out += literals;
+
+        if (in == in_end) break;  // Final sequence carries no match
+
+        if (in_end - in < 2) return false;
+        const size_t offset = read16(in);
+        in += 2;
+        if (offset == 0 || offset > static_cast<size_t>(out - dst)) return false;
+
+        size_t match_len = (token & 0xF) + MIN_MATCH;
+        if ((token & 0xF) == 15) {
+            match_len = read_extended(match_len);
+            if (match_len == SIZE_MAX) return false;
+        }
+        if (match_len > static_cast<size_t>(out_end - out)) return false;
+
+        // Overlapping copies are the RLE case; copy byte-wise
+        const char* from = out - offset;
+        for (size_t k = 0; k < match_len; ++k) {
+            out[k] = from[k];
+        }
+        out += match_len;
+    }
+
+    return out == out_end;
+}
+
+}  // namespace ouroboros::util::lz4
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ouroboros::util {
+
+/**
+ * MappedFile: RAII read-only mmap of a whole file.
+ *
+ * Mapping the file replaces per-chunk read() syscalls with page faults:
+ * the kernel pages data in only for the regions actually touched, so
+ * readers that skip around (cache loaders, tag parsers) never pay for
+ * the bytes in between. The destructor unmaps, so every early return
+ * in the caller is safe.
+ */
+struct MappedFile {
+    void* data = nullptr;
+    size_t size = 0;
+
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        close();
+    }
+
+    void close() {
+        if (data) munmap(data, size);
+        data = nullptr;
+        size = 0;
+    }
+
+    /// Queue asynchronous readahead for the whole mapping. Returns
+    /// immediately; the kernel pages the file in behind the caller, so
+    /// a sequential parse that follows finds pages already resident
+    /// instead of faulting one readahead window at a time. On
+    /// high-latency storage (NAS mounts) that turns per-fault
+    /// round-trips into one streamed read.
+    void advise_willneed() const {
+        if (data) madvise(data, size, MADV_WILLNEED);
+    }
+
+    bool open_readonly(const std::filesystem::path& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        size = static_cast<size_t>(st.st_size);
+        data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // Mapping keeps the file alive
+        if (data == MAP_FAILED) {
+            data = nullptr;
+            return false;
+        }
+        return true;
+    }
+};
+
+}  // namespace ouroboros::util
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace ouroboros::util {
+
+/**
+ * Process-wide resident-memory accountant.
+ *
+ * Every sizeable cache (decoded artwork pixels, raw artwork bytes,
+ * thumbnail tiers, parsed metadata) registers a usage probe and,
+ * optionally, an evictor. The main loop calls enforce() on a slow
+ * housekeeping cadence; when the registered total crosses the budget,
+ * evictors run in tier order - decoded pixels first (pure cache,
+ * re-decodable from raw), raw artwork pages second, metadata last -
+ * until the overage is gone or every tier has been asked. On a small
+ * media box this is the difference between degrading gracefully and
+ * meeting the OOM killer.
+ *
+ * The per-tier gauges are plain relaxed atomics so the perf HUD reads
+ * them wait-free from the render thread; registration and enforcement
+ * are cold paths behind a mutex. Usage probes read counters the caches
+ * already maintain - enforce() never walks a cache's contents itself.
+ */
+class MemoryBudget {
+public:
+    // Declaration order is eviction order under pressure.
+    enum class Tier : size_t {
+        ArtworkPixels = 0,  // ArtworkWindow decoded slots + pixel pool
+        ArtworkRaw,         // ArtworkCache compressed originals
+        Thumbnails,         // ThumbnailStore pre-scaled tiers
+        Metadata,           // MetadataCache parsed tracks
+    };
+    static constexpr size_t NUM_TIERS = 4;
+
+    static MemoryBudget& instance() {
+        static MemoryBudget budget;
+        return budget;
+    }
+
+    /// Wire a tier to its cache. `usage` returns resident bytes now;
+    /// `evict` frees toward `bytes_needed` and reports what it actually
+    /// released (pass nothing for account-only tiers).
+    void register_tier(Tier tier,
+                       std::function<size_t()> usage,
+                       std::function<size_t(size_t)> evict = {}) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& reg = tiers_[static_cast<size_t>(tier)];
+        reg.usage = std::move(usage);
+        reg.evict = std::move(evict);
+    }
+
+    void set_budget(size_t bytes) {
+        budget_bytes_.store(bytes, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t budget() const {
+        return budget_bytes_.load(std::memory_order_relaxed);
+    }
+
+    /// Last refreshed resident bytes for one tier (HUD display).
+    [[nodiscard]] size_t tier_bytes(Tier tier) const {
+        return gauges_[static_cast<size_t>(tier)].load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t total_bytes() const {
+        size_t total = 0;
+        for (const auto& g : gauges_) total += g.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    /// Refresh the gauges from the usage probes and, if the total is
+    /// over budget, run evictors in tier order until the overage is
+    /// covered. Main-loop housekeeping cadence; not a hot path.
+    void enforce() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t total = 0;
+        for (size_t i = 0; i < NUM_TIERS; ++i) {
+            const size_t bytes = tiers_[i].usage ? tiers_[i].usage() : 0;
+            gauges_[i].store(bytes, std::memory_order_relaxed);
+            total += bytes;
+        }
+
+        const size_t limit = budget_bytes_.load(std::memory_order_relaxed);
+        if (limit == 0 || total <= limit) return;
+
+        size_t overage = total - limit;
+        for (size_t i = 0; i < NUM_TIERS && overage > 0; ++i) {
+            if (!tiers_[i].evict) continue;
+            const size_t freed = tiers_[i].evict(overage);
+            overage -= std::min(freed, overage);
+            if (tiers_[i].usage) {
+                gauges_[i].store(tiers_[i].usage(), std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Resolve the budget: an explicit config value wins; otherwise
+    /// half of the cgroup memory limit when one is set (the caches must
+    /// leave room for the decode pipeline, the library and the heap);
+    /// otherwise half of MemTotal. Returns bytes, never 0.
+    [[nodiscard]] static size_t detect_budget(size_t config_bytes) {
+        if (config_bytes > 0) return config_bytes;
+
+        // cgroup v2, then v1. "max" / huge sentinels mean unlimited.
+        constexpr uint64_t UNLIMITED = uint64_t{1} << 60;
+        for (const char* path : {"/sys/fs/cgroup/memory.max",
+                                 "/sys/fs/cgroup/memory/memory.limit_in_bytes"}) {
+            std::ifstream in(path);
+            uint64_t bytes = 0;
+            if (in && (in >> bytes) && bytes > 0 && bytes < UNLIMITED) {
+                return static_cast<size_t>(bytes / 2);
+            }
+        }
+
+        // No cgroup limit: half of physical RAM
+        std::ifstream meminfo("/proc/meminfo");
+        std::string key;
+        uint64_t kb = 0;
+        while (meminfo >> key >> kb) {
+            if (key == "MemTotal:") {
+                meminfo.ignore(64, '\n');
+                return static_cast<size_t>(kb * 1024 / 2);
+            }
+            meminfo.ignore(64, '\n');
+        }
+        return size_t{2} * 1024 * 1024 * 1024 / 2;  // Assume a 2GB box
+    }
+
+private:
+    MemoryBudget() = default;
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    struct Registration {
+        std::function<size_t()> usage;
+        std::function<size_t(size_t)> evict;
+    };
+
+    std::mutex mutex_;  // Guards tiers_; enforce() is single-caller anyway
+    std::array<Registration, NUM_TIERS> tiers_;
+    std::array<std::atomic<size_t>, NUM_TIERS> gauges_{};
+    std::atomic<size_t> budget_bytes_{0};
+};
+
+}  // namespace ouroboros::util
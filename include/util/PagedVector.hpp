@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ouroboros::util {
+
+/**
+ * Persistent chunked vector for copy-on-write snapshot state.
+ *
+ * A flat std::vector behind a COW snapshot still clones every element
+ * when one of them changes - patching loudness gains into a 180k-track
+ * library copied 180k Tracks to touch a few dozen. Here elements live
+ * in fixed-size pages held through shared_ptr: copying a PagedVector
+ * copies only the page table, so snapshot generations share every page
+ * they have in common, and mutate(i) path-copies just the page holding
+ * element i when another generation still references it. Reads are two
+ * indexed loads.
+ *
+ * Same threading discipline as the rest of the snapshot state: one
+ * owner thread mutates a given instance, sharing is only between
+ * generations that are immutable once published. A racing use_count
+ * read can at worst over-report and cause a redundant page copy.
+ */
+template <typename T>
+class PagedVector {
+public:
+    // Elements per page. Power of two so index math is a shift/mask;
+    // sized so a page of Tracks is a few KB - small enough that a
+    // single-element edit copies little, large enough that the page
+    // table stays short at million-element scale.
+    static constexpr size_t kPageSize = 32;
+
+    PagedVector() = default;
+    PagedVector(std::vector<T>&& items) { assign(std::move(items)); }
+    PagedVector& operator=(std::vector<T>&& items) {
+        assign(std::move(items));
+        return *this;
+    }
+
+    /// Rebuild from a flat vector (moves the elements in)
+    void assign(std::vector<T>&& items) {
+        pages_.clear();
+        size_ = items.size();
+        pages_.reserve((size_ + kPageSize - 1) / kPageSize);
+        for (size_t base = 0; base < items.size(); base += kPageSize) {
+            const size_t count = std::min(kPageSize, items.size() - base);
+            auto page = std::make_shared<std::vector<T>>();
+            page->reserve(kPageSize);
+            for (size_t j = 0; j < count; ++j) {
+                page->push_back(std::move(items[base + j]));
+            }
+            pages_.push_back(std::move(page));
+        }
+        items.clear();
+    }
+
+    [[nodiscard]] size_t size() const { return size_; }
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+
+    const T& operator[](size_t i) const {
+        return (*pages_[i / kPageSize])[i % kPageSize];
+    }
+
+    /// Write access: path-copies the page if another generation shares
+    /// it, then returns a mutable reference into this instance's copy
+    T& mutate(size_t i) {
+        return (*writable_page(i / kPageSize))[i % kPageSize];
+    }
+
+    void push_back(T value) {
+        const size_t p = size_ / kPageSize;
+        if (p == pages_.size()) {
+            pages_.push_back(std::make_shared<std::vector<T>>());
+            pages_.back()->reserve(kPageSize);
+        }
+        writable_page(p)->push_back(std::move(value));
+        ++size_;
+    }
+
+    void clear() {
+        pages_.clear();
+        size_ = 0;
+    }
+
+    /// Pages two instances share compare as a pointer check; only
+    /// diverged pages fall back to element comparison
+    bool operator==(const PagedVector& other) const {
+        if (size_ != other.size_) return false;
+        for (size_t p = 0; p < pages_.size(); ++p) {
+            if (pages_[p] == other.pages_[p]) continue;
+            if (*pages_[p] != *other.pages_[p]) return false;
+        }
+        return true;
+    }
+
+    // Read-only forward iteration for range-for consumers
+    class const_iterator {
+    public:
+        using value_type = T;
+        using reference = const T&;
+        using difference_type = std::ptrdiff_t;
+
+        const_iterator(const PagedVector* v, size_t i) : v_(v), i_(i) {}
+        reference operator*() const { return (*v_)[i_]; }
+        const T* operator->() const { return &(*v_)[i_]; }
+        const_iterator& operator++() {
+            ++i_;
+            return *this;
+        }
+        bool operator==(const const_iterator& other) const { return i_ == other.i_; }
+
+    private:
+        const PagedVector* v_;
+        size_t i_;
+    };
+
+    [[nodiscard]] const_iterator begin() const { return {this, 0}; }
+    [[nodiscard]] const_iterator end() const { return {this, size_}; }
+
+private:
+    std::shared_ptr<std::vector<T>>& writable_page(size_t p) {
+        auto& page = pages_[p];
+        if (page.use_count() > 1) {
+            page = std::make_shared<std::vector<T>>(*page);
+            page->reserve(kPageSize);
+        }
+        return page;
+    }
+
+    std::vector<std::shared_ptr<std::vector<T>>> pages_;
+    size_t size_ = 0;
+};
+
+}  // namespace ouroboros::util
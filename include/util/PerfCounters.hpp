@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+namespace ouroboros::util {
+
+/// Wait-free hot-path instrumentation.
+///
+/// Every probe is a handful of relaxed atomic operations on its own
+/// cache line - no locks, no allocation, no syscalls - so the probes are
+/// safe anywhere including next to the RT audio path. Each Metric has a
+/// single writer (the instrumented thread); the HUD widget reads from
+/// the render thread with relaxed loads, so values are approximate by
+/// design.
+class PerfCounters {
+public:
+    // Duration metric: last/avg/max in nanoseconds. Single writer.
+    struct Metric {
+        alignas(64) std::atomic<uint64_t> last_ns{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> samples{0};
+        std::atomic<uint64_t> max_ns{0};
+
+        void record(uint64_t ns) {
+            last_ns.store(ns, std::memory_order_relaxed);
+            total_ns.fetch_add(ns, std::memory_order_relaxed);
+            samples.fetch_add(1, std::memory_order_relaxed);
+            // Single writer: load+store race-free against ourselves
+            if (ns > max_ns.load(std::memory_order_relaxed)) {
+                max_ns.store(ns, std::memory_order_relaxed);
+            }
+        }
+
+        [[nodiscard]] uint64_t avg_ns() const {
+            uint64_t n = samples.load(std::memory_order_relaxed);
+            return n ? total_ns.load(std::memory_order_relaxed) / n : 0;
+        }
+    };
+
+    // Point-in-time value (queue depth, fill level). Any writer.
+    struct Gauge {
+        alignas(64) std::atomic<int64_t> value{0};
+
+        void set(int64_t v) { value.store(v, std::memory_order_relaxed); }
+        [[nodiscard]] int64_t get() const { return value.load(std::memory_order_relaxed); }
+    };
+
+    // Monotonic event count (underruns, drops). Single writer.
+    struct Counter {
+        alignas(64) std::atomic<uint64_t> count{0};
+
+        void increment() { count.fetch_add(1, std::memory_order_relaxed); }
+        [[nodiscard]] uint64_t get() const { return count.load(std::memory_order_relaxed); }
+    };
+
+    // Running min/max of a sampled value. Single writer.
+    struct MinMax {
+        alignas(64) std::atomic<int64_t> min{INT64_MAX};
+        std::atomic<int64_t> max{INT64_MIN};
+        std::atomic<uint64_t> samples{0};
+
+        void sample(int64_t v) {
+            // Single writer: load+store race-free against ourselves
+            if (v < min.load(std::memory_order_relaxed)) {
+                min.store(v, std::memory_order_relaxed);
+            }
+            if (v > max.load(std::memory_order_relaxed)) {
+                max.store(v, std::memory_order_relaxed);
+            }
+            samples.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool empty() const {
+            return samples.load(std::memory_order_relaxed) == 0;
+        }
+    };
+
+    // Duration distribution: bucket i counts samples lasting
+    // [2^(i-1), 2^i) microseconds (bucket 0 is sub-microsecond, the
+    // last bucket absorbs everything longer). Single writer.
+    struct Histogram {
+        static constexpr size_t BUCKETS = 12;
+        alignas(64) std::atomic<uint64_t> buckets[BUCKETS]{};
+
+        void record(uint64_t ns) {
+            const uint64_t us = ns / 1000;
+            const size_t b = us == 0
+                ? 0
+                : std::min<size_t>(std::bit_width(us), BUCKETS - 1);
+            buckets[b].fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    static PerfCounters& instance() {
+        static PerfCounters counters;
+        return counters;
+    }
+
+    Metric frame_render;        // Renderer::render wall time
+    Metric publish_hold;        // SnapshotPublisher mutex hold time
+    Gauge ring_fill_percent;    // AudioRingBuffer occupancy (0-100)
+    Gauge decode_queue_depth;   // ImageDecoderPool pending jobs
+    Gauge decode_throughput;    // Decoded audio frames/sec (approximate)
+
+    // 1 while the decode loop is feeding the ring (0 when the queue is
+    // empty or playback is paused). The scan governor reads this to
+    // decide whether ring occupancy is meaningful.
+    Gauge playback_active;
+
+    // Per-widget composition and flush-phase breakdown (written by the
+    // render thread; see Renderer::render and flush_canvas). When a
+    // frame blows its budget these say whether a widget's draw, the
+    // damage scan, the escape encoding or the PTY write ate it.
+    Metric widget_browser;        // Browser::render
+    Metric widget_album_browser;  // AlbumBrowser::render
+    Metric widget_now_playing;    // NowPlaying::render
+    Metric widget_queue;          // Queue::render
+    Metric flush_diff;            // Damage scans + scroll fast path
+    Metric flush_emit;            // Escape/glyph encoding of damaged rows
+    Metric flush_write;           // write_raw + terminal flush
+
+    // RT audio path (written by on_process on PipeWire's RT thread)
+    Metric audio_callback;          // on_process wall time
+    Histogram audio_callback_hist;  // on_process duration distribution
+    Counter audio_underruns;        // Ring exhausted mid-callback (zero-filled)
+    MinMax audio_ring_occupancy;    // Ring fill % seen entering on_process
+
+private:
+    PerfCounters() = default;
+};
+
+/// RAII probe: records elapsed wall time into a Metric on destruction.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(PerfCounters::Metric& metric)
+        : metric_(metric), start_(std::chrono::steady_clock::now()) {}
+
+    ~ScopedTimer() {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+        metric_.record(static_cast<uint64_t>(ns));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    PerfCounters::Metric& metric_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace ouroboros::util
@@ -22,6 +22,31 @@ public:
 
     [[nodiscard]] static bool is_audio_file(const std::filesystem::path& path);
     [[nodiscard]] static std::string get_audio_format(const std::filesystem::path& path);
+
+    /**
+     * Scheduling class per thread role, so bulk work can't preempt the
+     * audio decode path.
+     *
+     * AudioDecode: SCHED_FIFO at a modest priority (below PipeWire's own
+     * RT threads); without RT privileges falls back to a negative nice,
+     * and failing that runs unmodified - playback has always worked at
+     * default priority, this only hardens it.
+     *
+     * BulkWorker: SCHED_IDLE plus idle-class I/O priority. Scan shards,
+     * tag parsers and artwork decoders then consume only cycles and disk
+     * bandwidth nothing else wants.
+     *
+     * Call from inside the thread being classified.
+     */
+    enum class ThreadRole { AudioDecode, BulkWorker };
+    static void set_current_thread_role(ThreadRole role);
+
+    /**
+     * Pin the calling thread to one CPU (opt-in via config
+     * audio_cpu_affinity; -1 leaves the scheduler free). Returns false
+     * if the CPU index is invalid or the kernel refuses.
+     */
+    static bool pin_current_thread_to_cpu(int cpu);
 };
 
 }  // namespace ouroboros::util
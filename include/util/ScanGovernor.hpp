@@ -0,0 +1,84 @@
+#pragma once
+
+#include "util/PerfCounters.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace ouroboros::util {
+
+/**
+ * Adaptive parallelism governor for bulk scan work.
+ *
+ * The idle scheduling class (Platform::ThreadRole::BulkWorker) keeps
+ * scan workers off the CPU the decode thread wants, but a full-width
+ * scan still saturates the disk queue - and on formats with heavy
+ * decode cost (DSD) the ring drains faster than a contended read can
+ * refill it. The governor reads the playback telemetry already in
+ * PerfCounters and sheds scan workers when headroom shrinks:
+ *
+ *   - playback idle: all workers run
+ *   - ring >= 75% full: all workers run
+ *   - ring 50-74%: half the workers run
+ *   - ring < 50%, or an underrun in the last 2s: one worker runs
+ *
+ * Workers consult it between work items via throttle(slot, max): shed
+ * slots sleep and re-check. Slot 0 is always allowed, so a scan makes
+ * progress no matter how stressed playback is - it just stops being
+ * parallel.
+ */
+class ScanGovernor {
+public:
+    static ScanGovernor& instance() {
+        static ScanGovernor governor;
+        return governor;
+    }
+
+    /// How many of `max_workers` may run right now (always >= 1)
+    [[nodiscard]] size_t allowed_workers(size_t max_workers) {
+        auto& pc = PerfCounters::instance();
+        if (pc.playback_active.get() == 0) return max_workers;
+
+        // An underrun means the shed thresholds weren't conservative
+        // enough for this machine; drop to one worker for a cooldown
+        const uint64_t underruns = pc.audio_underruns.get();
+        const int64_t now_ms = steady_ms();
+        uint64_t prev = last_underruns_.exchange(underruns, std::memory_order_relaxed);
+        if (underruns > prev) {
+            cooldown_until_ms_.store(now_ms + UNDERRUN_COOLDOWN_MS, std::memory_order_relaxed);
+        }
+        if (now_ms < cooldown_until_ms_.load(std::memory_order_relaxed)) return 1;
+
+        const int64_t fill = pc.ring_fill_percent.get();
+        if (fill >= 75) return max_workers;
+        if (fill >= 50) return std::max<size_t>(1, max_workers / 2);
+        return 1;
+    }
+
+    /// Called by worker `slot` between work items; sleeps while shed
+    void throttle(size_t slot, size_t max_workers) {
+        while (slot >= allowed_workers(max_workers)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+        }
+    }
+
+private:
+    static constexpr int64_t UNDERRUN_COOLDOWN_MS = 2000;
+    static constexpr int64_t POLL_INTERVAL_MS = 25;
+
+    ScanGovernor() = default;
+
+    [[nodiscard]] static int64_t steady_ms() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::atomic<uint64_t> last_underruns_{0};
+    std::atomic<int64_t> cooldown_until_ms_{0};
+};
+
+}  // namespace ouroboros::util
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace ouroboros::util {
+
+/**
+ * Startup phase profiler: named span timers dumped as a
+ * chrome://tracing / Perfetto compatible JSON trace.
+ *
+ * Always compiled in so a user can capture a trace of their own cold
+ * start with `--profile-startup` and no special build. Disabled cost is
+ * one relaxed atomic load per span, so spans are safe to leave in
+ * startup paths permanently. Spans run on several threads (main,
+ * cache loader, collectors); recording takes a mutex, which is fine for
+ * the dozens of coarse phases this measures - it is not a hot-path
+ * instrument (that's PerfCounters).
+ */
+class StartupProfiler {
+public:
+    static StartupProfiler& instance() {
+        static StartupProfiler profiler;
+        return profiler;
+    }
+
+    /// Arm the profiler and set the trace epoch (call before any span)
+    void enable() {
+        epoch_ = std::chrono::steady_clock::now();
+        enabled_.store(true, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool enabled() const {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void record(std::string_view name,
+                std::chrono::steady_clock::time_point start,
+                std::chrono::steady_clock::time_point end) {
+        Span span;
+        span.name = std::string(name);
+        span.ts_us = std::chrono::duration_cast<std::chrono::microseconds>(start - epoch_).count();
+        span.dur_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        span.tid = std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFF;
+        std::lock_guard<std::mutex> lock(mutex_);
+        spans_.push_back(std::move(span));
+    }
+
+    /// Write the collected spans as a chrome://tracing JSON array.
+    /// Span names are internal identifiers (no escaping needed).
+    [[nodiscard]] bool write_trace(const std::filesystem::path& path) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::ofstream out(path, std::ios::trunc);
+        if (!out) return false;
+        out << "[\n";
+        for (size_t i = 0; i < spans_.size(); ++i) {
+            const auto& s = spans_[i];
+            out << "  {\"name\": \"" << s.name << "\", \"ph\": \"X\", \"pid\": 1"
+                << ", \"tid\": " << s.tid
+                << ", \"ts\": " << s.ts_us
+                << ", \"dur\": " << s.dur_us << "}";
+            out << (i + 1 < spans_.size() ? ",\n" : "\n");
+        }
+        out << "]\n";
+        return out.good();
+    }
+
+private:
+    struct Span {
+        std::string name;
+        int64_t ts_us = 0;   // Offset from enable() epoch
+        int64_t dur_us = 0;
+        uint64_t tid = 0;
+    };
+
+    StartupProfiler() = default;
+
+    std::atomic<bool> enabled_{false};
+    std::chrono::steady_clock::time_point epoch_{};
+    mutable std::mutex mutex_;
+    std::vector<Span> spans_;
+};
+
+/// RAII span: records [construction, destruction) under `name` when the
+/// profiler is enabled; a single relaxed load otherwise.
+class StartupSpan {
+public:
+    explicit StartupSpan(std::string_view name)
+        : armed_(StartupProfiler::instance().enabled()), name_(name) {
+        if (armed_) start_ = std::chrono::steady_clock::now();
+    }
+
+    ~StartupSpan() {
+        if (armed_) {
+            StartupProfiler::instance().record(name_, start_, std::chrono::steady_clock::now());
+        }
+    }
+
+    StartupSpan(const StartupSpan&) = delete;
+    StartupSpan& operator=(const StartupSpan&) = delete;
+
+private:
+    bool armed_;
+    std::string_view name_;  // Must outlive the span; pass literals
+    std::chrono::steady_clock::time_point start_{};
+};
+
+}  // namespace ouroboros::util
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ouroboros::util {
+
+// Process-wide shared worker pool.
+//
+// Before this existed, ImageDecoderPool and LibraryCollector's album
+// grouping each spawned hardware_concurrency() threads, so a scan while
+// browsing artwork ran 2x oversubscribed and starved the render loop.
+// All subsystems now share ONE pool sized to the core count, with two
+// priority classes: High (UI-facing artwork decodes) always dequeues
+// ahead of Low (scan/metadata work), so interactive work effectively
+// preempts background batches at task granularity.
+class TaskPool {
+public:
+    using Task = std::function<void()>;
+
+    enum class Priority {
+        High,  // UI-facing: artwork decode, anything a visible frame waits on
+        Low,   // Background: library scan, album grouping, cache maintenance
+    };
+
+    static TaskPool& instance();
+
+    ~TaskPool();
+
+    // Enqueue a task (non-blocking).
+    void submit(Priority priority, Task task);
+
+    // Fan out fn(0..count-1) across the pool and block until complete.
+    // The calling thread participates, so a saturated pool cannot stall
+    // the caller indefinitely. Work is claimed via a shared atomic index
+    // (same pattern the album-grouping loop used with raw threads).
+    void run_parallel(size_t count, const std::function<void(size_t)>& fn,
+                      Priority priority = Priority::Low);
+
+    [[nodiscard]] size_t worker_count() const { return workers_.size(); }
+
+private:
+    TaskPool();
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    void worker_thread();
+
+    std::vector<std::thread> workers_;
+
+    // Two-level queue guarded by one mutex: High drains before Low.
+    std::deque<Task> high_queue_;
+    std::deque<Task> low_queue_;
+    mutable std::mutex queue_mutex_;
+    std::condition_variable cv_;
+
+    std::atomic<bool> stop_{false};
+};
+
+}  // namespace ouroboros::util
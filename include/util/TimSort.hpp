@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <iterator>
 #include <thread>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include "Logger.hpp"
@@ -25,6 +26,9 @@ namespace detail {
 
 constexpr size_t MIN_GALLOP = 7;
 
+// Merges smaller than this are not worth splitting across threads
+constexpr size_t MIN_MERGE_SLICE = 4096;
+
 struct Run {
     size_t base;
     size_t length;
@@ -483,6 +487,40 @@ size_t count_inversions_sample(RandomIt first, RandomIt last, Compare comp, size
     return count_inversions_recursive(positions, temp, 0, sample_size - 1, first, stride, comp);
 }
 
+// Merge-path split (co-rank): how many of the first r merged outputs
+// come from the left input, matching a stable left-wins-ties merge.
+// Lets one large merge be cut into independent equal-output slices that
+// threads can process concurrently.
+template<typename RandomIt, typename Compare>
+size_t merge_split(RandomIt left, size_t n1, RandomIt right, size_t n2, size_t r, Compare comp) {
+    size_t lo = (r > n2) ? r - n2 : 0;
+    size_t hi = std::min(r, n1);
+    while (lo < hi) {
+        size_t i1 = lo + (hi - lo) / 2;
+        // right[r-i1-1] is emitted at or after left[i1] (ties go left),
+        // so the first r outputs must take more than i1 from the left
+        if (!comp(*(right + (r - i1 - 1)), *(left + i1))) {
+            lo = i1 + 1;
+        } else {
+            hi = i1;
+        }
+    }
+    return lo;
+}
+
+// First 8 key bytes packed big-endian (zero-padded), so comparing two
+// prefixes as integers matches comparing the key bytes they were packed
+// from. Prefix ties fall back to the full key, which also resolves the
+// short-key-vs-embedded-NUL ambiguity the zero padding introduces.
+inline uint64_t pack_key_prefix(const std::string& key) {
+    uint64_t prefix = 0;
+    const size_t len = std::min<size_t>(key.size(), 8);
+    for (size_t i = 0; i < len; ++i) {
+        prefix |= static_cast<uint64_t>(static_cast<unsigned char>(key[i])) << (56 - 8 * i);
+    }
+    return prefix;
+}
+
 } // namespace detail
 
 // Pattern detection: O(n) single-pass analysis with sampled inversion counting
@@ -649,27 +687,65 @@ void parallel_timsort(RandomIt first, RandomIt last, Compare comp) {
     Logger::info("Phase 1 done: " +
                  std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()) + " ms");
 
-    // Phase 2: Parallel tree merge of sorted chunks
+    // Phase 2: Parallel tree merge of sorted chunks. Each merge is cut
+    // into near-equal output slices (merge-path binary search) and the
+    // slices are claimed from a shared atomic index, so skewed levels -
+    // including the final single-pair merge - keep every core busy
+    // instead of leaving the big tail merge on one thread.
     using ValueType = typename std::iterator_traits<RandomIt>::value_type;
     std::vector<ValueType> buffer(n);
 
+    // One independent slice of a merge; all ranges are absolute indices
+    struct MergeSlice {
+        size_t left_begin, left_end;
+        size_t right_begin, right_end;
+        size_t dest;
+    };
+
     size_t merge_size = chunk_size;
     while (merge_size < n) {
-        std::vector<std::thread> merge_workers;
         size_t next_merge_size = merge_size * 2;
 
+        std::vector<MergeSlice> slices;
         for (size_t start = 0; start < n; start += next_merge_size) {
             size_t mid = std::min(start + merge_size, n);
             size_t end = std::min(start + next_merge_size, n);
 
             if (mid >= end) continue;
 
-            merge_workers.emplace_back([first, start, mid, end, &buffer, &comp]() {
-                auto left = first + start;
-                auto left_end = first + mid;
-                auto right = first + mid;
-                auto right_end = first + end;
-                auto dest = buffer.begin() + start;
+            const size_t n1 = mid - start;
+            const size_t n2 = end - mid;
+            const size_t total = n1 + n2;
+            const size_t pieces = std::min(num_threads,
+                std::max<size_t>(total / detail::MIN_MERGE_SLICE, 1));
+
+            size_t prev_i1 = 0;
+            size_t prev_r = 0;
+            for (size_t p = 1; p <= pieces; ++p) {
+                size_t r = total * p / pieces;
+                size_t i1 = (p == pieces)
+                    ? n1
+                    : detail::merge_split(first + start, n1, first + mid, n2, r, comp);
+                slices.push_back({start + prev_i1, start + i1,
+                                  mid + (prev_r - prev_i1), mid + (r - i1),
+                                  start + prev_r});
+                prev_i1 = i1;
+                prev_r = r;
+            }
+        }
+
+        std::atomic<size_t> next_slice{0};
+        auto merge_worker = [first, &buffer, &comp, &slices, &next_slice]() {
+            for (;;) {
+                size_t s = next_slice.fetch_add(1, std::memory_order_relaxed);
+                if (s >= slices.size()) break;
+                const MergeSlice& sl = slices[s];
+
+                auto left = first + sl.left_begin;
+                auto left_end = first + sl.left_end;
+                auto right = first + sl.right_begin;
+                auto right_end = first + sl.right_end;
+                auto dest = buffer.begin() + sl.dest;
 
                 while (left != left_end && right != right_end) {
                     if (comp(*right, *left)) {
@@ -684,8 +760,15 @@ void parallel_timsort(RandomIt first, RandomIt last, Compare comp) {
                 while (right != right_end) {
                     *dest++ = std::move(*right++);
                 }
-            });
+            }
+        };
+
+        std::vector<std::thread> merge_workers;
+        merge_workers.reserve(num_threads - 1);
+        for (size_t t = 1; t < num_threads && t < slices.size(); ++t) {
+            merge_workers.emplace_back(merge_worker);
         }
+        merge_worker();  // Calling thread claims slices too
 
         for (auto& w : merge_workers) {
             w.join();
@@ -715,4 +798,79 @@ void parallel_timsort(Container& c, Compare comp) {
     parallel_timsort(c.begin(), c.end(), comp);
 }
 
+/**
+ * Decorate-sort-undecorate: extract each element's sort key exactly
+ * once, sort lightweight (key, index) entries, then apply the resulting
+ * permutation. For comparators whose key extraction dominates (ICU case
+ * folding, prefix stripping), this turns O(n log n) extractions into
+ * O(n).
+ *
+ * Keys are compared bytewise. Each entry carries its first 8 key bytes
+ * packed big-endian, so most comparisons resolve on a single integer
+ * compare without touching the heap string - a fixed-size prefix pass,
+ * with the full key only breaking prefix ties.
+ *
+ * key_of(element) -> std::string. Extraction runs on multiple threads
+ * concurrently, so key_of must be thread-safe. Stable: equal keys keep
+ * their original relative order.
+ */
+template<typename T, typename KeyFn>
+void parallel_timsort_by_key(std::vector<T>& items, KeyFn&& key_of) {
+    const size_t n = items.size();
+    if (n < 2) return;
+
+    struct Entry {
+        uint64_t prefix;
+        uint32_t index;
+        std::string key;
+    };
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    // Phase 0: extract keys once, in parallel chunks
+    std::vector<Entry> entries(n);
+    {
+        const size_t num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+        const size_t chunk_size = std::max((n + num_threads - 1) / num_threads, size_t{1});
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+
+        for (size_t t = 0; t < num_threads; ++t) {
+            size_t start = t * chunk_size;
+            if (start >= n) break;
+            size_t end = std::min(start + chunk_size, n);
+
+            workers.emplace_back([&items, &entries, &key_of, start, end]() {
+                for (size_t i = start; i < end; ++i) {
+                    entries[i].key = key_of(items[i]);
+                    entries[i].prefix = detail::pack_key_prefix(entries[i].key);
+                    entries[i].index = static_cast<uint32_t>(i);
+                }
+            });
+        }
+
+        for (auto& w : workers) {
+            w.join();
+        }
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    Logger::info("parallel_timsort_by_key: extracted " + std::to_string(n) + " keys in " +
+                 std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()) + " ms");
+
+    parallel_timsort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.prefix != b.prefix) return a.prefix < b.prefix;
+        return a.key < b.key;
+    });
+
+    // Apply the permutation
+    std::vector<T> sorted;
+    sorted.reserve(n);
+    for (const auto& e : entries) {
+        sorted.push_back(std::move(items[e.index]));
+    }
+    items = std::move(sorted);
+}
+
 } // namespace ouroboros::util
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ouroboros::util {
+
+/**
+ * Inverted index from byte trigrams to item indices.
+ *
+ * Built once per library publish over the precomputed normalized search
+ * keys. A query resolves to a candidate set by intersecting the posting
+ * lists of its trigrams (rarest list first, binary-search refinement),
+ * so a search touches only items that contain every trigram of the
+ * query instead of scanning the whole library. Trigram containment is
+ * necessary but not sufficient for a substring match - callers must
+ * verify candidates with a real search (BoyerMooreSearch).
+ *
+ * Build: O(total key bytes). Query: proportional to the rarest posting
+ * list, typically a few hundred entries even for very large libraries.
+ */
+class TrigramIndex {
+public:
+    // Queries shorter than one trigram cannot use the index; callers
+    // must fall back to a linear scan.
+    static constexpr size_t MIN_QUERY_BYTES = 3;
+
+    /**
+     * Build the index over item_count items.
+     * @param key_at Returns the searchable text of an item; items with
+     *               empty keys are not indexed (and never returned).
+     */
+    void build(size_t item_count, const std::function<std::string_view(size_t)>& key_at);
+
+    [[nodiscard]] bool empty() const { return postings_.empty(); }
+    [[nodiscard]] size_t item_count() const { return item_count_; }
+
+    /**
+     * Resolve a query to candidate item indices.
+     * @param query Text normalized the same way as the indexed keys
+     * @param out Receives matching item indices in ascending order
+     *            (cleared first). Empty when some query trigram occurs
+     *            in no key.
+     * @return false if the query is too short for the index
+     */
+    bool candidates(std::string_view query, std::vector<int>& out) const;
+
+private:
+    // Three consecutive bytes packed big-endian into one word
+    static uint32_t pack(const char* p) {
+        const auto* b = reinterpret_cast<const unsigned char*>(p);
+        return (uint32_t(b[0]) << 16) | (uint32_t(b[1]) << 8) | uint32_t(b[2]);
+    }
+
+    // Posting lists are sorted ascending by construction (items are
+    // indexed in order)
+    std::unordered_map<uint32_t, std::vector<int>> postings_;
+    size_t item_count_ = 0;
+};
+
+}  // namespace ouroboros::util
@@ -1,25 +1,52 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include <unicode/unistr.h>
 #include <unicode/translit.h>
 #include <unicode/normlzr.h>
 
 namespace ouroboros::util {
 
-/// Normalize text for Unicode-aware case-insensitive search
-/// Transliterates diacritics to ASCII equivalents (Björk → bjork, José → jose)
-/// and converts to lowercase for searching
-inline std::string normalize_for_search(const std::string& text) {
-    if (text.empty()) {
-        return text;
+namespace detail {
+
+/// Word-at-a-time scan for any byte >= 0x80
+inline bool is_ascii(std::string_view s) {
+    uint64_t acc = 0;
+    size_t i = 0;
+    for (; i + 8 <= s.size(); i += 8) {
+        uint64_t word;
+        std::memcpy(&word, s.data() + i, 8);
+        acc |= word;
     }
+    for (; i < s.size(); ++i) {
+        acc |= static_cast<unsigned char>(s[i]);
+    }
+    return (acc & 0x8080808080808080ULL) == 0;
+}
 
-    // Convert UTF-8 string to ICU UnicodeString
-    icu::UnicodeString unicode_text = icu::UnicodeString::fromUTF8(text);
+/// Branchless A-Z -> a-z append. The loop body has no data-dependent
+/// branches, so the compiler vectorizes it to 16-32 bytes per iteration.
+inline void ascii_lower_append(std::string_view src, std::string& out) {
+    size_t start = out.size();
+    out.resize(start + src.size());
+    char* dst = out.data() + start;
+    for (size_t i = 0; i < src.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(src[i]);
+        dst[i] = static_cast<char>(c + ((static_cast<unsigned>(c - 'A') < 26u) << 5));
+    }
+}
 
-    // Cache Transliterator per-thread (creation is expensive - parses rules, loads Unicode tables)
-    // thread_local ensures thread safety without locking
+/// Per-thread transliterator (creation is expensive - parses rules,
+/// loads Unicode tables); thread_local avoids locking around ICU state
+inline icu::Transliterator* search_transliterator() {
     thread_local std::unique_ptr<icu::Transliterator> trans = []() {
         UErrorCode status = U_ZERO_ERROR;
         auto t = std::unique_ptr<icu::Transliterator>(
@@ -31,21 +58,126 @@ inline std::string normalize_for_search(const std::string& text) {
         );
         return U_SUCCESS(status) ? std::move(t) : nullptr;
     }();
+    return trans.get();
+}
 
-    if (!trans) {
-        // Fallback: just lowercase without transliteration
-        std::string result;
-        unicode_text.toLower().toUTF8String(result);
-        return result;
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const {
+        return std::hash<std::string_view>{}(s);
+    }
+};
+
+/// ICU path shared by normalize_for_search and normalize_many, memoized
+/// process-wide: filtering, sort keys, and album grouping normalize the
+/// same non-ASCII strings over and over at microseconds a pass. Bounded
+/// by wholesale clear, like the other rebuildable caches - an LRU isn't
+/// worth the bookkeeping for strings this cheap to recompute.
+inline std::string normalize_non_ascii(std::string_view text) {
+    static std::mutex cache_mutex;
+    static std::unordered_map<std::string, std::string,
+                              TransparentStringHash, std::equal_to<>> cache;
+    constexpr size_t MAX_CACHE_ENTRIES = 8192;
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = cache.find(text);
+        if (it != cache.end()) {
+            return it->second;
+        }
     }
 
-    // Apply transliteration
-    trans->transliterate(unicode_text);
+    icu::UnicodeString unicode_text = icu::UnicodeString::fromUTF8(
+        icu::StringPiece(text.data(), static_cast<int32_t>(text.size())));
+
+    // Apply transliteration (fallback: just lowercase without it)
+    if (icu::Transliterator* trans = search_transliterator()) {
+        trans->transliterate(unicode_text);
+    }
 
     // Convert to lowercase and back to UTF-8 std::string
     std::string result;
     unicode_text.toLower().toUTF8String(result);
 
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (cache.size() >= MAX_CACHE_ENTRIES) {
+            cache.clear();
+        }
+        cache.emplace(std::string(text), result);
+    }
+
+    return result;
+}
+
+} // namespace detail
+
+/// Normalize text for Unicode-aware case-insensitive search
+/// Transliterates diacritics to ASCII equivalents (Björk → bjork, José → jose)
+/// and converts to lowercase for searching.
+///
+/// Pure-ASCII input (most library metadata) never touches ICU: the
+/// transliterator rules are identity on ASCII, so a byte-wise tolower
+/// is the same answer at a fraction of the cost. Non-ASCII results are
+/// memoized process-wide.
+inline std::string normalize_for_search(const std::string& text) {
+    if (text.empty()) {
+        return text;
+    }
+
+    if (detail::is_ascii(text)) {
+        std::string result;
+        result.reserve(text.size());
+        detail::ascii_lower_append(text, result);
+        return result;
+    }
+
+    return detail::normalize_non_ascii(text);
+}
+
+/// Batch normalization for full-library passes: LibraryCollector's key
+/// generation normalizes every title in one sweep, and per-call overhead
+/// (thread_local fetch, memo lock) adds up at that scale. `out` is
+/// grow-only - elements are cleared, not deallocated, so capacity
+/// survives reuse across batches. ASCII inputs take the vectorized
+/// lowercase path; only the rare non-ASCII entries reach ICU.
+inline void normalize_many(std::span<const std::string_view> inputs,
+                           std::vector<std::string>& out) {
+    if (out.size() < inputs.size()) {
+        out.resize(inputs.size());
+    }
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        std::string_view s = inputs[i];
+        out[i].clear();
+        if (s.empty()) {
+            continue;
+        }
+        if (detail::is_ascii(s)) {
+            detail::ascii_lower_append(s, out[i]);
+        } else {
+            out[i] = detail::normalize_non_ascii(s);
+        }
+    }
+}
+
+inline std::vector<std::string> normalize_many(std::span<const std::string_view> inputs) {
+    std::vector<std::string> out;
+    normalize_many(inputs, out);
+    return out;
+}
+
+/// Case-fold text into a byte-comparable sort key: comparing two folded
+/// keys bytewise orders them the same way case_insensitive_compare()
+/// orders the originals. Extracting the key once per element lets sorts
+/// pay the ICU fold O(n) times instead of once per comparison.
+inline std::string case_fold_key(const std::string& text) {
+    if (text.empty()) {
+        return text;
+    }
+    icu::UnicodeString u = icu::UnicodeString::fromUTF8(text);
+    u.foldCase();
+    std::string result;
+    u.toUTF8String(result);
     return result;
 }
 
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace ouroboros::util {
+
+/**
+ * UringStatBatcher: batched statx via raw io_uring syscalls.
+ *
+ * The getdents64 walk in DirectoryScanner avoids per-entry stat for type
+ * detection, but filling file/dir mtimes still issued one synchronous
+ * stat per path — on network filesystems those serial round-trips
+ * dominate scan time. This batcher queues statx SQEs and submits
+ * hundreds of them with a single io_uring_enter, so the kernel (and an
+ * NFS server) can service them concurrently.
+ *
+ * Uses io_uring_setup/io_uring_enter directly (no liburing dependency),
+ * matching the direct-syscall approach of DirectoryScanner itself.
+ * If the kernel lacks io_uring (or it is seccomp-filtered), available()
+ * returns false and callers fall back to synchronous fstatat.
+ *
+ * Not thread-safe: one batcher per scanning thread.
+ */
+class UringStatBatcher {
+public:
+    UringStatBatcher();
+    ~UringStatBatcher();
+
+    UringStatBatcher(const UringStatBatcher&) = delete;
+    UringStatBatcher& operator=(const UringStatBatcher&) = delete;
+
+    /// False if io_uring could not be set up; use the synchronous path.
+    [[nodiscard]] bool available() const { return ring_fd_ >= 0; }
+
+    /**
+     * Queue a statx for an absolute path. The mtime is written to
+     * `out_mtime` when the batch completes (out_mtime must stay valid
+     * until flush() returns — unordered_map mapped values qualify).
+     * Submits automatically once QUEUE_DEPTH requests are pending.
+     */
+    void queue(const std::string& abs_path, std::time_t& out_mtime);
+
+    /// Submit and reap all pending requests. Must be called before
+    /// reading any of the queued mtimes.
+    void flush();
+
+private:
+    static constexpr unsigned QUEUE_DEPTH = 256;
+
+    struct Pending {
+        std::string path;        // Owns the C string the SQE points at
+        std::time_t* dest;
+        alignas(8) unsigned char statx_buf[256];  // struct statx storage
+    };
+
+    void teardown();
+
+    int ring_fd_ = -1;
+
+    // Submission queue (mmap'd kernel memory)
+    void* sq_ring_ = nullptr;
+    size_t sq_ring_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    size_t sqes_size_ = 0;
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_mask_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+
+    // Completion queue
+    void* cq_ring_ = nullptr;
+    size_t cq_ring_size_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned* cq_mask_ = nullptr;
+    io_uring_cqe* cqes_ = nullptr;
+
+    std::vector<Pending> pending_;
+};
+
+}  // namespace ouroboros::util
@@ -1,8 +1,10 @@
 #include "audio/DSDDecoder.hpp"
+#include "audio/SampleConvert.hpp"
 #include "util/Logger.hpp"
 #include <cstring>
 #include <cmath>
 #include <algorithm>
+#include <sys/mman.h>
 
 namespace audio {
 
@@ -443,15 +445,17 @@ DSDDecoder::~DSDDecoder() {
 bool DSDDecoder::open(const std::string& filepath) {
     ouroboros::util::Logger::debug("DSDDecoder: Opening file: " + filepath);
 
-    file_ = std::fopen(filepath.c_str(), "rb");
-    if (!file_) {
-        ouroboros::util::Logger::error("DSDDecoder: Failed to open file: " + filepath);
+    if (!map_.open_readonly(filepath)) {
+        ouroboros::util::Logger::error("DSDDecoder: Failed to map file: " + filepath);
         return false;
     }
 
+    // Playback walks the data chunk front to back; sequential readahead
+    // keeps the kernel paging ahead of the decode cursor
+    ::madvise(map_.data, map_.size, MADV_SEQUENTIAL);
+
     if (!parse_dsf_header()) {
-        std::fclose(file_);
-        file_ = nullptr;
+        map_.close();
         return false;
     }
 
@@ -468,8 +472,7 @@ bool DSDDecoder::open(const std::string& filepath) {
             ouroboros::util::Logger::error("DSDDecoder: Unsupported DSD rate: " +
                 std::to_string(dsd_sample_rate_) + " Hz (decimation ratio " +
                 std::to_string(decimation_ratio) + ")");
-            std::fclose(file_);
-            file_ = nullptr;
+            map_.close();
             return false;
     }
 
@@ -477,12 +480,8 @@ bool DSDDecoder::open(const std::string& filepath) {
     total_output_frames_ = static_cast<long>(total_dsd_samples_ / decimation_ratio);
     output_position_ = 0;
 
-    // Build byte lookup tables
-    if (!build_lut(coeffs, num_groups_)) {
-        std::fclose(file_);
-        file_ = nullptr;
-        return false;
-    }
+    // Reorder filter taps for contiguous processing
+    build_fir(coeffs, num_groups_);
 
     // Initialize per-channel overlap buffers (zero-filled = silence on first block)
     overlap_.resize(channels_);
@@ -494,11 +493,13 @@ bool DSDDecoder::open(const std::string& filepath) {
     block_output_frames_ = static_cast<int>((static_cast<int64_t>(block_size_) * 8) / (bytes_per_output_ * 8));
     block_frames_consumed_ = block_output_frames_; // force first read
 
-    // Allocate block buffer and per-channel data
-    block_buffer_.resize(static_cast<size_t>(block_size_) * channels_);
-    ch_data_.resize(channels_);
-    for (auto& ch : ch_data_) {
-        ch.resize(block_size_);
+    // Per-channel expansion buffers (blocks are windows into the
+    // mapping, so there is no staging copy to allocate)
+    cur_block_ = nullptr;
+    cur_block_bytes_ = 0;
+    expanded_.resize(channels_);
+    for (auto& ex : expanded_) {
+        ex.resize((static_cast<size_t>(num_groups_) - 1 + block_size_) * 8);
     }
 
     // Residual buffer
@@ -506,6 +507,12 @@ bool DSDDecoder::open(const std::string& filepath) {
     residual_frames_ = 0;
     residual_offset_ = 0;
 
+    // Start the block prefetcher and warm the first block so even the
+    // opening read_pcm never faults cold pages on the decode thread
+    prefetch_stop_.store(false, std::memory_order_relaxed);
+    prefetch_thread_ = std::thread(&DSDDecoder::prefetch_worker, this);
+    request_prefetch(read_offset_);
+
     int dsd_mult = static_cast<int>(dsd_sample_rate_ / 44100);
     ouroboros::util::Logger::info("DSDDecoder: Opened DSD" + std::to_string(dsd_mult) +
         " (" + std::to_string(dsd_sample_rate_) + " Hz) - " +
@@ -518,10 +525,19 @@ bool DSDDecoder::open(const std::string& filepath) {
 }
 
 void DSDDecoder::close() {
-    if (file_) {
-        std::fclose(file_);
-        file_ = nullptr;
+    // The prefetcher touches pages of the mapping; stop it before unmap
+    if (prefetch_thread_.joinable()) {
+        prefetch_stop_.store(true, std::memory_order_relaxed);
+        prefetch_cv_.notify_one();
+        prefetch_thread_.join();
     }
+    prefetch_pending_ = false;
+    prefetch_offset_ = 0;
+
+    map_.close();
+    read_offset_ = 0;
+    cur_block_ = nullptr;
+    cur_block_bytes_ = 0;
     channels_ = 0;
     dsd_sample_rate_ = 0;
     total_dsd_samples_ = 0;
@@ -534,10 +550,9 @@ void DSDDecoder::close() {
     output_position_ = 0;
     block_output_frames_ = 0;
     block_frames_consumed_ = 0;
-    lut_.clear();
+    fir_.clear();
     overlap_.clear();
-    block_buffer_.clear();
-    ch_data_.clear();
+    expanded_.clear();
     residual_.clear();
     residual_frames_ = 0;
     residual_offset_ = 0;
@@ -547,50 +562,50 @@ void DSDDecoder::close() {
 // DSF Header Parser
 // ============================================================================
 
-static uint32_t read_le32(FILE* f) {
-    uint8_t buf[4];
-    if (std::fread(buf, 1, 4, f) != 4) return 0;
-    return static_cast<uint32_t>(buf[0]) |
-           (static_cast<uint32_t>(buf[1]) << 8) |
-           (static_cast<uint32_t>(buf[2]) << 16) |
-           (static_cast<uint32_t>(buf[3]) << 24);
+static uint32_t read_le32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) |
+           (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
 }
 
-static uint64_t read_le64(FILE* f) {
-    uint32_t lo = read_le32(f);
-    uint32_t hi = read_le32(f);
-    return static_cast<uint64_t>(lo) | (static_cast<uint64_t>(hi) << 32);
+static uint64_t read_le64(const uint8_t* p) {
+    return static_cast<uint64_t>(read_le32(p)) |
+           (static_cast<uint64_t>(read_le32(p + 4)) << 32);
 }
 
 bool DSDDecoder::parse_dsf_header() {
-    // DSD Chunk (28 bytes)
-    char magic[4];
-    if (std::fread(magic, 1, 4, file_) != 4 ||
-        std::memcmp(magic, "DSD ", 4) != 0) {
+    const uint8_t* base = static_cast<const uint8_t*>(map_.data);
+
+    // DSD chunk (28 bytes) + fmt chunk (52 bytes) precede the data chunk
+    if (map_.size < 80) {
+        ouroboros::util::Logger::error("DSDDecoder: File too small for DSF header");
+        return false;
+    }
+
+    if (std::memcmp(base, "DSD ", 4) != 0) {
         ouroboros::util::Logger::error("DSDDecoder: Not a DSF file (bad DSD chunk magic)");
         return false;
     }
 
-    uint64_t dsd_chunk_size = read_le64(file_);
+    uint64_t dsd_chunk_size = read_le64(base + 4);
     if (dsd_chunk_size != 28) {
         ouroboros::util::Logger::error("DSDDecoder: Unexpected DSD chunk size: " +
             std::to_string(dsd_chunk_size));
         return false;
     }
 
-    /*uint64_t file_size =*/ read_le64(file_);
-    /*uint64_t metadata_offset =*/ read_le64(file_);
+    // base + 12: file size, base + 20: metadata offset (both unused)
 
-    // Format Chunk
-    if (std::fread(magic, 1, 4, file_) != 4 ||
-        std::memcmp(magic, "fmt ", 4) != 0) {
+    // Format chunk
+    if (std::memcmp(base + 28, "fmt ", 4) != 0) {
         ouroboros::util::Logger::error("DSDDecoder: Missing fmt chunk");
         return false;
     }
 
-    uint64_t fmt_chunk_size = read_le64(file_);
-    uint32_t format_version = read_le32(file_);
-    uint32_t format_id = read_le32(file_);
+    uint64_t fmt_chunk_size = read_le64(base + 32);
+    uint32_t format_version = read_le32(base + 40);
+    uint32_t format_id = read_le32(base + 44);
 
     if (format_version != 1) {
         ouroboros::util::Logger::error("DSDDecoder: Unsupported DSF format version: " +
@@ -603,13 +618,13 @@ bool DSDDecoder::parse_dsf_header() {
         return false;
     }
 
-    /*uint32_t channel_type =*/ read_le32(file_);
-    channels_ = static_cast<int>(read_le32(file_));
-    dsd_sample_rate_ = read_le32(file_);
-    /*uint32_t bits_per_sample =*/ read_le32(file_);
-    total_dsd_samples_ = read_le64(file_);
-    block_size_ = read_le32(file_);
-    /*uint32_t reserved =*/ read_le32(file_);
+    // base + 48: channel type (unused)
+    channels_ = static_cast<int>(read_le32(base + 52));
+    dsd_sample_rate_ = read_le32(base + 56);
+    // base + 60: bits per sample (unused)
+    total_dsd_samples_ = read_le64(base + 64);
+    block_size_ = read_le32(base + 72);
+    // base + 76: reserved
 
     // Validate
     if (channels_ < 1 || channels_ > 8) {
@@ -633,77 +648,152 @@ bool DSDDecoder::parse_dsf_header() {
         return false;
     }
 
-    // Skip to end of fmt chunk (in case of padding)
-    std::fseek(file_, static_cast<long>(28 + fmt_chunk_size), SEEK_SET);
-
-    // Data Chunk
-    if (std::fread(magic, 1, 4, file_) != 4 ||
-        std::memcmp(magic, "data", 4) != 0) {
+    // Data chunk follows the fmt chunk (which may carry padding)
+    const uint64_t data_hdr = 28 + fmt_chunk_size;
+    if (data_hdr + 12 > map_.size ||
+        std::memcmp(base + data_hdr, "data", 4) != 0) {
         ouroboros::util::Logger::error("DSDDecoder: Missing data chunk");
         return false;
     }
 
-    uint64_t data_chunk_size = read_le64(file_);
+    uint64_t data_chunk_size = read_le64(base + data_hdr + 4);
     data_size_ = data_chunk_size - 12; // subtract magic(4) + size(8)
-    data_offset_ = static_cast<uint64_t>(std::ftell(file_));
+    data_offset_ = data_hdr + 12;
+    // A truncated file must not walk the cursor off the mapping
+    data_size_ = std::min<uint64_t>(data_size_, map_.size - data_offset_);
+    read_offset_ = data_offset_;
 
     return true;
 }
 
 // ============================================================================
-// Byte Lookup Table Construction
+// Bit Expansion and FIR Construction
 // ============================================================================
 
-bool DSDDecoder::build_lut(const float* coeffs, int num_groups) {
-    lut_.resize(num_groups);
-
-    for (int g = 0; g < num_groups; g++) {
-        for (int byte_val = 0; byte_val < 256; byte_val++) {
-            float sum = 0.0f;
-            for (int bit = 0; bit < 8; bit++) {
-                float h = coeffs[g * 8 + bit];
-                // DSF is LSB first: bit 0 = earliest sample in byte
-                // DSD: bit=1 means +1, bit=0 means -1
-                if (byte_val & (1 << bit)) {
-                    sum += h;
-                } else {
-                    sum -= h;
-                }
-            }
-            lut_[g][byte_val] = sum;
+// byte value -> 8 samples as +/-1.0 floats. DSF is LSB first (bit 0 =
+// earliest sample in byte); DSD: bit=1 means +1, bit=0 means -1.
+static constexpr auto BIT_LUT = [] {
+    std::array<std::array<float, 8>, 256> lut{};
+    for (int byte_val = 0; byte_val < 256; byte_val++) {
+        for (int bit = 0; bit < 8; bit++) {
+            lut[byte_val][bit] = (byte_val & (1 << bit)) ? 1.0f : -1.0f;
         }
     }
-
-    return true;
+    return lut;
+}();
+
+void DSDDecoder::build_fir(const float* coeffs, int num_groups) {
+    // The coefficient tables pair group 0 with the newest byte of the
+    // window; the expanded bit buffer runs oldest-first. Reorder the taps
+    // to time order so each output sample is one contiguous dot product.
+    fir_.resize(static_cast<size_t>(num_groups) * 8);
+    for (int t = 0; t < num_groups * 8; t++) {
+        fir_[t] = coeffs[(num_groups - 1 - t / 8) * 8 + (t % 8)];
+    }
 }
 
 // ============================================================================
 // Block I/O
 // ============================================================================
 
+void DSDDecoder::request_prefetch(uint64_t offset) {
+    if (!prefetch_thread_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        prefetch_offset_ = offset;
+        prefetch_pending_ = true;
+    }
+    prefetch_cv_.notify_one();
+}
+
+void DSDDecoder::prefetch_worker() {
+    constexpr size_t PAGE = 4096;
+
+    for (;;) {
+        uint64_t offset;
+        {
+            std::unique_lock<std::mutex> lock(prefetch_mutex_);
+            prefetch_cv_.wait(lock, [this] {
+                return prefetch_pending_ ||
+                       prefetch_stop_.load(std::memory_order_relaxed);
+            });
+            if (prefetch_stop_.load(std::memory_order_relaxed)) return;
+            offset = prefetch_offset_;
+            prefetch_pending_ = false;
+        }
+
+        const uint64_t data_end = data_offset_ + data_size_;
+        if (offset >= data_end) continue;  // Past EOF: nothing to warm
+
+        const size_t block_total = static_cast<size_t>(block_size_) * channels_;
+        const size_t span = static_cast<size_t>(
+            std::min<uint64_t>(block_total, data_end - offset));
+        const uint8_t* p = static_cast<const uint8_t*>(map_.data) + offset;
+
+        // Kick kernel readahead for the whole span, then touch one byte
+        // per page: WILLNEED is advisory (NFS in particular may ignore
+        // it), the touch is the guarantee. Read-only faults race fine
+        // with the decode thread reading the same pages.
+        const uintptr_t addr = reinterpret_cast<uintptr_t>(p);
+        const uintptr_t page_start = addr & ~(PAGE - 1);
+        ::madvise(reinterpret_cast<void*>(page_start),
+                  span + (addr - page_start), MADV_WILLNEED);
+
+        for (size_t i = 0; i < span; i += PAGE) {
+            if (prefetch_stop_.load(std::memory_order_relaxed)) return;
+            (void)reinterpret_cast<const volatile uint8_t*>(p)[i];
+        }
+    }
+}
+
 bool DSDDecoder::read_next_block() {
-    // DSF interleaves: [block_size bytes ch0][block_size bytes ch1][...]
+    // DSF interleaves: [block_size bytes ch0][block_size bytes ch1][...].
+    // The block is a window into the mapping - no read syscall, no
+    // staging copy; the kernel pages it in under MADV_SEQUENTIAL.
     size_t block_total = static_cast<size_t>(block_size_) * channels_;
-    size_t bytes_read = std::fread(block_buffer_.data(), 1, block_total, file_);
+    const uint64_t data_end = data_offset_ + data_size_;
+    if (read_offset_ >= data_end) return false;
+
+    const uint8_t* base = static_cast<const uint8_t*>(map_.data);
+    size_t bytes_read = static_cast<size_t>(
+        std::min<uint64_t>(block_total, data_end - read_offset_));
 
-    if (bytes_read == 0) return false;
+    cur_block_ = base + read_offset_;
+    cur_block_bytes_ = bytes_read;
+    read_offset_ += bytes_read;
+
+    // Double-buffer: fault the NEXT block in while this one decimates
+    request_prefetch(read_offset_);
+
+    block_frames_consumed_ = 0;
 
-    // De-interleave into per-channel arrays
+    // Expand [overlap | block] to +/-1.0 floats once per block so
+    // process_block runs a contiguous dot product per output sample
+    // instead of a serial table-gather over the filter groups. Bytes
+    // past a final partial block expand as zero, matching the old
+    // staging buffer's zero-fill.
+    int overlap_len = num_groups_ - 1;
     for (int ch = 0; ch < channels_; ch++) {
+        float* dst = expanded_[ch].data();
+        const auto& overlap = overlap_[ch];
+        for (int i = 0; i < overlap_len; i++) {
+            std::memcpy(dst + static_cast<size_t>(i) * 8,
+                        BIT_LUT[overlap[i]].data(), 8 * sizeof(float));
+        }
+        dst += static_cast<size_t>(overlap_len) * 8;
         size_t src_offset = static_cast<size_t>(ch) * block_size_;
-        size_t copy_len = std::min(static_cast<size_t>(block_size_),
-                                   bytes_read > src_offset ? bytes_read - src_offset : 0);
-        if (copy_len > 0) {
-            std::memcpy(ch_data_[ch].data(), block_buffer_.data() + src_offset, copy_len);
+        size_t have = cur_block_bytes_ > src_offset
+            ? std::min(static_cast<size_t>(block_size_), cur_block_bytes_ - src_offset)
+            : 0;
+        const uint8_t* src = cur_block_ + src_offset;
+        for (size_t i = 0; i < have; i++) {
+            std::memcpy(dst + i * 8, BIT_LUT[src[i]].data(), 8 * sizeof(float));
         }
-        // Zero-fill if partial block
-        if (copy_len < static_cast<size_t>(block_size_)) {
-            std::memset(ch_data_[ch].data() + copy_len, 0, block_size_ - copy_len);
+        for (size_t i = have; i < block_size_; i++) {
+            std::memcpy(dst + i * 8, BIT_LUT[0].data(), 8 * sizeof(float));
         }
     }
 
-    block_frames_consumed_ = 0;
-
     // Recompute output frames for this block (may be less for final partial block)
     int available_bytes = static_cast<int>(bytes_read / channels_);
     block_output_frames_ = available_bytes / bytes_per_output_;
@@ -711,20 +801,6 @@ bool DSDDecoder::read_next_block() {
     return block_output_frames_ > 0;
 }
 
-// ============================================================================
-// Sample Computation via LUT
-// ============================================================================
-
-float DSDDecoder::compute_sample(const uint8_t* data, int pos) {
-    // data points to the concatenated [overlap | block_data] for one channel
-    // pos is the byte index of the newest byte for this output sample
-    float sample = 0.0f;
-    for (int g = 0; g < num_groups_; g++) {
-        sample += lut_[g][data[pos - g]];
-    }
-    return sample;
-}
-
 // ============================================================================
 // Process one block into PCM output
 // ============================================================================
@@ -735,50 +811,41 @@ int DSDDecoder::process_block(float* output, int max_frames) {
     if (frames_to_produce <= 0) return 0;
 
     int overlap_len = num_groups_ - 1;
+    const size_t taps = static_cast<size_t>(num_groups_) * 8;
 
     for (int ch = 0; ch < channels_; ch++) {
-        // Build processing buffer: [overlap | block_data]
-        // We can work with a temporary merged view
-        // For each output frame, compute_sample needs access to num_groups_ consecutive bytes
-        // The overlap covers the tail of the previous block
-
-        const auto& overlap = overlap_[ch];
-        const auto& block = ch_data_[ch];
+        const float* expanded = expanded_[ch].data();
 
         for (int f = 0; f < frames_to_produce; f++) {
             int frame_idx = block_frames_consumed_ + f;
             // The newest byte for this output sample within the block data
             int block_byte_pos = (frame_idx + 1) * bytes_per_output_ - 1;
-            // The oldest byte needed: block_byte_pos - (num_groups_ - 1)
-            // This may reach into the overlap buffer
-
-            float sample = 0.0f;
-            for (int g = 0; g < num_groups_; g++) {
-                int byte_idx = block_byte_pos - g;
-                uint8_t byte_val;
-                if (byte_idx >= 0) {
-                    byte_val = block[byte_idx];
-                } else {
-                    // Reaches into overlap from previous block
-                    int overlap_idx = overlap_len + byte_idx;
-                    byte_val = (overlap_idx >= 0) ? overlap[overlap_idx] : 0;
-                }
-                sample += lut_[g][byte_val];
-            }
+            // expanded is [overlap | block], oldest first; the window's
+            // oldest byte is block_byte_pos - overlap_len relative to the
+            // block, i.e. expanded byte block_byte_pos (never negative)
+            const float* window =
+                expanded + static_cast<size_t>(block_byte_pos) * 8;
 
             // Interleave: output[f * channels + ch]
-            output[f * channels_ + ch] = sample;
+            output[f * channels_ + ch] = dot_product(fir_.data(), window, taps);
         }
     }
 
     block_frames_consumed_ += frames_to_produce;
 
-    // If block fully consumed, save overlap for next block
+    // If block fully consumed, save overlap for next block (zero for
+    // bytes past a partial block, as the expansion did)
     if (block_frames_consumed_ >= block_output_frames_) {
         for (int ch = 0; ch < channels_; ch++) {
             int start = static_cast<int>(block_size_) - overlap_len;
             if (start >= 0) {
-                std::memcpy(overlap_[ch].data(), ch_data_[ch].data() + start, overlap_len);
+                size_t src_offset = static_cast<size_t>(ch) * block_size_ +
+                                    static_cast<size_t>(start);
+                for (int i = 0; i < overlap_len; i++) {
+                    size_t idx = src_offset + static_cast<size_t>(i);
+                    overlap_[ch][static_cast<size_t>(i)] =
+                        idx < cur_block_bytes_ ? cur_block_[idx] : 0;
+                }
             }
         }
     }
@@ -791,7 +858,7 @@ int DSDDecoder::process_block(float* output, int max_frames) {
 // ============================================================================
 
 int DSDDecoder::read_pcm(float* buffer, int max_frames) {
-    if (!file_ || !buffer || max_frames <= 0) return 0;
+    if (!map_.data || !buffer || max_frames <= 0) return 0;
 
     int frames_written = 0;
 
@@ -825,7 +892,7 @@ int DSDDecoder::read_pcm(float* buffer, int max_frames) {
 }
 
 bool DSDDecoder::seek(long frame) {
-    if (!file_) return false;
+    if (!map_.data) return false;
 
     if (frame < 0) frame = 0;
     if (frame >= total_output_frames_) frame = total_output_frames_ - 1;
@@ -839,11 +906,13 @@ bool DSDDecoder::seek(long frame) {
     int64_t file_offset = static_cast<int64_t>(data_offset_) +
                           block_index * block_size_ * channels_;
 
-    if (std::fseek(file_, static_cast<long>(file_offset), SEEK_SET) != 0) {
+    if (file_offset < 0 ||
+        static_cast<uint64_t>(file_offset) >= data_offset_ + data_size_) {
         ouroboros::util::Logger::error("DSDDecoder: Seek failed to frame " +
             std::to_string(frame));
         return false;
     }
+    read_offset_ = static_cast<uint64_t>(file_offset);
 
     // Reset filter state
     for (auto& ov : overlap_) {
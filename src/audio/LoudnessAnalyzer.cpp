@@ -0,0 +1,116 @@
+#include "audio/LoudnessAnalyzer.hpp"
+
+#include <cmath>
+#include <numbers>
+
+namespace audio {
+
+void LoudnessAnalyzer::init(int sample_rate, int channels) {
+    channels_ = channels;
+    subblock_samples_ = static_cast<size_t>(sample_rate / 10);
+
+    // BS.1770 specifies the K-weighting coefficients at 48kHz; these are
+    // the analog prototype parameters re-discretized for the actual rate
+    // (bilinear transform, same derivation libebur128 uses).
+    {
+        // Stage 1: high-frequency shelf
+        constexpr double db = 3.999843853973347;
+        constexpr double f0 = 1681.974450955533;
+        constexpr double q = 0.7071752369554196;
+        const double k = std::tan(std::numbers::pi * f0 / sample_rate);
+        const double vh = std::pow(10.0, db / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+        const double a0 = 1.0 + k / q + k * k;
+        b0_[0] = (vh + vb * k / q + k * k) / a0;
+        b1_[0] = 2.0 * (k * k - vh) / a0;
+        b2_[0] = (vh - vb * k / q + k * k) / a0;
+        a1_[0] = 2.0 * (k * k - 1.0) / a0;
+        a2_[0] = (1.0 - k / q + k * k) / a0;
+    }
+    {
+        // Stage 2: high-pass (the "RLB" curve)
+        constexpr double f0 = 38.13547087602444;
+        constexpr double q = 0.5003270373238773;
+        const double k = std::tan(std::numbers::pi * f0 / sample_rate);
+        const double a0 = 1.0 + k / q + k * k;
+        b0_[1] = 1.0;
+        b1_[1] = -2.0;
+        b2_[1] = 1.0;
+        a1_[1] = 2.0 * (k * k - 1.0) / a0;
+        a2_[1] = (1.0 - k / q + k * k) / a0;
+    }
+
+    state_.assign(static_cast<size_t>(channels) * 2, {});
+    subblock_energy_.clear();
+    current_energy_ = 0.0;
+    current_frames_ = 0;
+}
+
+void LoudnessAnalyzer::process(const float* interleaved, size_t frames) {
+    for (size_t f = 0; f < frames; ++f) {
+        double frame_energy = 0.0;
+        for (int ch = 0; ch < channels_; ch++) {
+            double x = interleaved[f * channels_ + ch];
+            // Two cascaded biquads, direct form II transposed
+            for (int s = 0; s < 2; s++) {
+                BiquadState& st = state_[static_cast<size_t>(ch) * 2 + s];
+                double y = b0_[s] * x + st.z1;
+                st.z1 = b1_[s] * x - a1_[s] * y + st.z2;
+                st.z2 = b2_[s] * x - a2_[s] * y;
+                x = y;
+            }
+            frame_energy += x * x;
+        }
+        current_energy_ += frame_energy;
+        if (++current_frames_ >= subblock_samples_) {
+            subblock_energy_.push_back(current_energy_ /
+                                       static_cast<double>(subblock_samples_));
+            current_energy_ = 0.0;
+            current_frames_ = 0;
+        }
+    }
+}
+
+double LoudnessAnalyzer::integrated_lufs() const {
+    if (subblock_energy_.size() < 4) return -HUGE_VAL;
+
+    // 400ms gating blocks with 75% overlap = every run of 4 sub-blocks
+    auto block_loudness = [](double energy) {
+        return -0.691 + 10.0 * std::log10(energy);
+    };
+
+    std::vector<double> block_energies;
+    block_energies.reserve(subblock_energy_.size() - 3);
+    for (size_t i = 0; i + 4 <= subblock_energy_.size(); ++i) {
+        double e = (subblock_energy_[i] + subblock_energy_[i + 1] +
+                    subblock_energy_[i + 2] + subblock_energy_[i + 3]) / 4.0;
+        block_energies.push_back(e);
+    }
+
+    // Absolute gate at -70 LUFS
+    double sum = 0.0;
+    size_t count = 0;
+    for (double e : block_energies) {
+        if (block_loudness(e) > -70.0) {
+            sum += e;
+            count++;
+        }
+    }
+    if (count == 0) return -HUGE_VAL;
+
+    // Relative gate 10 LU below the absolutely-gated mean
+    const double relative_threshold = block_loudness(sum / count) - 10.0;
+    sum = 0.0;
+    count = 0;
+    for (double e : block_energies) {
+        if (block_loudness(e) > relative_threshold) {
+            sum += e;
+            count++;
+        }
+    }
+    if (count == 0) return -HUGE_VAL;
+
+    return block_loudness(sum / count);
+}
+
+}  // namespace audio
@@ -33,21 +33,39 @@ bool M4ADecoder::open(const std::string& filepath) {
         return false;
     }
 
-    // Find stream info
-    ret = avformat_find_stream_info(format_ctx_, nullptr);
-    if (ret < 0) {
-        ouroboros::util::Logger::error("M4ADecoder: Failed to find stream info");
-        close();
-        return false;
-    }
-
     // Find audio stream
-    audio_stream_index_ = -1;
-    for (unsigned i = 0; i < format_ctx_->nb_streams; i++) {
-        if (format_ctx_->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_AUDIO) {
-            audio_stream_index_ = i;
-            break;
+    auto find_audio_stream = [this]() {
+        for (unsigned i = 0; i < format_ctx_->nb_streams; i++) {
+            if (format_ctx_->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_AUDIO) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    };
+    audio_stream_index_ = find_audio_stream();
+
+    // The mp4 demuxer fills codec parameters straight from the moov atom,
+    // so the packet-probing pass in avformat_find_stream_info() is
+    // normally redundant here — and on hour-long audiobook files it is
+    // most of the open() latency. Only probe when the demuxer left the
+    // parameters incomplete (streamable/fragmented oddballs).
+    bool need_probe = audio_stream_index_ < 0;
+    if (!need_probe) {
+        const AVCodecParameters* par =
+            format_ctx_->streams[audio_stream_index_]->codecpar;
+        need_probe = par->codec_id == AV_CODEC_ID_NONE ||
+                     par->sample_rate <= 0 ||
+                     par->ch_layout.nb_channels <= 0;
+    }
+    if (need_probe) {
+        ouroboros::util::Logger::debug("M4ADecoder: Incomplete stream parameters, probing");
+        ret = avformat_find_stream_info(format_ctx_, nullptr);
+        if (ret < 0) {
+            ouroboros::util::Logger::error("M4ADecoder: Failed to find stream info");
+            close();
+            return false;
         }
+        audio_stream_index_ = find_audio_stream();
     }
 
     if (audio_stream_index_ < 0) {
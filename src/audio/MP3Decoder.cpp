@@ -1,10 +1,37 @@
 #include "audio/MP3Decoder.hpp"
+#include "audio/SampleConvert.hpp"
 #include "util/Logger.hpp"
+#include "util/Platform.hpp"
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <vector>
 
 namespace audio {
 
+namespace {
+
+// Seek index sidecar format: header + raw frame offsets from
+// mpg123_index(). Invalidated by mtime or size mismatch.
+constexpr uint32_t INDEX_MAGIC = 0x4F555258;  // 'OURX'
+constexpr uint32_t INDEX_VERSION = 1;
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    int64_t file_mtime;
+    uint64_t file_size;
+    int64_t step;       // Decoded frames between stored offsets
+    uint64_t fill;      // Number of offsets
+};
+
+// Only worth persisting once the index outgrows what a fresh open
+// rebuilds for free from the stream head
+constexpr size_t MIN_PERSIST_ENTRIES = 64;
+
+}  // namespace
+
 MP3Decoder::MP3Decoder() {
     ouroboros::util::Logger::debug("MP3Decoder: Constructor called");
     // Note: mpg123_init() called once globally in MetadataParser.cpp
@@ -15,6 +42,10 @@ MP3Decoder::MP3Decoder() {
     if (handle_) {
         mpg123_param(handle_, MPG123_ADD_FLAGS, MPG123_QUIET, 0);
         ouroboros::util::Logger::debug("MP3Decoder: Enabled quiet mode to suppress console spam");
+        // Let the seek index grow without bound instead of thinning to
+        // 1000 entries; a 2-hour VBR mix needs the full-resolution index
+        // for its cached seeks to stay O(log n)
+        mpg123_param(handle_, MPG123_INDEX_SIZE, -1, 0);
     }
 }
 
@@ -67,6 +98,9 @@ bool MP3Decoder::open(const std::string& filepath) {
     total_frames_ = (length == MPG123_ERR) ? 0 : static_cast<long>(length);
 
     position_frames_ = 0;
+    filepath_ = filepath;
+    loaded_index_fill_ = 0;
+    try_load_seek_index();
 
     ouroboros::util::Logger::info("MP3Decoder: Opened successfully - " +
                        std::to_string(sample_rate_) + "Hz, " +
@@ -79,12 +113,15 @@ bool MP3Decoder::open(const std::string& filepath) {
 void MP3Decoder::close() {
     ouroboros::util::Logger::debug("MP3Decoder: Closing decoder");
     if (handle_) {
+        try_save_seek_index();  // The index lives in the handle; save first
         mpg123_close(handle_);
     }
     sample_rate_ = 0;
     channels_ = 0;
     total_frames_ = 0;
     position_frames_ = 0;
+    filepath_.clear();
+    loaded_index_fill_ = 0;
 }
 
 int MP3Decoder::read_pcm(float* buffer, int max_frames) {
@@ -134,11 +171,9 @@ int MP3Decoder::read_pcm(float* buffer, int max_frames) {
         return 0;
     }
 
-    // Convert S16 to Float [-1.0, 1.0]
+    // Convert S16 to Float [-1.0, 1.0] (vectorized kernel)
     int samples_read = bytes_read / sizeof(short);
-    for (int i = 0; i < samples_read; ++i) {
-        buffer[i] = s16_buffer[i] / 32768.0f;
-    }
+    convert_s16_to_float(s16_buffer.data(), buffer, static_cast<size_t>(samples_read));
 
     int frames_read = samples_read / channels_;
     position_frames_ += frames_read;
@@ -166,4 +201,99 @@ bool MP3Decoder::seek(long frame) {
     return true;
 }
 
+// ============================================================================
+// Seek Index Cache
+// ============================================================================
+
+std::filesystem::path MP3Decoder::index_path_for(const std::string& filepath) {
+    // FNV-1a of the path; collisions are harmless because the header's
+    // mtime+size check rejects a foreign index
+    uint64_t h = 14695981039346656037ULL;
+    for (unsigned char c : filepath) {
+        h ^= c;
+        h *= 1099511628211ULL;
+    }
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.idx",
+                  static_cast<unsigned long long>(h));
+    return ouroboros::util::Platform::get_cache_directory() / "mp3index" / name;
+}
+
+void MP3Decoder::try_load_seek_index() {
+    std::error_code ec;
+    const auto mp3_size = std::filesystem::file_size(filepath_, ec);
+    if (ec) return;
+    const auto mp3_mtime = std::filesystem::last_write_time(filepath_, ec);
+    if (ec) return;
+
+    std::ifstream in(index_path_for(filepath_), std::ios::binary);
+    if (!in) return;
+
+    IndexHeader header{};
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in || header.magic != INDEX_MAGIC || header.version != INDEX_VERSION) {
+        return;
+    }
+    if (header.file_size != mp3_size ||
+        header.file_mtime != mp3_mtime.time_since_epoch().count()) {
+        return;  // File changed; the stale index dies on the next save
+    }
+    if (header.fill == 0 || header.fill > (1u << 24) || header.step <= 0) {
+        return;
+    }
+
+    std::vector<off_t> offsets(header.fill);
+    in.read(reinterpret_cast<char*>(offsets.data()),
+            static_cast<std::streamsize>(header.fill * sizeof(off_t)));
+    if (!in) return;
+
+    if (mpg123_set_index(handle_, offsets.data(),
+                         static_cast<off_t>(header.step), header.fill) != MPG123_OK) {
+        return;
+    }
+    loaded_index_fill_ = header.fill;
+    ouroboros::util::Logger::debug("MP3Decoder: Restored seek index (" +
+                       std::to_string(header.fill) + " entries)");
+}
+
+void MP3Decoder::try_save_seek_index() {
+    if (filepath_.empty()) return;
+
+    off_t* offsets = nullptr;
+    off_t step = 0;
+    size_t fill = 0;
+    if (mpg123_index(handle_, &offsets, &step, &fill) != MPG123_OK) return;
+    // Nothing new learned this session (or nothing worth the sidecar)
+    if (!offsets || fill <= loaded_index_fill_ || fill < MIN_PERSIST_ENTRIES) {
+        return;
+    }
+
+    std::error_code ec;
+    const auto mp3_size = std::filesystem::file_size(filepath_, ec);
+    if (ec) return;
+    const auto mp3_mtime = std::filesystem::last_write_time(filepath_, ec);
+    if (ec) return;
+
+    const auto index_path = index_path_for(filepath_);
+    std::filesystem::create_directories(index_path.parent_path(), ec);
+
+    std::ofstream out(index_path, std::ios::binary | std::ios::trunc);
+    if (!out) return;
+
+    IndexHeader header{};
+    header.magic = INDEX_MAGIC;
+    header.version = INDEX_VERSION;
+    header.file_mtime = mp3_mtime.time_since_epoch().count();
+    header.file_size = mp3_size;
+    header.step = static_cast<int64_t>(step);
+    header.fill = fill;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(offsets),
+              static_cast<std::streamsize>(fill * sizeof(off_t)));
+    if (out.good()) {
+        ouroboros::util::Logger::debug("MP3Decoder: Saved seek index (" +
+                           std::to_string(fill) + " entries)");
+    }
+}
+
 } // namespace audio
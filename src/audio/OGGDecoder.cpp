@@ -1,4 +1,5 @@
 #include "audio/OGGDecoder.hpp"
+#include "audio/SampleConvert.hpp"
 #include "util/Logger.hpp"
 #include <cstring>
 #include <cstdio>
@@ -76,12 +77,10 @@ int OGGDecoder::read_pcm(float* buffer, int max_frames) {
         long ret = ov_read_float(&vf_, &pcm, max_frames - frames_read, nullptr);
         if (ret <= 0) break;  // EOF or error
 
-        // Interleave channels
-        for (int i = 0; i < ret; i++) {
-            for (int ch = 0; ch < channels_; ch++) {
-                buffer[(frames_read + i) * channels_ + ch] = pcm[ch][i];
-            }
-        }
+        // Interleave channels (vectorized for stereo)
+        interleave_planar_float(pcm, channels_,
+                                buffer + static_cast<size_t>(frames_read) * channels_,
+                                static_cast<size_t>(ret));
 
         frames_read += ret;
     }
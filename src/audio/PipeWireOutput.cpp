@@ -1,9 +1,12 @@
 #include "audio/PipeWireOutput.hpp"
 #include "util/Logger.hpp"
+#include "util/PerfCounters.hpp"
 #include <pipewire/pipewire.h>
 #include <spa/utils/result.h>
 #include <spa/param/audio/format-utils.h>
+#include <chrono>
 #include <cstring>
+#include <thread>
 #include <cmath>
 #include <algorithm>
 
@@ -11,8 +14,11 @@ namespace audio {
 
 // PipeWire RT callback: pulls audio from ring buffer, fills PipeWire buffer.
 // Runs on PipeWire's real-time thread. No allocations, no logging, no locks.
+// Telemetry is wait-free PerfCounters probes (relaxed atomics only).
 void on_process_callback(void* userdata) {
     auto* output = static_cast<PipeWireOutput*>(userdata);
+    auto& pc = ouroboros::util::PerfCounters::instance();
+    const auto t0 = std::chrono::steady_clock::now();
 
     struct pw_buffer* pw_buf = pw_stream_dequeue_buffer(output->stream_);
     if (!pw_buf) return;
@@ -29,21 +35,21 @@ void on_process_callback(void* userdata) {
     if (pw_buf->requested > 0)
         max_frames = std::min(max_frames, static_cast<size_t>(pw_buf->requested));
 
-    // Pull from ring buffer
-    size_t frames_read = output->ring_.read(dst, max_frames);
-
-    // Apply volume scaling in-place
-    int vol = output->volume_.load(std::memory_order_relaxed);
-    if (vol != 100 && frames_read > 0) {
-        float scale = vol / 100.0f;
-        size_t total_samples = frames_read * output->channels_;
-        for (size_t i = 0; i < total_samples; ++i) {
-            dst[i] *= scale;
-        }
+    // Occupancy entering the callback: a shrinking minimum warns of an
+    // underrun before it happens
+    if (size_t cap = output->ring_.capacity_frames(); cap > 0) {
+        pc.audio_ring_occupancy.sample(static_cast<int64_t>(
+            output->ring_.read_available_frames() * 100 / cap));
     }
 
+    // Pull from ring buffer with the volume gain folded into the copy
+    // (SIMD; at 100% the copy degrades to memcpy)
+    const float gain = output->volume_.load(std::memory_order_relaxed) / 100.0f;
+    size_t frames_read = output->ring_.read(dst, max_frames, gain);
+
     // Underrun: fill remainder with silence
     if (frames_read < max_frames) {
+        pc.audio_underruns.increment();
         size_t silence_start = frames_read * output->channels_;
         size_t silence_count = (max_frames - frames_read) * output->channels_;
         std::memset(dst + silence_start, 0, silence_count * sizeof(float));
@@ -56,6 +62,22 @@ void on_process_callback(void* userdata) {
 
     pw_buf->size = frames_read;
     pw_stream_queue_buffer(output->stream_, pw_buf);
+
+    // Low-watermark wake: once the ring drains below the watermark,
+    // nudge the decode thread ahead of its polling timeout. The exchange
+    // suppresses repeat notifies; notify_one without holding the mutex
+    // keeps this path lock-free
+    size_t watermark = output->low_watermark_frames_.load(std::memory_order_relaxed);
+    if (watermark > 0 && output->ring_.read_available_frames() < watermark &&
+        !output->writable_signal_.exchange(true, std::memory_order_release)) {
+        output->wake_cv_.notify_one();
+    }
+
+    const auto ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - t0).count());
+    pc.audio_callback.record(ns);
+    pc.audio_callback_hist.record(ns);
 }
 
 static const struct pw_stream_events stream_events = {
@@ -73,6 +95,14 @@ static const struct pw_stream_events stream_events = {
     .trigger_done = nullptr,
 };
 
+// Ring depth is a fixed time target, not a frame count (see init_stream)
+static constexpr int RING_TARGET_MS = 200;
+
+static size_t ring_frames_for(int sample_rate) {
+    return std::max<size_t>(
+        static_cast<size_t>(sample_rate) * RING_TARGET_MS / 1000, 4096);
+}
+
 PipeWireOutput::PipeWireOutput() {
 }
 
@@ -81,9 +111,19 @@ PipeWireOutput::~PipeWireOutput() {
 }
 
 bool PipeWireOutput::init(PipeWireContext& context, int sample_rate, int channels) {
+    return init_stream(context, sample_rate, channels, true);
+}
+
+bool PipeWireOutput::prewarm(PipeWireContext& context, int sample_rate, int channels) {
+    return init_stream(context, sample_rate, channels, false);
+}
+
+bool PipeWireOutput::init_stream(PipeWireContext& context, int sample_rate,
+                                 int channels, bool start_active) {
     ouroboros::util::Logger::debug("PipeWireOutput: Initializing (" +
                                    std::to_string(sample_rate) + "Hz, " +
-                                   std::to_string(channels) + "ch)");
+                                   std::to_string(channels) + "ch" +
+                                   (start_active ? ")" : ", pre-warmed/corked)"));
 
     if (stream_) {
         ouroboros::util::Logger::debug("PipeWireOutput: Already initialized, skipping");
@@ -94,8 +134,13 @@ bool PipeWireOutput::init(PipeWireContext& context, int sample_rate, int channel
     sample_rate_ = sample_rate;
     channels_ = channels;
 
-    // Initialize ring buffer: 8192 frames capacity
-    ring_.init(8192, channels);
+    // Size the ring for a fixed time depth rather than a fixed frame
+    // count: 8192 frames is ~186ms at 44.1kHz but only ~21ms at 384kHz,
+    // which underruns whenever the decode thread stalls behind a scan.
+    // The decode thread refills once occupancy drops below a quarter of
+    // that depth (see wait_until_writable).
+    ring_.init(ring_frames_for(sample_rate), channels);
+    low_watermark_frames_.store(ring_.capacity_frames() / 4, std::memory_order_relaxed);
 
     struct pw_thread_loop* loop = context_->get_loop();
     if (!loop) {
@@ -137,18 +182,22 @@ bool PipeWireOutput::init(PipeWireContext& context, int sample_rate, int channel
     const struct spa_pod* params[1];
     params[0] = spa_format_audio_raw_build(&builder, SPA_PARAM_EnumFormat, &info);
 
+    // A pre-warmed stream connects INACTIVE: the graph negotiates the
+    // format and allocates buffers, but on_process stays silent until
+    // the first play-press flips the cork
+    uint32_t flags = PW_STREAM_FLAG_AUTOCONNECT | PW_STREAM_FLAG_MAP_BUFFERS;
+    if (!start_active) flags |= PW_STREAM_FLAG_INACTIVE;
+
     int result = pw_stream_connect(
         stream_,
         PW_DIRECTION_OUTPUT,
         PW_ID_ANY,
-        static_cast<pw_stream_flags>(
-            PW_STREAM_FLAG_AUTOCONNECT |
-            PW_STREAM_FLAG_MAP_BUFFERS
-        ),
+        static_cast<pw_stream_flags>(flags),
         params, 1
     );
 
     pw_thread_loop_unlock(loop);
+    paused_ = !start_active;
 
     if (result < 0) {
         ouroboros::util::Logger::error("PipeWireOutput: Stream connect failed (result=" +
@@ -157,12 +206,40 @@ bool PipeWireOutput::init(PipeWireContext& context, int sample_rate, int channel
         return false;
     }
 
-    ouroboros::util::Logger::info("PipeWireOutput: Initialized successfully (pull model, ring buffer 8192 frames)");
+    ouroboros::util::Logger::info("PipeWireOutput: Initialized successfully (pull model, ring buffer " +
+                                  std::to_string(ring_.capacity_frames()) + " frames / ~" +
+                                  std::to_string(RING_TARGET_MS) + "ms)");
     return true;
 }
 
 void PipeWireOutput::close() {
     ouroboros::util::Logger::debug("PipeWireOutput: Closing output");
+
+    // The stream lives across tracks, so teardown is effectively session
+    // end: dump the telemetry on_process accumulated for glitch forensics
+    auto& pc = ouroboros::util::PerfCounters::instance();
+    if (stream_ && pc.audio_callback.samples.load(std::memory_order_relaxed) > 0) {
+        std::string hist;
+        for (size_t i = 0; i < ouroboros::util::PerfCounters::Histogram::BUCKETS; ++i) {
+            if (i > 0) hist += "/";
+            hist += std::to_string(
+                pc.audio_callback_hist.buckets[i].load(std::memory_order_relaxed));
+        }
+        std::string occupancy = pc.audio_ring_occupancy.empty()
+            ? "n/a"
+            : std::to_string(pc.audio_ring_occupancy.min.load(std::memory_order_relaxed)) +
+              "-" +
+              std::to_string(pc.audio_ring_occupancy.max.load(std::memory_order_relaxed)) + "%";
+        ouroboros::util::Logger::info(
+            "PipeWireOutput: Session stats - underruns=" +
+            std::to_string(pc.audio_underruns.get()) +
+            ", callback avg=" + std::to_string(pc.audio_callback.avg_ns() / 1000) +
+            "us max=" +
+            std::to_string(pc.audio_callback.max_ns.load(std::memory_order_relaxed) / 1000) +
+            "us, ring occupancy " + occupancy +
+            ", callback hist(pow2 us)=" + hist);
+    }
+
     if (stream_ && context_ && context_->get_loop()) {
         struct pw_thread_loop* loop = context_->get_loop();
 
@@ -183,10 +260,94 @@ void PipeWireOutput::close() {
     channels_ = 0;
 }
 
+bool PipeWireOutput::reconfigure(int sample_rate, int channels) {
+    if (!stream_ || !context_ || !context_->get_loop()) return false;
+
+    if (sample_rate == sample_rate_ && channels == channels_) {
+        pause(false);  // Same format: just make sure the cork is out
+        return true;
+    }
+
+    ouroboros::util::Logger::debug("PipeWireOutput: Reconfiguring in place (" +
+                                   std::to_string(sample_rate_) + "Hz/" +
+                                   std::to_string(channels_) + "ch -> " +
+                                   std::to_string(sample_rate) + "Hz/" +
+                                   std::to_string(channels) + "ch)");
+
+    struct pw_thread_loop* loop = context_->get_loop();
+
+    // Holding the loop lock serializes against on_process, so the ring
+    // can be resized without the RT thread observing a torn state
+    pw_thread_loop_lock(loop);
+    pw_stream_set_active(stream_, false);
+
+    sample_rate_ = sample_rate;
+    channels_ = channels;
+    ring_.init(ring_frames_for(sample_rate), channels);
+    low_watermark_frames_.store(ring_.capacity_frames() / 4, std::memory_order_relaxed);
+
+    uint8_t buffer[1024];
+    struct spa_pod_builder builder = SPA_POD_BUILDER_INIT(buffer, sizeof(buffer));
+
+    struct spa_audio_info_raw info = {};
+    info.format = SPA_AUDIO_FORMAT_F32;
+    info.channels = static_cast<uint32_t>(channels_);
+    info.rate = static_cast<uint32_t>(sample_rate_);
+
+    const struct spa_pod* params[1];
+    params[0] = spa_format_audio_raw_build(&builder, SPA_PARAM_EnumFormat, &info);
+
+    int result = pw_stream_update_params(stream_, params, 1);
+    if (result < 0) {
+        // Stream is left intact but corked; the caller rebuilds it
+        pw_thread_loop_unlock(loop);
+        paused_ = true;
+        ouroboros::util::Logger::warn("PipeWireOutput: update_params failed (result=" +
+                                      std::to_string(result) + ")");
+        return false;
+    }
+
+    pw_stream_set_active(stream_, true);
+    pw_thread_loop_unlock(loop);
+    paused_ = false;
+
+    ouroboros::util::Logger::info("PipeWireOutput: Reconfigured in place (ring " +
+                                  std::to_string(ring_.capacity_frames()) + " frames)");
+    return true;
+}
+
 void PipeWireOutput::flush_ring() {
     ring_.reset();
 }
 
+void PipeWireOutput::wait_until_writable(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(wake_mutex_);
+    wake_cv_.wait_for(lock, timeout, [this] {
+        return writable_signal_.load(std::memory_order_acquire);
+    });
+    writable_signal_.store(false, std::memory_order_relaxed);
+}
+
+void PipeWireOutput::drain(std::chrono::milliseconds timeout) {
+    if (!stream_ || paused_) return;
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (ring_.read_available_frames() > 0 &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // The ring is empty but on_process already queued up to a quantum
+    // into the device; ask the stream to play that out too
+    if (context_ && context_->get_loop()) {
+        struct pw_thread_loop* loop = context_->get_loop();
+        pw_thread_loop_lock(loop);
+        pw_stream_flush(stream_, true);
+        pw_thread_loop_unlock(loop);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
 void PipeWireOutput::set_volume(int percent) {
     int new_volume = std::clamp(percent, 0, 100);
     int old_volume = volume_.load(std::memory_order_relaxed);
@@ -0,0 +1,137 @@
+#include "audio/Resampler.hpp"
+#include "audio/SampleConvert.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace audio {
+
+void Resampler::configure(int src_rate, int dst_rate, int channels) {
+    if (src_rate == src_rate_ && dst_rate == dst_rate_ && channels == channels_) {
+        return;  // Same conversion: keep history across the boundary
+    }
+
+    src_rate_ = src_rate;
+    dst_rate_ = dst_rate;
+    channels_ = channels;
+    step_ = (src_rate > 0 && dst_rate > 0)
+        ? static_cast<double>(src_rate) / static_cast<double>(dst_rate)
+        : 1.0;
+
+    history_.assign(static_cast<size_t>(std::max(channels, 0)), {});
+    if (active()) {
+        build_filter_bank();
+    }
+    reset();
+}
+
+void Resampler::reset() {
+    // Prime with a window of silence so the first output frame has a
+    // full TAPS span to convolve (costs TAPS/2 samples of group delay,
+    // well under a millisecond at audio rates)
+    for (auto& h : history_) {
+        h.assign(TAPS - 1, 0.0f);
+    }
+    pos_ = 0.0;
+}
+
+void Resampler::build_filter_bank() {
+    bank_.assign(static_cast<size_t>(PHASES) * TAPS, 0.0f);
+
+    // Cutoff sits below the narrower of the two Nyquist frequencies;
+    // the 0.9 factor leaves transition-band headroom a 32-tap window
+    // needs to reach its stopband before aliases fold back
+    const double fc = 0.9 * std::min(
+        1.0, static_cast<double>(dst_rate_) / static_cast<double>(src_rate_));
+    constexpr double kPi = 3.14159265358979323846;
+
+    for (int p = 0; p < PHASES; ++p) {
+        const double frac = static_cast<double>(p) / PHASES;
+        float* coeff = &bank_[static_cast<size_t>(p) * TAPS];
+        double sum = 0.0;
+
+        for (int k = 0; k < TAPS; ++k) {
+            // Source offset of tap k from the output point
+            const double x = static_cast<double>(k - (TAPS / 2 - 1)) - frac;
+            const double a = kPi * fc * x;
+            const double sinc = (std::abs(a) < 1e-12) ? 1.0 : std::sin(a) / a;
+
+            // Blackman-Harris window over the tap span
+            const double u = (x + TAPS / 2) / TAPS;  // [0, 1] across the window
+            const double w = 0.35875
+                - 0.48829 * std::cos(2.0 * kPi * u)
+                + 0.14128 * std::cos(4.0 * kPi * u)
+                - 0.01168 * std::cos(6.0 * kPi * u);
+
+            const double v = fc * sinc * w;
+            coeff[k] = static_cast<float>(v);
+            sum += v;
+        }
+
+        // Unity DC gain per phase, otherwise the gain ripples at the
+        // phase rate and modulates the signal audibly
+        if (sum != 0.0) {
+            const float norm = static_cast<float>(1.0 / sum);
+            for (int k = 0; k < TAPS; ++k) coeff[k] *= norm;
+        }
+    }
+}
+
+size_t Resampler::max_output_frames(size_t in_frames) const {
+    if (!active()) return in_frames;
+    return static_cast<size_t>(static_cast<double>(in_frames) / step_) + TAPS + 2;
+}
+
+size_t Resampler::process(const float* in, size_t in_frames, std::vector<float>& out) {
+    if (!active()) {
+        out.insert(out.end(), in, in + in_frames * static_cast<size_t>(channels_));
+        return in_frames;
+    }
+    if (in_frames == 0 || channels_ <= 0) return 0;
+
+    // Deinterleave the chunk onto each channel's history tail
+    for (int c = 0; c < channels_; ++c) {
+        auto& h = history_[static_cast<size_t>(c)];
+        h.reserve(h.size() + in_frames);
+        for (size_t f = 0; f < in_frames; ++f) {
+            h.push_back(in[f * static_cast<size_t>(channels_) + static_cast<size_t>(c)]);
+        }
+    }
+
+    const size_t available = history_[0].size();
+    size_t produced = 0;
+    double pos = pos_;
+
+    // The output frame at source position pos convolves the TAPS
+    // history samples starting at floor(pos)
+    while (static_cast<size_t>(pos) + TAPS <= available) {
+        size_t base = static_cast<size_t>(pos);
+        const double frac = pos - static_cast<double>(base);
+        int phase = static_cast<int>(frac * PHASES + 0.5);
+        if (phase >= PHASES) {  // frac rounded up to the next sample
+            phase = 0;
+            ++base;
+            if (base + TAPS > available) break;
+        }
+
+        const float* coeff = &bank_[static_cast<size_t>(phase) * TAPS];
+        for (int c = 0; c < channels_; ++c) {
+            out.push_back(dot_product(
+                coeff, history_[static_cast<size_t>(c)].data() + base, TAPS));
+        }
+        ++produced;
+        pos += step_;
+    }
+
+    // Drop history no future output frame can reach
+    const size_t keep_from = std::min(static_cast<size_t>(pos), available);
+    if (keep_from > 0) {
+        for (auto& h : history_) {
+            h.erase(h.begin(), h.begin() + static_cast<std::ptrdiff_t>(keep_from));
+        }
+        pos -= static_cast<double>(keep_from);
+    }
+    pos_ = pos;
+    return produced;
+}
+
+}  // namespace audio
@@ -0,0 +1,390 @@
+#include "audio/SampleConvert.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace audio {
+
+namespace {
+
+constexpr float S16_SCALE = 1.0f / 32768.0f;
+
+void s16_to_float_scalar(const short* in, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = in[i] * S16_SCALE;
+    }
+}
+
+#if defined(__x86_64__)
+
+// 16 samples per iteration. Compiled for AVX2 regardless of the build's
+// baseline; only called after the runtime check.
+__attribute__((target("avx2")))
+void s16_to_float_avx2(const short* in, float* out, size_t count) {
+    const __m256 scale = _mm256_set1_ps(S16_SCALE);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(s));
+        __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(s, 1));
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+        _mm256_storeu_ps(out + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    }
+    s16_to_float_scalar(in + i, out + i, count - i);
+}
+
+// 8 samples per iteration; SSE2 is part of the x86-64 baseline. Sign
+// extension via unpack-with-self plus arithmetic shift.
+void s16_to_float_sse2(const short* in, float* out, size_t count) {
+    const __m128 scale = _mm_set1_ps(S16_SCALE);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+    s16_to_float_scalar(in + i, out + i, count - i);
+}
+
+#elif defined(__aarch64__)
+
+// 8 samples per iteration
+void s16_to_float_neon(const short* in, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        int16x8_t s = vld1q_s16(in + i);
+        int32x4_t lo = vmovl_s16(vget_low_s16(s));
+        int32x4_t hi = vmovl_s16(vget_high_s16(s));
+        vst1q_f32(out + i, vmulq_n_f32(vcvtq_f32_s32(lo), S16_SCALE));
+        vst1q_f32(out + i + 4, vmulq_n_f32(vcvtq_f32_s32(hi), S16_SCALE));
+    }
+    s16_to_float_scalar(in + i, out + i, count - i);
+}
+
+#endif
+
+void interleave_stereo_scalar(const float* left, const float* right,
+                              float* out, size_t frames) {
+    for (size_t i = 0; i < frames; ++i) {
+        out[i * 2] = left[i];
+        out[i * 2 + 1] = right[i];
+    }
+}
+
+#if defined(__x86_64__)
+
+// 4 frames (8 output floats) per iteration via unpack
+void interleave_stereo_sse(const float* left, const float* right,
+                           float* out, size_t frames) {
+    size_t i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        __m128 l = _mm_loadu_ps(left + i);
+        __m128 r = _mm_loadu_ps(right + i);
+        _mm_storeu_ps(out + i * 2, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(out + i * 2 + 4, _mm_unpackhi_ps(l, r));
+    }
+    interleave_stereo_scalar(left + i, right + i, out + i * 2, frames - i);
+}
+
+#elif defined(__aarch64__)
+
+// 4 frames per iteration; vst2 does the interleave in the store
+void interleave_stereo_neon(const float* left, const float* right,
+                            float* out, size_t frames) {
+    size_t i = 0;
+    for (; i + 4 <= frames; i += 4) {
+        float32x4x2_t lr{vld1q_f32(left + i), vld1q_f32(right + i)};
+        vst2q_f32(out + i * 2, lr);
+    }
+    interleave_stereo_scalar(left + i, right + i, out + i * 2, frames - i);
+}
+
+#endif
+
+void copy_gain_scalar(const float* in, float* out, size_t count, float gain) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = in[i] * gain;
+    }
+}
+
+#if defined(__x86_64__)
+
+// 16 samples per iteration
+__attribute__((target("avx2")))
+void copy_gain_avx2(const float* in, float* out, size_t count, float gain) {
+    const __m256 g = _mm256_set1_ps(gain);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(in + i), g));
+        _mm256_storeu_ps(out + i + 8, _mm256_mul_ps(_mm256_loadu_ps(in + i + 8), g));
+    }
+    copy_gain_scalar(in + i, out + i, count - i, gain);
+}
+
+// 8 samples per iteration
+void copy_gain_sse2(const float* in, float* out, size_t count, float gain) {
+    const __m128 g = _mm_set1_ps(gain);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(in + i), g));
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_loadu_ps(in + i + 4), g));
+    }
+    copy_gain_scalar(in + i, out + i, count - i, gain);
+}
+
+#elif defined(__aarch64__)
+
+// 8 samples per iteration
+void copy_gain_neon(const float* in, float* out, size_t count, float gain) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        vst1q_f32(out + i, vmulq_n_f32(vld1q_f32(in + i), gain));
+        vst1q_f32(out + i + 4, vmulq_n_f32(vld1q_f32(in + i + 4), gain));
+    }
+    copy_gain_scalar(in + i, out + i, count - i, gain);
+}
+
+#endif
+
+float dot_scalar(const float* a, const float* b, size_t count) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+#if defined(__x86_64__)
+
+// 16 elements per iteration, two independent FMA accumulators to hide
+// the FMA latency chain.
+__attribute__((target("avx2,fma")))
+float dot_avx2(const float* a, const float* b, size_t count) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i),
+                               _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8),
+                               _mm256_loadu_ps(b + i + 8), acc1);
+    }
+    __m256 acc = _mm256_add_ps(acc0, acc1);
+    __m128 lo = _mm_add_ps(_mm256_castps256_ps128(acc),
+                           _mm256_extractf128_ps(acc, 1));
+    lo = _mm_add_ps(lo, _mm_movehl_ps(lo, lo));
+    lo = _mm_add_ss(lo, _mm_shuffle_ps(lo, lo, 1));
+    return _mm_cvtss_f32(lo) + dot_scalar(a + i, b + i, count - i);
+}
+
+// 8 elements per iteration
+float dot_sse2(const float* a, const float* b, size_t count) {
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = _mm_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i),
+                                           _mm_loadu_ps(b + i)));
+        acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4),
+                                           _mm_loadu_ps(b + i + 4)));
+    }
+    __m128 acc = _mm_add_ps(acc0, acc1);
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    return _mm_cvtss_f32(acc) + dot_scalar(a + i, b + i, count - i);
+}
+
+#elif defined(__aarch64__)
+
+// 8 elements per iteration
+float dot_neon(const float* a, const float* b, size_t count) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    return vaddvq_f32(vaddq_f32(acc0, acc1)) +
+           dot_scalar(a + i, b + i, count - i);
+}
+
+#endif
+
+void crossfade_scalar(float* out, const float* in, size_t count,
+                      float t, float dt) {
+    for (size_t i = 0; i < count; ++i) {
+        float tc = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        out[i] = out[i] * std::sqrt(1.0f - tc) + in[i] * std::sqrt(tc);
+        t += dt;
+    }
+}
+
+#if defined(__x86_64__)
+
+// 8 elements per iteration; the per-lane ramp advances by 8*dt each
+// loop so the gains stay in lockstep with the scalar version.
+__attribute__((target("avx2,fma")))
+void crossfade_avx2(float* out, const float* in, size_t count,
+                    float t, float dt) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 step = _mm256_set1_ps(dt * 8.0f);
+    __m256 tv = _mm256_add_ps(
+        _mm256_set1_ps(t),
+        _mm256_mul_ps(_mm256_set1_ps(dt),
+                      _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7)));
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 tc = _mm256_min_ps(_mm256_max_ps(tv, zero), one);
+        __m256 mixed = _mm256_fmadd_ps(
+            _mm256_loadu_ps(in + i), _mm256_sqrt_ps(tc),
+            _mm256_mul_ps(_mm256_loadu_ps(out + i),
+                          _mm256_sqrt_ps(_mm256_sub_ps(one, tc))));
+        _mm256_storeu_ps(out + i, mixed);
+        tv = _mm256_add_ps(tv, step);
+    }
+    crossfade_scalar(out + i, in + i, count - i, t + dt * i, dt);
+}
+
+// 4 elements per iteration
+void crossfade_sse2(float* out, const float* in, size_t count,
+                    float t, float dt) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 step = _mm_set1_ps(dt * 4.0f);
+    __m128 tv = _mm_add_ps(_mm_set1_ps(t),
+                           _mm_mul_ps(_mm_set1_ps(dt),
+                                      _mm_setr_ps(0, 1, 2, 3)));
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 tc = _mm_min_ps(_mm_max_ps(tv, zero), one);
+        __m128 mixed = _mm_add_ps(
+            _mm_mul_ps(_mm_loadu_ps(in + i), _mm_sqrt_ps(tc)),
+            _mm_mul_ps(_mm_loadu_ps(out + i),
+                       _mm_sqrt_ps(_mm_sub_ps(one, tc))));
+        _mm_storeu_ps(out + i, mixed);
+        tv = _mm_add_ps(tv, step);
+    }
+    crossfade_scalar(out + i, in + i, count - i, t + dt * i, dt);
+}
+
+#elif defined(__aarch64__)
+
+// 4 elements per iteration
+void crossfade_neon(float* out, const float* in, size_t count,
+                    float t, float dt) {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t step = vdupq_n_f32(dt * 4.0f);
+    const float ramp[4] = {0.0f, dt, dt * 2.0f, dt * 3.0f};
+    float32x4_t tv = vaddq_f32(vdupq_n_f32(t), vld1q_f32(ramp));
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t tc = vminq_f32(vmaxq_f32(tv, zero), one);
+        float32x4_t mixed = vfmaq_f32(
+            vmulq_f32(vld1q_f32(out + i), vsqrtq_f32(vsubq_f32(one, tc))),
+            vld1q_f32(in + i), vsqrtq_f32(tc));
+        vst1q_f32(out + i, mixed);
+        tv = vaddq_f32(tv, step);
+    }
+    crossfade_scalar(out + i, in + i, count - i, t + dt * i, dt);
+}
+
+#endif
+
+}  // namespace
+
+void convert_s16_to_float(const short* in, float* out, size_t count) {
+#if defined(__x86_64__)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        s16_to_float_avx2(in, out, count);
+    } else {
+        s16_to_float_sse2(in, out, count);
+    }
+#elif defined(__aarch64__)
+    s16_to_float_neon(in, out, count);
+#else
+    s16_to_float_scalar(in, out, count);
+#endif
+}
+
+void interleave_planar_float(const float* const* planes, int channels,
+                             float* out, size_t frames) {
+    if (channels == 2) {
+#if defined(__x86_64__)
+        interleave_stereo_sse(planes[0], planes[1], out, frames);
+#elif defined(__aarch64__)
+        interleave_stereo_neon(planes[0], planes[1], out, frames);
+#else
+        interleave_stereo_scalar(planes[0], planes[1], out, frames);
+#endif
+        return;
+    }
+
+    for (size_t i = 0; i < frames; ++i) {
+        for (int ch = 0; ch < channels; ++ch) {
+            out[i * channels + ch] = planes[ch][i];
+        }
+    }
+}
+
+void copy_with_gain(const float* in, float* out, size_t count, float gain) {
+    if (gain == 1.0f) {
+        std::memcpy(out, in, count * sizeof(float));
+        return;
+    }
+#if defined(__x86_64__)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        copy_gain_avx2(in, out, count, gain);
+    } else {
+        copy_gain_sse2(in, out, count, gain);
+    }
+#elif defined(__aarch64__)
+    copy_gain_neon(in, out, count, gain);
+#else
+    copy_gain_scalar(in, out, count, gain);
+#endif
+}
+
+float dot_product(const float* a, const float* b, size_t count) {
+#if defined(__x86_64__)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        return dot_avx2(a, b, count);
+    }
+    return dot_sse2(a, b, count);
+#elif defined(__aarch64__)
+    return dot_neon(a, b, count);
+#else
+    return dot_scalar(a, b, count);
+#endif
+}
+
+void crossfade_mix(float* out, const float* in, size_t count,
+                   float t_start, float t_step) {
+#if defined(__x86_64__)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        crossfade_avx2(out, in, count, t_start, t_step);
+    } else {
+        crossfade_sse2(out, in, count, t_start, t_step);
+    }
+#elif defined(__aarch64__)
+    crossfade_neon(out, in, count, t_start, t_step);
+#else
+    crossfade_scalar(out, in, count, t_start, t_step);
+#endif
+}
+
+}  // namespace audio
@@ -0,0 +1,175 @@
+#include "audio/SpectrumAnalyzer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace audio {
+
+namespace {
+
+constexpr size_t ANALYSIS_RING_FRAMES = 8192;
+constexpr float BAND_FLOOR_HZ = 40.0f;
+constexpr float LEVEL_FLOOR_DB = -66.0f;
+constexpr int DECAY_PER_FRAME = 9;  // Fast attack, slow release
+
+}  // namespace
+
+SpectrumAnalyzer& SpectrumAnalyzer::instance() {
+    static SpectrumAnalyzer analyzer;
+    return analyzer;
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer() {
+    ring_.init(ANALYSIS_RING_FRAMES, 1);
+    feed_buf_.resize(4096);
+    worker_ = std::jthread([this](std::stop_token st) { run_worker(st); });
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer() {
+    shutdown();
+}
+
+void SpectrumAnalyzer::feed(const float* interleaved, size_t frames,
+                            int channels, int sample_rate) {
+    if (channels <= 0 || frames < 2) return;
+    source_rate_.store(sample_rate, std::memory_order_relaxed);
+    active_.store(true, std::memory_order_relaxed);
+
+    // Downmix to mono and decimate 2:1 in one pass. The result is at
+    // most half a decode chunk, so the staging buffer never grows.
+    size_t out_frames = std::min(frames / 2, feed_buf_.size());
+    const float inv_ch = 1.0f / static_cast<float>(channels);
+    for (size_t i = 0; i < out_frames; ++i) {
+        const float* frame = interleaved + (i * 2) * static_cast<size_t>(channels);
+        float sum = 0.0f;
+        for (int ch = 0; ch < channels; ++ch) {
+            sum += frame[ch];
+        }
+        feed_buf_[i] = sum * inv_ch;
+    }
+
+    // Whatever does not fit is dropped - the worker being behind must
+    // never back-pressure the decode thread
+    ring_.write(feed_buf_.data(), out_frames);
+}
+
+std::array<int, SpectrumAnalyzer::BANDS> SpectrumAnalyzer::band_levels() const {
+    std::array<int, BANDS> out{};
+    for (size_t b = 0; b < BANDS; ++b) {
+        out[b] = levels_[b].load(std::memory_order_relaxed);
+    }
+    return out;
+}
+
+void SpectrumAnalyzer::shutdown() {
+    if (stopped_.exchange(true)) return;
+    worker_.request_stop();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void SpectrumAnalyzer::run_worker(std::stop_token stop_token) {
+    // Lowest priority: visualization must never compete with decode or
+    // render threads for CPU
+    ::setpriority(PRIO_PROCESS, static_cast<id_t>(::gettid()), 19);
+
+    constexpr size_t N = FFT_SIZE;
+
+    // Precomputed tables: Hann window, bit-reversal permutation and
+    // the N/2 roots of unity the butterflies index by stride
+    std::array<float, N> window;
+    for (size_t i = 0; i < N; ++i) {
+        window[i] = 0.5f - 0.5f * std::cos(2.0f * static_cast<float>(M_PI) *
+                                           static_cast<float>(i) / static_cast<float>(N - 1));
+    }
+    std::array<uint16_t, N> bitrev;
+    for (size_t i = 0; i < N; ++i) {
+        size_t r = 0;
+        for (size_t bit = 1, j = i; bit < N; bit <<= 1, j >>= 1) {
+            r = (r << 1) | (j & 1);
+        }
+        bitrev[i] = static_cast<uint16_t>(r);
+    }
+    std::array<float, N / 2> tw_re, tw_im;
+    for (size_t k = 0; k < N / 2; ++k) {
+        const float angle = -2.0f * static_cast<float>(M_PI) *
+                            static_cast<float>(k) / static_cast<float>(N);
+        tw_re[k] = std::cos(angle);
+        tw_im[k] = std::sin(angle);
+    }
+
+    std::array<float, N> samples, re, im;
+
+    while (!stop_token.stop_requested()) {
+        if (ring_.read_available_frames() < N) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(33));
+            continue;
+        }
+        ring_.read(samples.data(), N);
+
+        // Window into bit-reversed order, then iterative radix-2 FFT
+        for (size_t i = 0; i < N; ++i) {
+            re[bitrev[i]] = samples[i] * window[i];
+            im[bitrev[i]] = 0.0f;
+        }
+        for (size_t len = 2; len <= N; len <<= 1) {
+            const size_t half = len >> 1;
+            const size_t stride = N / len;
+            for (size_t base = 0; base < N; base += len) {
+                for (size_t k = 0; k < half; ++k) {
+                    const float wr = tw_re[k * stride];
+                    const float wi = tw_im[k * stride];
+                    const float xr = re[base + half + k];
+                    const float xi = im[base + half + k];
+                    const float tr = xr * wr - xi * wi;
+                    const float ti = xr * wi + xi * wr;
+                    re[base + half + k] = re[base + k] - tr;
+                    im[base + half + k] = im[base + k] - ti;
+                    re[base + k] += tr;
+                    im[base + k] += ti;
+                }
+            }
+        }
+
+        // Fold bins into log-spaced bands. The tap decimates 2:1, so
+        // the usable spectrum tops out at a quarter of the source rate.
+        const float nyquist = static_cast<float>(
+            source_rate_.load(std::memory_order_relaxed)) / 4.0f;
+        const float bin_hz = nyquist / static_cast<float>(N / 2);
+        const float ratio = nyquist > BAND_FLOOR_HZ ? nyquist / BAND_FLOOR_HZ : 2.0f;
+        const float norm = 2.0f / static_cast<float>(N);
+
+        size_t lo_bin = std::max<size_t>(1, static_cast<size_t>(BAND_FLOOR_HZ / bin_hz));
+        for (size_t b = 0; b < BANDS; ++b) {
+            const float hi_hz = BAND_FLOOR_HZ *
+                std::pow(ratio, static_cast<float>(b + 1) / static_cast<float>(BANDS));
+            size_t hi_bin = std::min<size_t>(
+                N / 2, static_cast<size_t>(hi_hz / bin_hz));
+            if (hi_bin <= lo_bin) hi_bin = lo_bin + 1;
+
+            float energy = 0.0f;
+            for (size_t k = lo_bin; k < hi_bin; ++k) {
+                const float mr = re[k] * norm;
+                const float mi = im[k] * norm;
+                energy += mr * mr + mi * mi;
+            }
+            energy /= static_cast<float>(hi_bin - lo_bin);
+            lo_bin = hi_bin;
+
+            const float db = 10.0f * std::log10(energy + 1e-12f);
+            int pct = static_cast<int>((db - LEVEL_FLOOR_DB) * 100.0f / -LEVEL_FLOOR_DB);
+            pct = std::clamp(pct, 0, 100);
+
+            // Fast attack, slow release so transients stay readable
+            const int prev = levels_[b].load(std::memory_order_relaxed);
+            levels_[b].store(static_cast<uint8_t>(
+                std::max(pct, prev - DECAY_PER_FRAME)), std::memory_order_relaxed);
+        }
+    }
+}
+
+}  // namespace audio
@@ -0,0 +1,203 @@
+#include "audio/WAVDecoder.hpp"
+#include "audio/FLACDecoder.hpp"
+#include "audio/SampleConvert.hpp"
+#include "util/Logger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <sys/mman.h>
+
+namespace audio {
+
+namespace {
+
+uint16_t read_le16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t read_le32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+constexpr float S24_SCALE = 1.0f / 8388608.0f;      // 2^23
+constexpr float S32_SCALE = 1.0f / 2147483648.0f;   // 2^31
+
+}  // namespace
+
+WAVDecoder::WAVDecoder() = default;
+
+WAVDecoder::~WAVDecoder() {
+    close();
+}
+
+bool WAVDecoder::parse_riff() {
+    const uint8_t* base = static_cast<const uint8_t*>(map_.data);
+    if (map_.size < 12 || std::memcmp(base, "RIFF", 4) != 0 ||
+        std::memcmp(base + 8, "WAVE", 4) != 0) {
+        return false;
+    }
+
+    bool have_fmt = false;
+    uint16_t audio_format = 0;
+    uint16_t bits = 0;
+    uint64_t data_size = 0;
+
+    // Walk the chunk list: [id:4][size:le32][payload, padded to even]
+    uint64_t off = 12;
+    while (off + 8 <= map_.size) {
+        const uint8_t* chunk = base + off;
+        const uint32_t chunk_size = read_le32(chunk + 4);
+        const uint64_t payload = off + 8;
+        if (payload + chunk_size > map_.size) break;
+
+        if (std::memcmp(chunk, "fmt ", 4) == 0 && chunk_size >= 16) {
+            audio_format = read_le16(chunk + 8);
+            channels_ = read_le16(chunk + 10);
+            sample_rate_ = static_cast<int>(read_le32(chunk + 12));
+            block_align_ = read_le16(chunk + 20);
+            bits = read_le16(chunk + 22);
+            if (audio_format == 0xFFFE && chunk_size >= 40) {
+                // WAVE_FORMAT_EXTENSIBLE: actual format code leads the
+                // SubFormat GUID
+                audio_format = read_le16(chunk + 32);
+            }
+            have_fmt = true;
+        } else if (std::memcmp(chunk, "data", 4) == 0) {
+            data_offset_ = payload;
+            data_size = chunk_size;
+        }
+
+        off = payload + chunk_size + (chunk_size & 1);
+    }
+
+    if (!have_fmt || data_offset_ == 0 || data_size == 0 ||
+        channels_ < 1 || channels_ > 8 || sample_rate_ <= 0 ||
+        block_align_ != channels_ * (bits / 8)) {
+        return false;
+    }
+
+    // Only the layouts the conversion kernels handle; SampleConvert's
+    // s16 kernel wants 2-byte alignment, which canonical headers give
+    if (audio_format == 1 && bits == 16 && data_offset_ % 2 == 0) {
+        format_ = SampleFormat::S16;
+    } else if (audio_format == 1 && bits == 24) {
+        format_ = SampleFormat::S24;
+    } else if (audio_format == 1 && bits == 32 && data_offset_ % 4 == 0) {
+        format_ = SampleFormat::S32;
+    } else if (audio_format == 3 && bits == 32 && data_offset_ % 4 == 0) {
+        format_ = SampleFormat::F32;
+    } else {
+        return false;
+    }
+
+    data_size = std::min<uint64_t>(data_size, map_.size - data_offset_);
+    total_frames_ = static_cast<long>(data_size / static_cast<uint64_t>(block_align_));
+    position_frames_ = 0;
+    return total_frames_ > 0;
+}
+
+bool WAVDecoder::open(const std::string& filepath) {
+    ouroboros::util::Logger::debug("WAVDecoder: Opening file: " + filepath);
+
+    if (map_.open_readonly(filepath) && parse_riff()) {
+        // Playback walks the data chunk front to back; tell the kernel
+        // so readahead stays ahead of the cursor
+        ::madvise(map_.data, map_.size, MADV_SEQUENTIAL);
+        ouroboros::util::Logger::info("WAVDecoder: Opened via mmap - " +
+            std::to_string(sample_rate_) + "Hz, " +
+            std::to_string(channels_) + "ch, " +
+            std::to_string(total_frames_) + " frames");
+        return true;
+    }
+
+    // Non-PCM or otherwise unusual WAV: hand the file to libsndfile
+    map_.close();
+    ouroboros::util::Logger::debug("WAVDecoder: Falling back to libsndfile for " + filepath);
+    fallback_ = std::make_unique<FLACDecoder>();
+    return fallback_->open(filepath);
+}
+
+void WAVDecoder::close() {
+    if (fallback_) {
+        fallback_->close();
+        fallback_.reset();
+    }
+    map_.close();
+    sample_rate_ = 0;
+    channels_ = 0;
+    block_align_ = 0;
+    data_offset_ = 0;
+    total_frames_ = 0;
+    position_frames_ = 0;
+}
+
+int WAVDecoder::read_pcm(float* buffer, int max_frames) {
+    if (fallback_) return fallback_->read_pcm(buffer, max_frames);
+    if (!map_.data || !buffer || max_frames <= 0) return 0;
+
+    const long frames = std::min<long>(max_frames, total_frames_ - position_frames_);
+    if (frames <= 0) return 0;
+
+    const uint8_t* src = static_cast<const uint8_t*>(map_.data) + data_offset_ +
+                         static_cast<uint64_t>(position_frames_) *
+                             static_cast<uint64_t>(block_align_);
+    const size_t samples = static_cast<size_t>(frames) * static_cast<size_t>(channels_);
+
+    switch (format_) {
+        case SampleFormat::S16:
+            convert_s16_to_float(reinterpret_cast<const short*>(src), buffer, samples);
+            break;
+        case SampleFormat::S24:
+            for (size_t i = 0; i < samples; ++i) {
+                const uint8_t* s = src + i * 3;
+                int32_t v = static_cast<int32_t>(
+                    (static_cast<uint32_t>(s[0]) << 8) |
+                    (static_cast<uint32_t>(s[1]) << 16) |
+                    (static_cast<uint32_t>(s[2]) << 24)) >> 8;
+                buffer[i] = static_cast<float>(v) * S24_SCALE;
+            }
+            break;
+        case SampleFormat::S32:
+            for (size_t i = 0; i < samples; ++i) {
+                int32_t v;
+                std::memcpy(&v, src + i * 4, 4);
+                buffer[i] = static_cast<float>(v) * S32_SCALE;
+            }
+            break;
+        case SampleFormat::F32:
+            std::memcpy(buffer, src, samples * sizeof(float));
+            break;
+    }
+
+    position_frames_ += frames;
+    return static_cast<int>(frames);
+}
+
+int WAVDecoder::get_sample_rate() const {
+    return fallback_ ? fallback_->get_sample_rate() : sample_rate_;
+}
+
+int WAVDecoder::get_channels() const {
+    return fallback_ ? fallback_->get_channels() : channels_;
+}
+
+long WAVDecoder::get_total_frames() const {
+    return fallback_ ? fallback_->get_total_frames() : total_frames_;
+}
+
+long WAVDecoder::get_position_frames() const {
+    return fallback_ ? fallback_->get_position_frames() : position_frames_;
+}
+
+bool WAVDecoder::seek(long frame) {
+    if (fallback_) return fallback_->seek(frame);
+    if (!map_.data) return false;
+    position_frames_ = std::clamp(frame, 0L, total_frames_);
+    return true;
+}
+
+bool WAVDecoder::is_open() const {
+    return fallback_ ? fallback_->is_open() : map_.data != nullptr;
+}
+
+}  // namespace audio
@@ -3,6 +3,10 @@
 #include "util/Platform.hpp"
 #include <fstream>
 #include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 // For image validation
 #define STBI_ONLY_JPEG
@@ -11,11 +15,59 @@
 
 namespace ouroboros::backend {
 
+namespace {
+
+// Bounds-checked cursor over the cache mapping; a truncated or corrupt
+// file fails a read and falls back to a rebuild instead of crashing
+struct MapReader {
+    const uint8_t* cur;
+    const uint8_t* end;
+
+    bool read(void* dst, size_t n) {
+        if (static_cast<size_t>(end - cur) < n) return false;
+        std::memcpy(dst, cur, n);
+        cur += n;
+        return true;
+    }
+
+    // Returns a pointer into the mapping and advances past it
+    const uint8_t* view(size_t n) {
+        if (static_cast<size_t>(end - cur) < n) return nullptr;
+        const uint8_t* p = cur;
+        cur += n;
+        return p;
+    }
+
+    bool read_string(std::string& out) {
+        uint32_t len;
+        if (!read(&len, sizeof(len))) return false;
+        const uint8_t* p = view(len);
+        if (!p) return false;
+        out.assign(reinterpret_cast<const char*>(p), len);
+        return true;
+    }
+};
+
+}  // namespace
+
 ArtworkCache& ArtworkCache::instance() {
     static ArtworkCache instance;
     return instance;
 }
 
+ArtworkCache::~ArtworkCache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    unmap_locked();
+}
+
+void ArtworkCache::unmap_locked() {
+    if (map_base_) {
+        munmap(map_base_, map_size_);
+        map_base_ = nullptr;
+        map_size_ = 0;
+    }
+}
+
 void ArtworkCache::store(const std::string& hash, std::vector<uint8_t> data, const std::string& mime_type, const std::string& source_dir) {
     if (hash.empty() || data.empty()) {
         return;
@@ -58,7 +110,7 @@ void ArtworkCache::store(const std::string& hash, std::vector<uint8_t> data, con
     }
 
     util::Logger::debug("ArtworkCache: Stored artwork " + hash.substr(0, 16) + "... (" +
-                       std::to_string(cache_[hash].data.size() / 1024) + " KB, " + mime_type + ")");
+                       std::to_string(cache_[hash].size() / 1024) + " KB, " + mime_type + ")");
 }
 
 const RawArtworkEntry* ArtworkCache::get(const std::string& hash) const {
@@ -185,9 +237,15 @@ bool ArtworkCache::save(const std::filesystem::path& cache_path) {
     try {
         std::filesystem::create_directories(cache_path.parent_path());
 
-        std::ofstream out(cache_path, std::ios::binary);
+        // Write to a temp file and rename over the old one: loaded
+        // entries point into the mapping of the current file, and an
+        // in-place truncate would yank those pages out from under them.
+        // The rename keeps the mapped inode alive until we unmap.
+        const std::filesystem::path tmp_path =
+            cache_path.string() + ".tmp";
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
         if (!out) {
-            util::Logger::error("ArtworkCache: Failed to open cache file for writing: " + cache_path.string());
+            util::Logger::error("ArtworkCache: Failed to open cache file for writing: " + tmp_path.string());
             return false;
         }
 
@@ -220,10 +278,11 @@ bool ArtworkCache::save(const std::filesystem::path& cache_path) {
                 out.write(entry.source_dir.data(), dir_len);
             }
 
-            // Artwork data
-            uint64_t data_len = entry.data.size();
+            // Artwork data (mapped entries stream straight from the
+            // page cache)
+            uint64_t data_len = entry.size();
             out.write(reinterpret_cast<const char*>(&data_len), sizeof(data_len));
-            out.write(reinterpret_cast<const char*>(entry.data.data()), data_len);
+            out.write(reinterpret_cast<const char*>(entry.bytes()), data_len);
 
             // Ref count (serialize as uint64_t for portability)
             uint64_t ref_count = entry.ref_count;
@@ -263,6 +322,14 @@ bool ArtworkCache::save(const std::filesystem::path& cache_path) {
             out.write(hash.data(), hash_len);
         }
 
+        out.close();
+        if (!out) {
+            util::Logger::error("ArtworkCache: Write failed: " + tmp_path.string());
+            std::filesystem::remove(tmp_path);
+            return false;
+        }
+        std::filesystem::rename(tmp_path, cache_path);
+
         dirty_ = false;  // Mark as clean after successful save
         util::Logger::info("ArtworkCache: Saved " + std::to_string(count) + " entries, " +
                           std::to_string(dir_hash_count) + " dirs, " +
@@ -285,129 +352,132 @@ bool ArtworkCache::load(const std::filesystem::path& cache_path) {
     }
 
     try {
-        std::ifstream in(cache_path, std::ios::binary);
-        if (!in) {
+        // Map the whole file read-only. The parse below walks the
+        // per-entry headers and skips over the image bytes, so startup
+        // faults in only the index pages; image bytes page in on first
+        // get() and the OS can drop cold ones under memory pressure.
+        // MADV_RANDOM turns off readahead that would otherwise pull
+        // image pages in behind the skips.
+        int fd = ::open(cache_path.c_str(), O_RDONLY);
+        if (fd < 0) {
             util::Logger::error("ArtworkCache: Failed to open cache file for reading: " + cache_path.string());
             return false;
         }
+        struct stat st{};
+        if (fstat(fd, &st) != 0 ||
+            st.st_size < static_cast<off_t>(sizeof(CACHE_MAGIC) + sizeof(CACHE_VERSION))) {
+            ::close(fd);
+            return false;
+        }
+        void* base = mmap(nullptr, static_cast<size_t>(st.st_size),
+                          PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            util::Logger::error("ArtworkCache: mmap failed for " + cache_path.string());
+            return false;
+        }
+        madvise(base, static_cast<size_t>(st.st_size), MADV_RANDOM);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_.clear();  // Drops any referents into a previous mapping
+        unmap_locked();
+        map_base_ = base;
+        map_size_ = static_cast<size_t>(st.st_size);
+
+        MapReader in{static_cast<const uint8_t*>(base),
+                     static_cast<const uint8_t*>(base) + map_size_};
+
+        auto fail = [&](const std::string& why) {
+            util::Logger::warn("ArtworkCache: " + why + ", will rebuild");
+            cache_.clear();
+            verified_tracks_.clear();
+            track_to_hash_.clear();
+            dir_to_hash_.clear();
+            unmap_locked();
+            return false;
+        };
 
         // Read and validate header
         uint64_t magic;
         uint32_t version;
-        in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
-        if (magic != CACHE_MAGIC) {
-            util::Logger::error("ArtworkCache: Invalid cache magic number");
-            return false;
+        if (!in.read(&magic, sizeof(magic)) || magic != CACHE_MAGIC) {
+            return fail("Invalid cache magic number");
         }
-
-        in.read(reinterpret_cast<char*>(&version), sizeof(version));
-        if (version != CACHE_VERSION) {
-            util::Logger::warn("ArtworkCache: Cache version mismatch (file=" + std::to_string(version) +
-                              ", expected=" + std::to_string(CACHE_VERSION) + "), will rebuild");
-            return false;
+        if (!in.read(&version, sizeof(version)) || version != CACHE_VERSION) {
+            return fail("Cache version mismatch (file=" + std::to_string(version) +
+                        ", expected=" + std::to_string(CACHE_VERSION) + ")");
         }
 
         // Read entry count
         uint64_t count;
-        in.read(reinterpret_cast<char*>(&count), sizeof(count));
-
-        std::lock_guard<std::mutex> lock(mutex_);
-        cache_.clear();
+        if (!in.read(&count, sizeof(count))) return fail("Truncated header");
         cache_.reserve(count);
 
-        // Read each entry
+        // Read each entry; image bytes stay in the mapping
         for (uint64_t i = 0; i < count; ++i) {
-            // Hash
-            uint32_t hash_len;
-            in.read(reinterpret_cast<char*>(&hash_len), sizeof(hash_len));
-            std::string hash(hash_len, '\0');
-            in.read(hash.data(), hash_len);
-
-            // MIME type
-            uint32_t mime_len;
-            in.read(reinterpret_cast<char*>(&mime_len), sizeof(mime_len));
-            std::string mime_type;
-            if (mime_len > 0) {
-                mime_type.resize(mime_len);
-                in.read(mime_type.data(), mime_len);
-            }
-
-            // Source directory
-            uint32_t dir_len;
-            in.read(reinterpret_cast<char*>(&dir_len), sizeof(dir_len));
-            std::string source_dir;
-            if (dir_len > 0) {
-                source_dir.resize(dir_len);
-                in.read(source_dir.data(), dir_len);
+            std::string hash, mime_type, source_dir;
+            if (!in.read_string(hash) || !in.read_string(mime_type) ||
+                !in.read_string(source_dir)) {
+                return fail("Truncated entry");
             }
 
-            // Artwork data
             uint64_t data_len;
-            in.read(reinterpret_cast<char*>(&data_len), sizeof(data_len));
-            std::vector<uint8_t> data(data_len);
-            in.read(reinterpret_cast<char*>(data.data()), data_len);
+            if (!in.read(&data_len, sizeof(data_len))) return fail("Truncated entry");
+            const uint8_t* span = in.view(data_len);
+            if (!span) return fail("Truncated entry");
 
-            // Ref count (read as uint64_t for portability, but ignore - reset to 0 at startup)
+            // Ref count persisted for portability but reset to 0 at
+            // startup (no LRU entries reference it yet)
             uint64_t ref_count_ignored;
-            in.read(reinterpret_cast<char*>(&ref_count_ignored), sizeof(ref_count_ignored));
+            if (!in.read(&ref_count_ignored, sizeof(ref_count_ignored))) {
+                return fail("Truncated entry");
+            }
 
-            // Store entry with ref_count=0 (no LRU entries reference it yet)
-            cache_[hash] = RawArtworkEntry{std::move(data), std::move(mime_type), source_dir, 0};
+            cache_[hash] = RawArtworkEntry{span, data_len,
+                                           std::move(mime_type), std::move(source_dir)};
         }
 
         // Read verified tracks
         verified_tracks_.clear();
         uint64_t verified_count;
-        in.read(reinterpret_cast<char*>(&verified_count), sizeof(verified_count));
+        if (!in.read(&verified_count, sizeof(verified_count))) return fail("Truncated verified set");
         for (uint64_t i = 0; i < verified_count; ++i) {
-            uint32_t path_len;
-            in.read(reinterpret_cast<char*>(&path_len), sizeof(path_len));
-            std::string path(path_len, '\0');
-            in.read(path.data(), path_len);
+            std::string path;
+            if (!in.read_string(path)) return fail("Truncated verified set");
             verified_tracks_.insert(std::move(path));
         }
 
         // Read track-to-hash mappings (for tracks with unique artwork)
         track_to_hash_.clear();
         uint64_t track_hash_count;
-        in.read(reinterpret_cast<char*>(&track_hash_count), sizeof(track_hash_count));
+        if (!in.read(&track_hash_count, sizeof(track_hash_count))) return fail("Truncated track map");
         for (uint64_t i = 0; i < track_hash_count; ++i) {
-            uint32_t path_len;
-            in.read(reinterpret_cast<char*>(&path_len), sizeof(path_len));
-            std::string path(path_len, '\0');
-            in.read(path.data(), path_len);
-            uint32_t hash_len;
-            in.read(reinterpret_cast<char*>(&hash_len), sizeof(hash_len));
-            std::string hash(hash_len, '\0');
-            in.read(hash.data(), hash_len);
+            std::string path, hash;
+            if (!in.read_string(path) || !in.read_string(hash)) return fail("Truncated track map");
             track_to_hash_[std::move(path)] = std::move(hash);
         }
 
         // Read dir-to-hash mappings (directory -> artwork hash)
         dir_to_hash_.clear();
         uint64_t dir_hash_count;
-        in.read(reinterpret_cast<char*>(&dir_hash_count), sizeof(dir_hash_count));
+        if (!in.read(&dir_hash_count, sizeof(dir_hash_count))) return fail("Truncated dir map");
         for (uint64_t i = 0; i < dir_hash_count; ++i) {
-            uint32_t dir_len;
-            in.read(reinterpret_cast<char*>(&dir_len), sizeof(dir_len));
-            std::string dir(dir_len, '\0');
-            in.read(dir.data(), dir_len);
-            uint32_t hash_len;
-            in.read(reinterpret_cast<char*>(&hash_len), sizeof(hash_len));
-            std::string hash(hash_len, '\0');
-            in.read(hash.data(), hash_len);
+            std::string dir, hash;
+            if (!in.read_string(dir) || !in.read_string(hash)) return fail("Truncated dir map");
             dir_to_hash_[std::move(dir)] = std::move(hash);
         }
 
         dirty_ = false;  // Freshly loaded, no changes yet
-        util::Logger::info("ArtworkCache: Loaded " + std::to_string(cache_.size()) + " entries, " +
+        util::Logger::info("ArtworkCache: Mapped " + std::to_string(cache_.size()) + " entries, " +
                           std::to_string(dir_to_hash_.size()) + " dirs, " +
                           std::to_string(track_to_hash_.size()) + " unique tracks from " + cache_path.string());
         return true;
 
     } catch (const std::exception& e) {
         util::Logger::error("ArtworkCache: Failed to load cache: " + std::string(e.what()));
+        std::lock_guard<std::mutex> lock(mutex_);
         cache_.clear();
+        unmap_locked();
         return false;
     }
 }
@@ -422,7 +492,9 @@ size_t ArtworkCache::memory_usage() const {
 
     size_t total = 0;
     for (const auto& [hash, entry] : cache_) {
-        total += entry.data.size();
+        // Mapped spans are file-backed and evictable; counted anyway as
+        // the logical cache size
+        total += entry.size();
         total += hash.size();
         total += entry.mime_type.size();
     }
@@ -430,9 +502,27 @@ size_t ArtworkCache::memory_usage() const {
     return total;
 }
 
+size_t ArtworkCache::release_mapped_pages() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!map_base_ || map_size_ == 0) return 0;
+
+    // Clean read-only file pages: the kernel drops them now and
+    // refaults from the cache file on next access. Entries stay valid -
+    // their spans still point into the mapping - and session-stored
+    // owned entries (the unsaved data) are never touched.
+    if (madvise(map_base_, map_size_, MADV_DONTNEED) != 0) {
+        util::Logger::warn("ArtworkCache: madvise(DONTNEED) failed");
+        return 0;
+    }
+    util::Logger::info("ArtworkCache: Released mapped pages (" +
+                       std::to_string(map_size_ / (1024 * 1024)) + " MB mapping)");
+    return map_size_;
+}
+
 void ArtworkCache::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
     cache_.clear();
+    unmap_locked();
 }
 
 }  // namespace ouroboros::backend
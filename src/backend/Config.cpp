@@ -69,6 +69,9 @@ Config ConfigLoader::load_from_file(const std::filesystem::path& path) {
     cfg.default_volume = toml.get_int("playback", "default_volume", cfg.default_volume);
     cfg.shuffle = toml.get_bool("playback", "shuffle", cfg.shuffle);
     cfg.repeat = toml.get_string("playback", "repeat", cfg.repeat);
+    cfg.replaygain = toml.get_string("playback", "replaygain", cfg.replaygain);
+    cfg.crossfade_ms = toml.get_int("playback", "crossfade_ms", cfg.crossfade_ms);
+    cfg.pin_sample_rate = toml.get_int("playback", "pin_sample_rate", cfg.pin_sample_rate);
 
     // [ui]
     cfg.layout = toml.get_string("ui", "layout", cfg.layout);
@@ -107,6 +110,8 @@ Config ConfigLoader::load_from_file(const std::filesystem::path& path) {
     cfg.artwork_prefetch_items = toml.get_int("performance", "artwork_prefetch_items", cfg.artwork_prefetch_items);
     cfg.artwork_spawn_threshold = toml.get_int("performance", "artwork_spawn_threshold", cfg.artwork_spawn_threshold);
     cfg.artwork_memory_limit_mb = toml.get_int("performance", "artwork_memory_limit_mb", cfg.artwork_memory_limit_mb);
+    cfg.memory_budget_mb = toml.get_int("performance", "memory_budget_mb", cfg.memory_budget_mb);
+    cfg.audio_cpu_affinity = toml.get_int("performance", "audio_cpu_affinity", cfg.audio_cpu_affinity);
 
     return cfg;
 }
@@ -125,7 +130,12 @@ void ConfigLoader::save_config(const Config& cfg, const std::filesystem::path& p
     file << "[playback]\n";
     file << "default_volume = " << cfg.default_volume << "\n";
     file << "shuffle = " << (cfg.shuffle ? "true" : "false") << "\n";
-    file << "repeat = \"" << cfg.repeat << "\"\n\n";
+    file << "repeat = \"" << cfg.repeat << "\"\n";
+    file << "replaygain = \"" << cfg.replaygain << "\"\n";
+    file << "crossfade_ms = " << cfg.crossfade_ms << "\n";
+    file << "# Pin the output at one rate and resample mixed-rate queues into it;\n";
+    file << "# 0 follows each track's native rate\n";
+    file << "pin_sample_rate = " << cfg.pin_sample_rate << "\n\n";
 
     file << "[ui]\n";
     file << "layout = \"" << cfg.layout << "\"\n";
@@ -158,6 +168,11 @@ void ConfigLoader::save_config(const Config& cfg, const std::filesystem::path& p
     file << "artwork_prefetch_items = " << cfg.artwork_prefetch_items << "\n";
     file << "artwork_spawn_threshold = " << cfg.artwork_spawn_threshold << "\n";
     file << "artwork_memory_limit_mb = " << cfg.artwork_memory_limit_mb << "\n";
+    file << "# Total cache budget across artwork/thumbnails/metadata;\n";
+    file << "# 0 derives it from the cgroup limit (or half of RAM)\n";
+    file << "memory_budget_mb = " << cfg.memory_budget_mb << "\n";
+    file << "# Pin the audio decode thread to one CPU; -1 leaves the scheduler free\n";
+    file << "audio_cpu_affinity = " << cfg.audio_cpu_affinity << "\n";
 
     // Semantic color roles -- these drive the entire UI.
     // Values: named color (e.g. "green"), hex "#RRGGBB", or palette index (integer).
@@ -214,6 +229,7 @@ Config ConfigLoader::create_default_config() {
     cfg.keybinds["clear_queue"] = "ctrl+d";
     cfg.keybinds["search"] = "ctrl+f";
     cfg.keybinds["help"] = "?";
+    cfg.keybinds["perf_hud"] = "ctrl+t";
     cfg.keybinds["tab"] = "tab";
     cfg.keybinds["nav_up"] = "k";
     cfg.keybinds["nav_down"] = "j";
@@ -221,6 +237,8 @@ Config ConfigLoader::create_default_config() {
     cfg.keybinds["nav_right"] = "l";
     cfg.keybinds["nav_select_up"] = "K";
     cfg.keybinds["nav_select_down"] = "J";
+    cfg.keybinds["jump_next_letter"] = "]";
+    cfg.keybinds["jump_prev_letter"] = "[";
     cfg.keybinds["select"] = "enter";
 
     return cfg;
@@ -0,0 +1,146 @@
+#include "backend/ControlSocket.hpp"
+
+#include "util/Logger.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace ouroboros::backend {
+
+ControlSocket::~ControlSocket() {
+    close();
+}
+
+std::filesystem::path ControlSocket::default_path() {
+    if (const char* runtime_dir = std::getenv("XDG_RUNTIME_DIR")) {
+        return std::filesystem::path(runtime_dir) / "ouroboros.sock";
+    }
+    return std::filesystem::path("/tmp") / ("ouroboros-" + std::to_string(getuid()) + ".sock");
+}
+
+bool ControlSocket::open(const std::filesystem::path& path) {
+    close();
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.string().size() >= sizeof(addr.sun_path)) {
+        util::Logger::error("ControlSocket: path too long: " + path.string());
+        return false;
+    }
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+        util::Logger::error("ControlSocket: socket() failed: " + std::string(strerror(errno)));
+        return false;
+    }
+
+    ::unlink(path.c_str());  // Stale file from a previous instance
+    if (bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        listen(listen_fd_, 4) < 0) {
+        util::Logger::error("ControlSocket: bind/listen failed on " + path.string() +
+                            ": " + std::string(strerror(errno)));
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+    chmod(path.c_str(), 0600);  // Same-user only
+
+    path_ = path;
+    util::Logger::info("ControlSocket: listening on " + path.string());
+    return true;
+}
+
+void ControlSocket::close() {
+    for (auto& client : clients_) {
+        ::close(client.fd);
+    }
+    clients_.clear();
+    if (listen_fd_ >= 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        ::unlink(path_.c_str());
+    }
+}
+
+void ControlSocket::drop_client(size_t index) {
+    ::close(clients_[index].fd);
+    clients_.erase(clients_.begin() + static_cast<long>(index));
+}
+
+int ControlSocket::service(int timeout_ms, const CommandHandler& on_command) {
+    if (listen_fd_ < 0) return 0;
+
+    std::vector<pollfd> pfds;
+    pfds.reserve(clients_.size() + 1);
+    pfds.push_back({listen_fd_, POLLIN, 0});
+    for (const auto& client : clients_) {
+        pfds.push_back({client.fd, POLLIN, 0});
+    }
+
+    int ret = poll(pfds.data(), pfds.size(), timeout_ms);
+    if (ret <= 0) return 0;  // Timeout, or EINTR - the caller loops anyway
+
+    // Accept new clients
+    if (pfds[0].revents & POLLIN) {
+        int fd;
+        while ((fd = accept4(listen_fd_, nullptr, nullptr,
+                             SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+            if (clients_.size() >= MAX_CLIENTS) {
+                ::close(fd);
+                continue;
+            }
+            clients_.push_back({fd, {}});
+        }
+    }
+
+    int dispatched = 0;
+    // Walk backwards so drop_client keeps indices stable; pfds[i + 1]
+    // corresponds to the client list as it was when poll was armed, so
+    // only the first clients_.size() entries are in play
+    for (size_t i = std::min(clients_.size(), pfds.size() - 1); i-- > 0;) {
+        if (!(pfds[i + 1].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+        auto& client = clients_[i];
+
+        char buf[1024];
+        ssize_t n = read(client.fd, buf, sizeof(buf));
+        if (n <= 0) {
+            if (n < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+            drop_client(i);  // EOF or hard error
+            continue;
+        }
+        client.inbuf.append(buf, static_cast<size_t>(n));
+        if (client.inbuf.size() > MAX_LINE_BYTES) {
+            drop_client(i);
+            continue;
+        }
+
+        size_t pos;
+        while ((pos = client.inbuf.find('\n')) != std::string::npos) {
+            std::string line = client.inbuf.substr(0, pos);
+            client.inbuf.erase(0, pos + 1);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line.empty()) continue;
+
+            std::string reply = on_command(line) + "\n";
+            dispatched++;
+            // Short replies to a local client; a blocked writer just
+            // loses the reply, never stalls the daemon
+            if (write(client.fd, reply.data(), reply.size()) < 0 && errno != EAGAIN) {
+                drop_client(i);
+                break;
+            }
+        }
+    }
+    return dispatched;
+}
+
+}  // namespace ouroboros::backend
@@ -0,0 +1,315 @@
+// ═══════════════════════════════════════════════════════════════════════
+// OUROBOROS — headless daemon front end
+//
+// The UI main loop minus everything visual: no Terminal, no Renderer,
+// no ArtworkCache/ThumbnailStore/ImageDecoderPool, no 30FPS pacing.
+// Collectors and the EventBus handlers are the same objects the UI
+// uses; the only new surface is the control-socket command parser. The
+// loop wakes every 200ms (or on a command) to drain the event ring, so
+// steady-state CPU is the decode thread plus a poll tick.
+// ═══════════════════════════════════════════════════════════════════════
+
+#include "backend/Daemon.hpp"
+
+#include "backend/Config.hpp"
+#include "backend/ControlSocket.hpp"
+#include "backend/QueueJournal.hpp"
+#include "backend/SnapshotMirror.hpp"
+#include "backend/SnapshotPublisher.hpp"
+#include "collectors/LibraryCollector.hpp"
+#include "collectors/PlaybackCollector.hpp"
+#include "events/CoreHandlers.hpp"
+#include "events/EventBus.hpp"
+#include "util/Logger.hpp"
+#include "util/Platform.hpp"
+
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include <signal.h>
+
+namespace ouroboros::backend {
+
+namespace {
+
+std::atomic<bool> g_daemon_shutdown{false};
+
+void daemon_signal_handler(int) {
+    g_daemon_shutdown.store(true);
+}
+
+const char* state_name(model::PlaybackState state) {
+    switch (state) {
+        case model::PlaybackState::Playing: return "playing";
+        case model::PlaybackState::Paused:  return "paused";
+        default:                            return "stopped";
+    }
+}
+
+/// `status` reply: one parseable line, stable field order
+std::string format_status(const std::shared_ptr<const model::Snapshot>& snap) {
+    if (!snap) return "ok stopped";
+    std::ostringstream out;
+    out << "ok " << state_name(snap->player.state)
+        << " volume=" << snap->player.volume_percent
+        << " shuffle=" << (snap->player.shuffle_enabled ? 1 : 0);
+    if (snap->library && snap->player.current_track_index.has_value()) {
+        int idx = *snap->player.current_track_index;
+        if (idx >= 0 && idx < util::narrow_cast<int>(snap->library->tracks.size())) {
+            const auto& track = snap->library->tracks[idx];
+            auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch())
+                              .count();
+            out << " track=" << idx
+                << " position_ms=" << snap->player.display_position_ms(now_ms)
+                << " duration_ms=" << track.duration_ms
+                << " title=\"" << track.title << "\""
+                << " artist=\"" << track.artist.str() << "\"";
+        }
+    }
+    if (snap->queue) {
+        out << " queue=" << snap->queue->future.size();
+    }
+    return out.str();
+}
+
+/// Resolves an `add` argument: a numeric library index, or a path to
+/// look up in the published library
+std::string handle_add(const std::shared_ptr<const model::Snapshot>& snap,
+                       const std::string& arg) {
+    if (!snap || !snap->library || snap->library->tracks.empty()) {
+        return "err library not loaded yet";
+    }
+    int index = -1;
+    auto [ptr, ec] = std::from_chars(arg.data(), arg.data() + arg.size(), index);
+    if (ec != std::errc{} || ptr != arg.data() + arg.size()) {
+        index = -1;
+        for (size_t i = 0; i < snap->library->tracks.size(); ++i) {
+            if (snap->library->tracks[i].path == arg) {
+                index = util::narrow_cast<int>(i);
+                break;
+            }
+        }
+        if (index < 0) return "err no such track: " + arg;
+    }
+    if (index < 0 || index >= util::narrow_cast<int>(snap->library->tracks.size())) {
+        return "err index out of range (library has " +
+               std::to_string(snap->library->tracks.size()) + " tracks)";
+    }
+    events::Event evt;
+    evt.type = events::Event::Type::AddTrackToQueue;
+    evt.index = index;
+    events::EventBus::instance().publish(evt);
+    return "ok queued " + std::to_string(index);
+}
+
+/// Translates one command line into EventBus traffic. The caller
+/// drains the bus before building the reply, so `status` after a
+/// transport command reflects it.
+std::string dispatch_command(const std::string& line,
+                             const std::shared_ptr<SnapshotPublisher>& publisher) {
+    std::istringstream words(line);
+    std::string cmd, arg;
+    words >> cmd;
+    std::getline(words >> std::ws, arg);
+
+    auto& bus = events::EventBus::instance();
+    using Type = events::Event::Type;
+
+    if (cmd == "status") {
+        return format_status(publisher->get_current());
+    }
+    auto publish = [&bus](Type type) {
+        events::Event evt;
+        evt.type = type;
+        bus.publish(evt);
+        return std::string("ok");
+    };
+    if (cmd == "toggle" || cmd == "play" || cmd == "pause") {
+        // PlaybackCollector owns play/pause state; like the UI keybind,
+        // all three are the toggle
+        return publish(Type::PlayPause);
+    }
+    if (cmd == "next")    return publish(Type::NextTrack);
+    if (cmd == "prev")    return publish(Type::PrevTrack);
+    if (cmd == "clear")   return publish(Type::ClearQueue);
+    if (cmd == "shuffle") return publish(Type::ShuffleToggle);
+    if (cmd == "repeat")  return publish(Type::RepeatToggle);
+    if (cmd == "add") {
+        if (arg.empty()) return "err usage: add <index|path>";
+        return handle_add(publisher->get_current(), arg);
+    }
+    if (cmd == "volume") {
+        int delta = 0;
+        auto [ptr, ec] = std::from_chars(arg.data(), arg.data() + arg.size(), delta);
+        if (ec != std::errc{} || ptr != arg.data() + arg.size() || delta == 0) {
+            return "err usage: volume <+N|-N>";
+        }
+        events::Event evt;
+        evt.type = delta > 0 ? Type::VolumeUp : Type::VolumeDown;
+        evt.volume_delta = std::abs(delta);
+        bus.publish(evt);
+        return "ok";
+    }
+    if (cmd == "seek") {
+        int seconds = 0;
+        auto [ptr, ec] = std::from_chars(arg.data(), arg.data() + arg.size(), seconds);
+        if (ec != std::errc{} || ptr != arg.data() + arg.size() || seconds == 0) {
+            return "err usage: seek <+secs|-secs>";
+        }
+        events::Event evt;
+        evt.type = seconds > 0 ? Type::SeekForward : Type::SeekBackward;
+        evt.seek_seconds = std::abs(seconds);
+        bus.publish(evt);
+        return "ok";
+    }
+    if (cmd == "quit") {
+        g_daemon_shutdown.store(true);
+        return "ok shutting down";
+    }
+    return "err unknown command (status|toggle|next|prev|add|clear|volume|seek|shuffle|repeat|quit)";
+}
+
+}  // namespace
+
+int run_daemon() {
+    util::Logger::init();
+    util::Logger::info("OUROBOROS starting in daemon mode...");
+
+    auto config = ConfigLoader::load_config();
+
+    namespace fs = std::filesystem;
+    fs::path cache_dir = fs::path(std::getenv("HOME")) / ".cache" / "ouroboros";
+    if (!fs::exists(cache_dir)) {
+        fs::create_directories(cache_dir);
+    }
+
+    struct sigaction sa{};
+    sa.sa_handler = daemon_signal_handler;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+    signal(SIGPIPE, SIG_IGN);  // A client vanishing mid-reply is routine
+
+    auto publisher = std::make_shared<SnapshotPublisher>();
+    publisher->update([&config](model::Snapshot& snap) {
+        snap.player.volume_percent = config.default_volume;
+        snap.player.shuffle_enabled = config.shuffle;
+        if (config.repeat == "one") {
+            snap.player.repeat_mode = model::RepeatMode::One;
+        } else if (config.repeat == "all") {
+            snap.player.repeat_mode = model::RepeatMode::All;
+        } else {
+            snap.player.repeat_mode = model::RepeatMode::Off;
+        }
+    });
+
+    auto& queue_journal = QueueJournal::instance();
+    queue_journal.open(cache_dir / "queue.journal");
+
+    events::register_core_handlers(publisher, queue_journal);
+
+    collectors::LibraryCollector lib_collector(publisher, config);
+    collectors::PlaybackCollector pb_collector(publisher);
+
+    std::jthread lib_thread([&lib_collector](std::stop_token st) {
+        while (!st.stop_requested() && !g_daemon_shutdown.load()) {
+            lib_collector.run(st);
+            if (g_daemon_shutdown.load()) break;
+        }
+    });
+    std::jthread pb_thread([&pb_collector, &config](std::stop_token st) {
+        util::Platform::set_current_thread_role(util::Platform::ThreadRole::AudioDecode);
+        if (config.audio_cpu_affinity >= 0) {
+            util::Platform::pin_current_thread_to_cpu(config.audio_cpu_affinity);
+        }
+        while (!st.stop_requested() && !g_daemon_shutdown.load()) {
+            pb_collector.run(st);
+            if (g_daemon_shutdown.load()) break;
+        }
+    });
+
+    ControlSocket control;
+    auto socket_path = ControlSocket::default_path();
+    if (!control.open(socket_path)) {
+        util::Logger::error("Daemon: control socket unavailable, transport is signal-only");
+    }
+
+    // Shared-memory state mirror for external readers (status bars
+    // etc.); optional like the control socket
+    SnapshotMirror mirror;
+    if (!mirror.open_writer()) {
+        util::Logger::warn("Daemon: shm state mirror unavailable");
+    }
+    uint64_t last_mirrored_seq = 0;
+
+    auto& event_bus = events::EventBus::instance();
+    bool queue_restored = queue_journal.restored_paths().empty();
+
+    while (!g_daemon_shutdown.load()) {
+        event_bus.drain();
+        publisher->flush_batched();
+
+        // Same deferred queue restore as the UI loop: journaled paths
+        // resolve against display indices once the library publishes
+        auto snap = publisher->get_current();
+        if (!queue_restored && snap && snap->library && !snap->library->tracks.empty()) {
+            queue_restored = true;
+            auto restored = queue_journal.restored_paths();
+            publisher->update(SnapshotPublisher::SectionQueue,
+                [&restored](model::Snapshot& s) {
+                    std::unordered_map<std::string_view, int> index_by_path;
+                    index_by_path.reserve(s.library->tracks.size());
+                    for (size_t i = 0; i < s.library->tracks.size(); ++i) {
+                        index_by_path.emplace(s.library->tracks[i].path,
+                                              util::narrow_cast<int>(i));
+                    }
+                    auto new_queue = s.queue
+                        ? std::make_shared<model::QueueState>(*s.queue)
+                        : std::make_shared<model::QueueState>();
+                    size_t resolved = 0;
+                    for (const auto& path : restored) {
+                        auto it = index_by_path.find(path);
+                        if (it == index_by_path.end()) continue;
+                        new_queue->future.push_back(it->second);
+                        ++resolved;
+                    }
+                    s.queue = new_queue;
+                    util::Logger::info("Daemon: restored " + std::to_string(resolved) +
+                                       " of " + std::to_string(restored.size()) +
+                                       " queued tracks");
+                });
+        }
+
+        if (snap && snap->seq != last_mirrored_seq) {
+            last_mirrored_seq = snap->seq;
+            mirror.publish(*snap);
+        }
+
+        control.service(200, [&publisher, &event_bus](const std::string& line) {
+            // Commands publish events; drain so the reply (and any
+            // follow-up status) sees their effect
+            std::string reply = dispatch_command(line, publisher);
+            event_bus.drain();
+            return reply;
+        });
+    }
+
+    util::Logger::info("Daemon: shutting down...");
+    mirror.close();
+    control.close();
+    queue_journal.shutdown();
+    util::Logger::info("OUROBOROS daemon shutdown");
+    return 0;
+}
+
+}  // namespace ouroboros::backend
@@ -1,30 +1,185 @@
 #include "backend/Library.hpp"
 #include "backend/MetadataParser.hpp"
+#include "audio/LoudnessAnalyzer.hpp"
+#include "backend/MetadataCache.hpp"
 #include "backend/ArtworkCache.hpp"
 #include "util/Logger.hpp"
 #include "util/DirectoryScanner.hpp"
+#include "util/Platform.hpp"
+#include "util/ScanGovernor.hpp"
+#include "util/Lz4.hpp"
+#include "util/MappedFile.hpp"
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
 #include <sys/stat.h>  // For stat() to get inode
+#include <fcntl.h>
+#include <unistd.h>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <thread>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <vector>
 
 namespace ouroboros::backend {
 
 // Binary format version magic
 constexpr uint32_t CACHE_MAGIC = 0x4F55524F; // 'OURO'
-constexpr uint32_t CACHE_VERSION = 3;  // v3: Added file_mtime and file_inode for optimization
+constexpr uint32_t CACHE_VERSION = 8;  // v8: v7 layout, payload LZ4-compressed
 
-// Helper to read/write string
-static void write_string(std::ofstream& out, const std::string& s) {
-    uint32_t len = static_cast<uint32_t>(s.length());
-    out.write(reinterpret_cast<const char*>(&len), sizeof(len));
-    if (len > 0) out.write(s.data(), len);
+// ═══════════════════════════════════════════════════════════════════════════
+// CACHE_VERSION 6 on-disk layout
+//
+//   CacheHeader | string table | padding to 8 | CacheRecord[track_count]
+//              | DirRecord[dir_count]
+//
+// All strings live in one deduplicated table (interned artist/album/
+// genre/date collapse to a single entry each); records are fixed-width
+// and 8-byte aligned so load_from_cache can mmap the file and read
+// fields straight out of the mapping via string_views instead of doing
+// one ifstream read plus one allocation per field.
+//
+// v5 appends the directory table: per-directory mtimes and hashes of
+// each dir's own audio paths, plus their XOR in the header. TIER 0
+// validation reuses stored hashes for directories whose mtime didn't
+// move and re-hashes only dirty ones — O(changed) instead of a full
+// tree walk. v4 files (no dir table) still load; they just take the
+// full-scan validation path once and get rewritten as v5.
+//
+// v6 widens CacheRecord with the loudness scanner's ReplayGain fields
+// (104 -> 112 bytes). v4/v5 records are the 104-byte prefix of the v6
+// layout, so the loader walks older files with the legacy stride and
+// leaves the gains at their unscanned defaults.
+//
+// v7 appends the persisted sort order: uint32 record indices in the
+// collector's display order plus a fingerprint of the comparator config
+// in the (widened) header, so a clean start can skip re-sorting the
+// whole library. v4-v6 headers are the 64-byte prefix of the v7 header.
+//
+// v8 keeps the v7 layout but stores everything after the (raw) header
+// LZ4-compressed: uint64 inflated payload size, then blocks of
+// [u32 raw_len][u32 comp_len][bytes], comp_len == raw_len marking a
+// stored (incompressible) block. Header offsets describe the inflated
+// layout, so the loader inflates into a buffer shaped exactly like a
+// v7 file and the parser below runs unchanged on either.
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+struct StrRef {
+    uint32_t off;   // Offset into the string table
+    uint32_t len;
+};
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t track_count;
+    uint64_t strtab_offset;
+    uint64_t strtab_size;
+    uint64_t records_offset;   // 8-byte aligned
+    // v5 fields (a v4 header stops at records_offset)
+    uint64_t tree_hash;        // XOR of all DirRecord hashes
+    uint64_t dirs_offset;      // 8-byte aligned
+    uint64_t dir_count;
+    // v7 fields (a v4-v6 header stops at dir_count)
+    uint64_t sort_fingerprint; // Comparator config the order was built with
+    uint64_t sort_offset;      // uint32[track_count] record indices, 0 = none
+};
+
+struct DirRecord {
+    StrRef path;        // Root-relative, same keys as dir_mtimes_
+    int64_t mtime;
+    uint64_t hash;      // Hash of the dir's own audio paths, 0 if none
+};
+
+struct CacheRecord {
+    StrRef path;
+    StrRef title;
+    StrRef artist;
+    StrRef album;
+    StrRef genre;
+    StrRef date;
+    StrRef artwork_hash;
+    int64_t file_mtime;
+    uint64_t file_inode;
+    int32_t track_number;
+    int32_t duration_ms;
+    uint32_t format;
+    int32_t sample_rate;
+    int32_t channels;
+    int32_t bit_depth;
+    int32_t bitrate;
+    uint8_t is_valid;
+    uint8_t is_compilation;
+    uint8_t loudness_scanned;
+    uint8_t pad;
+    // v6 fields: everything above is the v4/v5 104-byte record
+    float track_gain_db;
+    float album_gain_db;
+};
+
+// Stride for walking v4/v5 record arrays (the v6 prefix)
+constexpr size_t CACHE_RECORD_SIZE_V5 = 104;
+// v4-v6 header size (the v7 prefix)
+constexpr size_t CACHE_HEADER_SIZE_V6 = 64;
+
+static_assert(std::is_trivially_copyable_v<CacheRecord>);
+static_assert(std::is_trivially_copyable_v<DirRecord>);
+static_assert(sizeof(CacheHeader) == 80, "Cache header layout is part of the on-disk format");
+static_assert(offsetof(CacheHeader, sort_fingerprint) == CACHE_HEADER_SIZE_V6,
+              "v4-v6 headers must be the prefix of the v7 layout");
+static_assert(sizeof(CacheRecord) == 112, "Cache record layout is part of the on-disk format");
+static_assert(offsetof(CacheRecord, track_gain_db) == CACHE_RECORD_SIZE_V5,
+              "v4/v5 records must be the prefix of the v6 layout");
+static_assert(sizeof(DirRecord) == 24, "Dir record layout is part of the on-disk format");
+
+// v8 compressed payload: independent blocks keep a corrupt or truncated
+// tail from poisoning the whole file and bound the scratch memory
+constexpr size_t CACHE_LZ4_BLOCK = 256 * 1024;
+
+// Inflate a v8 file into a buffer laid out like a v7 file: raw header
+// up front, payload at its uncompressed offsets behind it
+bool inflate_cache_payload(const void* data, size_t size, std::vector<char>& out) {
+    if (size < sizeof(CacheHeader) + sizeof(uint64_t)) return false;
+    const char* p = static_cast<const char*>(data) + sizeof(CacheHeader);
+    const char* end = static_cast<const char*>(data) + size;
+
+    uint64_t raw_size = 0;
+    std::memcpy(&raw_size, p, sizeof(raw_size));
+    p += sizeof(raw_size);
+
+    out.resize(sizeof(CacheHeader) + raw_size);
+    std::memcpy(out.data(), data, sizeof(CacheHeader));
+
+    size_t off = sizeof(CacheHeader);
+    while (off < out.size()) {
+        if (end - p < static_cast<ptrdiff_t>(2 * sizeof(uint32_t))) return false;
+        uint32_t raw_len = 0, comp_len = 0;
+        std::memcpy(&raw_len, p, sizeof(raw_len));
+        std::memcpy(&comp_len, p + sizeof(raw_len), sizeof(comp_len));
+        p += 2 * sizeof(uint32_t);
+        if (raw_len == 0 || raw_len > out.size() - off ||
+            comp_len > static_cast<size_t>(end - p)) {
+            return false;
+        }
+        if (comp_len == raw_len) {
+            std::memcpy(out.data() + off, p, raw_len);
+        } else if (!util::lz4::decompress_block({p, comp_len}, out.data() + off, raw_len)) {
+            return false;
+        }
+        p += comp_len;
+        off += raw_len;
+    }
+    return off == out.size();
 }
 
+}  // namespace
+
+// Helper to read string (legacy v2/v3 stream format)
 static std::string read_string(std::ifstream& in) {
     uint32_t len;
     in.read(reinterpret_cast<char*>(&len), sizeof(len));
@@ -36,6 +191,226 @@ static std::string read_string(std::ifstream& in) {
     return "";
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// APPEND JOURNAL (.bin.journal)
+//
+// A full snapshot rewrite is a multi-hundred-MB write even when a
+// rescan only touched a handful of files. Routine saves instead append
+// length-prefixed change records (upsert/delete) to a sidecar journal;
+// load_from_cache replays it over the snapshot. The snapshot is
+// rewritten and the journal truncated when the whole library changed
+// or the journal passes JOURNAL_COMPACT_BYTES.
+// ═══════════════════════════════════════════════════════════════════════════
+
+constexpr uint32_t JOURNAL_MAGIC = 0x4F55524A;  // 'OURJ'
+constexpr uint32_t JOURNAL_VERSION = 2;  // v2: + ReplayGain fields
+constexpr size_t JOURNAL_COMPACT_BYTES = 8 * 1024 * 1024;
+
+constexpr uint8_t JOURNAL_OP_UPSERT = 1;
+constexpr uint8_t JOURNAL_OP_DELETE = 2;
+
+static std::filesystem::path journal_path_for(const std::filesystem::path& cache_path) {
+    return cache_path.string() + ".journal";
+}
+
+static void write_string(std::ofstream& out, const std::string& s) {
+    uint32_t len = static_cast<uint32_t>(s.length());
+    out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+    if (len > 0) out.write(s.data(), len);
+}
+
+static void write_journal_track(std::ofstream& out, const model::Track& t) {
+    write_string(out, t.path);
+    write_string(out, t.title);
+    write_string(out, t.artist);
+    write_string(out, t.album);
+    write_string(out, t.genre);
+    write_string(out, t.date);
+    write_string(out, t.artwork_hash);
+    out.write(reinterpret_cast<const char*>(&t.track_number), sizeof(t.track_number));
+    out.write(reinterpret_cast<const char*>(&t.duration_ms), sizeof(t.duration_ms));
+    out.write(reinterpret_cast<const char*>(&t.format), sizeof(t.format));
+    out.write(reinterpret_cast<const char*>(&t.sample_rate), sizeof(t.sample_rate));
+    out.write(reinterpret_cast<const char*>(&t.channels), sizeof(t.channels));
+    out.write(reinterpret_cast<const char*>(&t.bit_depth), sizeof(t.bit_depth));
+    out.write(reinterpret_cast<const char*>(&t.bitrate), sizeof(t.bitrate));
+    out.write(reinterpret_cast<const char*>(&t.file_mtime), sizeof(t.file_mtime));
+    out.write(reinterpret_cast<const char*>(&t.file_inode), sizeof(t.file_inode));
+    out.write(reinterpret_cast<const char*>(&t.is_valid), sizeof(t.is_valid));
+    out.write(reinterpret_cast<const char*>(&t.is_compilation), sizeof(t.is_compilation));
+    out.write(reinterpret_cast<const char*>(&t.loudness_scanned), sizeof(t.loudness_scanned));
+    out.write(reinterpret_cast<const char*>(&t.track_gain_db), sizeof(t.track_gain_db));
+    out.write(reinterpret_cast<const char*>(&t.album_gain_db), sizeof(t.album_gain_db));
+}
+
+static model::Track read_journal_track(std::ifstream& in) {
+    model::Track t;
+    t.path = read_string(in);
+    t.title = read_string(in);
+    t.artist = read_string(in);
+    t.album = read_string(in);
+    t.genre = read_string(in);
+    t.date = read_string(in);
+    t.artwork_hash = read_string(in);
+    in.read(reinterpret_cast<char*>(&t.track_number), sizeof(t.track_number));
+    in.read(reinterpret_cast<char*>(&t.duration_ms), sizeof(t.duration_ms));
+    in.read(reinterpret_cast<char*>(&t.format), sizeof(t.format));
+    in.read(reinterpret_cast<char*>(&t.sample_rate), sizeof(t.sample_rate));
+    in.read(reinterpret_cast<char*>(&t.channels), sizeof(t.channels));
+    in.read(reinterpret_cast<char*>(&t.bit_depth), sizeof(t.bit_depth));
+    in.read(reinterpret_cast<char*>(&t.bitrate), sizeof(t.bitrate));
+    in.read(reinterpret_cast<char*>(&t.file_mtime), sizeof(t.file_mtime));
+    in.read(reinterpret_cast<char*>(&t.file_inode), sizeof(t.file_inode));
+    in.read(reinterpret_cast<char*>(&t.is_valid), sizeof(t.is_valid));
+    in.read(reinterpret_cast<char*>(&t.is_compilation), sizeof(t.is_compilation));
+    in.read(reinterpret_cast<char*>(&t.loudness_scanned), sizeof(t.loudness_scanned));
+    in.read(reinterpret_cast<char*>(&t.track_gain_db), sizeof(t.track_gain_db));
+    in.read(reinterpret_cast<char*>(&t.album_gain_db), sizeof(t.album_gain_db));
+    return t;
+}
+
+// Replay journaled changes over a freshly loaded snapshot. A torn tail
+// (crash mid-append) simply ends the replay.
+// Returns the number of applied change records so the caller knows the
+// snapshot's derived data (e.g. the persisted sort order) is stale
+static size_t replay_journal(
+    const std::filesystem::path& journal_path,
+    util::FlatMap<std::string, model::Track>& tracks
+) {
+    std::ifstream in(journal_path, std::ios::binary);
+    if (!in) return 0;
+
+    uint32_t magic = 0, version = 0;
+    in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!in || magic != JOURNAL_MAGIC || version != JOURNAL_VERSION) {
+        util::Logger::warn("Library: Ignoring journal with bad header");
+        return 0;
+    }
+
+    size_t replayed = 0;
+    while (true) {
+        uint8_t op;
+        in.read(reinterpret_cast<char*>(&op), sizeof(op));
+        if (!in) break;
+
+        if (op == JOURNAL_OP_UPSERT) {
+            model::Track t = read_journal_track(in);
+            if (!in) break;
+            tracks[t.path] = std::move(t);
+        } else if (op == JOURNAL_OP_DELETE) {
+            std::string path = read_string(in);
+            if (!in) break;
+            tracks.erase(path);
+        } else {
+            util::Logger::warn("Library: Unknown journal op, stopping replay");
+            break;
+        }
+        replayed++;
+    }
+
+    if (replayed > 0) {
+        util::Logger::info("Library: Replayed " + std::to_string(replayed) + " journal entries");
+    }
+    return replayed;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// READ-AHEAD PREFETCH (TIER 3 helper)
+//
+// MetadataParser opens each file cold, so on spinning disks the
+// parallel parse is dominated by first-read seek latency. This stage
+// walks the parse list a window ahead of the workers' shared
+// work_index and asks the kernel to pull the tag regions (head, plus
+// the tail where ID3v1/APE/moov can live) into page cache, so parses
+// hit warm pages in scan-result order.
+// ═══════════════════════════════════════════════════════════════════════════
+static void prefetch_tag_regions(
+    const std::vector<std::string>& files,
+    const std::atomic<size_t>& work_index,
+    const std::atomic<bool>& done
+) {
+    constexpr size_t PREFETCH_WINDOW = 64;     // Files ahead of the parsers
+    constexpr off_t HEAD_BYTES = 512 * 1024;   // ID3v2/FLAC/fmt headers
+    constexpr off_t TAIL_BYTES = 64 * 1024;    // ID3v1/APE tags, trailing moov
+
+    size_t next = 0;
+    while (next < files.size() && !done.load(std::memory_order_relaxed)) {
+        size_t target = std::min(files.size(),
+                                 work_index.load(std::memory_order_relaxed) + PREFETCH_WINDOW);
+        if (next >= target) {
+            // Far enough ahead; let the parsers catch up
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            continue;
+        }
+
+        int fd = ::open(files[next].c_str(), O_RDONLY | O_CLOEXEC);
+        next++;
+        if (fd < 0) continue;
+
+        posix_fadvise(fd, 0, HEAD_BYTES, POSIX_FADV_WILLNEED);
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > HEAD_BYTES + TAIL_BYTES) {
+            posix_fadvise(fd, st.st_size - TAIL_BYTES, TAIL_BYTES, POSIX_FADV_WILLNEED);
+        }
+        close(fd);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DIRECTORY-LEVEL ARTWORK EXTRACTION (TIER 3 helper)
+//
+// Every track in an album directory embeds the same cover, so per-track
+// extract_artwork_data decoded and hashed the identical image 20 times
+// per album before ArtworkCache::store dedup'd by hash. The coordinator
+// extracts once per directory: the first worker to reach a dir claims
+// it and extracts, later workers block briefly (extraction is ~ms) and
+// reuse the recorded hash. A directory with no embedded art records an
+// empty hash so its siblings skip extraction too. Per-track covers that
+// differ from the album's are reconciled later by ArtworkWindow's
+// force_extract path, same as before.
+// ═══════════════════════════════════════════════════════════════════════════
+class DirArtworkCoordinator {
+public:
+    // Returns the artwork hash for the track's directory (empty if the
+    // directory's tracks carry no embedded art). Extracts and stores in
+    // ArtworkCache on first call per directory; subsequent calls reuse.
+    std::string hash_for(const std::string& track_path, const std::string& dir) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto [it, claimed] = dirs_.try_emplace(dir);
+        if (!claimed) {
+            // Another worker owns this dir; wait for its result
+            cv_.wait(lock, [&] { return it->second.done; });
+            return it->second.hash;
+        }
+
+        lock.unlock();
+        auto artwork_result = MetadataParser::extract_artwork_data(track_path);
+        std::string hash;
+        if (!artwork_result.data.empty() && !artwork_result.hash.empty()) {
+            hash = artwork_result.hash;
+            ArtworkCache::instance().store(artwork_result.hash, artwork_result.data,
+                                           artwork_result.mime_type, dir);
+        }
+        lock.lock();
+
+        it->second.hash = hash;
+        it->second.done = true;
+        cv_.notify_all();
+        return hash;
+    }
+
+private:
+    struct DirResult {
+        bool done = false;
+        std::string hash;
+    };
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, DirResult> dirs_;  // Node-based: refs stay valid
+};
+
 Library::Library() {}
 
 void Library::set_music_directory(const std::filesystem::path& dir) {
@@ -89,7 +464,69 @@ void Library::set_music_directories(const std::vector<std::filesystem::path>& di
     }
 }
 
-bool Library::save_to_cache(const std::filesystem::path& cache_path) const {
+bool Library::save_to_cache(const std::filesystem::path& cache_path) {
+    const auto journal_path = journal_path_for(cache_path);
+
+    if (full_save_needed_ || !std::filesystem::exists(cache_path)) {
+        return write_full_snapshot(cache_path);
+    }
+
+    if (journal_dirty_.empty() && journal_deleted_.empty()) {
+        if (sort_order_dirty_ && !sorted_paths_.empty()) {
+            // Track data is unchanged but the snapshot lacks a usable
+            // sort table; rewrite once so the next start skips sorting
+            return write_full_snapshot(cache_path);
+        }
+        return true;  // Nothing changed since the snapshot
+    }
+
+    // Compact once the journal gets big enough that replay would hurt
+    std::error_code ec;
+    const auto journal_size = std::filesystem::file_size(journal_path, ec);
+    if (!ec && journal_size > JOURNAL_COMPACT_BYTES) {
+        util::Logger::info("Library: Journal exceeded compaction threshold, rewriting snapshot");
+        return write_full_snapshot(cache_path);
+    }
+
+    try {
+        const bool fresh = ec || journal_size == 0;  // file_size failed -> no journal yet
+        std::ofstream out(journal_path, std::ios::binary | std::ios::app);
+        if (!out) return write_full_snapshot(cache_path);
+
+        if (fresh) {
+            out.write(reinterpret_cast<const char*>(&JOURNAL_MAGIC), sizeof(JOURNAL_MAGIC));
+            out.write(reinterpret_cast<const char*>(&JOURNAL_VERSION), sizeof(JOURNAL_VERSION));
+        }
+
+        for (const auto& path : journal_deleted_) {
+            out.write(reinterpret_cast<const char*>(&JOURNAL_OP_DELETE), sizeof(JOURNAL_OP_DELETE));
+            write_string(out, path);
+        }
+        for (const auto& path : journal_dirty_) {
+            auto it = tracks_.find(path);
+            if (it == tracks_.end()) continue;  // Dirtied then pruned
+            out.write(reinterpret_cast<const char*>(&JOURNAL_OP_UPSERT), sizeof(JOURNAL_OP_UPSERT));
+            write_journal_track(out, it->second);
+        }
+
+        if (!out.good()) {
+            util::Logger::warn("Library: Journal append failed, rewriting snapshot");
+            return write_full_snapshot(cache_path);
+        }
+
+        util::Logger::info("Library: Appended " +
+                          std::to_string(journal_dirty_.size() + journal_deleted_.size()) +
+                          " change records to journal");
+        journal_dirty_.clear();
+        journal_deleted_.clear();
+        return true;
+    } catch (const std::exception& e) {
+        util::Logger::error("Failed to append library journal: " + std::string(e.what()));
+        return write_full_snapshot(cache_path);
+    }
+}
+
+bool Library::write_full_snapshot(const std::filesystem::path& cache_path) {
     // Binary format invariants for serialized POD fields
     static_assert(sizeof(uint32_t) == 4);
     static_assert(sizeof(uint64_t) == 8);
@@ -102,42 +539,153 @@ bool Library::save_to_cache(const std::filesystem::path& cache_path) const {
         std::ofstream out(cache_path, std::ios::binary);
         if (!out) return false;
 
-        // Header
-        out.write(reinterpret_cast<const char*>(&CACHE_MAGIC), sizeof(CACHE_MAGIC));
-        out.write(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION));
+        // Build the deduplicated string table. Interned fields mean all
+        // tracks of an album contribute their artist/album/genre/date
+        // strings exactly once.
+        std::string strtab;
+        std::unordered_map<std::string_view, StrRef> table_index;
+        auto add_string = [&](const std::string& s) -> StrRef {
+            if (auto it = table_index.find(s); it != table_index.end()) {
+                return it->second;
+            }
+            StrRef ref{static_cast<uint32_t>(strtab.size()),
+                       static_cast<uint32_t>(s.size())};
+            strtab += s;
+            table_index.emplace(s, ref);  // Key views the Track, which outlives us
+            return ref;
+        };
+
+        std::vector<CacheRecord> records;
+        records.reserve(tracks_.size());
+        for (const auto& [path, t] : tracks_) {
+            CacheRecord r{};
+            r.path = add_string(t.path);
+            r.title = add_string(t.title);
+            r.artist = add_string(t.artist);
+            r.album = add_string(t.album);
+            r.genre = add_string(t.genre);
+            r.date = add_string(t.date);
+            r.artwork_hash = add_string(t.artwork_hash);
+            r.file_mtime = static_cast<int64_t>(t.file_mtime);
+            r.file_inode = t.file_inode;
+            r.track_number = t.track_number;
+            r.duration_ms = t.duration_ms;
+            r.format = static_cast<uint32_t>(t.format);
+            r.sample_rate = t.sample_rate;
+            r.channels = t.channels;
+            r.bit_depth = t.bit_depth;
+            r.bitrate = t.bitrate;
+            r.is_valid = t.is_valid ? 1 : 0;
+            r.is_compilation = t.is_compilation ? 1 : 0;
+            r.loudness_scanned = t.loudness_scanned ? 1 : 0;
+            r.track_gain_db = t.track_gain_db;
+            r.album_gain_db = t.album_gain_db;
+            records.push_back(r);
+        }
 
-        // Track count
-        uint64_t count = tracks_.size();
-        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        // Directory table: mtimes plus per-dir hashes so the next run's
+        // TIER 0 validation only re-hashes dirs whose mtime moved
+        std::vector<DirRecord> dir_records;
+        dir_records.reserve(dir_mtimes_.size());
+        for (const auto& [dir, mtime] : dir_mtimes_) {
+            DirRecord d{};
+            d.path = add_string(dir);
+            d.mtime = static_cast<int64_t>(mtime);
+            auto it = dir_hashes_.find(dir);
+            d.hash = it != dir_hashes_.end() ? it->second : 0;
+            dir_records.push_back(d);
+        }
 
-        for (const auto& [path, t] : tracks_) {
-            write_string(out, t.path);
-            write_string(out, t.title);
-            write_string(out, t.artist);
-            write_string(out, t.album);
-            write_string(out, t.genre);
-            write_string(out, t.date);
-
-            // POD fields
-            out.write(reinterpret_cast<const char*>(&t.track_number), sizeof(t.track_number));
-            out.write(reinterpret_cast<const char*>(&t.duration_ms), sizeof(t.duration_ms));
-            out.write(reinterpret_cast<const char*>(&t.format), sizeof(t.format));
-            out.write(reinterpret_cast<const char*>(&t.sample_rate), sizeof(t.sample_rate));
-            out.write(reinterpret_cast<const char*>(&t.channels), sizeof(t.channels));
-            out.write(reinterpret_cast<const char*>(&t.bit_depth), sizeof(t.bit_depth));
-            out.write(reinterpret_cast<const char*>(&t.bitrate), sizeof(t.bitrate));
-
-            // Phase 4: Serialize artwork hash
-            write_string(out, t.artwork_hash);
+        // Persisted sort order (v7): each display position's record
+        // index. Only written when the collector's order covers exactly
+        // the tracks being saved.
+        std::vector<uint32_t> sort_table;
+        if (!sorted_paths_.empty() && sorted_paths_.size() == records.size()) {
+            std::unordered_map<std::string_view, uint32_t> record_index;
+            record_index.reserve(records.size());
+            uint32_t next_record = 0;
+            for (const auto& [path, t] : tracks_) {
+                record_index.emplace(t.path, next_record++);
+            }
+            sort_table.reserve(sorted_paths_.size());
+            for (const auto& path : sorted_paths_) {
+                auto it = record_index.find(path);
+                if (it == record_index.end()) {
+                    sort_table.clear();
+                    break;
+                }
+                sort_table.push_back(it->second);
+            }
+        }
 
-            // CACHE_VERSION 3: Optimization fields
-            out.write(reinterpret_cast<const char*>(&t.file_mtime), sizeof(t.file_mtime));
-            out.write(reinterpret_cast<const char*>(&t.file_inode), sizeof(t.file_inode));
+        CacheHeader header{};
+        header.magic = CACHE_MAGIC;
+        header.version = CACHE_VERSION;
+        header.track_count = records.size();
+        header.strtab_offset = sizeof(CacheHeader);
+        header.strtab_size = strtab.size();
+        // Keep records 8-byte aligned so the mmap'd loader can read
+        // them in place
+        header.records_offset = (header.strtab_offset + header.strtab_size + 7) & ~uint64_t{7};
+        header.tree_hash = last_tree_hash_;
+        // CacheRecord is a multiple of 8 bytes, so this stays aligned
+        header.dirs_offset = header.records_offset + records.size() * sizeof(CacheRecord);
+        header.dir_count = dir_records.size();
+        header.sort_fingerprint = sort_table.empty() ? 0 : sort_fingerprint_;
+        header.sort_offset = sort_table.empty()
+            ? 0 : header.dirs_offset + dir_records.size() * sizeof(DirRecord);
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        // Assemble the uncompressed payload (everything the header's
+        // offsets describe), then write it as independent LZ4 blocks.
+        // Paths share long directory prefixes and the fixed-width
+        // records repeat byte patterns, so this cuts the file - and the
+        // startup read - several-fold.
+        std::string payload;
+        payload.reserve(strtab.size() + 8 + records.size() * sizeof(CacheRecord) +
+                        dir_records.size() * sizeof(DirRecord) +
+                        sort_table.size() * sizeof(uint32_t));
+        payload.append(strtab);
+        payload.append(header.records_offset - header.strtab_offset - header.strtab_size, '\0');
+        if (!records.empty()) {
+            payload.append(reinterpret_cast<const char*>(records.data()),
+                           records.size() * sizeof(CacheRecord));
+        }
+        if (!dir_records.empty()) {
+            payload.append(reinterpret_cast<const char*>(dir_records.data()),
+                           dir_records.size() * sizeof(DirRecord));
+        }
+        if (!sort_table.empty()) {
+            payload.append(reinterpret_cast<const char*>(sort_table.data()),
+                           sort_table.size() * sizeof(uint32_t));
+        }
 
-            // is_valid
-            out.write(reinterpret_cast<const char*>(&t.is_valid), sizeof(t.is_valid));
+        const uint64_t raw_size = payload.size();
+        out.write(reinterpret_cast<const char*>(&raw_size), sizeof(raw_size));
+        std::string block;
+        for (size_t off = 0; off < payload.size(); off += CACHE_LZ4_BLOCK) {
+            const uint32_t raw_len = static_cast<uint32_t>(
+                std::min(CACHE_LZ4_BLOCK, payload.size() - off));
+            block.clear();
+            util::lz4::compress_block({payload.data() + off, raw_len}, block);
+            // Incompressible block: store it raw (comp_len == raw_len)
+            const bool stored = block.size() >= raw_len;
+            const uint32_t comp_len = stored ? raw_len : static_cast<uint32_t>(block.size());
+            out.write(reinterpret_cast<const char*>(&raw_len), sizeof(raw_len));
+            out.write(reinterpret_cast<const char*>(&comp_len), sizeof(comp_len));
+            out.write(stored ? payload.data() + off : block.data(), comp_len);
         }
-        
+        if (!out.good()) return false;
+        out.close();
+
+        // Snapshot now covers everything; drop the journal
+        std::error_code ec;
+        std::filesystem::remove(journal_path_for(cache_path), ec);
+        journal_dirty_.clear();
+        journal_deleted_.clear();
+        full_save_needed_ = false;
+        sort_order_dirty_ = false;
         return true;
     } catch (const std::exception& e) {
         util::Logger::error("Failed to save library cache: " + std::string(e.what()));
@@ -148,6 +696,158 @@ bool Library::save_to_cache(const std::filesystem::path& cache_path) const {
 bool Library::load_from_cache(const std::filesystem::path& cache_path) {
     if (!std::filesystem::exists(cache_path)) return false;
 
+    // CACHE_VERSION 4: mmap the file and build tracks from views into
+    // the mapping. No per-field stream reads; the kernel pages data in
+    // as the single pass walks the record array, and interned fields
+    // dedup through the pool instead of allocating per track.
+    {
+        util::MappedFile map;
+        if (map.open_readonly(cache_path) && map.size >= CACHE_HEADER_SIZE_V6) {
+            // The parse below walks the whole file; start the page-in
+            // now so it streams ahead of the walk instead of faulting
+            // window by window
+            map.advise_willneed();
+            const auto* header = static_cast<const CacheHeader*>(map.data);
+            if (header->magic != CACHE_MAGIC) return false;
+            if (header->version >= 4 && header->version <= 8) {
+                // v8: inflate the LZ4 payload into a buffer shaped like
+                // a v7 file; the parse below is identical for both
+                const char* base = static_cast<const char*>(map.data);
+                size_t file_size = map.size;
+                std::vector<char> inflated;
+                if (header->version == 8) {
+                    if (!inflate_cache_payload(map.data, map.size, inflated)) {
+                        util::Logger::error("Library cache payload failed to inflate, ignoring cache");
+                        return false;
+                    }
+                    base = inflated.data();
+                    file_size = inflated.size();
+                    header = reinterpret_cast<const CacheHeader*>(base);
+                }
+
+                // v4/v5 records are the 104-byte prefix of the v6 layout
+                const bool has_gains = header->version >= 6;
+                const size_t record_size =
+                    has_gains ? sizeof(CacheRecord) : CACHE_RECORD_SIZE_V5;
+                const size_t records_bytes = header->track_count * record_size;
+                if (header->strtab_offset + header->strtab_size > file_size ||
+                    header->records_offset % alignof(CacheRecord) != 0 ||
+                    header->records_offset + records_bytes > file_size) {
+                    util::Logger::error("Library cache header out of bounds, ignoring cache");
+                    return false;
+                }
+                const bool has_dirs = header->version >= 5;
+                const size_t dirs_bytes = has_dirs
+                    ? header->dir_count * sizeof(DirRecord) : 0;
+                if (has_dirs &&
+                    (header->dirs_offset % alignof(DirRecord) != 0 ||
+                     header->dirs_offset + dirs_bytes > file_size)) {
+                    util::Logger::error("Library cache dir table out of bounds, ignoring cache");
+                    return false;
+                }
+
+                const char* strtab = base + header->strtab_offset;
+                const uint64_t strtab_size = header->strtab_size;
+                const char* records_base = base + header->records_offset;
+
+                auto view = [&](StrRef ref) -> std::string_view {
+                    if (uint64_t(ref.off) + ref.len > strtab_size) return {};
+                    return {strtab + ref.off, ref.len};
+                };
+
+                util::FlatMap<std::string, model::Track> loaded_tracks;
+                loaded_tracks.reserve(header->track_count);
+                for (uint64_t i = 0; i < header->track_count; ++i) {
+                    const CacheRecord& r = *reinterpret_cast<const CacheRecord*>(
+                        records_base + i * record_size);
+                    model::Track t;
+                    // Paths were normalized before the save; no per-track
+                    // lexically_normal pass needed here
+                    t.path = std::string(view(r.path));
+                    t.title = std::string(view(r.title));
+                    t.artist = view(r.artist);
+                    t.album = view(r.album);
+                    t.genre = view(r.genre);
+                    t.date = view(r.date);
+                    t.artwork_hash = std::string(view(r.artwork_hash));
+                    t.file_mtime = static_cast<std::time_t>(r.file_mtime);
+                    t.file_inode = r.file_inode;
+                    t.track_number = r.track_number;
+                    t.duration_ms = r.duration_ms;
+                    t.format = static_cast<model::AudioFormat>(r.format);
+                    t.sample_rate = r.sample_rate;
+                    t.channels = r.channels;
+                    t.bit_depth = r.bit_depth;
+                    t.bitrate = r.bitrate;
+                    t.is_valid = r.is_valid != 0;
+                    t.is_compilation = r.is_compilation != 0;
+                    if (has_gains) {
+                        t.loudness_scanned = r.loudness_scanned != 0;
+                        t.track_gain_db = r.track_gain_db;
+                        t.album_gain_db = r.album_gain_db;
+                    }
+
+                    std::string key = t.path;
+                    loaded_tracks[std::move(key)] = std::move(t);
+                }
+
+                if (has_dirs) {
+                    const auto* dirs =
+                        reinterpret_cast<const DirRecord*>(base + header->dirs_offset);
+                    dir_mtimes_.clear();
+                    dir_hashes_.clear();
+                    dir_mtimes_.reserve(header->dir_count);
+                    for (uint64_t i = 0; i < header->dir_count; ++i) {
+                        std::string dir(view(dirs[i].path));
+                        dir_mtimes_[dir] = static_cast<std::time_t>(dirs[i].mtime);
+                        if (dirs[i].hash != 0) {
+                            dir_hashes_[dir] = dirs[i].hash;
+                        }
+                    }
+                    last_tree_hash_ = header->tree_hash;
+                }
+
+                // Persisted sort order (v7): record indices in display
+                // order, mapped back to paths for the collector
+                sorted_paths_.clear();
+                sort_fingerprint_ = 0;
+                if (header->version >= 7 && file_size >= sizeof(CacheHeader) &&
+                    header->sort_offset != 0 && header->sort_fingerprint != 0 &&
+                    header->sort_offset % alignof(uint32_t) == 0 &&
+                    header->sort_offset + header->track_count * sizeof(uint32_t) <= file_size) {
+                    const auto* order =
+                        reinterpret_cast<const uint32_t*>(base + header->sort_offset);
+                    sorted_paths_.reserve(header->track_count);
+                    for (uint64_t i = 0; i < header->track_count; ++i) {
+                        if (order[i] >= header->track_count) {
+                            sorted_paths_.clear();
+                            break;
+                        }
+                        const CacheRecord& r = *reinterpret_cast<const CacheRecord*>(
+                            records_base + order[i] * record_size);
+                        sorted_paths_.emplace_back(view(r.path));
+                    }
+                    if (!sorted_paths_.empty()) {
+                        sort_fingerprint_ = header->sort_fingerprint;
+                    }
+                }
+
+                // Journal entries are not positioned in the stored sort
+                // order, so any replayed change invalidates it
+                if (replay_journal(journal_path_for(cache_path), loaded_tracks) > 0) {
+                    sorted_paths_.clear();
+                    sort_fingerprint_ = 0;
+                }
+                tracks_ = std::move(loaded_tracks);
+                // Older layouts load fine but get rewritten in the
+                // current format on the next save
+                full_save_needed_ = header->version != CACHE_VERSION;
+                return true;
+            }
+            // Older version: fall through to the legacy stream loader
+        }
+    }
+
     try {
         std::ifstream in(cache_path, std::ios::binary);
         if (!in) return false;
@@ -155,17 +855,17 @@ bool Library::load_from_cache(const std::filesystem::path& cache_path) {
         uint32_t magic, version;
         in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
         if (magic != CACHE_MAGIC) return false;
-        
+
         in.read(reinterpret_cast<char*>(&version), sizeof(version));
-        if (version != CACHE_VERSION && version != 2) {
+        if (version != 3 && version != 2) {
             util::Logger::error("Unsupported cache version: " + std::to_string(version));
-            return false;  // Only support v2 and v3
+            return false;  // Only support v2 and v3 here (v4 is mmap'd above)
         }
 
         uint64_t count;
         in.read(reinterpret_cast<char*>(&count), sizeof(count));
 
-        std::unordered_map<std::string, model::Track> loaded_tracks;
+        util::FlatMap<std::string, model::Track> loaded_tracks;
         loaded_tracks.reserve(count);
 
         for (uint64_t i = 0; i < count; ++i) {
@@ -210,7 +910,10 @@ bool Library::load_from_cache(const std::filesystem::path& cache_path) {
             loaded_tracks[t.path] = t;
         }
 
+        replay_journal(journal_path_for(cache_path), loaded_tracks);
         tracks_ = std::move(loaded_tracks);
+        // Legacy format on disk: force a v4 snapshot on next save
+        full_save_needed_ = true;
         return true;
     } catch (const std::exception& e) {
         util::Logger::error("Failed to load library cache: " + std::string(e.what()));
@@ -218,7 +921,23 @@ bool Library::load_from_cache(const std::filesystem::path& cache_path) {
     }
 }
 
-void Library::scan_directory(const std::function<void(int scanned, int total)>& progress_callback) {
+void Library::adopt_scan_dirs(const util::DirectoryScanner::ScanResult& scan_result) {
+    dir_mtimes_.clear();
+    dir_hashes_.clear();
+    dir_mtimes_.reserve(scan_result.dirs.size());
+    for (const auto& d : scan_result.dirs) {
+        std::string dir(scan_result.path_of(d));
+        dir_mtimes_[dir] = d.mtime;
+        if (d.hash != 0) {
+            dir_hashes_[dir] = d.hash;
+        }
+    }
+    last_tree_hash_ = scan_result.tree_hash;
+}
+
+void Library::scan_directory(
+    const std::function<void(int scanned, int total)>& progress_callback,
+    const std::function<void(std::vector<model::Track>&&)>& partial_callback) {
     ouroboros::util::Logger::info("Library: Starting directory scan for " + std::to_string(music_dirs_.size()) + " directories");
 
     is_scanning_ = true;
@@ -234,49 +953,47 @@ void Library::scan_directory(const std::function<void(int scanned, int total)>&
         // Scan all configured directories and merge results
         for (const auto& music_dir : music_dirs_) {
             util::Logger::info("Library: Scanning directory: " + music_dir.string());
-            auto dir_result = util::DirectoryScanner::scan_directory(music_dir);
-
-            // Merge results
-            scan_result.audio_files.insert(scan_result.audio_files.end(),
-                                            dir_result.audio_files.begin(),
-                                            dir_result.audio_files.end());
-            scan_result.dir_mtimes.insert(dir_result.dir_mtimes.begin(), dir_result.dir_mtimes.end());
-            scan_result.file_mtimes.insert(dir_result.file_mtimes.begin(), dir_result.file_mtimes.end());
-            scan_result.tree_hash ^= dir_result.tree_hash;  // XOR combine hashes
+            scan_result.merge(util::DirectoryScanner::scan_directory(music_dir));
         }
+        scan_result.finalize();  // Merging breaks sort order
     }
 
-    const int total_files = scan_result.audio_files.size();
+    const int total_files = scan_result.files.size();
     util::Logger::info("Library: Found " + std::to_string(total_files) + " audio files");
 
     // Store directory mtimes for TIER 1 validation
-    dir_mtimes_ = scan_result.dir_mtimes;
-    last_tree_hash_ = scan_result.tree_hash;
+    adopt_scan_dirs(scan_result);
 
     // Categorize files: cached vs new
     std::vector<std::string> files_to_parse;
-    std::unordered_map<std::string, model::Track> new_tracks;
+    util::FlatMap<std::string, model::Track> new_tracks;
 
-    for (const auto& path_str : scan_result.audio_files) {
+    for (const auto& rec : scan_result.files) {
+        std::string path_str(scan_result.path_of(rec));
         auto it = tracks_.find(path_str);
         if (it != tracks_.end()) {
-            // Check if file was modified (mtime comparison)
-            auto scan_mtime_it = scan_result.file_mtimes.find(path_str);
-            if (scan_mtime_it != scan_result.file_mtimes.end() &&
-                it->second.file_mtime > 0 &&
-                scan_mtime_it->second <= it->second.file_mtime) {
+            // Check if file was modified (mtime comparison; 0 = unknown)
+            if (rec.mtime != 0 && it->second.file_mtime > 0 &&
+                rec.mtime <= it->second.file_mtime) {
                 // File unchanged - keep cached metadata
                 new_tracks[path_str] = it->second;
             } else {
                 // File modified or mtime unknown - reparse
-                files_to_parse.push_back(path_str);
+                files_to_parse.push_back(std::move(path_str));
             }
         } else {
             // New file - parse it
-            files_to_parse.push_back(path_str);
+            files_to_parse.push_back(std::move(path_str));
         }
     }
 
+    // Journal bookkeeping: only reparsed files actually changed; reused
+    // cached tracks are byte-identical to the snapshot
+    for (const auto& path_str : files_to_parse) {
+        journal_deleted_.erase(path_str);
+        journal_dirty_.insert(path_str);
+    }
+
     util::Logger::info("Library: Reusing " + std::to_string(new_tracks.size()) +
                       " cached tracks, parsing " + std::to_string(files_to_parse.size()) + " new/modified");
 
@@ -292,49 +1009,80 @@ void Library::scan_directory(const std::function<void(int scanned, int total)>&
         std::atomic<int> completed{0};
         std::vector<model::Track> results(num_files);
 
-        // Launch worker threads
+        // Per-slot completion flags for the streaming harvest below;
+        // empty (and never stored to) without a partial_callback
+        std::vector<std::atomic<uint8_t>> parsed_flags(partial_callback ? num_files : 0);
+
+        // Read-ahead: warm tag regions a window ahead of the parsers
+        std::atomic<bool> parse_done{false};
+        std::thread prefetcher([&] {
+            util::Platform::set_current_thread_role(util::Platform::ThreadRole::BulkWorker);
+            prefetch_tag_regions(files_to_parse, work_index, parse_done);
+        });
+
+        // One artwork extraction per album directory for this scan
+        DirArtworkCoordinator artwork_coordinator;
+
+        // Launch worker threads (idle-class so parsing yields to playback)
         std::vector<std::thread> workers;
         for (size_t t = 0; t < num_threads; ++t) {
-            workers.emplace_back([&]() {
+            workers.emplace_back([&, t]() {
+                util::Platform::set_current_thread_role(util::Platform::ThreadRole::BulkWorker);
                 while (true) {
+                    // Back off while playback headroom is low (slot 0
+                    // always proceeds, so the parse can't stall)
+                    util::ScanGovernor::instance().throttle(t, num_threads);
                     size_t idx = work_index.fetch_add(1);
                     if (idx >= num_files) break;
 
                     const std::string& path_str = files_to_parse[idx];
                     std::filesystem::path path(path_str);
 
-                    // Parse metadata (thread-safe)
-                    model::Track track = MetadataParser::parse_file(path_str);
+                    const auto* scan_rec = scan_result.find_file(path_str);
+                    std::time_t scan_mtime = scan_rec ? scan_rec->mtime : 0;
+
+                    // Persistent metadata cache: a restart after a
+                    // partial scan resumes warm instead of re-parsing
+                    if (auto cached = MetadataCache::instance().get_cached_metadata(path_str, scan_mtime)) {
+                        results[idx] = std::move(*cached);
+                    } else {
+                        // Parse metadata (thread-safe)
+                        model::Track track = MetadataParser::parse_file(path_str);
+
+                        // Ensure format is set
+                        if (track.format == model::AudioFormat::Unknown) {
+                            if (path.extension() == ".mp3") track.format = model::AudioFormat::MP3;
+                            else if (path.extension() == ".flac") track.format = model::AudioFormat::FLAC;
+                            else if (path.extension() == ".ogg") track.format = model::AudioFormat::OGG;
+                            else if (path.extension() == ".wav") track.format = model::AudioFormat::WAV;
+                            else if (path.extension() == ".dsf") track.format = model::AudioFormat::DSD;
+                        }
 
-                    // Ensure format is set
-                    if (track.format == model::AudioFormat::Unknown) {
-                        if (path.extension() == ".mp3") track.format = model::AudioFormat::MP3;
-                        else if (path.extension() == ".flac") track.format = model::AudioFormat::FLAC;
-                        else if (path.extension() == ".ogg") track.format = model::AudioFormat::OGG;
-                        else if (path.extension() == ".wav") track.format = model::AudioFormat::WAV;
-                        else if (path.extension() == ".dsf") track.format = model::AudioFormat::DSD;
-                    }
+                        // Populate optimization fields
+                        track.file_mtime = scan_mtime;
 
-                    // Populate optimization fields
-                    auto scan_mtime_it = scan_result.file_mtimes.find(path_str);
-                    if (scan_mtime_it != scan_result.file_mtimes.end()) {
-                        track.file_mtime = scan_mtime_it->second;
-                    }
+                        struct stat st;
+                        if (stat(path_str.c_str(), &st) == 0) {
+                            track.file_inode = st.st_ino;
+                        }
 
-                    struct stat st;
-                    if (stat(path_str.c_str(), &st) == 0) {
-                        track.file_inode = st.st_ino;
-                    }
+                        // Artwork: one extraction per album directory, siblings
+                        // reuse the recorded hash (pre-populates for fast AlbumBrowser)
+                        std::string artwork_hash =
+                            artwork_coordinator.hash_for(path_str, path.parent_path().string());
+                        if (!artwork_hash.empty()) {
+                            track.artwork_hash = artwork_hash;
+                        }
 
-                    // Extract artwork and store in cache (pre-populates for fast AlbumBrowser)
-                    auto artwork_result = MetadataParser::extract_artwork_data(path_str);
-                    if (!artwork_result.data.empty() && !artwork_result.hash.empty()) {
-                        track.artwork_hash = artwork_result.hash;
-                        auto& artwork_cache = ArtworkCache::instance();
-                        artwork_cache.store(artwork_result.hash, artwork_result.data, artwork_result.mime_type, path.parent_path().string());
+                        MetadataCache::instance().cache_metadata(path_str, track);
+                        results[idx] = track;
                     }
 
-                    results[idx] = track;
+                    if (!parsed_flags.empty()) {
+                        // results[idx] is complete; release pairs with
+                        // the harvest loop's acquire
+                        parsed_flags[idx].store(1, std::memory_order_release);
+                    }
 
                     // Update progress every 100 files
                     int done = completed.fetch_add(1) + 1;
@@ -345,14 +1093,40 @@ void Library::scan_directory(const std::function<void(int scanned, int total)>&
             });
         }
 
+        // Streaming harvest: sweep the contiguous completed prefix of
+        // results and hand off disjoint batches while the workers keep
+        // parsing. Runs on the scan thread, so the callback never races
+        // a worker's store; batch contents are copies - the merge below
+        // still owns results.
+        if (partial_callback) {
+            constexpr size_t kStreamBatch = 5000;
+            size_t harvested = 0;  // results[0..harvested) observed complete
+            size_t emitted = 0;    // results[0..emitted) already delivered
+            while (harvested < num_files) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                while (harvested < num_files &&
+                       parsed_flags[harvested].load(std::memory_order_acquire)) {
+                    ++harvested;
+                }
+                if (harvested - emitted >= kStreamBatch) {
+                    std::vector<model::Track> batch(results.begin() + emitted,
+                                                    results.begin() + harvested);
+                    emitted = harvested;
+                    partial_callback(std::move(batch));
+                }
+            }
+        }
+
         // Wait for all threads
         for (auto& worker : workers) {
             worker.join();
         }
+        parse_done = true;
+        prefetcher.join();
 
         // Merge results
         for (size_t i = 0; i < num_files; ++i) {
-            new_tracks[files_to_parse[i]] = std::move(results[i]);
+            new_tracks.insert_or_assign(files_to_parse[i], std::move(results[i]));
         }
     }
 
@@ -365,18 +1139,24 @@ void Library::scan_directory(const std::function<void(int scanned, int total)>&
     // This preserves tracks from other directories (e.g., unmounted drives)
     // Only prune tracks whose files no longer exist anywhere
     for (auto& [path, track] : new_tracks) {
-        tracks_[path] = std::move(track);
+        tracks_.insert_or_assign(path, std::move(track));
     }
 
-    // Prune tracks that no longer exist on disk (cleanup stale entries)
-    for (auto it = tracks_.begin(); it != tracks_.end(); ) {
-        if (!std::filesystem::exists(it->first)) {
-            util::Logger::debug("Library: Pruning stale track: " + it->first);
-            it = tracks_.erase(it);
-        } else {
-            ++it;
+    // Prune tracks that no longer exist on disk (cleanup stale entries).
+    // Two-phase: FlatMap's backward-shift deletion moves entries, so
+    // collect first, erase after.
+    std::vector<std::string> stale;
+    for (const auto& [path, track] : tracks_) {
+        if (!std::filesystem::exists(path)) {
+            stale.push_back(path);
         }
     }
+    for (const auto& path : stale) {
+        util::Logger::debug("Library: Pruning stale track: " + path);
+        journal_dirty_.erase(path);
+        journal_deleted_.insert(path);
+        tracks_.erase(path);
+    }
 
     util::Logger::info("Library: Cache now contains " + std::to_string(tracks_.size()) + " tracks");
     is_scanning_ = false;
@@ -385,8 +1165,14 @@ void Library::scan_directory(const std::function<void(int scanned, int total)>&
 std::vector<model::Track> Library::get_all_tracks() const {
     std::vector<model::Track> result;
     result.reserve(tracks_.size());
+    for_each_track([&result](const model::Track& track) {
+        result.push_back(track);
+    });
+    return result;
+}
 
-    // Only return tracks from currently configured directories
+void Library::for_each_track(const std::function<void(const model::Track&)>& fn) const {
+    // Only visit tracks from currently configured directories
     // (cumulative cache may contain tracks from other directories)
     for (const auto& [path, track] : tracks_) {
         bool in_configured_dir = false;
@@ -397,9 +1183,32 @@ std::vector<model::Track> Library::get_all_tracks() const {
             }
         }
         if (in_configured_dir) {
-            result.push_back(track);
+            fn(track);
         }
     }
+}
+
+void Library::set_sort_order(std::vector<std::string> sorted_paths, uint64_t fingerprint) {
+    sorted_paths_ = std::move(sorted_paths);
+    sort_fingerprint_ = fingerprint;
+    // The caller only sorts fresh when the snapshot had no usable
+    // table, so what is on disk needs rewriting either way
+    sort_order_dirty_ = true;
+}
+
+std::optional<std::vector<model::Track>> Library::get_tracks_in_saved_order(
+    uint64_t fingerprint) const {
+    if (sorted_paths_.empty() || sort_fingerprint_ != fingerprint ||
+        sorted_paths_.size() != tracks_.size()) {
+        return std::nullopt;
+    }
+    std::vector<model::Track> result;
+    result.reserve(sorted_paths_.size());
+    for (const auto& path : sorted_paths_) {
+        auto it = tracks_.find(path);
+        if (it == tracks_.end()) return std::nullopt;
+        result.push_back(it->second);
+    }
     return result;
 }
 
@@ -415,7 +1224,62 @@ void Library::set_tracks(const std::vector<model::Track>& tracks) {
     tracks_.clear();
     tracks_.reserve(tracks.size());
     for (const auto& t : tracks) {
-        tracks_[t.path] = t;
+        tracks_.insert_or_assign(t.path, t);
+    }
+    // Wholesale replacement: the delta vs. the snapshot is unknown
+    journal_dirty_.clear();
+    journal_deleted_.clear();
+    full_save_needed_ = true;
+}
+
+void Library::set_track_loudness(const std::string& path, float track_gain_db) {
+    auto it = tracks_.find(path);
+    if (it == tracks_.end()) return;
+    it->second.track_gain_db = track_gain_db;
+    it->second.loudness_scanned = true;
+    journal_dirty_.insert(path);
+}
+
+void Library::recompute_album_gains() {
+    // Directory is truth (same grouping the album view uses). Per-track
+    // integrated loudness is recoverable from the stored gain, so album
+    // gain can be refreshed as each directory finishes scanning:
+    // duration-weighted energy mean of the member tracks' loudness.
+    struct DirAccum {
+        double energy_ms = 0.0;
+        double total_ms = 0.0;
+        bool complete = true;
+    };
+    std::unordered_map<std::string_view, DirAccum> dirs;
+
+    for (const auto& [path, t] : tracks_) {
+        if (!t.is_valid) continue;
+        size_t slash = path.rfind('/');
+        std::string_view dir(path.data(), slash != std::string::npos ? slash : 0);
+        DirAccum& acc = dirs[dir];
+        if (!t.loudness_scanned) {
+            acc.complete = false;
+            continue;
+        }
+        const double lufs = audio::LoudnessAnalyzer::REFERENCE_LUFS - t.track_gain_db;
+        const double ms = std::max(t.duration_ms, 1);
+        acc.energy_ms += ms * std::pow(10.0, lufs / 10.0);
+        acc.total_ms += ms;
+    }
+
+    for (auto& [path, t] : tracks_) {
+        if (!t.is_valid || !t.loudness_scanned) continue;
+        size_t slash = path.rfind('/');
+        std::string_view dir(path.data(), slash != std::string::npos ? slash : 0);
+        const DirAccum& acc = dirs[dir];
+        if (!acc.complete || acc.total_ms <= 0.0) continue;
+        const double album_lufs = 10.0 * std::log10(acc.energy_ms / acc.total_ms);
+        const float gain = static_cast<float>(
+            audio::LoudnessAnalyzer::REFERENCE_LUFS - album_lufs);
+        if (std::abs(gain - t.album_gain_db) > 0.01f) {
+            t.album_gain_db = gain;
+            journal_dirty_.insert(path);
+        }
     }
 }
 
@@ -435,28 +1299,60 @@ Library::CacheValidationResult Library::validate_cache_tier0(const std::filesyst
     (void)cache_path;  // Unused for now
     util::Logger::info("TIER 0: Validating cache with tree hash");
 
-    // Load cache header only (first 256 bytes would contain tree_hash in future)
-    // For now, we'll do a quick directory scan and compare
-    // Scan all configured directories and merge results
+    // O(changed) fast path: the v5 cache stored per-directory hashes
+    // and mtimes. Walk only the directory structure (no file listings),
+    // reuse the stored hash for every dir whose mtime didn't move, and
+    // re-list just the dirty ones. If the rebuilt XOR matches the
+    // stored tree hash, the audio file set is unchanged and we're done
+    // without touching a single file entry in clean subtrees.
+    if (last_tree_hash_ != 0 && !dir_mtimes_.empty()) {
+        uint64_t combined = 0;
+        size_t rehashed = 0;
+        for (const auto& music_dir : music_dirs_) {
+            std::string root_str = music_dir.string();
+            while (root_str.length() > 1 && root_str.back() == '/') {
+                root_str.pop_back();
+            }
+            auto current_dirs = util::DirectoryScanner::scan_directories_only(music_dir);
+            for (const auto& [rel_dir, mtime] : current_dirs) {
+                auto mt = dir_mtimes_.find(rel_dir);
+                if (mt != dir_mtimes_.end() && mt->second == mtime) {
+                    // Unchanged entry list: stored hash still holds
+                    auto h = dir_hashes_.find(rel_dir);
+                    if (h != dir_hashes_.end()) combined ^= h->second;
+                } else {
+                    // New or dirty dir: re-hash just this one
+                    std::string abs_dir = rel_dir == "/" ? root_str : root_str + rel_dir;
+                    combined ^= util::DirectoryScanner::hash_directory_files(abs_dir);
+                    rehashed++;
+                }
+            }
+            // Deleted dirs simply contribute nothing to the XOR
+        }
+        if (combined == last_tree_hash_) {
+            util::Logger::info("TIER 0: Tree hash match (" + std::to_string(rehashed) +
+                              " dirs re-hashed) - cache valid");
+            return CacheValidationResult::Valid;
+        }
+        util::Logger::info("TIER 0: Tree hash mismatch after " + std::to_string(rehashed) +
+                          " re-hashes - falling back to full scan");
+    }
+
+    // Full path: scan all configured directories and merge results
     util::DirectoryScanner::ScanResult scan_result;
     for (const auto& music_dir : music_dirs_) {
-        auto dir_result = util::DirectoryScanner::scan_directory(music_dir);
-        scan_result.audio_files.insert(scan_result.audio_files.end(),
-                                        dir_result.audio_files.begin(),
-                                        dir_result.audio_files.end());
-        scan_result.dir_mtimes.insert(dir_result.dir_mtimes.begin(), dir_result.dir_mtimes.end());
-        scan_result.file_mtimes.insert(dir_result.file_mtimes.begin(), dir_result.file_mtimes.end());
-        scan_result.tree_hash ^= dir_result.tree_hash;  // XOR combine
+        scan_result.merge(util::DirectoryScanner::scan_directory(music_dir));
     }
+    scan_result.finalize();  // Merging breaks sort order
 
     // Store for future use
-    last_tree_hash_ = scan_result.tree_hash;
-    dir_mtimes_ = scan_result.dir_mtimes;
+    adopt_scan_dirs(scan_result);
 
     // Check if all scanned files exist in cache (monolithic cache - directory agnostic)
     size_t cached_count = 0;
     size_t missing_count = 0;
-    for (const auto& file_path : scan_result.audio_files) {
+    for (const auto& rec : scan_result.files) {
+        std::string file_path(scan_result.path_of(rec));
         if (tracks_.find(file_path) != tracks_.end()) {
             cached_count++;
         } else {
@@ -469,14 +1365,15 @@ Library::CacheValidationResult Library::validate_cache_tier0(const std::filesyst
 
     if (missing_count > 0) {
         util::Logger::info("TIER 0: " + std::to_string(missing_count) + " files not in cache (" +
-                          std::to_string(cached_count) + "/" + std::to_string(scan_result.audio_files.size()) + " cached)");
+                          std::to_string(cached_count) + "/" + std::to_string(scan_result.files.size()) + " cached)");
         // Cache the scan result to avoid re-scanning in scan_directory()
         cached_scan_result_ = std::move(scan_result);
         return CacheValidationResult::CountMismatch;
     }
 
-    // Quick check: all relevant cached files still exist on disk
-    for (const auto& file_path : scan_result.audio_files) {
+    // Quick check: all cached files still exist on disk (the scan only
+    // proves what it found; deleted files are only visible from here)
+    for (const auto& [file_path, track] : tracks_) {
         if (!std::filesystem::exists(file_path)) {
             util::Logger::info("TIER 0: Cached file no longer exists: " + file_path);
             // Cache the scan result to avoid re-scanning in scan_directory()
@@ -537,9 +1434,19 @@ void Library::scan_for_changes(
     int processed = 0;
     int total = changed_files.size() + deleted_files.size();
 
+    // Size everything for the whole delta up front: a moved artist
+    // directory is tens of thousands of erase/inserts, and growing the
+    // robin-hood table (or the journal sets) mid-apply rehashes the
+    // entire library several times over
+    tracks_.reserve(tracks_.size() + changed_files.size());
+    journal_dirty_.reserve(journal_dirty_.size() + changed_files.size());
+    journal_deleted_.reserve(journal_deleted_.size() + deleted_files.size());
+
     // Remove deleted files
     for (const auto& path : deleted_files) {
         tracks_.erase(path);
+        journal_dirty_.erase(path);
+        journal_deleted_.insert(path);
         processed++;
         if (progress_callback && processed % 10 == 0) {
             progress_callback(processed, total);
@@ -561,54 +1468,73 @@ void Library::scan_for_changes(
         // Results storage (one per file)
         std::vector<model::Track> results(num_files);
 
-        // Launch worker threads
+        // Read-ahead: warm tag regions a window ahead of the parsers
+        std::atomic<bool> parse_done{false};
+        std::thread prefetcher([&] {
+            util::Platform::set_current_thread_role(util::Platform::ThreadRole::BulkWorker);
+            prefetch_tag_regions(changed_files, work_index, parse_done);
+        });
+
+        // One artwork extraction per album directory for this scan
+        DirArtworkCoordinator artwork_coordinator;
+
+        // Launch worker threads (idle-class so parsing yields to playback)
         std::vector<std::thread> workers;
         for (size_t t = 0; t < num_threads; ++t) {
-            workers.emplace_back([&]() {
+            workers.emplace_back([&, t]() {
+                util::Platform::set_current_thread_role(util::Platform::ThreadRole::BulkWorker);
                 while (true) {
+                    // Back off while playback headroom is low (slot 0
+                    // always proceeds, so the parse can't stall)
+                    util::ScanGovernor::instance().throttle(t, num_threads);
                     size_t idx = work_index.fetch_add(1);
                     if (idx >= num_files) break;
 
                     const std::string& path_str = changed_files[idx];
                     std::filesystem::path path(path_str);
 
-                    // Parse metadata (thread-safe)
-                    model::Track track = MetadataParser::parse_file(path_str);
-
-                    // Ensure format is set
-                    if (track.format == model::AudioFormat::Unknown) {
-                        if (path.extension() == ".mp3") track.format = model::AudioFormat::MP3;
-                        else if (path.extension() == ".flac") track.format = model::AudioFormat::FLAC;
-                        else if (path.extension() == ".ogg") track.format = model::AudioFormat::OGG;
-                        else if (path.extension() == ".wav") track.format = model::AudioFormat::WAV;
-                        else if (path.extension() == ".dsf") track.format = model::AudioFormat::DSD;
+                    std::time_t current_mtime = 0;
+                    uint64_t current_inode = 0;
+                    struct stat st;
+                    if (stat(path_str.c_str(), &st) == 0) {
+                        current_mtime = st.st_mtime;
+                        current_inode = st.st_ino;
                     }
 
-                    // Populate optimization fields
-                    try {
-                        auto ftime = std::filesystem::last_write_time(path);
-                        track.file_mtime = std::chrono::system_clock::to_time_t(
-                            std::chrono::file_clock::to_sys(ftime)
-                        );
+                    // Persistent metadata cache: skip the parse when the
+                    // file is byte-identical to what we cached
+                    if (auto cached = MetadataCache::instance().get_cached_metadata(path_str, current_mtime)) {
+                        results[idx] = std::move(*cached);
+                    } else {
+                        // Parse metadata (thread-safe)
+                        model::Track track = MetadataParser::parse_file(path_str);
+
+                        // Ensure format is set
+                        if (track.format == model::AudioFormat::Unknown) {
+                            if (path.extension() == ".mp3") track.format = model::AudioFormat::MP3;
+                            else if (path.extension() == ".flac") track.format = model::AudioFormat::FLAC;
+                            else if (path.extension() == ".ogg") track.format = model::AudioFormat::OGG;
+                            else if (path.extension() == ".wav") track.format = model::AudioFormat::WAV;
+                            else if (path.extension() == ".dsf") track.format = model::AudioFormat::DSD;
+                        }
 
-                        struct stat st;
-                        if (stat(path_str.c_str(), &st) == 0) {
-                            track.file_inode = st.st_ino;
+                        // Populate optimization fields
+                        track.file_mtime = current_mtime;
+                        track.file_inode = current_inode;
+
+                        // Artwork: one extraction per album directory, siblings
+                        // reuse the recorded hash (pre-populates for fast AlbumBrowser)
+                        std::string artwork_hash =
+                            artwork_coordinator.hash_for(path_str, path.parent_path().string());
+                        if (!artwork_hash.empty()) {
+                            track.artwork_hash = artwork_hash;
                         }
-                    } catch (...) {
-                        // Failed to get mtime/inode, continue anyway
-                    }
 
-                    // Extract artwork and store in cache (pre-populates for fast AlbumBrowser)
-                    auto artwork_result = MetadataParser::extract_artwork_data(path_str);
-                    if (!artwork_result.data.empty() && !artwork_result.hash.empty()) {
-                        track.artwork_hash = artwork_result.hash;
-                        auto& artwork_cache = ArtworkCache::instance();
-                        artwork_cache.store(artwork_result.hash, artwork_result.data, artwork_result.mime_type, path.parent_path().string());
-                    }
+                        MetadataCache::instance().cache_metadata(path_str, track);
 
-                    // Store result
-                    results[idx] = track;
+                        // Store result
+                        results[idx] = track;
+                    }
 
                     // Update progress every 100 files
                     int done = completed.fetch_add(1) + 1;
@@ -623,10 +1549,17 @@ void Library::scan_for_changes(
         for (auto& worker : workers) {
             worker.join();
         }
+        parse_done = true;
+        prefetcher.join();
 
-        // Merge results into tracks_ map (single-threaded for safety)
+        // Merge results into tracks_ map (single-threaded for safety).
+        // Single-probe move-upserts into the pre-sized table: the batch
+        // apply is one linear sweep over the results, no rehashes and
+        // no Track deep copies.
         for (size_t i = 0; i < num_files; ++i) {
-            tracks_[changed_files[i]] = results[i];
+            tracks_.insert_or_assign(changed_files[i], std::move(results[i]));
+            journal_deleted_.erase(changed_files[i]);
+            journal_dirty_.insert(changed_files[i]);
         }
 
         processed = deleted_files.size() + num_files;
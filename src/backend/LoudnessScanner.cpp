@@ -0,0 +1,147 @@
+#include "backend/LoudnessScanner.hpp"
+
+#include "audio/AudioDecoder.hpp"
+#include "audio/DSDDecoder.hpp"
+#include "audio/FLACDecoder.hpp"
+#include "audio/LoudnessAnalyzer.hpp"
+#include "audio/M4ADecoder.hpp"
+#include "audio/MP3Decoder.hpp"
+#include "audio/OGGDecoder.hpp"
+#include "util/Logger.hpp"
+#include "util/TaskPool.hpp"
+#include <cmath>
+#include <utility>
+
+namespace ouroboros::backend {
+
+LoudnessScanner::~LoudnessScanner() {
+    stop();
+}
+
+void LoudnessScanner::start(std::vector<model::Track> pending) {
+    bool kick = false;
+    {
+        std::lock_guard lock(mutex_);
+        for (auto& t : pending) {
+            queue_.push_back(std::move(t));
+        }
+        kick = !in_flight_ && !queue_.empty();
+        if (kick) in_flight_ = true;
+    }
+    if (kick) {
+        util::Logger::info("LoudnessScanner: " + std::to_string(pending.size()) +
+                           " tracks queued for R128 analysis");
+        schedule_next();
+    }
+}
+
+void LoudnessScanner::stop() {
+    stop_requested_.store(true, std::memory_order_relaxed);
+    std::unique_lock lock(mutex_);
+    queue_.clear();
+    quiesced_cv_.wait(lock, [this] { return !in_flight_; });
+}
+
+std::vector<LoudnessScanner::Result> LoudnessScanner::drain_results() {
+    std::lock_guard lock(mutex_);
+    return std::exchange(results_, {});
+}
+
+bool LoudnessScanner::idle() const {
+    std::lock_guard lock(mutex_);
+    return !in_flight_ && queue_.empty();
+}
+
+// Submits exactly one Low task; the task re-submits after each track so
+// the chain never occupies more than one pool worker.
+void LoudnessScanner::schedule_next() {
+    util::TaskPool::instance().submit(util::TaskPool::Priority::Low, [this] {
+        model::Track track;
+        {
+            std::lock_guard lock(mutex_);
+            if (queue_.empty() || stop_requested_.load(std::memory_order_relaxed)) {
+                in_flight_ = false;
+                quiesced_cv_.notify_all();
+                return;
+            }
+            track = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        analyze_one(track);
+
+        {
+            std::lock_guard lock(mutex_);
+            if (queue_.empty() || stop_requested_.load(std::memory_order_relaxed)) {
+                in_flight_ = false;
+                quiesced_cv_.notify_all();
+                return;
+            }
+        }
+        schedule_next();
+    });
+}
+
+void LoudnessScanner::analyze_one(const model::Track& track) {
+    auto decoder = create_decoder(track);
+    if (!decoder || !decoder->open(track.path)) {
+        util::Logger::debug("LoudnessScanner: Skipping " + track.path);
+        return;
+    }
+
+    audio::LoudnessAnalyzer analyzer;
+    analyzer.init(decoder->get_sample_rate(), decoder->get_channels());
+
+    constexpr int CHUNK_FRAMES = 4096;
+    std::vector<float> buffer(static_cast<size_t>(CHUNK_FRAMES) *
+                              decoder->get_channels());
+    int frames;
+    while ((frames = decoder->read_pcm(buffer.data(), CHUNK_FRAMES)) > 0) {
+        analyzer.process(buffer.data(), static_cast<size_t>(frames));
+        if (stop_requested_.load(std::memory_order_relaxed)) return;
+    }
+    decoder->close();
+
+    const double lufs = analyzer.integrated_lufs();
+    if (lufs == -HUGE_VAL) {
+        // Digital silence still counts as scanned at 0 dB so we don't
+        // re-analyze it every session
+        std::lock_guard lock(mutex_);
+        results_.push_back({track.path, audio::LoudnessAnalyzer::REFERENCE_LUFS, 0.0f});
+        return;
+    }
+
+    Result r;
+    r.path = track.path;
+    r.integrated_lufs = lufs;
+    r.track_gain_db =
+        static_cast<float>(audio::LoudnessAnalyzer::REFERENCE_LUFS - lufs);
+
+    std::lock_guard lock(mutex_);
+    results_.push_back(std::move(r));
+}
+
+std::unique_ptr<audio::AudioDecoder> LoudnessScanner::create_decoder(const model::Track& track) {
+    switch (track.format) {
+        case model::AudioFormat::MP3:
+            return std::make_unique<audio::MP3Decoder>();
+
+        case model::AudioFormat::FLAC:
+        case model::AudioFormat::WAV:
+            return std::make_unique<audio::FLACDecoder>();
+
+        case model::AudioFormat::OGG:
+            return std::make_unique<audio::OGGDecoder>();
+
+        case model::AudioFormat::M4A:
+            return std::make_unique<audio::M4ADecoder>();
+
+        case model::AudioFormat::DSD:
+            return std::make_unique<audio::DSDDecoder>();
+
+        default:
+            return nullptr;
+    }
+}
+
+}  // namespace ouroboros::backend
@@ -1,16 +1,205 @@
 #include "backend/MetadataCache.hpp"
+#include "util/Logger.hpp"
 
 namespace ouroboros::backend {
 
+// Disk tier format: header then appended records, one per
+// cache_metadata() call. Later records for the same path supersede
+// earlier ones on replay; a torn tail (crash mid-append) ends it.
+constexpr uint32_t META_CACHE_MAGIC = 0x4F55524D;  // 'OURM'
+constexpr uint32_t META_CACHE_VERSION = 1;
+
+static void write_string(std::ofstream& out, const std::string& s) {
+    uint32_t len = static_cast<uint32_t>(s.length());
+    out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+    if (len > 0) out.write(s.data(), len);
+}
+
+static std::string read_string(std::ifstream& in) {
+    uint32_t len;
+    in.read(reinterpret_cast<char*>(&len), sizeof(len));
+    if (in && len > 0) {
+        std::string s(len, '\0');
+        in.read(s.data(), len);
+        return s;
+    }
+    return "";
+}
+
+static void write_track(std::ofstream& out, const model::Track& t) {
+    write_string(out, t.path);
+    write_string(out, t.title);
+    write_string(out, t.artist);
+    write_string(out, t.album);
+    write_string(out, t.genre);
+    write_string(out, t.date);
+    write_string(out, t.artwork_hash);
+    out.write(reinterpret_cast<const char*>(&t.track_number), sizeof(t.track_number));
+    out.write(reinterpret_cast<const char*>(&t.duration_ms), sizeof(t.duration_ms));
+    out.write(reinterpret_cast<const char*>(&t.format), sizeof(t.format));
+    out.write(reinterpret_cast<const char*>(&t.sample_rate), sizeof(t.sample_rate));
+    out.write(reinterpret_cast<const char*>(&t.channels), sizeof(t.channels));
+    out.write(reinterpret_cast<const char*>(&t.bit_depth), sizeof(t.bit_depth));
+    out.write(reinterpret_cast<const char*>(&t.bitrate), sizeof(t.bitrate));
+    out.write(reinterpret_cast<const char*>(&t.file_mtime), sizeof(t.file_mtime));
+    out.write(reinterpret_cast<const char*>(&t.file_inode), sizeof(t.file_inode));
+    out.write(reinterpret_cast<const char*>(&t.is_valid), sizeof(t.is_valid));
+    out.write(reinterpret_cast<const char*>(&t.is_compilation), sizeof(t.is_compilation));
+}
+
+static model::Track read_track(std::ifstream& in) {
+    model::Track t;
+    t.path = read_string(in);
+    t.title = read_string(in);
+    t.artist = read_string(in);
+    t.album = read_string(in);
+    t.genre = read_string(in);
+    t.date = read_string(in);
+    t.artwork_hash = read_string(in);
+    in.read(reinterpret_cast<char*>(&t.track_number), sizeof(t.track_number));
+    in.read(reinterpret_cast<char*>(&t.duration_ms), sizeof(t.duration_ms));
+    in.read(reinterpret_cast<char*>(&t.format), sizeof(t.format));
+    in.read(reinterpret_cast<char*>(&t.sample_rate), sizeof(t.sample_rate));
+    in.read(reinterpret_cast<char*>(&t.channels), sizeof(t.channels));
+    in.read(reinterpret_cast<char*>(&t.bit_depth), sizeof(t.bit_depth));
+    in.read(reinterpret_cast<char*>(&t.bitrate), sizeof(t.bitrate));
+    in.read(reinterpret_cast<char*>(&t.file_mtime), sizeof(t.file_mtime));
+    in.read(reinterpret_cast<char*>(&t.file_inode), sizeof(t.file_inode));
+    in.read(reinterpret_cast<char*>(&t.is_valid), sizeof(t.is_valid));
+    in.read(reinterpret_cast<char*>(&t.is_compilation), sizeof(t.is_compilation));
+    return t;
+}
+
+MetadataCache& MetadataCache::instance() {
+    static MetadataCache cache;
+    return cache;
+}
+
 MetadataCache::MetadataCache(std::chrono::seconds ttl) : ttl_(ttl) {}
 
+size_t MetadataCache::total_entries() const {
+    size_t total = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.map.size();
+    }
+    return total;
+}
+
+bool MetadataCache::open_disk_cache(const std::filesystem::path& cache_file) {
+    std::lock_guard<std::mutex> disk_lock(disk_mutex_);
+    disk_path_ = cache_file;
+
+    size_t replayed = 0;
+    {
+        std::ifstream in(cache_file, std::ios::binary);
+        if (in) {
+            uint32_t magic = 0, version = 0;
+            in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+            in.read(reinterpret_cast<char*>(&version), sizeof(version));
+            if (in && magic == META_CACHE_MAGIC && version == META_CACHE_VERSION) {
+                auto now = std::chrono::steady_clock::now();
+                while (true) {
+                    model::Track t = read_track(in);
+                    if (!in) break;  // Torn tail or EOF
+                    Shard& shard = shards_[shard_index(t.path)];
+                    std::string key = t.path;  // Keep valid across the move
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    shard.map[std::move(key)] = {std::move(t), now};
+                    replayed++;
+                }
+            } else if (in) {
+                util::Logger::warn("MetadataCache: Unknown disk cache format, rebuilding");
+            }
+        }
+    }
+
+    const size_t distinct = total_entries();
+    if (replayed > 0) {
+        util::Logger::info("MetadataCache: Warm-started with " + std::to_string(replayed) +
+                          " records (" + std::to_string(distinct) + " distinct)");
+    }
+
+    // Compact when superseded records dominate the file
+    if (replayed > 64 && distinct < replayed / 2) {
+        rewrite_disk_cache();
+        return disk_out_.is_open();
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(cache_file.parent_path(), ec);
+    const bool fresh = !std::filesystem::exists(cache_file) || replayed == 0;
+    if (fresh) {
+        // Truncate: either no file yet or a header we can't replay
+        disk_out_.open(cache_file, std::ios::binary | std::ios::trunc);
+        if (disk_out_) {
+            disk_out_.write(reinterpret_cast<const char*>(&META_CACHE_MAGIC), sizeof(META_CACHE_MAGIC));
+            disk_out_.write(reinterpret_cast<const char*>(&META_CACHE_VERSION), sizeof(META_CACHE_VERSION));
+        }
+    } else {
+        disk_out_.open(cache_file, std::ios::binary | std::ios::app);
+    }
+
+    if (!disk_out_) {
+        util::Logger::warn("MetadataCache: Disk tier unavailable: " + cache_file.string());
+        return false;
+    }
+    return true;
+}
+
+void MetadataCache::rewrite_disk_cache() {
+    disk_out_.close();
+    disk_out_.open(disk_path_, std::ios::binary | std::ios::trunc);
+    if (!disk_out_) return;
+    disk_out_.write(reinterpret_cast<const char*>(&META_CACHE_MAGIC), sizeof(META_CACHE_MAGIC));
+    disk_out_.write(reinterpret_cast<const char*>(&META_CACHE_VERSION), sizeof(META_CACHE_VERSION));
+    size_t written = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& [path, entry] : shard.map) {
+            write_track(disk_out_, entry.metadata);
+            ++written;
+        }
+    }
+    disk_out_.flush();
+    util::Logger::info("MetadataCache: Compacted disk cache to " +
+                      std::to_string(written) + " records");
+}
+
 void MetadataCache::cache_metadata(const std::string& file_path, const model::Track& metadata) {
-    cache_[file_path] = {metadata, std::chrono::steady_clock::now()};
+    {
+        Shard& shard = shards_[shard_index(file_path)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.map[file_path] = {metadata, std::chrono::steady_clock::now()};
+    }
+    std::lock_guard<std::mutex> disk_lock(disk_mutex_);
+    if (disk_out_.is_open()) {
+        write_track(disk_out_, metadata);
+        disk_out_.flush();  // Each parsed file survives a crash right away
+    }
+}
+
+std::optional<model::Track> MetadataCache::get_cached_metadata(
+    const std::string& file_path, std::time_t current_mtime) const {
+    const Shard& shard = shards_[shard_index(file_path)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.map.find(file_path);
+    if (it == shard.map.end()) return std::nullopt;
+
+    // mtime is the validity check for disk-backed entries: a retagged
+    // file must be re-parsed
+    if (it->second.metadata.file_mtime == 0 ||
+        it->second.metadata.file_mtime != current_mtime) {
+        return std::nullopt;
+    }
+    return it->second.metadata;
 }
 
 std::optional<model::Track> MetadataCache::get_cached_metadata(const std::string& file_path) const {
-    auto it = cache_.find(file_path);
-    if (it == cache_.end()) return std::nullopt;
+    const Shard& shard = shards_[shard_index(file_path)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.map.find(file_path);
+    if (it == shard.map.end()) return std::nullopt;
 
     auto now = std::chrono::steady_clock::now();
     if (now - it->second.timestamp > ttl_) return std::nullopt;
@@ -19,22 +208,73 @@ std::optional<model::Track> MetadataCache::get_cached_metadata(const std::string
 }
 
 bool MetadataCache::has_cached_metadata(const std::string& file_path) const {
-    return cache_.find(file_path) != cache_.end();
+    const Shard& shard = shards_[shard_index(file_path)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.find(file_path) != shard.map.end();
 }
 
 void MetadataCache::clear() {
-    cache_.clear();
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.map.clear();
+    }
 }
 
 void MetadataCache::cleanup_expired() {
+    // Shard-by-shard sweep: readers and writers on other shards are
+    // never blocked while one shard is scanned
     auto now = std::chrono::steady_clock::now();
-    for (auto it = cache_.begin(); it != cache_.end();) {
-        if (now - it->second.timestamp > ttl_) {
-            it = cache_.erase(it);
-        } else {
-            ++it;
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.map.begin(); it != shard.map.end();) {
+            if (now - it->second.timestamp > ttl_) {
+                it = shard.map.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+size_t MetadataCache::resident_bytes() const {
+    size_t total = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (const auto& [path, entry] : shard.map) {
+            total += path.size() + sizeof(CacheEntry) +
+                     entry.metadata.path.size() + entry.metadata.title.size();
+        }
+    }
+    return total;
+}
+
+size_t MetadataCache::shrink(size_t bytes_needed) {
+    // TTL tightening under memory pressure: sweep everything older
+    // than HALF the configured horizon. The disk tier keeps the parse
+    // work - evicted entries replay on the next start, and a live
+    // lookup miss just re-parses one file. ttl_ itself is not mutated;
+    // parse workers read it concurrently.
+    const auto horizon = ttl_ / 2;
+    const auto now = std::chrono::steady_clock::now();
+    size_t freed = 0;
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.map.begin(); it != shard.map.end();) {
+            if (freed < bytes_needed && now - it->second.timestamp > horizon) {
+                freed += it->first.size() + sizeof(CacheEntry) +
+                         it->second.metadata.path.size() +
+                         it->second.metadata.title.size();
+                it = shard.map.erase(it);
+            } else {
+                ++it;
+            }
         }
     }
+    if (freed > 0) {
+        util::Logger::info("MetadataCache: Budget shrink freed ~" +
+                           std::to_string(freed / 1024) + " KB");
+    }
+    return freed;
 }
 
 }  // namespace ouroboros::backend
@@ -1,5 +1,6 @@
 #include "backend/MetadataParser.hpp"
 #include "util/ArtworkHasher.hpp"
+#include "util/MappedFile.hpp"
 #include <filesystem>
 #include <fstream>
 #include <algorithm>
@@ -65,6 +66,119 @@ struct Mpg123Initializer {
 };
 static Mpg123Initializer g_mpg123_init;
 
+/*
+ * MMAP-BACKED PARSING
+ *
+ * mpg123 and FFmpeg normally drive their own read()/lseek() loops while
+ * hunting for ID3 frames, the moov box, or DSD chunk headers — dozens of
+ * small syscalls per file, which adds up during a cold library scan. We
+ * map the whole file once and hand both libraries custom I/O callbacks
+ * that serve reads by pointer arithmetic over the mapping, so tag
+ * discovery is just page faults on the regions actually touched (head
+ * and tail for most files). If the mapping fails (e.g. a file on a
+ * filesystem without mmap support), the parsers fall back to the
+ * libraries' own stream I/O.
+ */
+
+// Cursor over an mmap'd file, shared by the mpg123 and FFmpeg callbacks
+struct MappedStream {
+    const util::MappedFile* file = nullptr;
+    int64_t pos = 0;
+};
+
+static mpg123_ssize_t mapped_mpg123_read(void* handle, void* buf, size_t count) {
+    auto* s = static_cast<MappedStream*>(handle);
+    const auto size = static_cast<int64_t>(s->file->size);
+    if (s->pos >= size) return 0;  // EOF
+    size_t n = std::min(count, static_cast<size_t>(size - s->pos));
+    std::memcpy(buf, static_cast<const char*>(s->file->data) + s->pos, n);
+    s->pos += static_cast<int64_t>(n);
+    return static_cast<mpg123_ssize_t>(n);
+}
+
+static off_t mapped_mpg123_lseek(void* handle, off_t offset, int whence) {
+    auto* s = static_cast<MappedStream*>(handle);
+    const auto size = static_cast<int64_t>(s->file->size);
+    int64_t base = 0;
+    switch (whence) {
+        case SEEK_SET: base = 0; break;
+        case SEEK_CUR: base = s->pos; break;
+        case SEEK_END: base = size; break;
+        default: return -1;
+    }
+    int64_t target = base + offset;
+    if (target < 0 || target > size) return -1;
+    s->pos = target;
+    return static_cast<off_t>(target);
+}
+
+static int mapped_avio_read(void* opaque, uint8_t* buf, int buf_size) {
+    auto* s = static_cast<MappedStream*>(opaque);
+    const auto size = static_cast<int64_t>(s->file->size);
+    if (s->pos >= size) return AVERROR_EOF;
+    int n = static_cast<int>(std::min<int64_t>(buf_size, size - s->pos));
+    std::memcpy(buf, static_cast<const char*>(s->file->data) + s->pos, n);
+    s->pos += n;
+    return n;
+}
+
+static int64_t mapped_avio_seek(void* opaque, int64_t offset, int whence) {
+    auto* s = static_cast<MappedStream*>(opaque);
+    const auto size = static_cast<int64_t>(s->file->size);
+    if (whence & AVSEEK_SIZE) return size;
+    int64_t base = 0;
+    switch (whence & ~AVSEEK_FORCE) {
+        case SEEK_SET: base = 0; break;
+        case SEEK_CUR: base = s->pos; break;
+        case SEEK_END: base = size; break;
+        default: return AVERROR(EINVAL);
+    }
+    int64_t target = base + offset;
+    if (target < 0 || target > size) return AVERROR(EINVAL);
+    s->pos = target;
+    return target;
+}
+
+// Opens an AVFormatContext reading through `stream` instead of FFmpeg's
+// file protocol. Returns nullptr on failure (caller falls back to
+// avformat_open_input on the path). The path is still passed so the
+// demuxer probe can use the extension as a hint.
+static AVFormatContext* open_mapped_input(const std::string& path, MappedStream& stream,
+                                          AVIOContext** avio) {
+    constexpr int AVIO_BUF_SIZE = 64 * 1024;
+    auto* buf = static_cast<unsigned char*>(av_malloc(AVIO_BUF_SIZE));
+    if (!buf) return nullptr;
+    *avio = avio_alloc_context(buf, AVIO_BUF_SIZE, 0, &stream,
+                               mapped_avio_read, nullptr, mapped_avio_seek);
+    if (!*avio) {
+        av_free(buf);
+        return nullptr;
+    }
+    AVFormatContext* ctx = avformat_alloc_context();
+    if (!ctx) {
+        av_freep(&(*avio)->buffer);
+        avio_context_free(avio);
+        return nullptr;
+    }
+    ctx->pb = *avio;
+    if (avformat_open_input(&ctx, path.c_str(), nullptr, nullptr) < 0) {
+        // avformat_open_input frees ctx on failure, but not our AVIO
+        av_freep(&(*avio)->buffer);
+        avio_context_free(avio);
+        return nullptr;
+    }
+    return ctx;
+}
+
+// Closes a context from either open path; avio is null for the fallback
+static void close_input(AVFormatContext** fmt_ctx, AVIOContext** avio) {
+    avformat_close_input(fmt_ctx);
+    if (*avio) {
+        av_freep(&(*avio)->buffer);
+        avio_context_free(avio);
+    }
+}
+
 model::Track MetadataParser::parse_file(const std::string& path) {
     model::Track track;
     track.path = path;
@@ -116,7 +230,24 @@ bool MetadataParser::parse_mp3(const std::string& path, model::Track& track) {
     mpg123_handle* mh = mpg123_new(nullptr, nullptr);
     if (!mh) return false;
 
-    if (mpg123_open(mh, path.c_str()) != MPG123_OK) {
+    // Fast path: serve mpg123's reads from an mmap of the file. The map
+    // must outlive mpg123_close, so it lives for the whole function.
+    util::MappedFile map;
+    MappedStream stream;
+    bool opened = false;
+    if (map.open_readonly(path)) {
+        stream.file = &map;
+        if (mpg123_replace_reader_handle(mh, mapped_mpg123_read, mapped_mpg123_lseek,
+                                         nullptr) == MPG123_OK &&
+            mpg123_open_handle(mh, &stream) == MPG123_OK) {
+            opened = true;
+        } else {
+            // Restore default I/O before the stream fallback
+            mpg123_replace_reader_handle(mh, nullptr, nullptr, nullptr);
+        }
+    }
+
+    if (!opened && mpg123_open(mh, path.c_str()) != MPG123_OK) {
         mpg123_delete(mh);
         return false;
     }
@@ -270,19 +401,28 @@ bool MetadataParser::parse_sndfile(const std::string& path, model::Track& track)
 bool MetadataParser::parse_m4a(const std::string& path, model::Track& track) {
     ouroboros::util::Logger::debug("MetadataParser: Parsing M4A file with FFmpeg: " + path);
 
+    util::MappedFile map;
+    MappedStream stream;
+    AVIOContext* avio = nullptr;
     AVFormatContext* fmt_ctx = nullptr;
-    int ret = avformat_open_input(&fmt_ctx, path.c_str(), nullptr, nullptr);
-    if (ret < 0) {
-        char errbuf[256];
-        av_strerror(ret, errbuf, sizeof(errbuf));
-        ouroboros::util::Logger::error("MetadataParser: Failed to open M4A file: " + std::string(errbuf));
-        return false;
+    if (map.open_readonly(path)) {
+        stream.file = &map;
+        fmt_ctx = open_mapped_input(path, stream, &avio);
+    }
+    if (!fmt_ctx) {
+        int ret = avformat_open_input(&fmt_ctx, path.c_str(), nullptr, nullptr);
+        if (ret < 0) {
+            char errbuf[256];
+            av_strerror(ret, errbuf, sizeof(errbuf));
+            ouroboros::util::Logger::error("MetadataParser: Failed to open M4A file: " + std::string(errbuf));
+            return false;
+        }
     }
 
-    ret = avformat_find_stream_info(fmt_ctx, nullptr);
+    int ret = avformat_find_stream_info(fmt_ctx, nullptr);
     if (ret < 0) {
         ouroboros::util::Logger::error("MetadataParser: Failed to find stream info for M4A");
-        avformat_close_input(&fmt_ctx);
+        close_input(&fmt_ctx, &avio);
         return false;
     }
 
@@ -297,7 +437,7 @@ bool MetadataParser::parse_m4a(const std::string& path, model::Track& track) {
 
     if (audio_stream_idx < 0) {
         ouroboros::util::Logger::error("MetadataParser: No audio stream found in M4A file");
-        avformat_close_input(&fmt_ctx);
+        close_input(&fmt_ctx, &avio);
         return false;
     }
 
@@ -361,23 +501,32 @@ bool MetadataParser::parse_m4a(const std::string& path, model::Track& track) {
     ouroboros::util::Logger::info("MetadataParser: Parsed M4A - " + track.title +
         " by " + track.artist + " (" + std::to_string(track.duration_ms / 1000) + "s)");
 
-    avformat_close_input(&fmt_ctx);
+    close_input(&fmt_ctx, &avio);
     return true;
 }
 
 bool MetadataParser::parse_dsf(const std::string& path, model::Track& track) {
     // DSF metadata extraction via ffmpeg (which has a native DSF demuxer)
+    util::MappedFile map;
+    MappedStream stream;
+    AVIOContext* avio = nullptr;
     AVFormatContext* fmt_ctx = nullptr;
-    int ret = avformat_open_input(&fmt_ctx, path.c_str(), nullptr, nullptr);
-    if (ret < 0) {
-        ouroboros::util::Logger::error("MetadataParser: Failed to open DSF file: " + path);
-        return false;
+    if (map.open_readonly(path)) {
+        stream.file = &map;
+        fmt_ctx = open_mapped_input(path, stream, &avio);
+    }
+    if (!fmt_ctx) {
+        int ret = avformat_open_input(&fmt_ctx, path.c_str(), nullptr, nullptr);
+        if (ret < 0) {
+            ouroboros::util::Logger::error("MetadataParser: Failed to open DSF file: " + path);
+            return false;
+        }
     }
 
-    ret = avformat_find_stream_info(fmt_ctx, nullptr);
+    int ret = avformat_find_stream_info(fmt_ctx, nullptr);
     if (ret < 0) {
         ouroboros::util::Logger::error("MetadataParser: Failed to find stream info for DSF");
-        avformat_close_input(&fmt_ctx);
+        close_input(&fmt_ctx, &avio);
         return false;
     }
 
@@ -391,7 +540,7 @@ bool MetadataParser::parse_dsf(const std::string& path, model::Track& track) {
 
     if (audio_stream_idx < 0) {
         ouroboros::util::Logger::error("MetadataParser: No audio stream found in DSF file");
-        avformat_close_input(&fmt_ctx);
+        close_input(&fmt_ctx, &avio);
         return false;
     }
 
@@ -455,7 +604,7 @@ bool MetadataParser::parse_dsf(const std::string& path, model::Track& track) {
         " - " + track.title + " by " + track.artist +
         " (" + std::to_string(track.duration_ms / 1000) + "s)");
 
-    avformat_close_input(&fmt_ctx);
+    close_input(&fmt_ctx, &avio);
     return true;
 }
 
@@ -474,6 +623,34 @@ model::AudioFormat MetadataParser::detect_format(const std::string& path) {
 }
 
 // Extract embedded artwork using ffmpeg CLI (fallback for iTunes-encoded files)
+// Single-pass image file read: SHA-256 is updated chunk by chunk as the
+// bytes land in the buffer, instead of a second full pass over the
+// finished vector (artwork totals gigabytes on a full rescan). Returns
+// false when the file cannot be read or is empty.
+static bool read_and_hash_file(const std::filesystem::path& path,
+                               std::vector<uint8_t>& data, std::string& hash) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    auto size = static_cast<size_t>(file.tellg());
+    file.seekg(0);
+
+    data.clear();
+    data.reserve(size);
+    util::ArtworkHasher::Sha256 stream;
+    std::vector<char> chunk(256 * 1024);
+    while (file) {
+        file.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        std::streamsize n = file.gcount();
+        if (n <= 0) break;
+        const auto* bytes = reinterpret_cast<const uint8_t*>(chunk.data());
+        stream.update(bytes, static_cast<size_t>(n));
+        data.insert(data.end(), bytes, bytes + n);
+    }
+    if (data.empty()) return false;
+    hash = stream.finish_hex();
+    return true;
+}
+
 static ArtworkExtractionResult extract_artwork_ffmpeg(const std::string& path) {
     // Create temp file for artwork
     char temp_path[] = "/tmp/ouroboros_artwork_XXXXXX.jpg";
@@ -490,21 +667,12 @@ static ArtworkExtractionResult extract_artwork_ffmpeg(const std::string& path) {
         return {{}, "", ""};
     }
 
-    // Read extracted artwork
-    std::ifstream file(temp_path, std::ios::binary);
-    if (!file) {
-        unlink(temp_path);
-        return {{}, "", ""};
-    }
-
-    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
-                               std::istreambuf_iterator<char>());
-    file.close();
+    // Read extracted artwork, hashing as it streams in
+    std::vector<uint8_t> data;
+    std::string hash;
+    bool ok = read_and_hash_file(temp_path, data, hash);
     unlink(temp_path);
-
-    if (data.empty()) return {{}, "", ""};
-
-    std::string hash = util::ArtworkHasher::hash_artwork(data);
+    if (!ok) return {{}, "", ""};
     ouroboros::util::Logger::info("Extracted artwork via ffmpeg from " +
         std::filesystem::path(path).filename().string() +
         " (" + std::to_string(data.size()) + " bytes)");
@@ -550,9 +718,11 @@ static ArtworkExtractionResult extract_mp3_embedded_artwork(const std::string& p
         }
 
         if (best && best->data && best->size > 0) {
-            std::vector<uint8_t> data(best->data, best->data + best->size);
+            // Hash while copying out of the tag buffer instead of
+            // making a second pass over the finished vector
+            std::vector<uint8_t> data;
+            std::string hash = util::ArtworkHasher::hash_and_copy(best->data, best->size, data);
             std::string mime = best->mime_type.p ? best->mime_type.p : "image/jpeg";
-            std::string hash = util::ArtworkHasher::hash_artwork(data);
 
             ouroboros::util::Logger::info("Extracted embedded artwork from " +
                 std::filesystem::path(path).filename().string() +
@@ -603,22 +773,16 @@ ArtworkExtractionResult MetadataParser::extract_artwork_data(const std::string&
 
                 ouroboros::util::Logger::info("Found artwork: " + entry.path().filename().string());
 
-                std::ifstream file(entry.path(), std::ios::binary);
-                if (file) {
-                    std::vector<uint8_t> data(
-                        (std::istreambuf_iterator<char>(file)),
-                        std::istreambuf_iterator<char>()
-                    );
-
+                // Single pass: hash streams alongside the read
+                std::vector<uint8_t> data;
+                std::string hash;
+                if (read_and_hash_file(entry.path(), data, hash)) {
                     // Determine MIME type
                     std::string mime = "image/jpeg";
                     if (ext == ".png") mime = "image/png";
                     else if (ext == ".gif") mime = "image/gif";
                     else if (ext == ".bmp") mime = "image/bmp";
 
-                    // Compute SHA-256 hash for content-addressed caching
-                    std::string hash = util::ArtworkHasher::hash_artwork(data);
-
                     ouroboros::util::Logger::debug("Loaded " + std::to_string(data.size()) +
                         " bytes, hash: " + hash.substr(0, 16) + "...");
                     return {std::move(data), mime, hash};
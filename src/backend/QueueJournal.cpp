@@ -0,0 +1,137 @@
+#include "backend/QueueJournal.hpp"
+#include "util/Logger.hpp"
+#include <cstdint>
+#include <fstream>
+
+namespace ouroboros::backend {
+
+namespace {
+
+constexpr uint32_t QUEUE_JOURNAL_MAGIC = 0x4F555251;  // 'OURQ'
+constexpr uint32_t QUEUE_JOURNAL_VERSION = 1;
+constexpr uint8_t QUEUE_OP_ADD = 1;
+
+void write_header(std::ofstream& out) {
+    out.write(reinterpret_cast<const char*>(&QUEUE_JOURNAL_MAGIC), sizeof(QUEUE_JOURNAL_MAGIC));
+    out.write(reinterpret_cast<const char*>(&QUEUE_JOURNAL_VERSION), sizeof(QUEUE_JOURNAL_VERSION));
+}
+
+}  // namespace
+
+QueueJournal& QueueJournal::instance() {
+    static QueueJournal instance;
+    return instance;
+}
+
+QueueJournal::~QueueJournal() {
+    shutdown();
+}
+
+void QueueJournal::open(const std::filesystem::path& journal_path) {
+    path_ = journal_path;
+
+    // Replay: adds accumulate in order; a truncated tail record (crash
+    // mid-append) just ends the replay early
+    std::ifstream in(path_, std::ios::binary);
+    if (in) {
+        uint32_t magic = 0, version = 0;
+        in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        in.read(reinterpret_cast<char*>(&version), sizeof(version));
+        if (in.good() && magic == QUEUE_JOURNAL_MAGIC && version == QUEUE_JOURNAL_VERSION) {
+            while (true) {
+                uint8_t op = 0;
+                uint32_t len = 0;
+                in.read(reinterpret_cast<char*>(&op), sizeof(op));
+                in.read(reinterpret_cast<char*>(&len), sizeof(len));
+                if (!in.good() || op != QUEUE_OP_ADD) break;
+                std::string path(len, '\0');
+                in.read(path.data(), len);
+                if (!in.good()) break;
+                loaded_.push_back(std::move(path));
+            }
+            if (!loaded_.empty()) {
+                util::Logger::info("QueueJournal: Replayed " +
+                                   std::to_string(loaded_.size()) + " queued tracks");
+            }
+        } else if (magic != 0) {
+            util::Logger::warn("QueueJournal: Unrecognized journal header, starting fresh");
+        }
+    }
+
+    writer_ = std::thread([this] { run_writer(); });
+}
+
+std::vector<std::string> QueueJournal::restored_paths() const {
+    return loaded_;
+}
+
+void QueueJournal::record_add(std::string track_path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back(Op{false, std::move(track_path)});
+    }
+    cv_.notify_one();
+}
+
+void QueueJournal::record_clear() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // A clear supersedes everything queued before it
+        pending_.clear();
+        pending_.push_back(Op{true, {}});
+    }
+    cv_.notify_one();
+}
+
+void QueueJournal::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) return;
+        stop_ = true;
+    }
+    cv_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+}
+
+void QueueJournal::run_writer() {
+    std::error_code ec;
+    std::filesystem::create_directories(path_.parent_path(), ec);
+
+    // Append to an existing valid journal, otherwise start one
+    const bool fresh = !std::filesystem::exists(path_, ec) ||
+                       std::filesystem::file_size(path_, ec) < 2 * sizeof(uint32_t);
+    std::ofstream out(path_, fresh ? std::ios::binary | std::ios::trunc
+                                   : std::ios::binary | std::ios::app);
+    if (out && fresh) {
+        write_header(out);
+    }
+
+    std::vector<Op> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+            batch.swap(pending_);
+            if (batch.empty() && stop_) break;
+        }
+
+        for (const Op& op : batch) {
+            if (op.clear) {
+                out.close();
+                out.open(path_, std::ios::binary | std::ios::trunc);
+                if (out) write_header(out);
+            } else if (out) {
+                const auto len = static_cast<uint32_t>(op.path.size());
+                out.write(reinterpret_cast<const char*>(&QUEUE_OP_ADD), sizeof(QUEUE_OP_ADD));
+                out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+                out.write(op.path.data(), len);
+            }
+        }
+        if (out) out.flush();
+        batch.clear();
+    }
+}
+
+}  // namespace ouroboros::backend
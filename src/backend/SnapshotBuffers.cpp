@@ -68,10 +68,38 @@ void SnapshotBuffers::publish() {
     // util::Logger::debug("SnapshotBuffers::publish - COMPLETE (seq=" + std::to_string(back_->seq) + ")");
 }
 
+void SnapshotBuffers::begin_write() {
+    // Odd = writer active. acq_rel so the following buffer writes can't
+    // be reordered before the version bump.
+    version_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void SnapshotBuffers::end_write() {
+    version_.fetch_add(1, std::memory_order_release);
+}
+
 const model::Snapshot& SnapshotBuffers::front() const {
     return *front_.load(std::memory_order_acquire);
 }
 
+model::Snapshot SnapshotBuffers::read_consistent() const {
+    // Classic seqlock read: sample an even version, copy, re-check.
+    // The copy is cheap (PlayerState + shared_ptrs + alerts), so retries
+    // under a 30Hz writer are rare and the loop converges immediately.
+    for (;;) {
+        uint64_t v1 = version_.load(std::memory_order_acquire);
+        if (v1 & 1) continue;  // Writer mid-flight
+
+        model::Snapshot copy = *front_.load(std::memory_order_acquire);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t v2 = version_.load(std::memory_order_relaxed);
+        if (v1 == v2) return copy;
+        // A publish landed while copying: our buffer may have swapped to
+        // the back role and been overwritten under us. Retry.
+    }
+}
+
 uint64_t SnapshotBuffers::seq() const {
     return front().seq;
 }
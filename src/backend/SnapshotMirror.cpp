@@ -0,0 +1,140 @@
+#include "backend/SnapshotMirror.hpp"
+
+#include "util/Logger.hpp"
+#include "util/Platform.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace ouroboros::backend {
+
+namespace {
+
+void copy_str(char* dst, size_t cap, const std::string& src) {
+    size_t n = std::min(src.size(), cap - 1);
+    std::memcpy(dst, src.data(), n);
+    dst[n] = '\0';
+}
+
+}  // namespace
+
+SnapshotMirror::~SnapshotMirror() {
+    close();
+}
+
+std::string SnapshotMirror::default_name() {
+    return "/ouroboros-state-" + std::to_string(getuid());
+}
+
+bool SnapshotMirror::open_writer(const std::string& name) {
+    close();
+    int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        util::Logger::error("SnapshotMirror: shm_open failed: " + std::string(strerror(errno)));
+        return false;
+    }
+    if (ftruncate(fd, sizeof(Segment)) < 0) {
+        util::Logger::error("SnapshotMirror: ftruncate failed: " + std::string(strerror(errno)));
+        ::close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);  // The mapping keeps the segment alive
+    if (map == MAP_FAILED) {
+        util::Logger::error("SnapshotMirror: mmap failed: " + std::string(strerror(errno)));
+        return false;
+    }
+    // Placement-construct over the zeroed (or stale) segment; readers
+    // ignore it until magic/version land, which happens before any seq
+    segment_ = new (map) Segment();
+    segment_->magic = MAGIC;
+    segment_->version = VERSION;
+    name_ = name;
+    writer_ = true;
+    util::Logger::info("SnapshotMirror: publishing to /dev/shm" + name);
+    return true;
+}
+
+bool SnapshotMirror::open_reader(const std::string& name) {
+    close();
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return false;
+    void* map = mmap(nullptr, sizeof(Segment), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) return false;
+    auto* segment = static_cast<Segment*>(map);
+    if (segment->magic != MAGIC || segment->version != VERSION) {
+        munmap(map, sizeof(Segment));
+        return false;
+    }
+    segment_ = segment;
+    name_ = name;
+    writer_ = false;
+    return true;
+}
+
+void SnapshotMirror::close() {
+    if (!segment_) return;
+    munmap(segment_, sizeof(Segment));
+    if (writer_) {
+        shm_unlink(name_.c_str());
+    }
+    segment_ = nullptr;
+    writer_ = false;
+}
+
+void SnapshotMirror::publish(const model::Snapshot& snap) {
+    if (!segment_ || !writer_) return;
+
+    uint64_t seq = segment_->seq.load(std::memory_order_relaxed);
+    MirrorState& slot = segment_->slots[(seq + 1) & 1];
+
+    slot = MirrorState{};
+    slot.playback_state = static_cast<int32_t>(snap.player.state);
+    slot.volume_percent = snap.player.volume_percent;
+    slot.shuffle_enabled = snap.player.shuffle_enabled ? 1 : 0;
+    slot.repeat_mode = static_cast<int32_t>(snap.player.repeat_mode);
+    slot.position_ms = snap.player.playback_position_ms;
+    slot.position_anchor_steady_ms = snap.player.position_anchor_steady_ms;
+    slot.snapshot_seq = snap.seq;
+    if (snap.queue) {
+        slot.queue_upcoming = util::narrow_cast<uint32_t>(snap.queue->future.size());
+    }
+    if (snap.library) {
+        slot.library_tracks = util::narrow_cast<uint32_t>(snap.library->tracks.size());
+        if (snap.player.current_track_index.has_value()) {
+            int idx = *snap.player.current_track_index;
+            if (idx >= 0 && idx < util::narrow_cast<int>(snap.library->tracks.size())) {
+                const auto& track = snap.library->tracks[idx];
+                slot.current_track_index = idx;
+                slot.duration_ms = track.duration_ms;
+                copy_str(slot.title, sizeof(slot.title), track.title);
+                copy_str(slot.artist, sizeof(slot.artist), track.artist.str());
+                copy_str(slot.album, sizeof(slot.album), track.album.str());
+            }
+        }
+    }
+    slot.is_scanning = snap.scan_progress.is_scanning ? 1 : 0;
+
+    // Release: the slot bytes above happen-before the seq readers
+    // acquire, same ordering contract as SnapshotBuffers::publish
+    segment_->seq.store(seq + 1, std::memory_order_release);
+}
+
+bool SnapshotMirror::read(MirrorState& out) const {
+    if (!segment_) return false;
+    for (;;) {
+        uint64_t s1 = segment_->seq.load(std::memory_order_acquire);
+        if (s1 == 0) return false;  // Nothing published yet
+        out = segment_->slots[s1 & 1];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (segment_->seq.load(std::memory_order_relaxed) == s1) return true;
+        // Writer lapped us mid-copy; go again
+    }
+}
+
+}  // namespace ouroboros::backend
@@ -1,45 +1,134 @@
 #include "backend/SnapshotPublisher.hpp"
 #include "util/Logger.hpp"
+#include "util/PerfCounters.hpp"
+#include <sys/eventfd.h>
+#include <unistd.h>
 
 namespace ouroboros::backend {
 
 SnapshotPublisher::SnapshotPublisher() {
+    notify_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (notify_fd_ < 0) {
+        // Not fatal: the main loop still wakes on its poll timeout,
+        // publishes just wait for the next tick instead of forcing one
+        util::Logger::warn("SnapshotPublisher: eventfd failed, publish wakeups disabled");
+    }
 }
 
-SnapshotPublisher::~SnapshotPublisher() = default;
+SnapshotPublisher::~SnapshotPublisher() {
+    if (notify_fd_ >= 0) ::close(notify_fd_);
+}
+
+void SnapshotPublisher::wake() {
+    if (notify_fd_ < 0) return;
+    const uint64_t one = 1;
+    // eventfd write only accumulates a counter; EAGAIN at UINT64_MAX-1
+    // would mean the wakeup is already pending, so the result is moot
+    [[maybe_unused]] ssize_t n = ::write(notify_fd_, &one, sizeof(one));
+}
+
+void SnapshotPublisher::drain_notify() {
+    if (notify_fd_ < 0) return;
+    uint64_t count = 0;
+    [[maybe_unused]] ssize_t n = ::read(notify_fd_, &count, sizeof(count));
+}
 
 void SnapshotPublisher::publish(model::Snapshot snap) {
     std::lock_guard<std::mutex> lock(mutex_);
     // Copy the provided snapshot into the back buffer
     // Note: This copies the lightweight structure (shared_ptrs), not the heavy data
+    buffers_.begin_write();
     buffers_.back() = snap;
     buffers_.publish();
+    buffers_.end_write();
+    batch_dirty_ = false;
+    published_sections_ |= SectionAll;
+    batch_sections_ = 0;
+    last_publish_ = std::chrono::steady_clock::now();
+    wake();
 }
 
 void SnapshotPublisher::update(std::function<void(model::Snapshot&)> updater) {
+    update(SectionAll, std::move(updater));
+}
+
+void SnapshotPublisher::update(uint32_t sections, std::function<void(model::Snapshot&)> updater) {
     // LOGGING DISABLED: Called hundreds of times/second in playback loop, creates I/O storm
     // util::Logger::debug("SnapshotPublisher::update - acquiring lock...");
     std::lock_guard<std::mutex> lock(mutex_);
+    util::ScopedTimer hold_timer(util::PerfCounters::instance().publish_hold);
     // util::Logger::debug("SnapshotPublisher::update - lock acquired, calling updater");
-    // Modify the back buffer directly
+    // Modify the back buffer directly (seqlock write section: a reader
+    // holding a stale front pointer could otherwise tear on the re-sync)
+    buffers_.begin_write();
     updater(buffers_.back());
     // util::Logger::debug("SnapshotPublisher::update - updater done, publishing");
+    // Any batched changes already applied to the back buffer ride along.
     buffers_.publish();
+    buffers_.end_write();
+    batch_dirty_ = false;
+    // Batched changes already in the back buffer publish with this call
+    published_sections_ |= sections | batch_sections_;
+    batch_sections_ = 0;
+    last_publish_ = std::chrono::steady_clock::now();
+    wake();
     // util::Logger::debug("SnapshotPublisher::update - done, releasing lock");
 }
 
+void SnapshotPublisher::update_batched(std::function<void(model::Snapshot&)> updater) {
+    update_batched(SectionAll, std::move(updater));
+}
+
+void SnapshotPublisher::update_batched(uint32_t sections, std::function<void(model::Snapshot&)> updater) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    util::ScopedTimer hold_timer(util::PerfCounters::instance().publish_hold);
+    buffers_.begin_write();
+    updater(buffers_.back());
+    batch_dirty_ = true;
+    batch_sections_ |= sections;
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_publish_ >= kBatchInterval) {
+        buffers_.publish();
+        batch_dirty_ = false;
+        published_sections_ |= batch_sections_;
+        batch_sections_ = 0;
+        last_publish_ = now;
+        wake();
+    }
+    buffers_.end_write();
+}
+
+void SnapshotPublisher::flush_batched() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!batch_dirty_) return;
+    buffers_.begin_write();
+    buffers_.publish();
+    buffers_.end_write();
+    batch_dirty_ = false;
+    published_sections_ |= batch_sections_;
+    batch_sections_ = 0;
+    last_publish_ = std::chrono::steady_clock::now();
+    // No wake(): flush_batched is the main loop's own call, it already
+    // re-reads the snapshot this same iteration
+}
+
+uint32_t SnapshotPublisher::consume_dirty_sections() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint32_t sections = published_sections_;
+    published_sections_ = 0;
+    return sections;
+}
+
 // LOCK-FREE READ PATH
 // This method is called frequently (every 33ms by main loop).
-// It does NOT acquire the mutex because SnapshotBuffers::front()
-// uses an atomic pointer (std::atomic<Snapshot*> front_).
-// Multiple readers can call this concurrently. Writers in update()
-// modify the back buffer only, never the front buffer that we read.
+// It does NOT acquire the mutex: SnapshotBuffers::read_consistent()
+// is a seqlock read, so ANY number of threads (UI, search indexing,
+// future IPC server) can call this concurrently and each gets a
+// consistent copy, retrying on torn reads instead of blocking writers.
 std::shared_ptr<const model::Snapshot> SnapshotPublisher::get_current() const {
     // LOGGING DISABLED: Called 100+ times/second, creates I/O storm
-    // util::Logger::debug("SnapshotPublisher::get_current - reading snapshot (lock-free)");
-    // NO MUTEX: buffers_.front() uses atomic pointer internally
-    // Safe for concurrent reads while update() may be modifying back buffer
-    auto result = std::make_shared<model::Snapshot>(buffers_.front());
+    auto result = std::make_shared<model::Snapshot>(buffers_.read_consistent());
     // util::Logger::debug("SnapshotPublisher::get_current - snapshot read complete");
     return result;
 }
@@ -0,0 +1,344 @@
+#include "backend/ThumbnailStore.hpp"
+#include "util/Logger.hpp"
+#include <fstream>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ouroboros::backend {
+
+namespace {
+
+// Bounds-checked cursor over the store mapping (same pattern as
+// ArtworkCache): a truncated or corrupt file fails a read and falls
+// back to a rebuild instead of crashing
+struct MapReader {
+    const uint8_t* cur;
+    const uint8_t* end;
+
+    bool read(void* dst, size_t n) {
+        if (static_cast<size_t>(end - cur) < n) return false;
+        std::memcpy(dst, cur, n);
+        cur += n;
+        return true;
+    }
+
+    const uint8_t* view(size_t n) {
+        if (static_cast<size_t>(end - cur) < n) return nullptr;
+        const uint8_t* p = cur;
+        cur += n;
+        return p;
+    }
+
+    bool read_string(std::string& out) {
+        uint32_t len;
+        if (!read(&len, sizeof(len))) return false;
+        const uint8_t* p = view(len);
+        if (!p) return false;
+        out.assign(reinterpret_cast<const char*>(p), len);
+        return true;
+    }
+};
+
+}  // namespace
+
+ThumbnailStore& ThumbnailStore::instance() {
+    static ThumbnailStore instance;
+    return instance;
+}
+
+ThumbnailStore::~ThumbnailStore() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    unmap_locked();
+}
+
+void ThumbnailStore::unmap_locked() {
+    if (map_base_) {
+        munmap(map_base_, map_size_);
+        map_base_ = nullptr;
+        map_size_ = 0;
+    }
+}
+
+int ThumbnailStore::tier_index(int tier) {
+    for (size_t i = 0; i < NUM_TIERS; ++i) {
+        if (TIERS[i] == tier) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+const ThumbnailEntry* ThumbnailStore::get(const std::string& hash, int min_px) const {
+    if (hash.empty()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = store_.find(hash);
+    if (it == store_.end()) {
+        return nullptr;
+    }
+
+    // Tiers are ordered smallest-first; first valid one that covers the
+    // target is the cheapest to resize from
+    for (size_t i = 0; i < NUM_TIERS; ++i) {
+        const ThumbnailEntry& entry = it->second[i];
+        if (entry.valid() && TIERS[i] >= min_px) {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+bool ThumbnailStore::has(const std::string& hash) const {
+    if (hash.empty()) return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    return store_.find(hash) != store_.end();
+}
+
+void ThumbnailStore::store(const std::string& hash, int tier, int width, int height,
+                           std::vector<uint8_t> rgb) {
+    if (hash.empty() || rgb.empty() || width <= 0 || height <= 0) {
+        return;
+    }
+    int idx = tier_index(tier);
+    if (idx < 0) {
+        util::Logger::warn("ThumbnailStore: Unknown tier " + std::to_string(tier));
+        return;
+    }
+    if (rgb.size() != static_cast<size_t>(width) * height * 3) {
+        util::Logger::warn("ThumbnailStore: Pixel size mismatch for " + hash.substr(0, 16) + "...");
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ThumbnailEntry& entry = store_[hash][idx];
+    if (entry.valid()) {
+        return;  // Already generated (content-addressed, never changes)
+    }
+
+    entry.owned = std::move(rgb);
+    entry.mapped = nullptr;
+    entry.mapped_size = 0;
+    entry.width = static_cast<uint16_t>(width);
+    entry.height = static_cast<uint16_t>(height);
+    dirty_ = true;
+
+    util::Logger::debug("ThumbnailStore: Stored " + std::to_string(tier) + "px tier for " +
+                       hash.substr(0, 16) + "... (" +
+                       std::to_string(entry.size() / 1024) + " KB)");
+}
+
+bool ThumbnailStore::is_dirty() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dirty_;
+}
+
+bool ThumbnailStore::save(const std::filesystem::path& store_path) {
+    static_assert(sizeof(uint32_t) == 4);
+    static_assert(sizeof(uint64_t) == 8);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!dirty_) {
+        util::Logger::info("ThumbnailStore: No changes, skipping save");
+        return true;
+    }
+
+    try {
+        std::filesystem::create_directories(store_path.parent_path());
+
+        // Temp file + rename, like ArtworkCache: loaded tiers point
+        // into the current file's mapping and an in-place truncate
+        // would invalidate those pages
+        const std::filesystem::path tmp_path = store_path.string() + ".tmp";
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            util::Logger::error("ThumbnailStore: Failed to open store file for writing: " + tmp_path.string());
+            return false;
+        }
+
+        out.write(reinterpret_cast<const char*>(&STORE_MAGIC), sizeof(STORE_MAGIC));
+        out.write(reinterpret_cast<const char*>(&STORE_VERSION), sizeof(STORE_VERSION));
+
+        uint64_t count = store_.size();
+        out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+        for (const auto& [hash, tiers] : store_) {
+            uint32_t hash_len = static_cast<uint32_t>(hash.length());
+            out.write(reinterpret_cast<const char*>(&hash_len), sizeof(hash_len));
+            out.write(hash.data(), hash_len);
+
+            // All tiers written in order; absent tiers as zero dims
+            for (const ThumbnailEntry& entry : tiers) {
+                uint16_t w = entry.valid() ? entry.width : 0;
+                uint16_t h = entry.valid() ? entry.height : 0;
+                out.write(reinterpret_cast<const char*>(&w), sizeof(w));
+                out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+                uint64_t data_len = entry.valid() ? entry.size() : 0;
+                out.write(reinterpret_cast<const char*>(&data_len), sizeof(data_len));
+                if (data_len > 0) {
+                    out.write(reinterpret_cast<const char*>(entry.bytes()), data_len);
+                }
+            }
+        }
+
+        out.close();
+        if (!out) {
+            util::Logger::error("ThumbnailStore: Write failed: " + tmp_path.string());
+            std::filesystem::remove(tmp_path);
+            return false;
+        }
+        std::filesystem::rename(tmp_path, store_path);
+
+        dirty_ = false;
+        util::Logger::info("ThumbnailStore: Saved " + std::to_string(count) +
+                          " entries to " + store_path.string());
+        return true;
+
+    } catch (const std::exception& e) {
+        util::Logger::error("ThumbnailStore: Failed to save store: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool ThumbnailStore::load(const std::filesystem::path& store_path) {
+    static_assert(sizeof(uint32_t) == 4);
+    static_assert(sizeof(uint64_t) == 8);
+
+    if (!std::filesystem::exists(store_path)) {
+        util::Logger::info("ThumbnailStore: No existing store file found");
+        return false;
+    }
+
+    try {
+        // Map read-only and parse past the pixel data; thumbs page in
+        // on first get() and the OS can drop cold ones under pressure
+        int fd = ::open(store_path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            util::Logger::error("ThumbnailStore: Failed to open store file for reading: " + store_path.string());
+            return false;
+        }
+        struct stat st{};
+        if (fstat(fd, &st) != 0 ||
+            st.st_size < static_cast<off_t>(sizeof(STORE_MAGIC) + sizeof(STORE_VERSION))) {
+            ::close(fd);
+            return false;
+        }
+        void* base = mmap(nullptr, static_cast<size_t>(st.st_size),
+                          PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            util::Logger::error("ThumbnailStore: mmap failed for " + store_path.string());
+            return false;
+        }
+        madvise(base, static_cast<size_t>(st.st_size), MADV_RANDOM);
+        // Warm the whole store asynchronously: the pre-scaled tiers ARE
+        // the first-render working set (album grid thumbnails), and this
+        // load already overlaps the terminal handshake, so the page-in
+        // rides the startup phases instead of stalling the first get()s
+        // behind NAS latency. WILLNEED queues the readahead and returns;
+        // MADV_RANDOM above still governs fault behavior afterwards.
+        madvise(base, static_cast<size_t>(st.st_size), MADV_WILLNEED);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        store_.clear();  // Drops any referents into a previous mapping
+        unmap_locked();
+        map_base_ = base;
+        map_size_ = static_cast<size_t>(st.st_size);
+
+        MapReader in{static_cast<const uint8_t*>(base),
+                     static_cast<const uint8_t*>(base) + map_size_};
+
+        auto fail = [&](const std::string& why) {
+            util::Logger::warn("ThumbnailStore: " + why + ", will rebuild");
+            store_.clear();
+            unmap_locked();
+            return false;
+        };
+
+        uint64_t magic;
+        uint32_t version;
+        if (!in.read(&magic, sizeof(magic)) || magic != STORE_MAGIC) {
+            return fail("Invalid store magic number");
+        }
+        if (!in.read(&version, sizeof(version)) || version != STORE_VERSION) {
+            return fail("Store version mismatch (file=" + std::to_string(version) +
+                        ", expected=" + std::to_string(STORE_VERSION) + ")");
+        }
+
+        uint64_t count;
+        if (!in.read(&count, sizeof(count))) return fail("Truncated header");
+        store_.reserve(count);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            std::string hash;
+            if (!in.read_string(hash)) return fail("Truncated entry");
+
+            auto& tiers = store_[hash];
+            for (size_t t = 0; t < NUM_TIERS; ++t) {
+                uint16_t w, h;
+                uint64_t data_len;
+                if (!in.read(&w, sizeof(w)) || !in.read(&h, sizeof(h)) ||
+                    !in.read(&data_len, sizeof(data_len))) {
+                    return fail("Truncated entry");
+                }
+                if (data_len == 0) continue;
+                if (data_len != static_cast<uint64_t>(w) * h * 3) {
+                    return fail("Tier size mismatch");
+                }
+                const uint8_t* span = in.view(data_len);
+                if (!span) return fail("Truncated entry");
+
+                tiers[t].mapped = span;
+                tiers[t].mapped_size = data_len;
+                tiers[t].width = w;
+                tiers[t].height = h;
+            }
+        }
+
+        dirty_ = false;
+        util::Logger::info("ThumbnailStore: Mapped " + std::to_string(store_.size()) +
+                          " entries from " + store_path.string());
+        return true;
+
+    } catch (const std::exception& e) {
+        util::Logger::error("ThumbnailStore: Failed to load store: " + std::string(e.what()));
+        std::lock_guard<std::mutex> lock(mutex_);
+        store_.clear();
+        unmap_locked();
+        return false;
+    }
+}
+
+size_t ThumbnailStore::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return store_.size();
+}
+
+size_t ThumbnailStore::memory_usage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    size_t total = 0;
+    for (const auto& [hash, tiers] : store_) {
+        total += hash.size();
+        for (const ThumbnailEntry& entry : tiers) {
+            total += entry.size();
+        }
+    }
+
+    return total;
+}
+
+void ThumbnailStore::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    store_.clear();
+    unmap_locked();
+}
+
+}  // namespace ouroboros::backend
@@ -1,11 +1,17 @@
 #include "collectors/LibraryCollector.hpp"
 #include "backend/Library.hpp"
+#include "backend/LoudnessScanner.hpp"
+#include "backend/MetadataCache.hpp"
 #include "backend/Config.hpp"
 #include "util/Platform.hpp"
 #include "util/Logger.hpp"
+#include "util/TaskPool.hpp"
 #include "util/TimSort.hpp"
 #include "util/DirectoryScanner.hpp"
+#include "util/InotifyWatcher.hpp"
+#include "util/StartupProfiler.hpp"
 #include "util/UnicodeUtils.hpp"
+#include "util/TrigramIndex.hpp"
 #include <thread>
 #include <fstream>
 #include <map>
@@ -48,7 +54,7 @@ static std::string extract_primary_artist(const std::string& artist) {
 }
 
 // Detect if album has scattered artists (compilation)
-static bool detect_scattered(const model::AlbumGroup& album, const std::vector<model::Track>& tracks) {
+static bool detect_scattered(const model::AlbumGroup& album, const util::PagedVector<model::Track>& tracks) {
     std::unordered_set<std::string> unique_artists;
 
     for (int idx : album.track_indices) {
@@ -79,38 +85,113 @@ static bool detect_scattered(const model::AlbumGroup& album, const std::vector<m
     return false;
 }
 
-// Compute album groups from sorted tracks (called once at library load)
-static void compute_album_groups(model::LibraryState& lib_state, const backend::Config& config) {
-    util::Logger::info("Computing album groups from " + std::to_string(lib_state.tracks.size()) + " tracks");
-
-    // Helper to get sort key for artist (strips prefixes based on config)
-    auto get_artist_sort_key = [&config](const std::string& artist) -> std::string {
-        if (artist.empty()) return artist;
-        size_t start = 0;
-        if (config.sort_ignore_the_prefix && artist.size() >= 4) {
-            if ((artist[0] == 'T' || artist[0] == 't') &&
-                (artist[1] == 'H' || artist[1] == 'h') &&
-                (artist[2] == 'E' || artist[2] == 'e') &&
-                artist[3] == ' ') {
-                start = 4;
-            }
-        }
-        if (config.sort_ignore_bracket_prefix && start < artist.size() && artist[start] == '[') {
-            start++;
-        }
-        return (start > 0) ? artist.substr(start) : artist;
+// Precompute normalized search keys so the Browser filter is a plain
+// byte scan per track (no per-row ICU work at query time). Artist and
+// album are interned, so each unique value is normalized once.
+static void compute_search_keys(model::LibraryState& lib_state) {
+    util::StartupSpan profile_span("compute_search_keys");
+    std::unordered_map<const char*, std::string> memo;
+    auto normalized = [&memo](const util::InternedString& s) -> const std::string& {
+        auto [it, inserted] = memo.try_emplace(s.data());
+        if (inserted) it->second = util::normalize_for_search(s.str());
+        return it->second;
     };
 
-    // Helper to convert year string to int for numeric comparison
-    auto year_to_int = [](const std::string& y) -> int {
-        if (y.empty()) return 9999;
-        try {
-            std::string year_str = y.substr(0, 4);
-            return std::stoi(year_str);
-        } catch (...) {
-            return 9999;
+    // Titles are mostly unique so the interning memo can't help them;
+    // batch them through normalize_many (vectorized ASCII lowercase,
+    // one memo consultation per rare non-ASCII title) instead of paying
+    // the per-call overhead once per track
+    std::vector<std::string_view> titles;
+    titles.reserve(lib_state.tracks.size());
+    for (const auto& t : lib_state.tracks) {
+        titles.push_back(t.title);
+    }
+    std::vector<std::string> normalized_titles = util::normalize_many(titles);
+
+    for (size_t i = 0; i < lib_state.tracks.size(); ++i) {
+        auto& t = lib_state.tracks.mutate(i);
+        // '\n' separators keep a query from matching across field borders
+        t.search_key = normalized(t.artist) + '\n' + normalized(t.album) + '\n' +
+                       normalized_titles[i];
+    }
+
+    // Index the fresh keys so queries resolve to candidate sets instead
+    // of scanning every track
+    auto index = std::make_shared<util::TrigramIndex>();
+    index->build(lib_state.tracks.size(), [&](size_t i) {
+        return std::string_view(lib_state.tracks[i].search_key);
+    });
+    lib_state.track_search_index = std::move(index);
+}
+
+// Sort key for artist (strips prefixes based on config)
+static std::string artist_sort_key_for(const std::string& artist, const backend::Config& config) {
+    if (artist.empty()) return artist;
+    size_t start = 0;
+    if (config.sort_ignore_the_prefix && artist.size() >= 4) {
+        if ((artist[0] == 'T' || artist[0] == 't') &&
+            (artist[1] == 'H' || artist[1] == 'h') &&
+            (artist[2] == 'E' || artist[2] == 'e') &&
+            artist[3] == ' ') {
+            start = 4;
         }
-    };
+    }
+    if (config.sort_ignore_bracket_prefix && start < artist.size() && artist[start] == '[') {
+        start++;
+    }
+    return (start > 0) ? artist.substr(start) : artist;
+}
+
+// Convert year string to int for numeric comparison
+static int year_to_int(const std::string& y) {
+    if (y.empty()) return 9999;
+    try {
+        std::string year_str = y.substr(0, 4);
+        return std::stoi(year_str);
+    } catch (...) {
+        return 9999;
+    }
+}
+
+// Bytewise-comparable ordering key for the album list: scattered albums
+// sort by title, unified by folded artist; then fixed-width year (when
+// configured) and title. Shared by the full sort and the incremental
+// binary insertion so both produce the same order.
+static std::string album_sort_key(const model::AlbumGroup& a, const backend::Config& config) {
+    // normalized_title is already folded by normalize_for_search
+    std::string key = a.is_scattered ? a.normalized_title
+                                     : util::case_fold_key(artist_sort_key_for(a.artist, config));
+    key += '\x01';
+    if (config.sort_albums_by_year) {
+        uint32_t y = static_cast<uint32_t>(year_to_int(a.year));
+        key += static_cast<char>((y >> 24) & 0xFF);
+        key += static_cast<char>((y >> 16) & 0xFF);
+        key += static_cast<char>((y >> 8) & 0xFF);
+        key += static_cast<char>(y & 0xFF);
+    }
+    key += a.normalized_title;
+    return key;
+}
+
+// Seed a directory's AlbumGroup from its first track (runs the ICU
+// normalization - the part incremental regrouping avoids repeating)
+static model::AlbumGroup seed_album_group(const model::Track& track, const std::string& album_dir) {
+    model::AlbumGroup g;
+    g.title = track.album.empty() ? "Unknown Album" : track.album;
+    g.artist = track.artist.empty() ? "Unknown Artist" : track.artist;
+    g.year = track.date;
+    g.normalized_title = util::normalize_for_search(g.title);
+    g.normalized_artist = util::normalize_for_search(g.artist);
+    g.representative_track_path = track.path;
+    g.album_directory = album_dir;
+    g.is_scattered = false;  // Detected later
+    return g;
+}
+
+// Compute album groups from sorted tracks (called once at library load)
+static void compute_album_groups(model::LibraryState& lib_state, const backend::Config& config) {
+    util::StartupSpan profile_span("compute_album_groups");
+    util::Logger::info("Computing album groups from " + std::to_string(lib_state.tracks.size()) + " tracks");
 
     // ═══════════════════════════════════════════════════════════════════════
     // STEP 1: Group tracks by DIRECTORY (not artist+album)
@@ -131,16 +212,7 @@ static void compute_album_groups(model::LibraryState& lib_state, const backend::
         std::string key = album_dir;
 
         if (groups.find(key) == groups.end()) {
-            model::AlbumGroup g;
-            g.title = track.album.empty() ? "Unknown Album" : track.album;
-            g.artist = track.artist.empty() ? "Unknown Artist" : track.artist;
-            g.year = track.date;
-            g.normalized_title = util::normalize_for_search(g.title);
-            g.normalized_artist = util::normalize_for_search(g.artist);
-            g.representative_track_path = track.path;
-            g.album_directory = album_dir;
-            g.is_scattered = false;  // Will be detected in Step 2
-            groups[key] = g;
+            groups[key] = seed_album_group(track, album_dir);
         }
         groups[key].track_indices.push_back(static_cast<int>(i));
     }
@@ -159,37 +231,23 @@ static void compute_album_groups(model::LibraryState& lib_state, const backend::
     // Each album is independent - perfect for parallel processing
     // Uses atomic work-stealing pattern for load balancing across cores
     // ═══════════════════════════════════════════════════════════════════════
-    const size_t num_threads = std::thread::hardware_concurrency();
     const size_t num_albums = albums.size();
-    std::atomic<size_t> work_index{0};
-
-    util::Logger::info("Processing " + std::to_string(num_albums) + " albums with " +
-                      std::to_string(num_threads) + " threads");
 
-    std::vector<std::thread> workers;
-    for (size_t t = 0; t < num_threads; ++t) {
-        workers.emplace_back([&]() {
-            while (true) {
-                size_t idx = work_index.fetch_add(1, std::memory_order_relaxed);
-                if (idx >= num_albums) break;
+    util::Logger::info("Processing " + std::to_string(num_albums) + " albums on shared TaskPool");
 
-                auto& album = albums[idx];
-
-                // Sort tracks within this album by track number (TimSort for natural runs)
-                ouroboros::util::timsort(album.track_indices,
-                    [&lib_state](int a, int b) {
-                        return lib_state.tracks[a].track_number < lib_state.tracks[b].track_number;
-                    });
+    // Low priority: artwork decodes sharing the pool preempt this batch
+    util::TaskPool::instance().run_parallel(num_albums, [&](size_t idx) {
+        auto& album = albums[idx];
 
-                // Detect if this album is scattered (compilation)
-                album.is_scattered = detect_scattered(album, lib_state.tracks);
-            }
-        });
-    }
+        // Sort tracks within this album by track number (TimSort for natural runs)
+        ouroboros::util::timsort(album.track_indices,
+            [&lib_state](int a, int b) {
+                return lib_state.tracks[a].track_number < lib_state.tracks[b].track_number;
+            });
 
-    for (auto& w : workers) {
-        w.join();
-    }
+        // Detect if this album is scattered (compilation)
+        album.is_scattered = detect_scattered(album, lib_state.tracks);
+    });
 
     size_t scattered_count = std::count_if(albums.begin(), albums.end(),
         [](const model::AlbumGroup& a) { return a.is_scattered; });
@@ -199,33 +257,85 @@ static void compute_album_groups(model::LibraryState& lib_state, const backend::
     // STEP 3: Sort albums (parallel)
     // Scattered: by title | Unified: by artist, then year, then title
     // ═══════════════════════════════════════════════════════════════════════
-    bool sort_by_year = config.sort_albums_by_year;
-
     util::Logger::info("Sorting " + std::to_string(albums.size()) + " albums (parallel)");
-    ouroboros::util::parallel_timsort(albums,
-        [sort_by_year, &get_artist_sort_key, &year_to_int](
-            const model::AlbumGroup& a, const model::AlbumGroup& b) {
-
-            // Scattered albums sort by title, unified by artist
-            std::string key_a = a.is_scattered ? a.normalized_title : get_artist_sort_key(a.artist);
-            std::string key_b = b.is_scattered ? b.normalized_title : get_artist_sort_key(b.artist);
-
-            int cmp = util::case_insensitive_compare(key_a, key_b);
-            if (cmp != 0) return cmp < 0;
-
-            // Same primary key, compare by year
-            if (sort_by_year) {
-                int ya = year_to_int(a.year);
-                int yb = year_to_int(b.year);
-                if (ya != yb) return ya < yb;
-            }
+    ouroboros::util::parallel_timsort_by_key(albums,
+        [&config](const model::AlbumGroup& a) { return album_sort_key(a, config); });
+
+    lib_state.albums = std::move(albums);
+    util::Logger::info("Album groups computed: " + std::to_string(lib_state.albums.size()) + " albums");
+}
+
+// Incremental regroup after a small delta (watcher events): albums
+// whose directory is untouched keep their normalized metadata, scatter
+// verdict and position in the sorted list - only their track indices
+// are remapped into the new track vector. Dirty or new directories are
+// rebuilt from scratch and spliced in via binary insertion on the
+// shared ordering key, so the result matches a full recompute.
+static void update_album_groups(model::LibraryState& lib_state,
+                                const model::LibraryState& prev_state,
+                                const std::unordered_set<std::string>& dirty_dirs,
+                                const backend::Config& config) {
+    if (prev_state.albums.empty()) {
+        compute_album_groups(lib_state, config);
+        return;
+    }
 
-            // Finally by title
-            return util::case_insensitive_compare(a.normalized_title, b.normalized_title) < 0;
+    // New track indices per directory (cheap: no ICU work)
+    std::unordered_map<std::string, std::vector<int>> dir_tracks;
+    for (size_t i = 0; i < lib_state.tracks.size(); ++i) {
+        const auto& path = lib_state.tracks[i].path;
+        size_t last_slash = path.rfind('/');
+        std::string album_dir = (last_slash != std::string::npos)
+            ? path.substr(0, last_slash)
+            : path;
+        dir_tracks[album_dir].push_back(static_cast<int>(i));
+    }
+
+    auto sort_by_track_number = [&lib_state](std::vector<int>& indices) {
+        ouroboros::util::timsort(indices, [&lib_state](int a, int b) {
+            return lib_state.tracks[a].track_number < lib_state.tracks[b].track_number;
         });
+    };
 
+    // Clean albums: keep previous order, remap indices
+    std::vector<model::AlbumGroup> albums;
+    albums.reserve(prev_state.albums.size());
+    for (const auto& old_album : prev_state.albums) {
+        if (dirty_dirs.count(old_album.album_directory)) continue;  // rebuilt below
+        auto it = dir_tracks.find(old_album.album_directory);
+        if (it == dir_tracks.end()) continue;  // directory gone
+
+        model::AlbumGroup album = old_album;
+        album.track_indices = std::move(it->second);
+        sort_by_track_number(album.track_indices);
+        dir_tracks.erase(it);
+        albums.push_back(std::move(album));
+    }
+
+    // Dirty or new directories: full rebuild, then binary insertion at
+    // the position the full sort would have put them
+    size_t rebuilt = 0;
+    for (auto& [album_dir, indices] : dir_tracks) {
+        if (indices.empty()) continue;
+
+        model::AlbumGroup album = seed_album_group(lib_state.tracks[indices.front()], album_dir);
+        album.track_indices = std::move(indices);
+        sort_by_track_number(album.track_indices);
+        album.is_scattered = detect_scattered(album, lib_state.tracks);
+
+        const std::string key = album_sort_key(album, config);
+        auto pos = std::lower_bound(albums.begin(), albums.end(), key,
+            [&config](const model::AlbumGroup& a, const std::string& k) {
+                return album_sort_key(a, config) < k;
+            });
+        albums.insert(pos, std::move(album));
+        ++rebuilt;
+    }
+
+    util::Logger::info("Incremental album regroup: " +
+                       std::to_string(albums.size() - rebuilt) + " reused, " +
+                       std::to_string(rebuilt) + " rebuilt");
     lib_state.albums = std::move(albums);
-    util::Logger::info("Album groups computed: " + std::to_string(lib_state.albums.size()) + " albums");
 }
 
 LibraryCollector::LibraryCollector(std::shared_ptr<backend::SnapshotPublisher> publisher,
@@ -235,49 +345,80 @@ LibraryCollector::LibraryCollector(std::shared_ptr<backend::SnapshotPublisher> p
 void LibraryCollector::run(std::stop_token stop_token) {
     backend::Library library;
 
-    // Helper to get sort key for artist (strips prefixes based on config)
-    auto get_artist_sort_key = [this](const std::string& artist) -> std::string {
-        if (artist.empty()) return artist;
-
-        size_t start = 0;
+    // Bytewise-comparable sort key defining every track sort below:
+    // folded artist (prefixes stripped per config), date, directory
+    // (matches album view's directory-based grouping), track number.
+    // Kept in one place so the published order - and the persisted copy
+    // of it - cannot drift between the cache-load, full-scan and
+    // watcher paths. parallel_timsort_by_key extracts it once per track
+    // instead of re-running the ICU fold on every comparison.
+    auto track_sort_key = [this](const model::Track& t) {
+        std::string key = util::case_fold_key(artist_sort_key_for(t.artist, config_));
+        key += '\x01';
+        key += t.date;
+        key += '\x01';
+        size_t slash = t.path.rfind('/');
+        key.append(t.path.data(), slash != std::string::npos ? slash : 0);
+        key += '\x01';
+        // Fixed-width big-endian track number, sign bit flipped so the
+        // bytewise order is the signed numeric order
+        uint32_t tn = static_cast<uint32_t>(t.track_number) ^ 0x80000000u;
+        key += static_cast<char>((tn >> 24) & 0xFF);
+        key += static_cast<char>((tn >> 16) & 0xFF);
+        key += static_cast<char>((tn >> 8) & 0xFF);
+        key += static_cast<char>(tn & 0xFF);
+        return key;
+    };
 
-        // Strip "The " prefix if configured (case-insensitive)
-        if (config_.sort_ignore_the_prefix && artist.size() >= 4) {
-            if ((artist[0] == 'T' || artist[0] == 't') &&
-                (artist[1] == 'H' || artist[1] == 'h') &&
-                (artist[2] == 'E' || artist[2] == 'e') &&
-                artist[3] == ' ') {
-                start = 4;
-            }
+    // Fingerprint of everything track_sort_key's result depends on
+    // besides the tracks themselves; a persisted order under a
+    // different fingerprint is ignored and the library re-sorted
+    auto sort_fingerprint = [this]() {
+        uint64_t fp = 0x534F525400000002ull;  // 'SORT' | key schema v2 (bytewise fold key)
+        if (config_.sort_ignore_the_prefix) fp ^= 0x100;
+        if (config_.sort_ignore_bracket_prefix) fp ^= 0x200;
+        for (const auto& dir : config_.music_directories) {
+            fp ^= std::hash<std::string>{}(dir.string());
         }
-
-        // Strip "[" prefix if configured
-        if (config_.sort_ignore_bracket_prefix && start < artist.size() && artist[start] == '[') {
-            start++;
+        return fp;
+    }();
+
+    // Hand the published order to the library so the next snapshot
+    // write persists it (CACHE_VERSION 7)
+    auto remember_sort_order = [sort_fingerprint](backend::Library& lib,
+                                                  const std::vector<model::Track>& sorted_tracks) {
+        std::vector<std::string> paths;
+        paths.reserve(sorted_tracks.size());
+        for (const auto& t : sorted_tracks) {
+            paths.push_back(t.path);
         }
-
-        return (start > 0) ? artist.substr(start) : artist;
+        lib.set_sort_order(std::move(paths), sort_fingerprint);
     };
 
+    // Last published album grouping, kept so watcher deltas can regroup
+    // incrementally instead of rebuilding every album
+    std::shared_ptr<const model::LibraryState> last_albums_state;
+
     // Use config music_directories if set, otherwise fall back to Platform default
+    std::vector<std::filesystem::path> music_dirs;
     if (!config_.music_directories.empty()) {
         for (const auto& dir : config_.music_directories) {
             util::Logger::info("Music directory: " + dir.string());
         }
-        library.set_music_directories(config_.music_directories);
+        music_dirs = config_.music_directories;
     } else {
         auto default_dir = util::Platform::get_music_directory();
         util::Logger::info("Music directory (default): " + default_dir.string());
-        library.set_music_directories({default_dir});
+        music_dirs = {default_dir};
     }
+    library.set_music_directories(music_dirs);
 
     // Publish early scanning state so UI shows loading indicator during validation
     publisher_->update([](model::Snapshot& snap) {
-        auto loading_state = std::make_shared<model::LibraryState>();
-        loading_state->is_scanning = true;
-        loading_state->scanned_count = 0;
-        loading_state->total_count = 0;
-        snap.library = loading_state;
+        snap.library = std::make_shared<model::LibraryState>();
+        snap.scan_progress.is_scanning = true;
+        snap.scan_progress.scanned_count = 0;
+        snap.scan_progress.total_count = 0;
     });
 
     // Cache file path
@@ -295,6 +436,12 @@ void LibraryCollector::run(std::stop_token stop_token) {
     }
     std::filesystem::path cache_file = cache_dir / "library.bin";
 
+    // Disk tier for parsed metadata: a restart after a partial scan
+    // resumes warm instead of re-parsing from scratch
+    if (!backend::MetadataCache::instance().open_disk_cache(cache_dir / "metadata.bin")) {
+        util::Logger::warn("MetadataCache disk tier disabled");
+    }
+
     bool cache_valid = false;
 
     // ═══════════════════════════════════════════════════════════════════════
@@ -303,11 +450,19 @@ void LibraryCollector::run(std::stop_token stop_token) {
     backend::Library::CacheValidationResult tier0_result = backend::Library::CacheValidationResult::GenericFailure;
 
     if (std::filesystem::exists(cache_file)) {
-        if (library.load_from_cache(cache_file)) {
+        bool cache_loaded;
+        {
+            util::StartupSpan span("library_cache_load");
+            cache_loaded = library.load_from_cache(cache_file);
+        }
+        if (cache_loaded) {
             util::Logger::info("Cache loaded: " + std::to_string(library.get_track_count()) + " tracks");
 
             // Validate cache with TIER 0
-            tier0_result = library.validate_cache_tier0(cache_file);
+            {
+                util::StartupSpan span("tier0_validation");
+                tier0_result = library.validate_cache_tier0(cache_file);
+            }
 
             if (tier0_result == backend::Library::CacheValidationResult::Valid) {
                 util::Logger::info("TIER 0: Cache validated successfully - skipping scan");
@@ -315,42 +470,48 @@ void LibraryCollector::run(std::stop_token stop_token) {
 
                 // Instant publish!
                 auto new_lib_state = std::make_shared<model::LibraryState>();
-                new_lib_state->tracks = library.get_all_tracks();
-
-                // Sort library (parallel)
-                util::Logger::info("Sorting library (parallel): " + std::to_string(new_lib_state->tracks.size()) + " tracks");
-                ouroboros::util::parallel_timsort(new_lib_state->tracks, [&get_artist_sort_key](const model::Track& a, const model::Track& b) {
-                    int cmp = util::case_insensitive_compare(get_artist_sort_key(a.artist), get_artist_sort_key(b.artist));
-                    if (cmp != 0) return cmp < 0;
-                    if (a.date != b.date) return a.date < b.date;
-                    // Group by directory (matches album view's directory-based grouping)
-                    size_t a_slash = a.path.rfind('/');
-                    size_t b_slash = b.path.rfind('/');
-                    std::string_view a_dir(a.path.data(), a_slash != std::string::npos ? a_slash : 0);
-                    std::string_view b_dir(b.path.data(), b_slash != std::string::npos ? b_slash : 0);
-                    if (a_dir != b_dir) return a_dir < b_dir;
-                    return a.track_number < b.track_number;
-                });
-                util::Logger::info("Library sorted successfully");
-
-                new_lib_state->is_scanning = false;
-                new_lib_state->scanned_count = library.get_track_count();
-                new_lib_state->total_count = library.get_track_count();
+                if (auto presorted = library.get_tracks_in_saved_order(sort_fingerprint)) {
+                    // The cache carries the order from the last run; a
+                    // clean load skips the whole sort
+                    util::Logger::info("Using persisted sort order: " +
+                                       std::to_string(presorted->size()) + " tracks");
+                    new_lib_state->tracks = std::move(*presorted);
+                } else {
+                    // Sort a flat vector, then page it: the sort needs
+                    // contiguous storage, the published state doesn't
+                    auto sorted_tracks = library.get_all_tracks();
+                    util::Logger::info("Sorting library (parallel): " + std::to_string(sorted_tracks.size()) + " tracks");
+                    {
+                        util::StartupSpan sort_span("library_sort");
+                        ouroboros::util::parallel_timsort_by_key(sorted_tracks, track_sort_key);
+                    }
+                    util::Logger::info("Library sorted successfully");
+                    remember_sort_order(library, sorted_tracks);
+                    if (!library.save_to_cache(cache_file)) {
+                        util::Logger::warn("Failed to persist sort order to cache");
+                    }
+                    new_lib_state->tracks = std::move(sorted_tracks);
+                }
 
                 // Publish tracks immediately so Track view renders fast
                 publisher_->update([&](model::Snapshot& s) {
                     s.library = new_lib_state;
+                    s.scan_progress.is_scanning = false;
+                    s.scan_progress.scanned_count = library.get_track_count();
+                    s.scan_progress.total_count = library.get_track_count();
                     s.timestamp = std::chrono::steady_clock::now();
                 });
 
                 // Compute album groups in background AFTER Track view is ready
                 util::Logger::info("Computing album groups in background...");
                 auto albums_state = std::make_shared<model::LibraryState>(*new_lib_state);
+                compute_search_keys(*albums_state);
                 compute_album_groups(*albums_state, config_);
                 publisher_->update([&, albums_state](model::Snapshot& s) {
                     s.library = albums_state;
                     s.timestamp = std::chrono::steady_clock::now();
                 });
+                last_albums_state = albums_state;
             }
         }
     }
@@ -367,14 +528,17 @@ void LibraryCollector::run(std::stop_token stop_token) {
 
         // Scan all configured directories and merge mtimes
         std::unordered_map<std::string, std::time_t> current_dir_mtimes;
-        if (!config_.music_directories.empty()) {
-            for (const auto& dir : config_.music_directories) {
-                auto dir_mtimes = util::DirectoryScanner::scan_directories_only(dir);
-                current_dir_mtimes.insert(dir_mtimes.begin(), dir_mtimes.end());
+        {
+            util::StartupSpan span("tier1_directory_scan");
+            if (!config_.music_directories.empty()) {
+                for (const auto& dir : config_.music_directories) {
+                    auto dir_mtimes = util::DirectoryScanner::scan_directories_only(dir);
+                    current_dir_mtimes.insert(dir_mtimes.begin(), dir_mtimes.end());
+                }
+            } else {
+                auto default_dir = util::Platform::get_music_directory();
+                current_dir_mtimes = util::DirectoryScanner::scan_directories_only(default_dir);
             }
-        } else {
-            auto default_dir = util::Platform::get_music_directory();
-            current_dir_mtimes = util::DirectoryScanner::scan_directories_only(default_dir);
         }
         auto dirty_dirs = library.find_dirty_directories(current_dir_mtimes, library.get_dir_mtimes());
 
@@ -384,35 +548,44 @@ void LibraryCollector::run(std::stop_token stop_token) {
 
             // Publish cached library
             auto new_lib_state = std::make_shared<model::LibraryState>();
-            new_lib_state->tracks = library.get_all_tracks();
-
-            util::Logger::info("Sorting library (parallel): " + std::to_string(new_lib_state->tracks.size()) + " tracks");
-            ouroboros::util::parallel_timsort(new_lib_state->tracks, [&get_artist_sort_key](const model::Track& a, const model::Track& b) {
-                int cmp = util::case_insensitive_compare(get_artist_sort_key(a.artist), get_artist_sort_key(b.artist));
-                if (cmp != 0) return cmp < 0;
-                if (a.date != b.date) return a.date < b.date;
-                return a.track_number < b.track_number;
-            });
-            util::Logger::info("Library sorted successfully");
-
-            new_lib_state->is_scanning = false;
-            new_lib_state->scanned_count = library.get_track_count();
-            new_lib_state->total_count = library.get_track_count();
+            if (auto presorted = library.get_tracks_in_saved_order(sort_fingerprint)) {
+                util::Logger::info("Using persisted sort order: " +
+                                   std::to_string(presorted->size()) + " tracks");
+                new_lib_state->tracks = std::move(*presorted);
+            } else {
+                auto sorted_tracks = library.get_all_tracks();
+                util::Logger::info("Sorting library (parallel): " + std::to_string(sorted_tracks.size()) + " tracks");
+                {
+                    util::StartupSpan sort_span("library_sort");
+                    ouroboros::util::parallel_timsort_by_key(sorted_tracks, track_sort_key);
+                }
+                util::Logger::info("Library sorted successfully");
+                remember_sort_order(library, sorted_tracks);
+                if (!library.save_to_cache(cache_file)) {
+                    util::Logger::warn("Failed to persist sort order to cache");
+                }
+                new_lib_state->tracks = std::move(sorted_tracks);
+            }
 
             // Publish tracks immediately so Track view renders fast
             publisher_->update([&](model::Snapshot& s) {
                 s.library = new_lib_state;
+                s.scan_progress.is_scanning = false;
+                s.scan_progress.scanned_count = library.get_track_count();
+                s.scan_progress.total_count = library.get_track_count();
                 s.timestamp = std::chrono::steady_clock::now();
             });
 
             // Compute album groups in background AFTER Track view is ready
             util::Logger::info("Computing album groups in background...");
             auto albums_state = std::make_shared<model::LibraryState>(*new_lib_state);
+            compute_search_keys(*albums_state);
             compute_album_groups(*albums_state, config_);
             publisher_->update([&, albums_state](model::Snapshot& s) {
                 s.library = albums_state;
                 s.timestamp = std::chrono::steady_clock::now();
             });
+            last_albums_state = albums_state;
         }
     } else if (skip_tier1) {
         util::Logger::info("Skipping TIER 1 because TIER 0 detected Count Mismatch (files added/removed)");
@@ -424,77 +597,267 @@ void LibraryCollector::run(std::stop_token stop_token) {
     if (!cache_valid) {
         util::Logger::info("Cache invalid - performing full scan with optimizations");
 
-        // Publish scanning state
+        // Publish scanning state (retained tracks stay shared - no copy)
         publisher_->update([](model::Snapshot& snap) {
-            auto scanning_state = std::make_shared<model::LibraryState>();
-            if (snap.library) {
-                scanning_state->tracks = snap.library->tracks;
-            }
-            scanning_state->is_scanning = true;
-            scanning_state->scanned_count = 0;
-            scanning_state->total_count = 0;
-            snap.library = scanning_state;
+            snap.scan_progress.is_scanning = true;
+            snap.scan_progress.scanned_count = 0;
+            snap.scan_progress.total_count = 0;
         });
 
-        // Scan with progress callback (uses getdents64 + parallel parsing)
-        library.scan_directory([this](int scanned, int total) {
-            publisher_->update([scanned, total](model::Snapshot& snap) {
-                if (snap.library) {
-                    auto progress_state = std::make_shared<model::LibraryState>(*snap.library);
-                    progress_state->scanned_count = scanned;
-                    progress_state->total_count = total;
-                    snap.library = progress_state;
-                }
+        // Streaming publishes make sense only on a first-ever scan:
+        // when an invalid cache still holds tracks, replacing the full
+        // (stale) library with a growing partial one would shrink the
+        // browser mid-session instead of improving it
+        const bool stream_partials = library.get_track_count() == 0;
+        std::vector<model::Track> streamed_tracks;  // Sorted accumulation
+
+        // Merge-insert one parsed batch and publish the partial state.
+        // The accumulation stays sorted, so each republish is timsort's
+        // near-linear sorted-run + small-tail case, and the browser is
+        // usable seconds into a fresh 500k-track scan
+        auto publish_partial = [&](std::vector<model::Track>&& batch) {
+            streamed_tracks.insert(streamed_tracks.end(),
+                                   std::make_move_iterator(batch.begin()),
+                                   std::make_move_iterator(batch.end()));
+            ouroboros::util::parallel_timsort_by_key(streamed_tracks, track_sort_key);
+
+            auto partial_state = std::make_shared<model::LibraryState>();
+            partial_state->tracks = std::vector<model::Track>(streamed_tracks);
+            publisher_->update([&](model::Snapshot& s) {
+                s.library = partial_state;
+                s.timestamp = std::chrono::steady_clock::now();
             });
-        });
-
-        // Save monolithic cache
-        if (!library.save_to_cache(cache_file)) {
-            util::Logger::error("Failed to save library cache: " + cache_file.string());
+            util::Logger::info("Streaming scan: published partial library with " +
+                               std::to_string(streamed_tracks.size()) + " tracks");
+        };
+
+        // Scan with progress callback (uses getdents64 + parallel parsing).
+        // Progress ticks only touch the value-type counters, so each publish
+        // is O(1) regardless of library size.
+        {
+            util::StartupSpan span("full_library_scan");
+            library.scan_directory(
+                [this](int scanned, int total) {
+                    publisher_->update([scanned, total](model::Snapshot& snap) {
+                        snap.scan_progress.scanned_count = scanned;
+                        snap.scan_progress.total_count = total;
+                    });
+                },
+                stream_partials
+                    ? std::function<void(std::vector<model::Track>&&)>(publish_partial)
+                    : nullptr);
         }
 
         // Publish final library
         auto new_lib_state = std::make_shared<model::LibraryState>();
-        new_lib_state->tracks = library.get_all_tracks();
-
-        util::Logger::info("Sorting scanned library (parallel): " + std::to_string(new_lib_state->tracks.size()) + " tracks");
-        ouroboros::util::parallel_timsort(new_lib_state->tracks, [&get_artist_sort_key](const model::Track& a, const model::Track& b) {
-            int cmp = util::case_insensitive_compare(get_artist_sort_key(a.artist), get_artist_sort_key(b.artist));
-            if (cmp != 0) return cmp < 0;
-            if (a.date != b.date) return a.date < b.date;
-            return a.track_number < b.track_number;
-        });
+        auto sorted_tracks = library.get_all_tracks();
+
+        util::Logger::info("Sorting scanned library (parallel): " + std::to_string(sorted_tracks.size()) + " tracks");
+        {
+            util::StartupSpan sort_span("library_sort");
+            ouroboros::util::parallel_timsort_by_key(sorted_tracks, track_sort_key);
+        }
         util::Logger::info("Library sorted successfully");
+        remember_sort_order(library, sorted_tracks);
+        new_lib_state->tracks = std::move(sorted_tracks);
 
-        new_lib_state->is_scanning = false;
-        new_lib_state->scanned_count = library.get_track_count();
-        new_lib_state->total_count = library.get_track_count();
+        // Save monolithic cache (sorted order rides along in the snapshot)
+        if (!library.save_to_cache(cache_file)) {
+            util::Logger::error("Failed to save library cache: " + cache_file.string());
+        }
 
         // Publish tracks immediately so Track view renders fast
         publisher_->update([&](model::Snapshot& s) {
             s.library = new_lib_state;
+            s.scan_progress.is_scanning = false;
+            s.scan_progress.scanned_count = library.get_track_count();
+            s.scan_progress.total_count = library.get_track_count();
             s.timestamp = std::chrono::steady_clock::now();
         });
 
         // Compute album groups in background AFTER Track view is ready
         util::Logger::info("Computing album groups in background...");
         auto albums_state = std::make_shared<model::LibraryState>(*new_lib_state);
+        compute_search_keys(*albums_state);
         compute_album_groups(*albums_state, config_);
         publisher_->update([&, albums_state](model::Snapshot& s) {
             s.library = albums_state;
             s.timestamp = std::chrono::steady_clock::now();
         });
+        last_albums_state = albums_state;
     }
 
     util::Logger::info("Library scan complete: " + std::to_string(library.get_track_count()) + " tracks");
 
-    // Library only scans once at startup, so just sleep until shutdown
+    // ═══════════════════════════════════════════════════════════════════════
+    // BACKGROUND LOUDNESS SCAN (EBU R128)
+    // One track per TaskPool Low task, so UI-facing work preempts it.
+    // Gains persist into the library cache as they land, which makes the
+    // scan resumable: a fresh session only queues what's still unscanned.
+    // ═══════════════════════════════════════════════════════════════════════
+    backend::LoudnessScanner loudness_scanner;
+    {
+        std::vector<model::Track> unscanned;
+        library.for_each_track([&unscanned](const model::Track& t) {
+            if (t.is_valid && !t.loudness_scanned) {
+                unscanned.push_back(t);
+            }
+        });
+        if (!unscanned.empty()) {
+            loudness_scanner.start(std::move(unscanned));
+        }
+    }
+    std::vector<backend::LoudnessScanner::Result> loudness_pending;
+
+    // ═══════════════════════════════════════════════════════════════════════
+    // LIVE WATCHER: inotify on the music trees
+    // Changed/deleted paths flow straight into scan_for_changes, so a
+    // newly copied album shows up in seconds with zero traversal and
+    // the save afterwards is a journal append, not a snapshot rewrite.
+    // ═══════════════════════════════════════════════════════════════════════
+    util::InotifyWatcher watcher(music_dirs);
+    util::InotifyWatcher::Changes pending;
+    auto last_event = std::chrono::steady_clock::now();
+    constexpr auto kSettleDelay = std::chrono::seconds(2);
+
     while (!stop_token.stop_requested()) {
-        // Sleep in short intervals to allow immediate shutdown
-        for (int i = 0; i < 60; ++i) {
-            if (stop_token.stop_requested()) break;
+        // Fold in finished loudness measurements on this loop's cadence.
+        // Flushes are batched (or fired when the scanner drains) so a
+        // long scan saves and republishes every N tracks, not every one.
+        {
+            auto measured = loudness_scanner.drain_results();
+            loudness_pending.insert(loudness_pending.end(),
+                                    std::make_move_iterator(measured.begin()),
+                                    std::make_move_iterator(measured.end()));
+            if (!loudness_pending.empty() &&
+                (loudness_pending.size() >= 64 || loudness_scanner.idle())) {
+                for (const auto& r : loudness_pending) {
+                    library.set_track_loudness(r.path, r.track_gain_db);
+                }
+                library.recompute_album_gains();
+                util::Logger::info("Loudness: Persisting " +
+                                   std::to_string(loudness_pending.size()) +
+                                   " measured tracks");
+                loudness_pending.clear();
+                if (!library.save_to_cache(cache_file)) {
+                    util::Logger::error("Loudness: Failed to save library cache");
+                }
+
+                // Patch gains into the published state in place: order is
+                // untouched, so album indices stay valid and no re-sort
+                // or regroup is needed. The map points into the
+                // library's own storage (nothing else mutates it on
+                // this thread), so no copy of the library is made.
+                std::unordered_map<std::string_view, const model::Track*> by_path;
+                by_path.reserve(library.get_track_count());
+                library.for_each_track([&by_path](const model::Track& t) {
+                    by_path.emplace(t.path, &t);
+                });
+                publisher_->update([&](model::Snapshot& s) {
+                    if (!s.library) return;
+                    auto patched = std::make_shared<model::LibraryState>(*s.library);
+                    // Look up before mutate(i): only pages that actually
+                    // hold a measured track get copied, the rest stay
+                    // shared with the previous snapshot generation
+                    for (size_t i = 0; i < patched->tracks.size(); ++i) {
+                        auto it = by_path.find(patched->tracks[i].path);
+                        if (it == by_path.end()) continue;
+                        auto& t = patched->tracks.mutate(i);
+                        t.track_gain_db = it->second->track_gain_db;
+                        t.album_gain_db = it->second->album_gain_db;
+                        t.loudness_scanned = it->second->loudness_scanned;
+                    }
+                    s.library = patched;
+                    s.timestamp = std::chrono::steady_clock::now();
+                });
+            }
+        }
+
+        if (!watcher.available()) {
+            // No inotify: keep the old scan-at-startup-only behavior
             std::this_thread::sleep_for(std::chrono::seconds(1));
+            continue;
+        }
+
+        if (watcher.poll(pending, 1000)) {
+            last_event = std::chrono::steady_clock::now();
+            continue;  // Keep draining; a copy-in produces event bursts
+        }
+
+        // Quiet period: apply once the burst has settled
+        if (pending.empty() ||
+            std::chrono::steady_clock::now() - last_event < kSettleDelay) {
+            continue;
         }
+
+        // Expand deleted directories to the tracks we know were inside
+        // (single visitation pass; the old loop deep-copied the whole
+        // library once per deleted directory)
+        if (!pending.deleted_dirs.empty()) {
+            std::vector<std::string> prefixes;
+            prefixes.reserve(pending.deleted_dirs.size());
+            for (const auto& dir : pending.deleted_dirs) {
+                prefixes.push_back(dir + "/");
+            }
+            library.for_each_track([&](const model::Track& track) {
+                for (const auto& prefix : prefixes) {
+                    if (track.path.starts_with(prefix)) {
+                        pending.deleted_files.push_back(track.path);
+                        break;
+                    }
+                }
+            });
+        }
+
+        util::Logger::info("Watcher: Applying " +
+                          std::to_string(pending.changed_files.size()) + " changed, " +
+                          std::to_string(pending.deleted_files.size()) + " deleted");
+
+        // Directories whose membership changed; every other album keeps
+        // its grouping and sorted position in the incremental regroup
+        std::unordered_set<std::string> dirty_dirs;
+        auto parent_dir_of = [](const std::string& p) {
+            size_t slash = p.rfind('/');
+            return (slash != std::string::npos) ? p.substr(0, slash) : p;
+        };
+        for (const auto& f : pending.changed_files) dirty_dirs.insert(parent_dir_of(f));
+        for (const auto& f : pending.deleted_files) dirty_dirs.insert(parent_dir_of(f));
+
+        library.scan_for_changes(pending.changed_files, pending.deleted_files);
+        pending = {};
+
+        if (!library.save_to_cache(cache_file)) {
+            util::Logger::error("Watcher: Failed to save library cache");
+        }
+
+        // Republish: tracks first for a fast Track view, albums after
+        auto new_lib_state = std::make_shared<model::LibraryState>();
+        auto sorted_tracks = library.get_all_tracks();
+        ouroboros::util::parallel_timsort_by_key(sorted_tracks, track_sort_key);
+        // Persisted whenever the next snapshot rewrite happens; the
+        // journal append above keeps routine watcher saves cheap
+        remember_sort_order(library, sorted_tracks);
+        new_lib_state->tracks = std::move(sorted_tracks);
+
+        publisher_->update([&](model::Snapshot& s) {
+            s.library = new_lib_state;
+            s.scan_progress.scanned_count = library.get_track_count();
+            s.scan_progress.total_count = library.get_track_count();
+            s.timestamp = std::chrono::steady_clock::now();
+        });
+
+        auto albums_state = std::make_shared<model::LibraryState>(*new_lib_state);
+        compute_search_keys(*albums_state);
+        if (last_albums_state) {
+            update_album_groups(*albums_state, *last_albums_state, dirty_dirs, config_);
+        } else {
+            compute_album_groups(*albums_state, config_);
+        }
+        publisher_->update([&, albums_state](model::Snapshot& s) {
+            s.library = albums_state;
+            s.timestamp = std::chrono::steady_clock::now();
+        });
+        last_albums_state = albums_state;
     }
 }
 
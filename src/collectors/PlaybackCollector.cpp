@@ -5,9 +5,16 @@
 #include "audio/M4ADecoder.hpp"
 #include "audio/DSDDecoder.hpp"
 #include "audio/PipeWireOutput.hpp"
+#include "audio/Resampler.hpp"
+#include "audio/SampleConvert.hpp"
+#include "audio/WAVDecoder.hpp"
+#include "audio/SpectrumAnalyzer.hpp"
+#include "backend/Config.hpp"
 #include "backend/MetadataParser.hpp"
 #include "util/Logger.hpp"
+#include "util/PerfCounters.hpp"
 #include "util/Platform.hpp"
+#include "util/StartupProfiler.hpp"
 #include "events/EventBus.hpp"
 #include <thread>
 #include <memory>
@@ -32,6 +39,7 @@ PlaybackCollector::PlaybackCollector(std::shared_ptr<backend::SnapshotPublisher>
             util::Logger::debug("PlaybackCollector: Clear requested (atomic flag set)");
         }));
 
+    util::StartupSpan span("pipewire_context_init");
     if (!audio_context_.init()) {
         util::Logger::error("Failed to initialize PipeWire context!");
     }
@@ -42,6 +50,13 @@ PlaybackCollector::~PlaybackCollector() {
     for (auto id : subscriptions_) {
         bus.unsubscribe(id);
     }
+
+    if (prefetch_thread_.joinable()) {
+        prefetch_thread_.join();
+    }
+    if (prefetched_decoder_) {
+        prefetched_decoder_->close();
+    }
 }
 
 // Position interpolation methods
@@ -71,14 +86,60 @@ void PlaybackCollector::reset_position_anchor(int64_t position_ms, audio::PipeWi
     anchor_consumed_frames_ = output.frames_consumed();
 }
 
+int64_t PlaybackCollector::anchor_steady_ms() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        anchor_time_.time_since_epoch()).count();
+}
+
 void PlaybackCollector::run(std::stop_token stop_token) {
     bool last_queue_empty_logged = false;
 
-    // GAPLESS PLAYBACK: Persistent output - lives across tracks
-    audio::PipeWireOutput output;
+    // GAPLESS PLAYBACK: Persistent output - lives across tracks. Heap
+    // allocation because the stream registers `this` as the RT callback
+    // userdata: the object must never move, but the dual-stream
+    // handover below swaps which object is live by swapping pointers.
+    auto output = std::make_unique<audio::PipeWireOutput>();
     int output_sample_rate = 0;
     int output_channels = 0;
 
+    // Dual-stream handover: when the next track needs a different
+    // device format, a second stream is pre-negotiated (corked) during
+    // the current tail and adopted at the boundary
+    std::unique_ptr<audio::PipeWireOutput> standby_output;
+    // Whether the previous track ran to its natural end (drain the old
+    // tail before a handover) or was skipped (switch immediately)
+    bool last_track_finished = false;
+
+    // Pinned-rate mode: all tracks resample into one device rate
+    audio::Resampler resampler;
+
+    // Pre-warm: connect + negotiate a corked stream before the first
+    // play-press, so pressing enter costs a cork flip instead of the
+    // full connect/negotiation round-trip. Format guess is the restored
+    // queue's current track when one is already resolved, else CD
+    // stereo; a wrong guess falls into the reconfigure fast path below.
+    {
+        int warm_rate = 44100;
+        int warm_channels = 2;
+        if (int pin = backend::Config::instance().pin_sample_rate; pin > 0) {
+            warm_rate = pin;
+        } else if (auto snap_ptr = publisher_->get_current()) {
+            const auto& q = *snap_ptr->queue;
+            if (q.current.has_value() && *q.current >= 0 &&
+                *q.current < util::narrow_cast<int>(snap_ptr->library->tracks.size())) {
+                const auto& t = snap_ptr->library->tracks[*q.current];
+                if (t.sample_rate > 0) warm_rate = t.sample_rate;
+                if (t.channels > 0) warm_channels = t.channels;
+            }
+        }
+        if (output->prewarm(audio_context_, warm_rate, warm_channels)) {
+            output_sample_rate = warm_rate;
+            output_channels = warm_channels;
+            util::Logger::info("PlaybackCollector: Pre-warmed PipeWire stream (" +
+                std::to_string(warm_rate) + "Hz, " + std::to_string(warm_channels) + "ch)");
+        }
+    }
+
     while (!stop_token.stop_requested()) {
         auto snap_ptr = publisher_->get_current();
         if (!snap_ptr) {
@@ -94,6 +155,7 @@ void PlaybackCollector::run(std::stop_token stop_token) {
                 util::Logger::debug("PlaybackCollector: No current track (queue empty or stopped)");
                 last_queue_empty_logged = true;
             }
+            util::PerfCounters::instance().playback_active.set(0);
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
             continue;
         }
@@ -152,7 +214,15 @@ void PlaybackCollector::run(std::stop_token stop_token) {
             continue;
         }
 
-        std::unique_ptr<audio::AudioDecoder> decoder = create_decoder_for_track(track);
+        // GAPLESS: A decoder pre-opened during the previous track's tail
+        // skips the open/header-parse latency entirely
+        std::unique_ptr<audio::AudioDecoder> decoder = take_prefetched(track.path);
+        const bool already_open = decoder != nullptr;
+        if (already_open) {
+            util::Logger::debug("PlaybackCollector: Using prefetched decoder for " + track.path);
+        } else {
+            decoder = acquire_decoder(track);
+        }
 
         if (!decoder) {
             publisher_->update([&](model::Snapshot& s) {
@@ -166,7 +236,7 @@ void PlaybackCollector::run(std::stop_token stop_token) {
             continue;
         }
 
-        if (!decoder->open(track.path)) {
+        if (!already_open && !decoder->open(track.path)) {
             publisher_->update([&](model::Snapshot& s) {
                 s.alerts.push_back({
                     "error",
@@ -174,6 +244,7 @@ void PlaybackCollector::run(std::stop_token stop_token) {
                     std::chrono::steady_clock::now()
                 });
             });
+            release_decoder(track.format, std::move(decoder));
             std::this_thread::sleep_for(std::chrono::seconds(1));
             continue;
         }
@@ -181,54 +252,169 @@ void PlaybackCollector::run(std::stop_token stop_token) {
         int actual_sample_rate = decoder->get_sample_rate();
         int actual_channels = decoder->get_channels();
 
-        // GAPLESS: Only reinit output if format changed
-        bool format_changed = (actual_sample_rate != output_sample_rate ||
+        // Pinned-rate mode: the device holds one rate and the decode
+        // loop resamples into it, so rate changes never touch the stream
+        const int pinned_rate = backend::Config::instance().pin_sample_rate;
+        const int device_rate = pinned_rate > 0 ? pinned_rate : actual_sample_rate;
+        resampler.configure(actual_sample_rate, device_rate, actual_channels);
+
+        // GAPLESS: Only touch the output if the device format changed
+        bool format_changed = (device_rate != output_sample_rate ||
                                actual_channels != output_channels);
 
         if (format_changed) {
-            if (output.is_initialized()) {
+            bool stream_ready = false;
+
+            // Dual-stream handover: adopt the stream pre-negotiated
+            // during the previous tail. After a natural track end the
+            // old tail drains first, so nothing gets chopped; a manual
+            // skip switches immediately.
+            if (standby_output) {
+                if (standby_output->get_sample_rate() == device_rate &&
+                    standby_output->get_channels() == actual_channels) {
+                    if (output->is_initialized()) {
+                        if (last_track_finished) {
+                            output->drain(std::chrono::milliseconds(400));
+                        }
+                        output->close();
+                    }
+                    output = std::move(standby_output);
+                    output->pause(false);
+                    stream_ready = true;
+                    util::Logger::info("PlaybackCollector: Adopted pre-negotiated stream (" +
+                        std::to_string(device_rate) + "Hz, " +
+                        std::to_string(actual_channels) + "ch)");
+                } else {
+                    // The queue changed since the guess; drop it
+                    standby_output.reset();
+                }
+            }
+
+            // Fast path: renegotiate the live stream in place (cork,
+            // update params, uncork). Teardown + rebuild only when the
+            // graph refuses the new format.
+            if (!stream_ready && output->is_initialized()) {
                 util::Logger::debug("PlaybackCollector: Format change detected (" +
                     std::to_string(output_sample_rate) + "Hz/" + std::to_string(output_channels) + "ch -> " +
-                    std::to_string(actual_sample_rate) + "Hz/" + std::to_string(actual_channels) + "ch), reinitializing");
-                output.close();
+                    std::to_string(device_rate) + "Hz/" + std::to_string(actual_channels) + "ch), reconfiguring");
+                if (last_track_finished) {
+                    output->drain(std::chrono::milliseconds(400));
+                }
+                stream_ready = output->reconfigure(device_rate, actual_channels);
+                if (!stream_ready) {
+                    util::Logger::warn("PlaybackCollector: In-place reconfigure failed, rebuilding stream");
+                    output->close();
+                }
             }
 
-            util::Logger::debug("PlaybackCollector: Initializing PipeWire (" +
-                std::to_string(actual_sample_rate) + "Hz, " +
-                std::to_string(actual_channels) + "ch)");
+            if (!stream_ready) {
+                util::Logger::debug("PlaybackCollector: Initializing PipeWire (" +
+                    std::to_string(device_rate) + "Hz, " +
+                    std::to_string(actual_channels) + "ch)");
 
-            if (!output.init(audio_context_, actual_sample_rate, actual_channels)) {
-                util::Logger::error("Failed to initialize PipeWire output");
-                decoder->close();
-                std::this_thread::sleep_for(std::chrono::seconds(1));
-                continue;
+                if (!output->init(audio_context_, device_rate, actual_channels)) {
+                    util::Logger::error("Failed to initialize PipeWire output");
+                    release_decoder(track.format, std::move(decoder));
+                    std::this_thread::sleep_for(std::chrono::seconds(1));
+                    continue;
+                }
             }
 
-            output_sample_rate = actual_sample_rate;
+            output_sample_rate = device_rate;
             output_channels = actual_channels;
-            util::Logger::debug("PlaybackCollector: PipeWire initialized successfully");
+            util::Logger::debug("PlaybackCollector: PipeWire ready");
         } else {
             util::Logger::debug("PlaybackCollector: Reusing PipeWire stream (gapless transition)");
+            output->pause(false);  // No-op mid-session; uncorks a pre-warmed stream
         }
 
-        // Initialize position anchor for this track
-        anchor_sample_rate_ = actual_sample_rate;
-        reset_position_anchor(0, output);
+        // Initialize position anchor for this track. A decoder handed
+        // over from a crossfade has already played its head into the
+        // previous track's tail, so start the clock where it stands.
+        // Consumed frames are counted at the device rate (they come out
+        // of the ring the resampler feeds)
+        anchor_sample_rate_ = device_rate;
+        int64_t initial_ms = 0;
+        if (already_open && actual_sample_rate > 0) {
+            initial_ms = decoder->get_position_frames() * 1000LL / actual_sample_rate;
+        }
+        reset_position_anchor(initial_ms, *output);
 
-        // Update snapshot with playing state
-        publisher_->update([&track_index](model::Snapshot& s) {
+        // Update snapshot with playing state and the position anchor the
+        // UI interpolates from (one publish per state change, not per tick)
+        publisher_->update([this, &track_index](model::Snapshot& s) {
             s.player.state = model::PlaybackState::Playing;
             s.player.current_track_index = track_index;
+            s.player.playback_position_ms = static_cast<int>(anchor_position_ms_);
+            s.player.position_anchor_steady_ms = anchor_steady_ms();
         });
 
         // Decode loop: push PCM into ring buffer
         constexpr int DECODE_CHUNK = 4096;
+        // Pre-open the next decoder this long before the track drains
+        constexpr int64_t PREFETCH_LEAD_MS = 5000;
         std::vector<float> buffer(DECODE_CHUNK * decoder->get_channels(), 0.0f);
-        auto& ring = output.ring_buffer();
+        auto& ring = output->ring_buffer();
+
+        // Resampled tracks stage through here; at the native rate the
+        // lambda degrades to a plain ring write
+        std::vector<float> resampled;
+        auto write_frames = [&](const float* data, int frames) {
+            if (!resampler.active()) {
+                ring.write(data, static_cast<size_t>(frames));
+                return;
+            }
+            resampled.clear();
+            size_t out_frames = resampler.process(
+                data, static_cast<size_t>(frames), resampled);
+            if (out_frames > 0) {
+                ring.write(resampled.data(), out_frames);
+            }
+        };
+        // Ring space one decoded chunk can need after conversion
+        const size_t chunk_out_frames = resampler.active()
+            ? resampler.max_output_frames(DECODE_CHUNK)
+            : static_cast<size_t>(DECODE_CHUNK);
+
+        // ReplayGain: fixed linear factor for the whole track, resolved
+        // from config mode and the loudness scanner's stored gains.
+        // Album gain is only populated once a track's whole directory is
+        // measured, so "album" falls back to track gain until then.
+        auto resolve_replaygain = [](const model::Track& t) {
+            const std::string& mode = backend::Config::instance().replaygain;
+            if (!t.loudness_scanned || mode == "off") return 1.0f;
+            float gain_db = t.track_gain_db;
+            if (mode == "album" && t.album_gain_db != 0.0f) {
+                gain_db = t.album_gain_db;
+            }
+            return std::pow(10.0f, gain_db / 20.0f);
+        };
+        float rg_linear = resolve_replaygain(track);
+
+        // CROSSFADE: while the incoming decoder is live we mix its head
+        // into the outgoing tail through fade_buffer. Only the overlap
+        // window pays for the staging copy; the steady-state path below
+        // stays zero-copy.
+        const long crossfade_frames = backend::Config::instance().crossfade_ms > 0
+            ? static_cast<long>(backend::Config::instance().crossfade_ms) *
+                  actual_sample_rate / 1000
+            : 0;
+        std::unique_ptr<audio::AudioDecoder> incoming_decoder;
+        std::string incoming_path;
+        model::AudioFormat incoming_format{};
+        std::vector<float> fade_buffer;
+        long fade_pos = 0;
+        long fade_total = 0;
+        float incoming_rg = 1.0f;
 
         bool track_finished = false;
         bool was_paused = false;
+        bool prefetch_started = false;
+        // Decode loop active: the scan governor starts respecting ring
+        // occupancy from here
+        util::PerfCounters::instance().playback_active.set(1);
         auto last_position_update = std::chrono::steady_clock::now();
+        auto last_anchor_publish = last_position_update;
 
         while (!stop_token.stop_requested()) {
             if (stop_token.stop_requested()) break;
@@ -236,21 +422,23 @@ void PlaybackCollector::run(std::stop_token stop_token) {
             // Check clear request
             if (clear_requested_.load(std::memory_order_acquire)) {
                 util::Logger::debug("PlaybackCollector: Clear detected - flushing and breaking");
-                output.pause(true);
-                output.flush_ring();
-                output.pause(false);
+                output->pause(true);
+                output->flush_ring();
+                output->pause(false);
                 break;
             }
 
             // Handle pause
             if (paused_) {
                 if (!was_paused) {
-                    output.pause(true);
-                    update_position_anchor(output);
+                    util::PerfCounters::instance().playback_active.set(0);
+                    output->pause(true);
+                    update_position_anchor(*output);
                     frozen_position_ms_ = get_interpolated_position_ms();
                     publisher_->update([this](model::Snapshot& s) {
                         s.player.state = model::PlaybackState::Paused;
                         s.player.playback_position_ms = static_cast<int>(frozen_position_ms_);
+                        s.player.position_anchor_steady_ms = 0;  // Frozen position is exact
                     });
                     was_paused = true;
                 }
@@ -258,10 +446,13 @@ void PlaybackCollector::run(std::stop_token stop_token) {
                 continue;
             } else if (was_paused) {
                 // Resuming from pause
-                reset_position_anchor(frozen_position_ms_, output);
-                output.pause(false);
-                publisher_->update([](model::Snapshot& s) {
+                util::PerfCounters::instance().playback_active.set(1);
+                reset_position_anchor(frozen_position_ms_, *output);
+                output->pause(false);
+                publisher_->update([this](model::Snapshot& s) {
                     s.player.state = model::PlaybackState::Playing;
+                    s.player.playback_position_ms = static_cast<int>(frozen_position_ms_);
+                    s.player.position_anchor_steady_ms = anchor_steady_ms();
                 });
                 was_paused = false;
             }
@@ -273,13 +464,15 @@ void PlaybackCollector::run(std::stop_token stop_token) {
                 if (current_snap_ptr->player.seek_request_ms >= 0) {
                     int64_t target = current_snap_ptr->player.seek_request_ms;
 
-                    output.pause(true);
-                    output.flush_ring();
+                    output->pause(true);
+                    output->flush_ring();
+                    resampler.reset();  // History is pre-seek audio
 
                     if (decoder->seek_to_ms(target)) {
-                        reset_position_anchor(target, output);
-                        publisher_->update([target](model::Snapshot& s) {
+                        reset_position_anchor(target, *output);
+                        publisher_->update([this, target](model::Snapshot& s) {
                             s.player.playback_position_ms = static_cast<int>(target);
+                            s.player.position_anchor_steady_ms = anchor_steady_ms();
                             s.player.seek_request_ms = -1;
                         });
                     } else {
@@ -288,12 +481,12 @@ void PlaybackCollector::run(std::stop_token stop_token) {
                         });
                     }
 
-                    output.pause(false);
+                    output->pause(false);
                 }
 
                 // Volume update
                 int current_volume = current_snap_ptr->player.volume_percent;
-                output.set_volume(current_volume);
+                output->set_volume(current_volume);
 
                 // Track change detection
                 if (!current_snap_ptr->queue->current.has_value() ||
@@ -304,20 +497,102 @@ void PlaybackCollector::run(std::stop_token stop_token) {
                 }
             }
 
+            // Start the crossfade once the outgoing tail enters the
+            // overlap window and the prefetched decoder is ready in a
+            // matching format (fade_total < 0 marks a failed attempt so
+            // we don't re-check every chunk)
+            if (crossfade_frames > 0 && !incoming_decoder && fade_total == 0 &&
+                prefetch_started && current_snap_ptr && decoder->get_total_frames() > 0) {
+                long remaining = decoder->get_total_frames() - decoder->get_position_frames();
+                if (remaining > 0 && remaining <= crossfade_frames) {
+                    const model::Track* next = peek_next_track(*current_snap_ptr);
+                    auto candidate = next ? take_prefetched(next->path) : nullptr;
+                    if (candidate &&
+                        candidate->get_sample_rate() == actual_sample_rate &&
+                        candidate->get_channels() == actual_channels) {
+                        incoming_decoder = std::move(candidate);
+                        incoming_path = next->path;
+                        incoming_format = next->format;
+                        incoming_rg = resolve_replaygain(*next);
+                        fade_total = remaining;
+                        fade_pos = 0;
+                        fade_buffer.assign(buffer.size(), 0.0f);
+                        util::Logger::debug("PlaybackCollector: Crossfade started (" +
+                            std::to_string(remaining) + " frame overlap)");
+                    } else {
+                        if (candidate) {
+                            // Format change at the boundary: no crossfade;
+                            // hand the decoder back for the gapless switch
+                            std::lock_guard<std::mutex> lock(prefetch_mutex_);
+                            prefetched_decoder_ = std::move(candidate);
+                            prefetched_path_ = next->path;
+                        }
+                        fade_total = -1;
+                    }
+                }
+            }
+
             // Decode into ring buffer
-            if (ring.write_available_frames() >= static_cast<size_t>(DECODE_CHUNK)) {
-                std::fill(buffer.begin(), buffer.end(), 0.0f);
-                int frames_read = decoder->read_pcm(buffer.data(), DECODE_CHUNK);
+            if (incoming_decoder &&
+                ring.write_available_frames() >= chunk_out_frames) {
+                // CROSSFADE: sum the outgoing tail and the incoming head
+                // through the staging buffers with equal-power ramps
+                int out_frames = decoder->read_pcm(buffer.data(), DECODE_CHUNK);
+                if (out_frames <= 0) {
+                    // Outgoing drained mid-fade: the incoming decoder,
+                    // already fade_pos frames in, becomes the prefetched
+                    // decoder the next loop iteration resumes from
+                    track_finished = true;
+                    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+                    prefetched_decoder_ = std::move(incoming_decoder);
+                    prefetched_path_ = incoming_path;
+                    break;
+                }
 
+                size_t total_samples =
+                    static_cast<size_t>(out_frames) * actual_channels;
+                std::fill(fade_buffer.begin(),
+                          fade_buffer.begin() + total_samples, 0.0f);
+                // A next track shorter than the overlap just mixes
+                // against silence for the remainder
+                incoming_decoder->read_pcm(fade_buffer.data(), out_frames);
+
+                for (size_t i = 0; i < total_samples; ++i) {
+                    buffer[i] *= rg_linear;
+                    fade_buffer[i] *= incoming_rg;
+                }
+                audio::crossfade_mix(
+                    buffer.data(), fade_buffer.data(), total_samples,
+                    static_cast<float>(fade_pos) / static_cast<float>(fade_total),
+                    1.0f / (static_cast<float>(fade_total) * actual_channels));
+                for (size_t i = 0; i < total_samples; ++i) {
+                    float val = buffer[i];
+                    if (!std::isfinite(val)) {
+                        buffer[i] = 0.0f;
+                    } else if (val > 1.0f) {
+                        buffer[i] = 1.0f;
+                    } else if (val < -1.0f) {
+                        buffer[i] = -1.0f;
+                    }
+                }
+                write_frames(buffer.data(), out_frames);
+                fade_pos += out_frames;
+            } else if (resampler.active() &&
+                       ring.write_available_frames() >= chunk_out_frames) {
+                // Pinned-rate path: decode at the source rate into the
+                // staging buffer, then resample into the ring. The
+                // zero-copy reservation below doesn't apply - the sinc
+                // pass needs distinct source and destination anyway.
+                int frames_read = decoder->read_pcm(buffer.data(), DECODE_CHUNK);
                 if (frames_read <= 0) {
                     track_finished = true;
                     break;
                 }
 
-                // Clamp NaN/Inf on producer side (keeps on_process RT-safe)
                 size_t total_samples = static_cast<size_t>(frames_read) * decoder->get_channels();
                 for (size_t i = 0; i < total_samples; ++i) {
-                    float val = buffer[i];
+                    float val = buffer[i] * rg_linear;
+                    buffer[i] = val;
                     if (!std::isfinite(val)) {
                         buffer[i] = 0.0f;
                     } else if (val > 1.0f) {
@@ -327,26 +602,128 @@ void PlaybackCollector::run(std::stop_token stop_token) {
                     }
                 }
 
-                ring.write(buffer.data(), frames_read);
+                // Spectrum taps the source-rate signal; the analyzer is
+                // told the true rate either way
+                audio::SpectrumAnalyzer::instance().feed(
+                    buffer.data(), static_cast<size_t>(frames_read),
+                    decoder->get_channels(), actual_sample_rate);
+
+                write_frames(buffer.data(), frames_read);
+            } else if (!resampler.active() &&
+                       ring.write_available_frames() >= static_cast<size_t>(DECODE_CHUNK)) {
+                // Zero-copy: decode straight into ring memory when one
+                // contiguous span covers the chunk; fall back to the
+                // staging buffer when the reservation wraps.
+                auto region = ring.reserve(DECODE_CHUNK);
+                const bool in_place =
+                    region.first_frames >= static_cast<size_t>(DECODE_CHUNK);
+                float* dst = in_place ? region.first : buffer.data();
+                if (!in_place) {
+                    std::fill(buffer.begin(), buffer.end(), 0.0f);
+                }
+                int frames_read = decoder->read_pcm(dst, DECODE_CHUNK);
+
+                if (frames_read <= 0) {
+                    track_finished = true;
+                    break;
+                }
+
+                // Apply ReplayGain, then clamp NaN/Inf on producer side
+                // (keeps on_process RT-safe; the clamp also catches
+                // positive-gain peaks pushed past full scale)
+                size_t total_samples = static_cast<size_t>(frames_read) * decoder->get_channels();
+                for (size_t i = 0; i < total_samples; ++i) {
+                    float val = dst[i] * rg_linear;
+                    dst[i] = val;
+                    if (!std::isfinite(val)) {
+                        dst[i] = 0.0f;
+                    } else if (val > 1.0f) {
+                        dst[i] = 1.0f;
+                    } else if (val < -1.0f) {
+                        dst[i] = -1.0f;
+                    }
+                }
+
+                // Spectrum tap: wait-free, drops under load, so the
+                // visualizer never back-pressures decode
+                audio::SpectrumAnalyzer::instance().feed(
+                    dst, static_cast<size_t>(frames_read),
+                    decoder->get_channels(), actual_sample_rate);
+
+                if (in_place) {
+                    ring.commit(static_cast<size_t>(frames_read));
+                } else {
+                    ring.write(buffer.data(), frames_read);
+                }
             } else {
-                // Ring buffer full - PipeWire will drain it
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                // Ring buffer full: block until the RT callback drains it
+                // below the low watermark (the timeout keeps pause/seek/
+                // track-change checks responsive)
+                output->wait_until_writable(std::chrono::milliseconds(10));
             }
 
             // Position update at ~30Hz (interpolated from consumed frames)
             auto now = std::chrono::steady_clock::now();
             auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_position_update).count();
             if (elapsed >= 33) {
-                update_position_anchor(output);
+                update_position_anchor(*output);
                 int64_t display_ms = get_interpolated_position_ms();
-                publisher_->update([display_ms](model::Snapshot& s) {
-                    s.player.playback_position_ms = static_cast<int>(display_ms);
-                });
+                // Sample ring occupancy here (30Hz, decode thread) so the
+                // RT on_process callback stays untouched
+                if (size_t cap = ring.capacity_frames(); cap > 0) {
+                    util::PerfCounters::instance().ring_fill_percent.set(
+                        static_cast<int64_t>(ring.read_available_frames() * 100 / cap));
+                }
+                // No per-tick publish: the UI extrapolates display
+                // position from the published anchor and the wall clock.
+                // Re-anchor at a low rate only to correct drift between
+                // the audio clock (consumed frames) and wall time.
+                if (std::chrono::duration_cast<std::chrono::seconds>(
+                        now - last_anchor_publish).count() >= 5) {
+                    publisher_->update_batched(backend::SnapshotPublisher::SectionPlayer,
+                                               [this](model::Snapshot& s) {
+                        s.player.playback_position_ms = static_cast<int>(anchor_position_ms_);
+                        s.player.position_anchor_steady_ms = anchor_steady_ms();
+                    });
+                    last_anchor_publish = now;
+                }
                 last_position_update = now;
+
+                // Near the end of the track: pre-open the next queue
+                // entry's decoder so the boundary switch is seamless
+                if (!prefetch_started && current_snap_ptr && track.duration_ms > 0 &&
+                    display_ms >= track.duration_ms - PREFETCH_LEAD_MS) {
+                    prefetch_started = true;
+                    if (const model::Track* next = peek_next_track(*current_snap_ptr)) {
+                        start_prefetch(*next);
+
+                        // Dual-stream handover: if the next track needs
+                        // a different device format (and no pinned rate
+                        // bridges it), negotiate a second corked stream
+                        // now, while this tail still plays. Metadata is
+                        // the guess; adoption re-checks the decoder's
+                        // actual format at the boundary.
+                        if (pinned_rate == 0 && !standby_output &&
+                            next->sample_rate > 0 && next->channels > 0 &&
+                            (next->sample_rate != output_sample_rate ||
+                             next->channels != output_channels)) {
+                            auto standby = std::make_unique<audio::PipeWireOutput>();
+                            if (standby->prewarm(audio_context_, next->sample_rate,
+                                                 next->channels)) {
+                                standby_output = std::move(standby);
+                                util::Logger::info(
+                                    "PlaybackCollector: Pre-negotiating standby stream (" +
+                                    std::to_string(next->sample_rate) + "Hz, " +
+                                    std::to_string(next->channels) + "ch)");
+                            }
+                        }
+                    }
+                }
             }
         }
 
         util::Logger::debug("PlaybackCollector: Loop finished.");
+        last_track_finished = track_finished;
 
         // Reset clear flag
         if (clear_requested_.load(std::memory_order_acquire)) {
@@ -360,6 +737,9 @@ void PlaybackCollector::run(std::stop_token stop_token) {
         // giving true gapless transitions (same format) without silence gaps.
         if (track_finished) {
             publisher_->update([&](model::Snapshot& s) {
+                // The next track's start publish re-anchors; until then the
+                // position is exact and must not be extrapolated
+                s.player.position_anchor_steady_ms = 0;
                 if (s.player.repeat_mode == model::RepeatMode::One) {
                     s.player.playback_position_ms = 0;
                 } else {
@@ -404,35 +784,135 @@ void PlaybackCollector::run(std::stop_token stop_token) {
             });
         }
 
-        decoder->close();
-        decoder.reset();
+        if (incoming_decoder) {
+            // Fade interrupted (manual skip, stop, clear): drop the head
+            release_decoder(incoming_format, std::move(incoming_decoder));
+        }
+
+        release_decoder(track.format, std::move(decoder));
         util::Logger::debug("PlaybackCollector: Decoder closed. Ready for next track (gapless).");
 
         // Handle clear request - close output to release audio device
         if (clear_requested_.load(std::memory_order_acquire)) {
-            output.close();
+            output->close();
             output_sample_rate = 0;
             output_channels = 0;
             util::Logger::debug("PlaybackCollector: Output closed due to clear request.");
         }
     }
 
+    util::PerfCounters::instance().playback_active.set(0);
+
     // Final cleanup
-    if (output.is_initialized()) {
-        output.close();
+    if (output->is_initialized()) {
+        output->close();
         util::Logger::debug("PlaybackCollector: Final output cleanup on shutdown.");
     }
 }
 
+const model::Track* PlaybackCollector::peek_next_track(const model::Snapshot& snap) const {
+    // Shuffle picks randomly at the boundary; there is no "next" to pre-open
+    if (snap.player.shuffle_enabled) return nullptr;
+
+    int next_index;
+    if (snap.player.repeat_mode == model::RepeatMode::One) {
+        if (!snap.queue->current.has_value()) return nullptr;
+        next_index = *snap.queue->current;  // Same track replays
+    } else if (!snap.queue->future.empty()) {
+        next_index = snap.queue->future.front();
+    } else {
+        return nullptr;  // End of queue (RepeatMode::All reshuffles history)
+    }
+
+    if (next_index < 0 || next_index >= util::narrow_cast<int>(snap.library->tracks.size())) {
+        return nullptr;
+    }
+    const auto& next = snap.library->tracks[next_index];
+    return next.is_valid ? &next : nullptr;
+}
+
+void PlaybackCollector::start_prefetch(const model::Track& next) {
+    // A previous prefetch is either consumed or stale; its thread has
+    // long finished by the time a new track approaches its tail
+    if (prefetch_thread_.joinable()) {
+        prefetch_thread_.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        if (prefetched_decoder_) {
+            prefetched_decoder_->close();
+            prefetched_decoder_.reset();
+        }
+        prefetched_path_.clear();
+    }
+
+    auto decoder = acquire_decoder(next);
+    if (!decoder) return;
+
+    util::Logger::debug("PlaybackCollector: Prefetching decoder for " + next.path);
+    prefetch_thread_ = std::thread(
+        [this, d = std::move(decoder), path = next.path, fmt = next.format]() mutable {
+            // open() does the blocking file-open and header parse; only a
+            // successful open is published
+            if (d->open(path)) {
+                std::lock_guard<std::mutex> lock(prefetch_mutex_);
+                prefetched_decoder_ = std::move(d);
+                prefetched_path_ = path;
+                prefetched_format_ = fmt;
+            }
+        });
+}
+
+std::unique_ptr<audio::AudioDecoder> PlaybackCollector::take_prefetched(const std::string& path) {
+    // The open may still be in flight; joining costs at most what the
+    // synchronous open would have
+    if (prefetch_thread_.joinable()) {
+        prefetch_thread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    if (prefetched_decoder_ && prefetched_path_ == path) {
+        prefetched_path_.clear();
+        return std::move(prefetched_decoder_);
+    }
+    // Wrong track queued up (manual skip, shuffle): back to the pool
+    if (prefetched_decoder_) {
+        release_decoder(prefetched_format_, std::move(prefetched_decoder_));
+        prefetched_path_.clear();
+    }
+    return nullptr;
+}
+
+std::unique_ptr<audio::AudioDecoder> PlaybackCollector::acquire_decoder(const model::Track& track) {
+    auto it = decoder_pool_.find(track.format);
+    if (it != decoder_pool_.end() && it->second) {
+        auto decoder = std::move(it->second);
+        decoder_pool_.erase(it);
+        return decoder;
+    }
+    return create_decoder_for_track(track);
+}
+
+void PlaybackCollector::release_decoder(model::AudioFormat format,
+                                        std::unique_ptr<audio::AudioDecoder> decoder) {
+    if (!decoder) return;
+    decoder->close();
+    decoder_pool_[format] = std::move(decoder);
+}
+
 std::unique_ptr<audio::AudioDecoder> PlaybackCollector::create_decoder_for_track(const model::Track& track) {
     switch (track.format) {
         case model::AudioFormat::MP3:
             return std::make_unique<audio::MP3Decoder>();
 
         case model::AudioFormat::FLAC:
-        case model::AudioFormat::WAV:
             return std::make_unique<audio::FLACDecoder>();
 
+        case model::AudioFormat::WAV:
+            // mmap direct-read for plain PCM; falls back to libsndfile
+            // internally for anything exotic
+            return std::make_unique<audio::WAVDecoder>();
+
         case model::AudioFormat::OGG:
             return std::make_unique<audio::OGGDecoder>();
 
@@ -13,6 +13,8 @@ void KeyMap::load_default_keybinds() {
     bindings_["q"] = "quit";
     bindings_["+"] = "volume_up";
     bindings_["-"] = "volume_down";
+    bindings_["]"] = "jump_next_letter";
+    bindings_["["] = "jump_prev_letter";
 }
 
 void KeyMap::add_binding(const std::string& action, const std::string& key_sequence) {
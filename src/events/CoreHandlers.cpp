@@ -0,0 +1,270 @@
+#include "events/CoreHandlers.hpp"
+
+#include "events/EventBus.hpp"
+#include "util/Logger.hpp"
+#include "util/Platform.hpp"
+
+#include <memory>
+#include <string>
+#include <sys/random.h>
+#include <utility>
+
+namespace ouroboros::events {
+
+void register_core_handlers(std::shared_ptr<backend::SnapshotPublisher> publisher,
+                            backend::QueueJournal& queue_journal) {
+    auto& event_bus = EventBus::instance();
+
+    // ========== QUEUE MANAGEMENT ==========
+    
+    // Add track to queue (Two Stacks: push to future)
+    event_bus.subscribe(ouroboros::events::Event::Type::AddTrackToQueue,
+        [publisher, &queue_journal](const ouroboros::events::Event& evt) {
+            std::string added_path;  // Set by the updater on a real add
+            publisher->update([evt, &added_path](ouroboros::model::Snapshot& snap) {
+                // Defensive: Check library exists
+                if (!snap.library) {
+                    ouroboros::util::Logger::error("AddTrackToQueue: Library is null!");
+                    return;
+                }
+
+                // Defensive: Bounds check
+                if (evt.index < 0 || evt.index >= ouroboros::util::narrow_cast<int>(snap.library->tracks.size())) {
+                    ouroboros::util::Logger::error("AddTrackToQueue: Index out of bounds! index=" +
+                        std::to_string(evt.index) + ", library size=" +
+                        std::to_string(snap.library->tracks.size()));
+                    return;
+                }
+
+                const auto& track = snap.library->tracks[evt.index];
+                added_path = track.path;
+
+                // Defensive: Check queue exists
+                if (!snap.queue) {
+                    ouroboros::util::Logger::error("AddTrackToQueue: Queue is null! Creating new queue.");
+                    snap.queue = std::make_shared<ouroboros::model::QueueState>();
+                }
+
+                // Copy-On-Write: Two Stacks model
+                auto new_queue = std::make_shared<ouroboros::model::QueueState>(*snap.queue);
+
+                // Add to future stack (next track at back)
+                new_queue->future.push_back(evt.index);
+
+                // If nothing playing, start playback immediately
+                if (!new_queue->current.has_value()) {
+                    new_queue->current = new_queue->future.back();
+                    new_queue->future.pop_back();
+                    snap.player.current_track_index = evt.index;
+                    ouroboros::util::Logger::debug("AddTrackToQueue: Started playback with track " +
+                        std::to_string(evt.index));
+                }
+
+                snap.queue = new_queue;
+                ouroboros::util::Logger::info("Added to queue: " + track.title +
+                    " [Queue: " + std::to_string(new_queue->history.size()) + " played, " +
+                    (new_queue->current.has_value() ? "1 current, " : "0 current, ") +
+                    std::to_string(new_queue->future.size()) + " upcoming]");
+            });
+            // Journal the add off the update path: O(1) enqueue, the
+            // journal's writer thread does the disk append
+            if (!added_path.empty()) {
+                queue_journal.record_add(std::move(added_path));
+            }
+        });
+    
+    // Next track (Two Stacks: push current to history, pop from future)
+    event_bus.subscribe(ouroboros::events::Event::Type::NextTrack,
+        [publisher](const ouroboros::events::Event&) {
+            publisher->update([](ouroboros::model::Snapshot& snap) {
+                auto new_queue = std::make_shared<ouroboros::model::QueueState>(*snap.queue);
+
+                // Push current to history
+                if (new_queue->current.has_value()) {
+                    new_queue->history.push_back(*new_queue->current);
+                }
+
+                if (!new_queue->future.empty()) {
+                    if (snap.player.shuffle_enabled) {
+                        // Shuffle: CSPRNG pick random from future
+                        uint64_t rand_val;
+                        getrandom(&rand_val, sizeof(rand_val), 0);
+                        size_t idx = rand_val % new_queue->future.size();
+                        new_queue->current = new_queue->future[idx];
+                        new_queue->future.erase(new_queue->future.begin() + idx);
+                        ouroboros::util::Logger::info("NextTrack (shuffle): Random pick, " +
+                            std::to_string(new_queue->future.size()) + " remaining in future");
+                    } else {
+                        // Linear: pop from FRONT of future (FIFO order)
+                        new_queue->current = new_queue->future.front();
+                        new_queue->future.erase(new_queue->future.begin());
+                        ouroboros::util::Logger::info("NextTrack: Advanced to next, " +
+                            std::to_string(new_queue->future.size()) + " remaining");
+                    }
+                } else if (snap.player.repeat_mode == ouroboros::model::RepeatMode::All) {
+                    // Repeat All: recycle history back to future (maintain add order)
+                    new_queue->future = new_queue->history;
+                    new_queue->history.clear();
+                    if (!new_queue->future.empty()) {
+                        if (snap.player.shuffle_enabled) {
+                            uint64_t rand_val;
+                            getrandom(&rand_val, sizeof(rand_val), 0);
+                            size_t idx = rand_val % new_queue->future.size();
+                            new_queue->current = new_queue->future[idx];
+                            new_queue->future.erase(new_queue->future.begin() + idx);
+                        } else {
+                            new_queue->current = new_queue->future.front();
+                            new_queue->future.erase(new_queue->future.begin());
+                        }
+                        ouroboros::util::Logger::info("NextTrack: Repeat All - recycled " +
+                            std::to_string(new_queue->future.size() + 1) + " tracks");
+                    }
+                } else {
+                    // No more tracks, stop
+                    new_queue->current = std::nullopt;
+                    snap.player.state = ouroboros::model::PlaybackState::Stopped;
+                    ouroboros::util::Logger::info("NextTrack: End of queue, stopped");
+                }
+
+                snap.queue = new_queue;
+            });
+        });
+    
+    // Previous track (Two Stacks: ALWAYS deterministic - pop from history)
+    event_bus.subscribe(ouroboros::events::Event::Type::PrevTrack,
+        [publisher](const ouroboros::events::Event&) {
+            ouroboros::util::Logger::info("PrevTrack: Event received");
+            publisher->update([](ouroboros::model::Snapshot& snap) {
+                auto new_queue = std::make_shared<ouroboros::model::QueueState>(*snap.queue);
+
+                ouroboros::util::Logger::info("PrevTrack: history=" +
+                    std::to_string(new_queue->history.size()) + ", current=" +
+                    (new_queue->current.has_value() ? std::to_string(*new_queue->current) : "none") +
+                    ", future=" + std::to_string(new_queue->future.size()));
+
+                // Push current to FRONT of future (so it becomes "next" if we go forward again)
+                if (new_queue->current.has_value()) {
+                    new_queue->future.insert(new_queue->future.begin(), *new_queue->current);
+                }
+
+                if (!new_queue->history.empty()) {
+                    // Pop from history - ALWAYS deterministic, even in shuffle
+                    new_queue->current = new_queue->history.back();
+                    new_queue->history.pop_back();
+                    ouroboros::util::Logger::info("PrevTrack: Back to previous track " +
+                        std::to_string(*new_queue->current) + ", " +
+                        std::to_string(new_queue->history.size()) + " remaining in history");
+                } else {
+                    // At beginning - restore current from future
+                    if (!new_queue->future.empty()) {
+                        new_queue->current = new_queue->future.front();
+                        new_queue->future.erase(new_queue->future.begin());
+                    }
+                    ouroboros::util::Logger::warn("PrevTrack: At beginning of history");
+                }
+
+                snap.queue = new_queue;
+            });
+        });
+
+    // Clear queue (Two Stacks: reset all stacks)
+    event_bus.subscribe(ouroboros::events::Event::Type::ClearQueue,
+        [publisher, &queue_journal](const ouroboros::events::Event&) {
+            publisher->update([](ouroboros::model::Snapshot& snap) {
+                auto new_queue = std::make_shared<ouroboros::model::QueueState>();
+                // All vectors default empty, current defaults to nullopt
+                snap.queue = new_queue;
+                snap.player.state = ouroboros::model::PlaybackState::Stopped;
+                snap.player.current_track_index = std::nullopt;
+                ouroboros::util::Logger::info("ClearQueue: Queue cleared, playback stopped");
+            });
+            queue_journal.record_clear();
+        });
+    
+    // ========== PLAYBACK CONTROLS ==========
+    
+    // PlayPause is handled by PlaybackCollector
+    
+    // Seek forward
+    event_bus.subscribe(ouroboros::events::Event::Type::SeekForward,
+        [publisher](const ouroboros::events::Event& evt) {
+            publisher->update([evt](ouroboros::model::Snapshot& snap) {
+                if (!snap.player.current_track_index.has_value()) return;
+
+                // Resolve track via Library
+                int track_idx = snap.player.current_track_index.value();
+                if (track_idx < 0 || track_idx >= ouroboros::util::narrow_cast<int>(snap.library->tracks.size())) return;
+                const auto& track = snap.library->tracks[track_idx];
+
+                int current_pos = snap.player.playback_position_ms;
+                int target = current_pos + (evt.seek_seconds * 1000);
+                int duration = track.duration_ms;
+
+                if (duration > 0 && target >= duration) {
+                    // Skip to next track
+                    // Note: We can't easily emit an event from inside update()
+                    // So we just simulate next track logic here or rely on playback collector
+                    // For now, just clamp
+                    snap.player.seek_request_ms = duration; 
+                } else {
+                    snap.player.seek_request_ms = target;
+                }
+            });
+        });
+    
+    // Seek backward
+    event_bus.subscribe(ouroboros::events::Event::Type::SeekBackward,
+        [publisher](const ouroboros::events::Event& evt) {
+            publisher->update([evt](ouroboros::model::Snapshot& snap) {
+                int current_pos = snap.player.playback_position_ms;
+                snap.player.seek_request_ms = std::max(0, current_pos - (evt.seek_seconds * 1000));
+            });
+        });
+    
+    // Volume up
+    event_bus.subscribe(ouroboros::events::Event::Type::VolumeUp,
+        [publisher](const ouroboros::events::Event& evt) {
+            publisher->update([evt](ouroboros::model::Snapshot& snap) {
+                snap.player.volume_percent = std::min(100, snap.player.volume_percent + evt.volume_delta);
+            });
+        });
+    
+    // Volume down
+    event_bus.subscribe(ouroboros::events::Event::Type::VolumeDown,
+        [publisher](const ouroboros::events::Event& evt) {
+            publisher->update([evt](ouroboros::model::Snapshot& snap) {
+                snap.player.volume_percent = std::max(0, snap.player.volume_percent - evt.volume_delta);
+            });
+        });
+        
+    // Repeat Toggle
+    event_bus.subscribe(ouroboros::events::Event::Type::RepeatToggle,
+        [publisher](const ouroboros::events::Event&) {
+             publisher->update([](ouroboros::model::Snapshot& snap) {
+                switch (snap.player.repeat_mode) {
+                    case ouroboros::model::RepeatMode::Off:
+                        snap.player.repeat_mode = ouroboros::model::RepeatMode::One;
+                        break;
+                    case ouroboros::model::RepeatMode::One:
+                        snap.player.repeat_mode = ouroboros::model::RepeatMode::All;
+                        break;
+                    case ouroboros::model::RepeatMode::All:
+                        snap.player.repeat_mode = ouroboros::model::RepeatMode::Off;
+                        break;
+                    default: std::unreachable();
+                }
+             });
+        });
+
+    // Shuffle Toggle (Two Stacks: history IS the play order, no reset needed)
+    event_bus.subscribe(ouroboros::events::Event::Type::ShuffleToggle,
+        [publisher](const ouroboros::events::Event&) {
+            publisher->update([](ouroboros::model::Snapshot& snap) {
+                snap.player.shuffle_enabled = !snap.player.shuffle_enabled;
+                ouroboros::util::Logger::info("Shuffle: " +
+                    std::string(snap.player.shuffle_enabled ? "ON" : "OFF"));
+            });
+        });
+}
+
+}  // namespace ouroboros::events
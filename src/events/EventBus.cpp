@@ -1,48 +1,126 @@
 #include "events/EventBus.hpp"
 #include "util/Logger.hpp"
 #include <algorithm>
+#include <utility>
 
 namespace ouroboros::events {
 
+EventBus::EventBus() {
+    subscribers_.store(std::make_shared<const SubscriberTable>(),
+                       std::memory_order_relaxed);
+    for (size_t i = 0; i < kQueueCapacity; ++i) {
+        slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+}
+
 EventBus::SubscriptionId EventBus::subscribe(Event::Type type, Handler handler) {
     ouroboros::util::Logger::debug("EventBus: Subscribing to event type");
 
+    // Clone-mutate-swap: in-flight dispatches keep iterating the old
+    // table; the next dispatch picks this one up
     std::lock_guard<std::mutex> lock(mutex_);
     SubscriptionId id = next_id_++;
-    subscribers_[type].push_back({id, std::move(handler)});
+    auto table = std::make_shared<SubscriberTable>(
+        *subscribers_.load(std::memory_order_relaxed));
+    (*table)[type].push_back({id, std::move(handler)});
+    id_types_.emplace(id, type);
+    subscribers_.store(std::move(table), std::memory_order_release);
     return id;
 }
 
 void EventBus::unsubscribe(SubscriptionId id) {
     ouroboros::util::Logger::debug("EventBus: Unsubscribing id " + std::to_string(id));
 
+    // The dispatch snapshot may still run this handler once more after
+    // we return - same re-entrancy contract the handler copy gave
     std::lock_guard<std::mutex> lock(mutex_);
-    for (auto& [type, subs] : subscribers_) {
+    auto idx = id_types_.find(id);
+    if (idx == id_types_.end()) return;  // Unknown or already removed
+
+    // The reverse index pins the one vector holding the id, so only
+    // that type's list is touched (plus the clone the RCU swap needs)
+    auto table = std::make_shared<SubscriberTable>(
+        *subscribers_.load(std::memory_order_relaxed));
+    auto entry = table->find(idx->second);
+    if (entry != table->end()) {
+        auto& subs = entry->second;
         auto it = std::remove_if(subs.begin(), subs.end(),
             [id](const Subscription& s) { return s.id == id; });
         subs.erase(it, subs.end());
+        if (subs.empty()) table->erase(entry);
     }
+    id_types_.erase(idx);
+    subscribers_.store(std::move(table), std::memory_order_release);
 }
 
-void EventBus::publish(const Event& event) {
-    ouroboros::util::Logger::debug("EventBus: Publishing event");
-
-    // Copy handlers to avoid holding lock during execution
-    std::vector<Handler> handlers;
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = subscribers_.find(event.type);
-        if (it != subscribers_.end()) {
-            for (const auto& sub : it->second) {
-                handlers.push_back(sub.handler);
+void EventBus::publish(Event&& event) {
+    // LOGGING DISABLED: hot path; fired from render + collector threads
+    // ouroboros::util::Logger::debug("EventBus: Publishing event");
+
+    // Vyukov bounded-queue enqueue: claim a slot whose sequence equals the
+    // position we are about to take. slot.seq == pos means "free",
+    // slot.seq < pos means the ring is full (consumer hasn't caught up).
+    uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = slots_[pos & (kQueueCapacity - 1)];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                   std::memory_order_relaxed)) {
+                slot.event = std::move(event);
+                // Publish the slot: consumer waits for seq == pos + 1
+                slot.seq.store(pos + 1, std::memory_order_release);
+                return;
             }
+            // CAS failed: pos was reloaded, retry with the new position.
+        } else if (diff < 0) {
+            // Ring full. Never block a producer - drop and count.
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            // Another producer advanced past us; reload and retry.
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
         }
     }
+}
+
+size_t EventBus::drain() {
+    size_t dispatched = 0;
+    uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Slot& slot = slots_[pos & (kQueueCapacity - 1)];
+        uint64_t seq = slot.seq.load(std::memory_order_acquire);
+
+        // seq == pos + 1 means the producer finished writing this slot.
+        if (seq != pos + 1) break;
+
+        Event event = std::move(slot.event);
+        // Recycle the slot for the producer one full lap ahead.
+        slot.seq.store(pos + kQueueCapacity, std::memory_order_release);
+        pos++;
+        dequeue_pos_.store(pos, std::memory_order_relaxed);
+
+        dispatch(event);
+        dispatched++;
+    }
+
+    return dispatched;
+}
+
+void EventBus::dispatch(const Event& event) {
+    // Snapshot load: no lock, no per-event handler copies. The snapshot
+    // is immutable, so a handler subscribing or unsubscribing mid-
+    // dispatch swaps in a new table without disturbing this iteration.
+    auto table = subscribers_.load(std::memory_order_acquire);
+    auto it = table->find(event.type);
+    if (it == table->end()) return;
 
-    // Execute handlers outside the lock
-    for (const auto& handler : handlers) {
-        handler(event);
+    for (const auto& sub : it->second) {
+        sub.handler(event);
     }
 }
 
-}  // namespace ouroboros::events
\ No newline at end of file
+}  // namespace ouroboros::events
@@ -6,22 +6,43 @@ namespace ouroboros::events {
 void Scheduler::schedule(const std::string& name, std::chrono::milliseconds interval, Task task) {
     ouroboros::util::Logger::debug("Scheduler: Scheduling task");
 
-    tasks_[name] = {task, interval, std::chrono::steady_clock::now()};
+    // Re-scheduling an existing name bumps the generation, which lazily
+    // invalidates any entry already sitting in the heap.
+    uint64_t gen = next_generation_++;
+    tasks_[name] = {std::move(task), interval, gen};
+    due_heap_.push({Clock::now() + interval, name, gen});
 }
 
 void Scheduler::unschedule(const std::string& name) {
     ouroboros::util::Logger::debug("Scheduler: Unscheduling task");
 
+    // Lazy deletion: the heap entry is discarded when it surfaces.
     tasks_.erase(name);
 }
 
 void Scheduler::process() {
-    auto now = std::chrono::steady_clock::now();
-    for (auto& [name, task] : tasks_) {
-        if (now - task.last_run >= task.interval) {
-            task.task();
-            task.last_run = now;
+    if (due_heap_.empty()) return;
+
+    // One now() for the whole batch: every task due this iteration runs
+    // against the same reading and is re-armed relative to it, so tasks
+    // with equal intervals stay coalesced in future iterations too.
+    const auto now = Clock::now();
+
+    while (!due_heap_.empty() && due_heap_.top().due <= now) {
+        HeapEntry entry = due_heap_.top();
+        due_heap_.pop();
+
+        auto it = tasks_.find(entry.name);
+        if (it == tasks_.end() || it->second.generation != entry.generation) {
+            continue;  // Unscheduled or re-scheduled; stale entry
         }
+
+        it->second.task();
+
+        // Re-arm. A task that took longer than its interval fires again
+        // next iteration rather than replaying missed ticks.
+        entry.due = now + it->second.interval;
+        due_heap_.push(std::move(entry));
     }
 }
 
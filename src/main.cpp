@@ -3,6 +3,11 @@
 #include "backend/Library.hpp"
 #include "backend/Config.hpp"
 #include "backend/ArtworkCache.hpp"
+#include "backend/QueueJournal.hpp"
+#include "backend/Daemon.hpp"
+#include "backend/SnapshotMirror.hpp"
+#include "backend/ThumbnailStore.hpp"
+#include "audio/SpectrumAnalyzer.hpp"
 #include "collectors/LibraryCollector.hpp"
 #include "collectors/PlaybackCollector.hpp"
 #include "ui/Terminal.hpp"
@@ -10,8 +15,13 @@
 #include "ui/ArtworkWindow.hpp"
 #include "ui/ImageRenderer.hpp"
 #include "events/EventBus.hpp"
+#include "events/CoreHandlers.hpp"
+#include "backend/MetadataCache.hpp"
 #include "util/Logger.hpp"
+#include "util/MemoryBudget.hpp"
+#include "util/PerfCounters.hpp"
 #include "util/Platform.hpp"
+#include "util/StartupProfiler.hpp"
 #include <iostream>
 #include <memory>
 #include <thread>
@@ -25,6 +35,8 @@
 #include <filesystem>
 #include <sys/random.h>
 #include <optional>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -56,10 +68,28 @@ static void signal_handler(int) {
 }
 
 
-int main() {
+int main(int argc, char* argv[]) {
     // Set locale for proper Unicode handling (required for wcwidth)
     std::setlocale(LC_ALL, "");
 
+    // Startup tracing: --profile-startup arms the span timers around the
+    // startup phases and writes a chrome://tracing JSON on exit. Enabled
+    // before any phase so the trace epoch covers everything.
+    bool daemon_mode = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]) == "--profile-startup") {
+            ouroboros::util::StartupProfiler::instance().enable();
+        } else if (std::string_view(argv[i]) == "--daemon") {
+            daemon_mode = true;
+        }
+    }
+
+    // Headless mode: collectors + snapshot core + control socket only,
+    // none of the terminal/renderer/artwork machinery below
+    if (daemon_mode) {
+        return ouroboros::backend::run_daemon();
+    }
+
     try {
         // CRITICAL: Redirect stderr to log file to capture libmpg123 warnings
         // libmpg123 writes directly to stderr, bypassing our logger
@@ -85,22 +115,50 @@ int main() {
             ouroboros::util::Logger::info("Created cache directory: " + cache_dir.string());
         }
 
-        // Load cache if it exists
+        // PARALLELIZED STARTUP: the artwork/thumbnail cache loads are
+        // pure disk I/O and both singletons lock internally, so they run
+        // on a background thread while the terminal handshake below
+        // waits on its escape-query replies. The library cache load and
+        // PipeWire connect already overlap on the collector threads;
+        // time-to-first-frame is the max of the phases, not the sum.
         auto& artwork_cache = ouroboros::backend::ArtworkCache::instance();
-        if (fs::exists(cache_file)) {
-            if (artwork_cache.load(cache_file)) {
-                ouroboros::util::Logger::info("Loaded artwork cache: " + std::to_string(artwork_cache.size()) +
-                    " entries, " + std::to_string(artwork_cache.memory_usage() / 1024) + " KB");
+        fs::path thumbs_file = cache_dir / "thumbs.cache";
+        auto& thumbnail_store = ouroboros::backend::ThumbnailStore::instance();
+        std::jthread cache_loader([&artwork_cache, &thumbnail_store, cache_file, thumbs_file] {
+            ouroboros::util::StartupSpan span("artwork_cache_load");
+            if (fs::exists(cache_file)) {
+                if (artwork_cache.load(cache_file)) {
+                    ouroboros::util::Logger::info("Loaded artwork cache: " + std::to_string(artwork_cache.size()) +
+                        " entries, " + std::to_string(artwork_cache.memory_usage() / 1024) + " KB");
+                } else {
+                    ouroboros::util::Logger::warn("Failed to load artwork cache from: " + cache_file.string());
+                }
             } else {
-                ouroboros::util::Logger::warn("Failed to load artwork cache from: " + cache_file.string());
+                ouroboros::util::Logger::info("No existing artwork cache found, starting fresh");
             }
-        } else {
-            ouroboros::util::Logger::info("No existing artwork cache found, starting fresh");
-        }
+
+            // Pre-scaled thumbnail tiers live next to the artwork cache
+            if (fs::exists(thumbs_file)) {
+                if (thumbnail_store.load(thumbs_file)) {
+                    ouroboros::util::Logger::info("Loaded thumbnail store: " + std::to_string(thumbnail_store.size()) +
+                        " entries, " + std::to_string(thumbnail_store.memory_usage() / 1024) + " KB");
+                } else {
+                    ouroboros::util::Logger::warn("Failed to load thumbnail store from: " + thumbs_file.string());
+                }
+            }
+        });
+
+        // Queue persistence: replay the append-only journal now (tiny
+        // file); the queue itself is rebuilt once the library publishes
+        auto& queue_journal = ouroboros::backend::QueueJournal::instance();
+        queue_journal.open(cache_dir / "queue.journal");
 
         // Initialize terminal
         auto& terminal = ouroboros::ui::Terminal::instance();
-        terminal.init();
+        {
+            ouroboros::util::StartupSpan span("terminal_init");
+            terminal.init();
+        }
 
         // Register atexit handler as safety net (montauk pattern)
         std::atexit(on_atexit_restore);
@@ -143,7 +201,14 @@ int main() {
                 if (g_shutdown.load()) break;
             }
         });
-        std::jthread pb_thread([&pb_collector](std::stop_token st) {
+        std::jthread pb_thread([&pb_collector, &config](std::stop_token st) {
+            // This thread feeds the audio ring; scheduling class keeps
+            // scan/artwork bulk work from preempting it
+            ouroboros::util::Platform::set_current_thread_role(
+                ouroboros::util::Platform::ThreadRole::AudioDecode);
+            if (config.audio_cpu_affinity >= 0) {
+                ouroboros::util::Platform::pin_current_thread_to_cpu(config.audio_cpu_affinity);
+            }
             while (!st.stop_requested() && !g_shutdown.load()) {
                 pb_collector.run(st);
                 if (g_shutdown.load()) break;
@@ -160,249 +225,9 @@ int main() {
 
         // Setup EventBus handlers
         auto& event_bus = ouroboros::events::EventBus::instance();
-        
-        // ========== QUEUE MANAGEMENT ==========
-        
-        // Add track to queue (Two Stacks: push to future)
-        event_bus.subscribe(ouroboros::events::Event::Type::AddTrackToQueue,
-            [publisher](const ouroboros::events::Event& evt) {
-                publisher->update([evt](ouroboros::model::Snapshot& snap) {
-                    // Defensive: Check library exists
-                    if (!snap.library) {
-                        ouroboros::util::Logger::error("AddTrackToQueue: Library is null!");
-                        return;
-                    }
-
-                    // Defensive: Bounds check
-                    if (evt.index < 0 || evt.index >= ouroboros::util::narrow_cast<int>(snap.library->tracks.size())) {
-                        ouroboros::util::Logger::error("AddTrackToQueue: Index out of bounds! index=" +
-                            std::to_string(evt.index) + ", library size=" +
-                            std::to_string(snap.library->tracks.size()));
-                        return;
-                    }
 
-                    const auto& track = snap.library->tracks[evt.index];
-
-                    // Defensive: Check queue exists
-                    if (!snap.queue) {
-                        ouroboros::util::Logger::error("AddTrackToQueue: Queue is null! Creating new queue.");
-                        snap.queue = std::make_shared<ouroboros::model::QueueState>();
-                    }
-
-                    // Copy-On-Write: Two Stacks model
-                    auto new_queue = std::make_shared<ouroboros::model::QueueState>(*snap.queue);
-
-                    // Add to future stack (next track at back)
-                    new_queue->future.push_back(evt.index);
-
-                    // If nothing playing, start playback immediately
-                    if (!new_queue->current.has_value()) {
-                        new_queue->current = new_queue->future.back();
-                        new_queue->future.pop_back();
-                        snap.player.current_track_index = evt.index;
-                        ouroboros::util::Logger::debug("AddTrackToQueue: Started playback with track " +
-                            std::to_string(evt.index));
-                    }
-
-                    snap.queue = new_queue;
-                    ouroboros::util::Logger::info("Added to queue: " + track.title +
-                        " [Queue: " + std::to_string(new_queue->history.size()) + " played, " +
-                        (new_queue->current.has_value() ? "1 current, " : "0 current, ") +
-                        std::to_string(new_queue->future.size()) + " upcoming]");
-                });
-            });
-        
-        // Next track (Two Stacks: push current to history, pop from future)
-        event_bus.subscribe(ouroboros::events::Event::Type::NextTrack,
-            [publisher](const ouroboros::events::Event&) {
-                publisher->update([](ouroboros::model::Snapshot& snap) {
-                    auto new_queue = std::make_shared<ouroboros::model::QueueState>(*snap.queue);
-
-                    // Push current to history
-                    if (new_queue->current.has_value()) {
-                        new_queue->history.push_back(*new_queue->current);
-                    }
-
-                    if (!new_queue->future.empty()) {
-                        if (snap.player.shuffle_enabled) {
-                            // Shuffle: CSPRNG pick random from future
-                            uint64_t rand_val;
-                            getrandom(&rand_val, sizeof(rand_val), 0);
-                            size_t idx = rand_val % new_queue->future.size();
-                            new_queue->current = new_queue->future[idx];
-                            new_queue->future.erase(new_queue->future.begin() + idx);
-                            ouroboros::util::Logger::info("NextTrack (shuffle): Random pick, " +
-                                std::to_string(new_queue->future.size()) + " remaining in future");
-                        } else {
-                            // Linear: pop from FRONT of future (FIFO order)
-                            new_queue->current = new_queue->future.front();
-                            new_queue->future.erase(new_queue->future.begin());
-                            ouroboros::util::Logger::info("NextTrack: Advanced to next, " +
-                                std::to_string(new_queue->future.size()) + " remaining");
-                        }
-                    } else if (snap.player.repeat_mode == ouroboros::model::RepeatMode::All) {
-                        // Repeat All: recycle history back to future (maintain add order)
-                        new_queue->future = new_queue->history;
-                        new_queue->history.clear();
-                        if (!new_queue->future.empty()) {
-                            if (snap.player.shuffle_enabled) {
-                                uint64_t rand_val;
-                                getrandom(&rand_val, sizeof(rand_val), 0);
-                                size_t idx = rand_val % new_queue->future.size();
-                                new_queue->current = new_queue->future[idx];
-                                new_queue->future.erase(new_queue->future.begin() + idx);
-                            } else {
-                                new_queue->current = new_queue->future.front();
-                                new_queue->future.erase(new_queue->future.begin());
-                            }
-                            ouroboros::util::Logger::info("NextTrack: Repeat All - recycled " +
-                                std::to_string(new_queue->future.size() + 1) + " tracks");
-                        }
-                    } else {
-                        // No more tracks, stop
-                        new_queue->current = std::nullopt;
-                        snap.player.state = ouroboros::model::PlaybackState::Stopped;
-                        ouroboros::util::Logger::info("NextTrack: End of queue, stopped");
-                    }
-
-                    snap.queue = new_queue;
-                });
-            });
-        
-        // Previous track (Two Stacks: ALWAYS deterministic - pop from history)
-        event_bus.subscribe(ouroboros::events::Event::Type::PrevTrack,
-            [publisher](const ouroboros::events::Event&) {
-                ouroboros::util::Logger::info("PrevTrack: Event received");
-                publisher->update([](ouroboros::model::Snapshot& snap) {
-                    auto new_queue = std::make_shared<ouroboros::model::QueueState>(*snap.queue);
-
-                    ouroboros::util::Logger::info("PrevTrack: history=" +
-                        std::to_string(new_queue->history.size()) + ", current=" +
-                        (new_queue->current.has_value() ? std::to_string(*new_queue->current) : "none") +
-                        ", future=" + std::to_string(new_queue->future.size()));
-
-                    // Push current to FRONT of future (so it becomes "next" if we go forward again)
-                    if (new_queue->current.has_value()) {
-                        new_queue->future.insert(new_queue->future.begin(), *new_queue->current);
-                    }
-
-                    if (!new_queue->history.empty()) {
-                        // Pop from history - ALWAYS deterministic, even in shuffle
-                        new_queue->current = new_queue->history.back();
-                        new_queue->history.pop_back();
-                        ouroboros::util::Logger::info("PrevTrack: Back to previous track " +
-                            std::to_string(*new_queue->current) + ", " +
-                            std::to_string(new_queue->history.size()) + " remaining in history");
-                    } else {
-                        // At beginning - restore current from future
-                        if (!new_queue->future.empty()) {
-                            new_queue->current = new_queue->future.front();
-                            new_queue->future.erase(new_queue->future.begin());
-                        }
-                        ouroboros::util::Logger::warn("PrevTrack: At beginning of history");
-                    }
-
-                    snap.queue = new_queue;
-                });
-            });
-
-        // Clear queue (Two Stacks: reset all stacks)
-        event_bus.subscribe(ouroboros::events::Event::Type::ClearQueue,
-            [publisher](const ouroboros::events::Event&) {
-                publisher->update([](ouroboros::model::Snapshot& snap) {
-                    auto new_queue = std::make_shared<ouroboros::model::QueueState>();
-                    // All vectors default empty, current defaults to nullopt
-                    snap.queue = new_queue;
-                    snap.player.state = ouroboros::model::PlaybackState::Stopped;
-                    snap.player.current_track_index = std::nullopt;
-                    ouroboros::util::Logger::info("ClearQueue: Queue cleared, playback stopped");
-                });
-            });
-        
-        // ========== PLAYBACK CONTROLS ==========
-        
-        // PlayPause is handled by PlaybackCollector
-        
-        // Seek forward
-        event_bus.subscribe(ouroboros::events::Event::Type::SeekForward,
-            [publisher](const ouroboros::events::Event& evt) {
-                publisher->update([evt](ouroboros::model::Snapshot& snap) {
-                    if (!snap.player.current_track_index.has_value()) return;
-
-                    // Resolve track via Library
-                    int track_idx = snap.player.current_track_index.value();
-                    if (track_idx < 0 || track_idx >= ouroboros::util::narrow_cast<int>(snap.library->tracks.size())) return;
-                    const auto& track = snap.library->tracks[track_idx];
-
-                    int current_pos = snap.player.playback_position_ms;
-                    int target = current_pos + (evt.seek_seconds * 1000);
-                    int duration = track.duration_ms;
-
-                    if (duration > 0 && target >= duration) {
-                        // Skip to next track
-                        // Note: We can't easily emit an event from inside update()
-                        // So we just simulate next track logic here or rely on playback collector
-                        // For now, just clamp
-                        snap.player.seek_request_ms = duration; 
-                    } else {
-                        snap.player.seek_request_ms = target;
-                    }
-                });
-            });
-        
-        // Seek backward
-        event_bus.subscribe(ouroboros::events::Event::Type::SeekBackward,
-            [publisher](const ouroboros::events::Event& evt) {
-                publisher->update([evt](ouroboros::model::Snapshot& snap) {
-                    int current_pos = snap.player.playback_position_ms;
-                    snap.player.seek_request_ms = std::max(0, current_pos - (evt.seek_seconds * 1000));
-                });
-            });
-        
-        // Volume up
-        event_bus.subscribe(ouroboros::events::Event::Type::VolumeUp,
-            [publisher](const ouroboros::events::Event& evt) {
-                publisher->update([evt](ouroboros::model::Snapshot& snap) {
-                    snap.player.volume_percent = std::min(100, snap.player.volume_percent + evt.volume_delta);
-                });
-            });
-        
-        // Volume down
-        event_bus.subscribe(ouroboros::events::Event::Type::VolumeDown,
-            [publisher](const ouroboros::events::Event& evt) {
-                publisher->update([evt](ouroboros::model::Snapshot& snap) {
-                    snap.player.volume_percent = std::max(0, snap.player.volume_percent - evt.volume_delta);
-                });
-            });
-            
-        // Repeat Toggle
-        event_bus.subscribe(ouroboros::events::Event::Type::RepeatToggle,
-            [publisher](const ouroboros::events::Event&) {
-                 publisher->update([](ouroboros::model::Snapshot& snap) {
-                    switch (snap.player.repeat_mode) {
-                        case ouroboros::model::RepeatMode::Off:
-                            snap.player.repeat_mode = ouroboros::model::RepeatMode::One;
-                            break;
-                        case ouroboros::model::RepeatMode::One:
-                            snap.player.repeat_mode = ouroboros::model::RepeatMode::All;
-                            break;
-                        case ouroboros::model::RepeatMode::All:
-                            snap.player.repeat_mode = ouroboros::model::RepeatMode::Off;
-                            break;
-                        default: std::unreachable();
-                    }
-                 });
-            });
-
-        // Shuffle Toggle (Two Stacks: history IS the play order, no reset needed)
-        event_bus.subscribe(ouroboros::events::Event::Type::ShuffleToggle,
-            [publisher](const ouroboros::events::Event&) {
-                publisher->update([](ouroboros::model::Snapshot& snap) {
-                    snap.player.shuffle_enabled = !snap.player.shuffle_enabled;
-                    ouroboros::util::Logger::info("Shuffle: " +
-                        std::string(snap.player.shuffle_enabled ? "ON" : "OFF"));
-                });
-            });
+        // Queue and transport handlers (shared with --daemon mode)
+        ouroboros::events::register_core_handlers(publisher, queue_journal);
 
         ouroboros::util::Logger::info("EventBus configured");
 
@@ -411,19 +236,80 @@ int main() {
 
         ouroboros::util::Logger::info("Renderer initialized");
 
+        // The caches are lock-guarded so first renders could proceed
+        // regardless, but joining here (after the terminal handshake the
+        // load overlapped with) keeps the save path below trivially
+        // ordered after the load
+        if (cache_loader.joinable()) {
+            cache_loader.join();
+        }
+
         // Force initial render so UI appears immediately
-        renderer.render();
+        {
+            ouroboros::util::StartupSpan span("first_render");
+            renderer.render();
+        }
+
+        // Shared-memory state mirror so status bars and the like can
+        // read playback state without scraping; same segment the
+        // daemon publishes
+        ouroboros::backend::SnapshotMirror mirror;
+        if (!mirror.open_writer()) {
+            ouroboros::util::Logger::warn("Main: shm state mirror unavailable");
+        }
+
+        // Central memory budget: every sizeable cache registers a usage
+        // probe and (where safe) an evictor; the loop below enforces on
+        // a slow cadence. The budget comes from config, else the cgroup
+        // limit, else half of RAM.
+        auto& memory_budget = ouroboros::util::MemoryBudget::instance();
+        {
+            using MB = ouroboros::util::MemoryBudget;
+            auto& artwork_window = ouroboros::ui::ArtworkWindow::instance();
+            memory_budget.register_tier(MB::Tier::ArtworkPixels,
+                [&artwork_window] { return artwork_window.resident_bytes(); },
+                [&artwork_window](size_t need) { return artwork_window.shrink(need); });
+            memory_budget.register_tier(MB::Tier::ArtworkRaw,
+                [&artwork_cache] { return artwork_cache.memory_usage(); },
+                [&artwork_cache](size_t) { return artwork_cache.release_mapped_pages(); });
+            // Thumbnail tiers are the decode accelerator; account them
+            // but never evict (they're small and regenerating is the
+            // expensive path the store exists to avoid)
+            memory_budget.register_tier(MB::Tier::Thumbnails,
+                [&thumbnail_store] { return thumbnail_store.memory_usage(); });
+            auto& metadata_cache = ouroboros::backend::MetadataCache::instance();
+            memory_budget.register_tier(MB::Tier::Metadata,
+                [&metadata_cache] { return metadata_cache.resident_bytes(); },
+                [&metadata_cache](size_t need) { return metadata_cache.shrink(need); });
+            memory_budget.set_budget(MB::detect_budget(
+                static_cast<size_t>(std::max(0, config.memory_budget_mb)) * 1024 * 1024));
+            ouroboros::util::Logger::info("MemoryBudget: " +
+                std::to_string(memory_budget.budget() / (1024 * 1024)) + " MB across caches");
+        }
+        auto last_budget_check = std::chrono::steady_clock::now();
 
         // Main Loop with POLL
         // Start with seq=0 so any initial snapshot will trigger a render
         uint64_t last_rendered_seq = 0;
         std::optional<int> last_track_index;  // Track when current track changes
+        bool queue_restored = queue_journal.restored_paths().empty();
+        auto last_input_time = std::chrono::steady_clock::now();
 
         while (!renderer.should_quit() && !g_shutdown.load()) {
             // LOGGING DISABLED: Main loop runs 30fps, creates I/O storm
             // ouroboros::util::Logger::debug("Main loop iteration start");
             bool needs_render = false;
 
+            // Dispatch events queued by producer threads (lock-free MPSC
+            // ring). Runs BEFORE get_current() so snapshot changes made by
+            // handlers are rendered in this same frame.
+            if (event_bus.drain() > 0) {
+                needs_render = true;
+            }
+
+            // Publish any coalesced update_batched() changes still pending
+            publisher->flush_batched();
+
             // Check for updates
             // ouroboros::util::Logger::debug("Main loop: Calling get_current()...");
             auto snap = publisher->get_current();
@@ -433,9 +319,42 @@ int main() {
             if (snap && snap->seq != last_rendered_seq) {
                 needs_render = true;
                 last_rendered_seq = snap->seq;
+                mirror.publish(*snap);
                 // ouroboros::util::Logger::debug("Main loop: Snapshot changed, will render");
             }
 
+            // Restore the persisted queue once the library has loaded:
+            // journaled paths resolve to current display indices, and
+            // entries whose file vanished since last session drop out
+            if (!queue_restored && snap && snap->library && !snap->library->tracks.empty()) {
+                queue_restored = true;
+                auto restored = queue_journal.restored_paths();
+                publisher->update(ouroboros::backend::SnapshotPublisher::SectionQueue,
+                    [&restored](ouroboros::model::Snapshot& s) {
+                        std::unordered_map<std::string_view, int> index_by_path;
+                        index_by_path.reserve(s.library->tracks.size());
+                        for (size_t i = 0; i < s.library->tracks.size(); ++i) {
+                            index_by_path.emplace(s.library->tracks[i].path,
+                                                  static_cast<int>(i));
+                        }
+                        auto new_queue = s.queue
+                            ? std::make_shared<ouroboros::model::QueueState>(*s.queue)
+                            : std::make_shared<ouroboros::model::QueueState>();
+                        size_t resolved = 0;
+                        for (const auto& path : restored) {
+                            auto it = index_by_path.find(path);
+                            if (it == index_by_path.end()) continue;
+                            new_queue->future.push_back(it->second);
+                            ++resolved;
+                        }
+                        s.queue = new_queue;
+                        ouroboros::util::Logger::info("QueueJournal: Restored " +
+                            std::to_string(resolved) + " of " +
+                            std::to_string(restored.size()) + " queued tracks");
+                    });
+                needs_render = true;
+            }
+
             // Check if artwork finished loading (unified ArtworkWindow)
             auto& artwork_window = ouroboros::ui::ArtworkWindow::instance();
             bool artwork_updated = false;
@@ -449,7 +368,13 @@ int main() {
             }
 
             // Force continuous rendering while library is scanning (for loading animation)
-            if (snap && snap->library && snap->library->is_scanning) {
+            if (snap && snap->library && snap->scan_progress.is_scanning) {
+                needs_render = true;
+            }
+
+            // Playback publishes only on state changes; the position timer
+            // is interpolated at render time, so keep frames coming
+            if (snap && snap->player.state == ouroboros::model::PlaybackState::Playing) {
                 needs_render = true;
             }
 
@@ -474,10 +399,39 @@ int main() {
                 }
             }
 
-            // Poll for input (latency killer)
-            // ouroboros::util::Logger::debug("Polling for input...");
-            struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
-            int ret = poll(&pfd, 1, 33); // 33ms timeout (target ~30fps for UI updates)
+            // Memory budget housekeeping: refresh the tier gauges and
+            // evict if over. Slow cadence - enforce() is not a hot path
+            if (std::chrono::steady_clock::now() - last_budget_check >
+                    std::chrono::seconds(5)) {
+                last_budget_check = std::chrono::steady_clock::now();
+                memory_budget.enforce();
+            }
+
+            // ADAPTIVE FRAME PACING: the poll timeout only governs
+            // timer-driven redraws — input and snapshot publishes wake the
+            // poll immediately (stdin + the publisher's eventfd), so idle
+            // frames cost nothing but the timeout tick:
+            //   recent input        16ms   ~60fps scroll burst
+            //   library scanning    33ms   loading animation
+            //   playing + spectrum  33ms   analyzer bands animate
+            //   otherwise          500ms   ~2fps, position clock alone
+            int timeout_ms = 500;
+            if (std::chrono::steady_clock::now() - last_input_time <
+                    std::chrono::milliseconds(300)) {
+                timeout_ms = 16;
+            } else if (snap && snap->library && snap->scan_progress.is_scanning) {
+                timeout_ms = 33;
+            } else if (snap &&
+                       snap->player.state == ouroboros::model::PlaybackState::Playing &&
+                       renderer.spectrum_visible()) {
+                timeout_ms = 33;
+            }
+
+            struct pollfd pfds[2] = {
+                {STDIN_FILENO, POLLIN, 0},
+                {publisher->notify_fd(), POLLIN, 0},
+            };
+            int ret = poll(pfds, 2, timeout_ms);
 
             if (ret < 0) {
                 if (errno == EINTR) {
@@ -491,13 +445,28 @@ int main() {
 
             // ouroboros::util::Logger::debug("Poll returned: " + std::to_string(ret));
 
-            if (ret > 0 && (pfd.revents & POLLIN)) {
+            // Publish wakeup: clear the eventfd; the seq check at the top
+            // of the next iteration picks up the new snapshot and renders
+            if (ret > 0 && (pfds[1].revents & POLLIN)) {
+                publisher->drain_notify();
+            }
+
+            if (ret > 0 && (pfds[0].revents & POLLIN)) {
                 try {
                     ouroboros::util::Logger::debug("Main: Input available, draining queue...");
 
-                    // DRAIN LOOP: Consume all buffered input events to prevent queue backlog
-                    // This fixes the Ghostty terminal runaway key repeat issue
-                    ouroboros::ui::InputEvent last_event;
+                    // DRAIN + COALESCE: consume the whole backlog in one
+                    // iteration, collapsing runs of the same key into an
+                    // event + repeat count. Distinct events (a pasted
+                    // search string) all apply in order; repeated nav
+                    // keys apply as one multi-step move between renders,
+                    // so held-key scrolling tracks the key repeat rate
+                    // instead of dribbling out one row per frame.
+                    struct PendingInput {
+                        ouroboros::ui::InputEvent event;
+                        int count;
+                    };
+                    std::vector<PendingInput> batch;
                     int events_drained = 0;
 
                     while (true) {
@@ -508,8 +477,14 @@ int main() {
                             break;
                         }
 
-                        // Keep only the last event
-                        last_event = event;
+                        if (!batch.empty() &&
+                            batch.back().event.type == event.type &&
+                            batch.back().event.key == event.key &&
+                            batch.back().event.key_name == event.key_name) {
+                            batch.back().count++;
+                        } else {
+                            batch.push_back({std::move(event), 1});
+                        }
                         events_drained++;
 
                         // Safety: warn if drain count is unusually high (possible bug in empty-event detection)
@@ -519,17 +494,45 @@ int main() {
                         }
                     }
 
-                    // Process only the LAST event from the drained queue
-                    if (events_drained > 0) {
+                    // One-shot actions must not replay per repeat: a
+                    // terminal that floods key repeats (the Ghostty
+                    // runaway-repeat issue) would otherwise queue up N
+                    // track skips or play/pause toggles.
+                    auto is_one_shot = [](const ouroboros::ui::InputEvent& e) {
+                        static constexpr const char* actions[] = {
+                            "quit", "play", "next", "prev", "repeat_cycle",
+                            "shuffle_toggle", "toggle_album_view", "clear_queue",
+                            "search", "help", "perf_hud", "tab", "select",
+                        };
+                        for (const char* action : actions) {
+                            if (ouroboros::ui::matches_keybind(e, action)) return true;
+                        }
+                        return e.type == ouroboros::ui::InputEvent::Type::Resize ||
+                               e.key_name == "enter" || e.key_name == "escape";
+                    };
+
+                    if (!batch.empty()) {
+                        last_input_time = std::chrono::steady_clock::now();
                         if (events_drained > 5) {
                             ouroboros::util::Logger::debug("Main: Drained " + std::to_string(events_drained) +
-                                                          " buffered input events, processing last event");
+                                                          " buffered input events into " +
+                                                          std::to_string(batch.size()) + " batched");
                         }
 
-                        ouroboros::util::Logger::debug("Main: Processing event key=" + std::to_string(last_event.key) +
-                                                      " name=" + last_event.key_name);
-                        renderer.handle_input_event(last_event);
-                        ouroboros::util::Logger::debug("Main: Event processed, rendering...");
+                        for (const auto& pending : batch) {
+                            // Repeat cap: a legitimate held key queues a
+                            // handful of repeats per frame; hundreds mean
+                            // terminal flood, and the excess is dropped
+                            int applies = std::min(pending.count, 10);
+                            if (is_one_shot(pending.event)) applies = 1;
+                            for (int i = 0; i < applies; ++i) {
+                                renderer.handle_input_event(pending.event);
+                            }
+                        }
+                        // Input handlers publish through the event ring;
+                        // drain so their effects land before the render.
+                        event_bus.drain();
+                        ouroboros::util::Logger::debug("Main: Event batch processed, rendering...");
                         renderer.render(); // Update UI immediately after input
                         ouroboros::util::Logger::debug("Main: Post-input render complete");
                     }
@@ -548,6 +551,12 @@ int main() {
         terminal.shutdown();
         ouroboros::util::Logger::info("Terminal restored, performing background cleanup...");
 
+        // Flush any queue-journal appends still in flight
+        queue_journal.shutdown();
+
+        // Stop the spectrum worker (joins within one poll interval)
+        audio::SpectrumAnalyzer::instance().shutdown();
+
         // Phase 3: Save artwork cache to disk before shutdown
         ouroboros::util::Logger::info("Saving artwork cache...");
         if (artwork_cache.save(cache_file)) {
@@ -557,6 +566,53 @@ int main() {
             ouroboros::util::Logger::error("Failed to save artwork cache to: " + cache_file.string());
         }
 
+        if (thumbnail_store.save(thumbs_file)) {
+            ouroboros::util::Logger::info("Thumbnail store saved: " + std::to_string(thumbnail_store.size()) +
+                " entries, " + std::to_string(thumbnail_store.memory_usage() / 1024) + " KB");
+        } else {
+            ouroboros::util::Logger::error("Failed to save thumbnail store to: " + thumbs_file.string());
+        }
+
+        // Dump the startup trace last so spans from the collector
+        // threads (scan, sort, album grouping) are all collected
+        auto& profiler = ouroboros::util::StartupProfiler::instance();
+        if (profiler.enabled()) {
+            // Session render metrics ride along as summary spans at the
+            // tail of the trace (dur = session average / observed max),
+            // so a "UI stutters" report's JSON carries the per-widget
+            // and per-flush-phase breakdown without per-frame spans
+            // accumulating for the whole session
+            auto& pc = ouroboros::util::PerfCounters::instance();
+            auto summarize = [&](const std::string& name,
+                                 const ouroboros::util::PerfCounters::Metric& m) {
+                const auto base = std::chrono::steady_clock::now();
+                profiler.record(name + ".avg", base,
+                                base + std::chrono::nanoseconds(m.avg_ns()));
+                profiler.record(name + ".max", base,
+                                base + std::chrono::nanoseconds(
+                                    m.max_ns.load(std::memory_order_relaxed)));
+            };
+            summarize("render.frame", pc.frame_render);
+            summarize("render.browser", pc.widget_browser);
+            summarize("render.album_browser", pc.widget_album_browser);
+            summarize("render.now_playing", pc.widget_now_playing);
+            summarize("render.queue", pc.widget_queue);
+            summarize("render.flush_diff", pc.flush_diff);
+            summarize("render.flush_emit", pc.flush_emit);
+            summarize("render.flush_write", pc.flush_write);
+
+            fs::path trace_file = cache_dir / "startup-trace.json";
+            if (profiler.write_trace(trace_file)) {
+                ouroboros::util::Logger::info("Startup trace written: " + trace_file.string());
+                // stderr is redirected to the debug log; stdout is back
+                // on the normal screen after terminal.shutdown()
+                std::cout << "Startup trace written to " << trace_file.string()
+                          << " (load in chrome://tracing or ui.perfetto.dev)" << std::endl;
+            } else {
+                ouroboros::util::Logger::error("Failed to write startup trace: " + trace_file.string());
+            }
+        }
+
         ouroboros::util::Logger::info("OUROBOROS shutdown");
 
         return 0;
@@ -0,0 +1,296 @@
+// ═══════════════════════════════════════════════════════════════════════
+// OUROBOROS — PGO training workload
+//
+// Deterministic replay of the hot paths a real session exercises, built
+// as the `ouroboros_train` target. An instrumented build runs this to
+// collect branch/call profiles for -fprofile-use; see the PGO section
+// in CMakeLists.txt for the three-step build flow. No terminal, no
+// PipeWire, no user input — everything runs against synthesized
+// fixtures so profiles are reproducible across machines.
+//
+// The replayed phases mirror startup and steady state:
+//   1. directory scan of a fixture tree (DirectoryScanner)
+//   2. library cache save/load round trips (Library serialization)
+//   3. library sort (parallel_timsort, the startup sort path)
+//   4. search: trigram candidates + Boyer-Moore verify + fuzzy scoring
+//   5. scrolling: Browser::handle_input / render / Canvas frame diff
+//   6. decode: WAVDecoder over synthesized PCM fixtures
+// ═══════════════════════════════════════════════════════════════════════
+
+#include "backend/Config.hpp"
+#include "backend/Library.hpp"
+#include "model/Snapshot.hpp"
+#include "audio/WAVDecoder.hpp"
+#include "ui/Canvas.hpp"
+#include "ui/InputEvent.hpp"
+#include "ui/widgets/Browser.hpp"
+#include "util/BoyerMoore.hpp"
+#include "util/DirectoryScanner.hpp"
+#include "util/FuzzyMatch.hpp"
+#include "util/TimSort.hpp"
+#include "util/TrigramIndex.hpp"
+#include "util/UnicodeUtils.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cmath>
+
+namespace fs = std::filesystem;
+using namespace ouroboros;
+
+namespace {
+
+// ─── timing ─────────────────────────────────────────────────────────────
+
+class PhaseTimer {
+public:
+    explicit PhaseTimer(const char* name)
+        : name_(name), start_(std::chrono::steady_clock::now()) {}
+    ~PhaseTimer() {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::steady_clock::now() - start_)
+                      .count();
+        std::cout << "  " << name_ << ": " << ms << " ms" << std::endl;
+    }
+
+private:
+    const char* name_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// ─── fixtures ───────────────────────────────────────────────────────────
+
+constexpr int NUM_DIRS = 64;
+constexpr int FILES_PER_DIR = 32;
+constexpr size_t NUM_TRACKS = 20'000;
+
+/// 2s of 440Hz stereo s16 PCM in a minimal RIFF container — enough to
+/// drive the WAVDecoder header parse, mmap, and convert kernels.
+void write_wav_fixture(const fs::path& path) {
+    constexpr uint32_t rate = 44100;
+    constexpr uint32_t frames = rate * 2;
+    constexpr uint16_t channels = 2;
+    constexpr uint32_t data_bytes = frames * channels * 2;
+
+    std::ofstream out(path, std::ios::binary);
+    auto u16 = [&](uint16_t v) { out.write(reinterpret_cast<char*>(&v), 2); };
+    auto u32 = [&](uint32_t v) { out.write(reinterpret_cast<char*>(&v), 4); };
+
+    out.write("RIFF", 4);
+    u32(36 + data_bytes);
+    out.write("WAVE", 4);
+    out.write("fmt ", 4);
+    u32(16);
+    u16(1);  // PCM
+    u16(channels);
+    u32(rate);
+    u32(rate * channels * 2);  // byte rate
+    u16(channels * 2);         // block align
+    u16(16);                   // bits per sample
+    out.write("data", 4);
+    u32(data_bytes);
+
+    for (uint32_t i = 0; i < frames; ++i) {
+        auto s = static_cast<int16_t>(12000.0 * std::sin(2.0 * 3.14159265 * 440.0 * i / rate));
+        u16(static_cast<uint16_t>(s));
+        u16(static_cast<uint16_t>(s));
+    }
+}
+
+/// Fixture tree: NUM_DIRS directories of FILES_PER_DIR dummy audio
+/// files (scanner only stats them) plus one real WAV per 16th dir.
+fs::path build_fixture_tree(const fs::path& root) {
+    if (fs::exists(root)) return root;
+    for (int d = 0; d < NUM_DIRS; ++d) {
+        auto dir = root / ("artist" + std::to_string(d)) / "album";
+        fs::create_directories(dir);
+        for (int f = 0; f < FILES_PER_DIR; ++f) {
+            std::ofstream(dir / ("track" + std::to_string(f) + ".mp3")) << "x";
+        }
+        if (d % 16 == 0) {
+            write_wav_fixture(dir / "fixture.wav");
+        }
+    }
+    return root;
+}
+
+/// Library-shaped synthetic tracks: realistic artist/album cardinality
+/// (interning and album grouping behave like a real collection) with
+/// search keys precomputed the way LibraryCollector does.
+std::vector<model::Track> make_tracks() {
+    static const char* artists[] = {"Boards of Canada", "Autechre", "Aphex Twin",
+                                    "Burial", "Four Tet", "Björk", "Café Tacvba"};
+    std::vector<model::Track> tracks(NUM_TRACKS);
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        auto& t = tracks[i];
+        std::string artist = artists[i % std::size(artists)];
+        std::string album = "Album " + std::to_string(i / 100);
+        t.title = "Track " + std::to_string(i % 100);
+        t.artist = artist;
+        t.album = album;
+        t.path = "/music/" + artist + "/" + album + "/" + t.title + ".flac";
+        t.track_number = static_cast<int>(i % 100) + 1;
+        t.duration_ms = 240'000;
+        t.search_key = util::normalize_for_search(artist) + '\n' +
+                       util::normalize_for_search(album) + '\n' +
+                       util::normalize_for_search(t.title);
+    }
+    return tracks;
+}
+
+// ─── phases ─────────────────────────────────────────────────────────────
+
+void phase_scan(const fs::path& fixture_root) {
+    PhaseTimer timer("directory scan x10");
+    for (int i = 0; i < 10; ++i) {
+        auto result = util::DirectoryScanner::scan_directory(fixture_root);
+        if (result.files.size() != NUM_DIRS * FILES_PER_DIR + NUM_DIRS / 16) {
+            std::cerr << "unexpected scan result: " << result.files.size()
+                      << " files" << std::endl;
+        }
+    }
+}
+
+void phase_library_cache(const std::vector<model::Track>& tracks, const fs::path& work_dir) {
+    PhaseTimer timer("library cache save/load x5");
+    auto cache_file = work_dir / "train_library.bin";
+    backend::Library library;
+    library.set_tracks(tracks);
+    if (!library.save_to_cache(cache_file)) {
+        std::cerr << "cache save failed: " << cache_file << std::endl;
+        return;
+    }
+    for (int i = 0; i < 5; ++i) {
+        backend::Library fresh;
+        if (!fresh.load_from_cache(cache_file) ||
+            fresh.get_track_count() != tracks.size()) {
+            std::cerr << "cache load failed on pass " << i << std::endl;
+        }
+    }
+}
+
+void phase_sort(const std::vector<model::Track>& tracks) {
+    PhaseTimer timer("library sort x5");
+    for (int i = 0; i < 5; ++i) {
+        auto v = tracks;
+        util::parallel_timsort(v, [](const model::Track& a, const model::Track& b) {
+            if (a.artist != b.artist) return a.artist < b.artist;
+            if (a.album != b.album) return a.album < b.album;
+            return a.track_number < b.track_number;
+        });
+    }
+}
+
+void phase_search(const std::vector<model::Track>& tracks) {
+    PhaseTimer timer("search queries x200");
+    util::TrigramIndex index;
+    index.build(tracks.size(),
+                [&](size_t i) -> std::string_view { return tracks[i].search_key; });
+
+    static const char* queries[] = {"boards", "track 4", "album 17", "bjork",
+                                    "aphex", "cafe", "zzzzz"};
+    std::vector<int> candidates;
+    size_t hits = 0;
+    for (int pass = 0; pass < 200; ++pass) {
+        for (const char* q : queries) {
+            std::string query = util::normalize_for_search(q);
+            if (!index.candidates(query, candidates)) continue;
+            util::BoyerMooreSearch verify(query);
+            util::FuzzyMatcher fuzzy(query);
+            for (int idx : candidates) {
+                const auto& key = tracks[static_cast<size_t>(idx)].search_key;
+                if (verify.search(key) >= 0) hits++;
+                (void)fuzzy.score(key);
+            }
+        }
+    }
+    if (hits == 0) std::cerr << "search phase matched nothing" << std::endl;
+}
+
+void phase_scroll(const std::vector<model::Track>& tracks) {
+    PhaseTimer timer("scroll 2000 frames");
+    auto lib = std::make_shared<model::LibraryState>();
+    lib->tracks = std::vector<model::Track>(tracks);  // paged copy; the snapshot owns it
+
+    model::Snapshot snap;
+    snap.library = lib;
+    snap.queue = std::make_shared<model::QueueState>();
+
+    ui::widgets::Browser browser;
+    ui::Canvas cur(220, 60), prev(220, 60);
+    ui::LayoutRect rect{0, 0, 220, 60};
+    std::vector<std::pair<int, int>> spans;
+
+    // j-held scrolling with occasional reversals, rendering and
+    // frame-diffing every event like the 30FPS loop does
+    for (int frame = 0; frame < 2000; ++frame) {
+        ui::InputEvent event;
+        event.type = ui::InputEvent::Type::KeyPress;
+        bool down = (frame % 250) < 200;
+        event.key = down ? 'j' : 'k';
+        event.key_name = down ? "j" : "k";
+        browser.handle_input(event);
+
+        cur.clear();
+        browser.render(cur, rect, snap, true);
+        for (int y = 0; y < 60; ++y) {
+            if (!cur.row_differs(prev, y)) continue;
+            spans.clear();
+            cur.changed_spans(prev, y, spans);
+        }
+        std::swap(cur, prev);
+    }
+}
+
+void phase_decode(const fs::path& fixture_root) {
+    PhaseTimer timer("wav decode");
+    std::vector<float> pcm(4096 * 2);
+    long total_frames = 0;
+    for (const auto& entry : fs::recursive_directory_iterator(fixture_root)) {
+        if (entry.path().extension() != ".wav") continue;
+        audio::WAVDecoder decoder;
+        if (!decoder.open(entry.path().string())) {
+            std::cerr << "decode open failed: " << entry.path() << std::endl;
+            continue;
+        }
+        int frames;
+        while ((frames = decoder.read_pcm(pcm.data(), 4096)) > 0) {
+            total_frames += frames;
+        }
+        decoder.close();
+    }
+    if (total_frames == 0) std::cerr << "decode phase read nothing" << std::endl;
+}
+
+}  // namespace
+
+int main() {
+    // Default keybinds only — training must not depend on a user config
+    backend::Config::instance().keybinds = {
+        {"nav_up", "k"}, {"nav_down", "j"}, {"select", "enter"}};
+
+    auto work_dir = fs::temp_directory_path() / "ouroboros_train";
+    fs::create_directories(work_dir);
+    auto fixture_root = build_fixture_tree(work_dir / "fixtures");
+
+    std::cout << "=== OUROBOROS PGO TRAINING WORKLOAD ===" << std::endl;
+    auto tracks = make_tracks();
+
+    phase_scan(fixture_root);
+    phase_library_cache(tracks, work_dir);
+    phase_sort(tracks);
+    phase_search(tracks);
+    phase_scroll(tracks);
+    phase_decode(fixture_root);
+
+    std::cout << "training workload complete" << std::endl;
+    return 0;
+}
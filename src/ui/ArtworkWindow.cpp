@@ -1,9 +1,13 @@
 #include "ui/ArtworkWindow.hpp"
 #include "backend/ArtworkCache.hpp"
+#include "backend/ThumbnailStore.hpp"
 #include "backend/MetadataParser.hpp"
 #include "backend/Config.hpp"
 #include "util/Logger.hpp"
+#include "util/Platform.hpp"
 
+#include <bit>
+#include <cstring>
 #include <filesystem>
 #include <sys/ioctl.h>
 #include <unistd.h>
@@ -24,13 +28,137 @@
 #include "stb/stb_image_write.h"
 #pragma GCC diagnostic pop
 
+// SIMD JPEG decoding when built against libjpeg-turbo; stb_image
+// remains the fallback (and handles PNG either way)
+#ifdef OUROBOROS_HAVE_TURBOJPEG
+#include <turbojpeg.h>
+#include <cstdlib>
+#endif
+
 namespace ouroboros::ui {
 
+namespace {
+
+#ifdef OUROBOROS_HAVE_TURBOJPEG
+
+// Decodes a JPEG to RGB with libjpeg-turbo, using DCT scaling so a
+// 3000px original targeted at a 256px slot is decoded at the smallest
+// scale factor that still covers min_px - most of the IDCT work never
+// happens. Returns a malloc'd buffer (free-compatible with
+// stbi_image_free) or nullptr, in which case the caller falls back to
+// stb_image.
+unsigned char* turbo_decode_jpeg(const uint8_t* data, size_t size, int min_px,
+                                 int& out_w, int& out_h) {
+    if (size < 2 || data[0] != 0xFF || data[1] != 0xD8) {
+        return nullptr;  // Not a JPEG (PNG etc. go through stb)
+    }
+
+    // One handle per worker thread; creation is not free
+    thread_local tjhandle handle = tjInitDecompress();
+    if (!handle) return nullptr;
+
+    int w = 0, h = 0, subsamp = 0, colorspace = 0;
+    if (tjDecompressHeader3(handle, data, static_cast<unsigned long>(size),
+                            &w, &h, &subsamp, &colorspace) != 0) {
+        util::Logger::debug(std::string("ArtworkWindow: turbojpeg header rejected: ") +
+                           tjGetErrorStr2(handle));
+        return nullptr;
+    }
+
+    // Smallest DCT scaling factor whose result still covers the target
+    int num_factors = 0;
+    tjscalingfactor* factors = tjGetScalingFactors(&num_factors);
+    int scaled_w = w, scaled_h = h;
+    if (factors && min_px > 0) {
+        for (int i = 0; i < num_factors; ++i) {
+            int sw = TJSCALED(w, factors[i]);
+            int sh = TJSCALED(h, factors[i]);
+            if (std::max(sw, sh) >= min_px &&
+                static_cast<long>(sw) * sh < static_cast<long>(scaled_w) * scaled_h) {
+                scaled_w = sw;
+                scaled_h = sh;
+            }
+        }
+    }
+
+    auto* pixels = static_cast<unsigned char*>(
+        std::malloc(static_cast<size_t>(scaled_w) * scaled_h * 3));
+    if (!pixels) return nullptr;
+
+    if (tjDecompress2(handle, data, static_cast<unsigned long>(size), pixels,
+                      scaled_w, 0, scaled_h, TJPF_RGB, TJFLAG_FASTDCT) != 0) {
+        util::Logger::debug(std::string("ArtworkWindow: turbojpeg decode failed: ") +
+                           tjGetErrorStr2(handle));
+        std::free(pixels);
+        return nullptr;
+    }
+
+    out_w = scaled_w;
+    out_h = scaled_h;
+    return pixels;
+}
+
+#endif  // OUROBOROS_HAVE_TURBOJPEG
+
+}  // namespace
+
 ArtworkWindow& ArtworkWindow::instance() {
     static ArtworkWindow instance;
     return instance;
 }
 
+std::vector<uint8_t> ArtworkWindow::PixelBufferPool::acquire(size_t size) {
+    std::vector<uint8_t> buf;
+    if (size >= MIN_POOL_BYTES) {
+        size_t cls = std::bit_width(size - 1);  // Class of bit_ceil(size)
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cls < NUM_CLASSES && !classes_[cls].empty()) {
+            buf = std::move(classes_[cls].back());
+            classes_[cls].pop_back();
+            pooled_bytes_ -= buf.capacity();
+        }
+    }
+    // First use of a class pins capacity to its ceiling, so every
+    // later reuse within the class is realloc-free
+    buf.reserve(std::bit_ceil(size));
+    buf.resize(size);
+    return buf;
+}
+
+void ArtworkWindow::PixelBufferPool::release(std::vector<uint8_t>&& buf) {
+    size_t cap = buf.capacity();
+    if (cap < MIN_POOL_BYTES || cap != std::bit_ceil(cap)) {
+        return;  // Too small, or not one of ours - let it free
+    }
+    size_t cls = std::bit_width(cap - 1);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cls >= NUM_CLASSES || classes_[cls].size() >= MAX_PER_CLASS ||
+        pooled_bytes_ + cap > MAX_POOL_BYTES) {
+        return;
+    }
+    pooled_bytes_ += cap;
+    classes_[cls].push_back(std::move(buf));
+}
+
+size_t ArtworkWindow::PixelBufferPool::pooled() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pooled_bytes_;
+}
+
+size_t ArtworkWindow::PixelBufferPool::shrink(size_t bytes_needed) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t freed = 0;
+    // Largest classes first: fewer deallocations per byte released
+    for (size_t cls = NUM_CLASSES; cls-- > 0 && freed < bytes_needed;) {
+        while (!classes_[cls].empty() && freed < bytes_needed) {
+            freed += classes_[cls].back().capacity();
+            classes_[cls].pop_back();
+        }
+    }
+    pooled_bytes_ -= freed;
+    return freed;
+}
+
 ArtworkWindow::ArtworkWindow() {
     // Get memory limit from config
     const auto& config = backend::Config::instance();
@@ -79,6 +207,23 @@ void ArtworkWindow::request(const std::string& path, int priority, int width_col
 
     // Key by album directory, not individual track path - all tracks share same artwork
     std::string album_dir = std::filesystem::path(path).parent_path().string();
+
+    if (!notify) {
+        // Batched caller: stage only. flush_requests() diffs the whole
+        // frame against slot state in one locked pass instead of
+        // paying two lock round-trips per request here.
+        StagedRequest sr;
+        sr.path = path;
+        sr.album_dir = std::move(album_dir);
+        sr.priority = priority;
+        sr.width_cols = width_cols;
+        sr.height_rows = height_rows;
+        sr.force_extract = force_extract;
+        sr.timestamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        std::lock_guard<std::mutex> lock(staging_mutex_);
+        staged_.push_back(std::move(sr));
+        return;
+    }
     CacheKey key{album_dir, width_cols, height_rows};
 
     // Check if already cached (including failed attempts)
@@ -138,10 +283,15 @@ void ArtworkWindow::request(const std::string& path, int priority, int width_col
             return;  // Already verified to use album artwork
         }
 
-        if (pending_paths_.count(pending_key)) {
-            return;  // Already queued
+        auto [pending_it, inserted] = pending_paths_.try_emplace(pending_key, priority);
+        if (!inserted) {
+            if (priority >= pending_it->second) {
+                return;  // Already queued at least this urgently
+            }
+            // Re-prioritize: record the better priority and queue a
+            // duplicate; the worker drops the stale lower-priority copy
+            pending_it->second = priority;
         }
-        pending_paths_.insert(pending_key);
 
         WindowRequest req;
         req.path = path;
@@ -150,6 +300,7 @@ void ArtworkWindow::request(const std::string& path, int priority, int width_col
         req.target_width = width_cols * cell_width_;
         req.target_height = height_rows * cell_height_;
         req.force_extract = force_extract;
+        req.generation = cancel_generation_.load(std::memory_order_relaxed);
 
         request_queue_.push(req);
 
@@ -166,6 +317,114 @@ void ArtworkWindow::request(const std::string& path, int priority, int width_col
 }
 
 void ArtworkWindow::flush_requests() {
+    std::vector<StagedRequest> batch;
+    {
+        std::lock_guard<std::mutex> lock(staging_mutex_);
+        batch.swap(staged_);
+    }
+
+    if (!batch.empty()) {
+        // Intra-frame dedup before anything is hashed or locked: the
+        // scroll handler stages the same key more than once per frame
+        // (slot assignment plus prefetch). Keep the best priority.
+        std::unordered_map<std::string, size_t> best_by_key;
+        best_by_key.reserve(batch.size());
+        std::vector<size_t> unique_order;
+        unique_order.reserve(batch.size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            auto& sr = batch[i];
+            sr.pending_key = sr.path + ":" + std::to_string(sr.width_cols) +
+                             "x" + std::to_string(sr.height_rows);
+            auto [it, inserted] = best_by_key.try_emplace(sr.pending_key, i);
+            if (inserted) {
+                unique_order.push_back(i);
+            } else if (sr.priority < batch[it->second].priority) {
+                batch[it->second].priority = sr.priority;
+            }
+        }
+
+        // One cache pass: drop requests a Ready slot already answers
+        // (refreshing its LRU position, as the unbatched path does) or
+        // a Failed slot has ruled out
+        std::vector<size_t> to_queue;
+        to_queue.reserve(unique_order.size());
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex_);
+            for (size_t i : unique_order) {
+                const auto& sr = batch[i];
+                if (sr.force_extract) {
+                    // Per-track entries only; the dir entry can't answer
+                    // a force_extract (needs the SHA256 comparison)
+                    CacheKey track_key{sr.path, sr.width_cols, sr.height_rows};
+                    auto it = cache_.find(track_key);
+                    if (it != cache_.end() && it->second &&
+                        it->second->state.load(std::memory_order_acquire) ==
+                            NowPlayingSlotState::Ready) {
+                        lru_list_.splice(lru_list_.begin(), lru_list_, it->second->lru_iter);
+                        continue;
+                    }
+                    to_queue.push_back(i);
+                    continue;
+                }
+
+                CacheKey key{sr.album_dir, sr.width_cols, sr.height_rows};
+                auto it = cache_.find(key);
+                if (it != cache_.end() && it->second) {
+                    NowPlayingSlotState state =
+                        it->second->state.load(std::memory_order_acquire);
+                    if (state == NowPlayingSlotState::Ready) {
+                        lru_list_.splice(lru_list_.begin(), lru_list_, it->second->lru_iter);
+                        continue;
+                    }
+                    if (state == NowPlayingSlotState::Failed) {
+                        continue;
+                    }
+                    // Evicted/Loading/Empty fall through to the queue;
+                    // pending_paths_ below absorbs in-flight duplicates
+                }
+                to_queue.push_back(i);
+            }
+        }
+
+        // One queue pass: pending dedup (same re-prioritization rules
+        // as the unbatched path) and push
+        if (!to_queue.empty()) {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            const uint64_t gen = cancel_generation_.load(std::memory_order_relaxed);
+            size_t queued = 0;
+            for (size_t i : to_queue) {
+                auto& sr = batch[i];
+                if (sr.force_extract && verified_tracks_.count(sr.pending_key)) {
+                    continue;  // Already verified to use album artwork
+                }
+
+                auto [pending_it, inserted] =
+                    pending_paths_.try_emplace(sr.pending_key, sr.priority);
+                if (!inserted) {
+                    if (sr.priority >= pending_it->second) {
+                        continue;  // Already queued at least this urgently
+                    }
+                    pending_it->second = sr.priority;
+                }
+
+                WindowRequest req;
+                req.path = std::move(sr.path);
+                req.priority = sr.priority;
+                req.timestamp = sr.timestamp;
+                req.target_width = sr.width_cols * cell_width_;
+                req.target_height = sr.height_rows * cell_height_;
+                req.force_extract = sr.force_extract;
+                req.generation = gen;
+                request_queue_.push(std::move(req));
+                ++queued;
+            }
+            if (queued > 0) {
+                util::Logger::debug("ArtworkWindow: Flushed " + std::to_string(batch.size()) +
+                                    " staged requests -> " + std::to_string(queued) + " queued");
+            }
+        }
+    }
+
     queue_cv_.notify_all();
 }
 
@@ -237,6 +496,11 @@ bool ArtworkWindow::is_failed(const std::string& path, int width_cols, int heigh
 void ArtworkWindow::reset() {
     util::Logger::debug("ArtworkWindow: Reset called - clearing request queue");
 
+    // Invalidate the cancellation token: workers already inside a decode
+    // for the old window abort at their next phase boundary instead of
+    // finishing a megapixel decode nobody will display
+    cancel_generation_.fetch_add(1, std::memory_order_relaxed);
+
     // Clear queue only - cache uses LRU eviction and shouldn't be cleared
     // (clearing cache causes NowPlaying artwork to flicker on Big Jump)
     // Don't set has_updates_ - queue clearing doesn't require re-render
@@ -247,6 +511,12 @@ void ArtworkWindow::reset() {
         }
         pending_paths_.clear();
     }
+
+    // Staged-but-unflushed requests belong to the abandoned viewport too
+    {
+        std::lock_guard<std::mutex> lock(staging_mutex_);
+        staged_.clear();
+    }
 }
 
 bool ArtworkWindow::has_updates() {
@@ -262,6 +532,11 @@ size_t ArtworkWindow::get_entry_count() const {
     return cache_.size();
 }
 
+size_t ArtworkWindow::pending_count() {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return pending_paths_.size();
+}
+
 void ArtworkWindow::evict_until_under_limit() {
     // NOTE: Caller must hold cache_mutex_
     // Two-tier eviction: deallocate pixels but keep entry metadata for re-decode
@@ -284,9 +559,9 @@ void ArtworkWindow::evict_until_under_limit() {
                 bytes_freed += entry_bytes;
                 total_bytes_.fetch_sub(entry_bytes);
 
-                // Deallocate pixels but keep entry metadata
-                entry->decoded_pixels.clear();
-                entry->decoded_pixels.shrink_to_fit();  // Actually deallocate memory
+                // Recycle pixels through the pool but keep entry metadata
+                pixel_pool_.release(std::move(entry->decoded_pixels));
+                entry->decoded_pixels = {};
                 entry->state.store(NowPlayingSlotState::Evicted, std::memory_order_release);
 
                 ++evicted;
@@ -316,8 +591,52 @@ void ArtworkWindow::evict_until_under_limit() {
     }
 }
 
+size_t ArtworkWindow::resident_bytes() {
+    return total_bytes_.load() + pixel_pool_.pooled();
+}
+
+size_t ArtworkWindow::shrink(size_t bytes_needed) {
+    // Pooled buffers are pure ballast - drain those before touching
+    // entries the UI could still redisplay
+    size_t freed = pixel_pool_.shrink(bytes_needed);
+
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    size_t evicted = 0;
+    while (freed < bytes_needed && !lru_list_.empty()) {
+        auto oldest_key = lru_list_.back();
+        auto it = cache_.find(oldest_key);
+
+        if (it != cache_.end() && it->second &&
+            it->second->state.load(std::memory_order_acquire) ==
+                NowPlayingSlotState::Ready) {
+            auto& entry = it->second;
+            size_t entry_bytes = entry->decoded_pixels.size();
+            freed += entry_bytes;
+            total_bytes_.fetch_sub(entry_bytes);
+
+            // Free outright, bypassing the pool: the budget wants the
+            // memory back, not recycled
+            entry->decoded_pixels = {};
+            entry->state.store(NowPlayingSlotState::Evicted, std::memory_order_release);
+            ++evicted;
+        }
+        lru_list_.pop_back();
+    }
+
+    if (freed > 0) {
+        util::Logger::info("ArtworkWindow: Budget shrink freed " +
+                          std::to_string(freed / 1024) + " KB (" +
+                          std::to_string(evicted) + " entries), now " +
+                          std::to_string(total_bytes_.load() / (1024 * 1024)) + " MB");
+    }
+    return freed;
+}
+
 void ArtworkWindow::worker_thread() {
     util::Logger::debug("ArtworkWindow: Worker thread started");
+    // Idle-class: artwork decodes soak up spare cycles but never
+    // contend with the audio decode path
+    util::Platform::set_current_thread_role(util::Platform::ThreadRole::BulkWorker);
 
     while (!should_stop_) {
         WindowRequest req;
@@ -338,6 +657,13 @@ void ArtworkWindow::worker_thread() {
             pending_key = req.path + ":" + std::to_string(req.target_width / cell_width_) +
                          "x" + std::to_string(req.target_height / cell_height_);
 
+            // Stale duplicate left behind by a re-prioritization (or the
+            // key was already serviced): the better copy is still queued
+            auto pending_it = pending_paths_.find(pending_key);
+            if (pending_it == pending_paths_.end() || pending_it->second < req.priority) {
+                continue;
+            }
+
             // Log priority when pulled from queue to verify ordering
             std::string filename = req.path.substr(req.path.rfind('/') + 1);
             if (filename.length() > 25) filename = filename.substr(0, 25) + "...";
@@ -451,7 +777,8 @@ void ArtworkWindow::worker_thread() {
         if (!artwork_hash.empty()) {
             const auto* cached_entry = global_cache.get(artwork_hash);
             if (cached_entry) {
-                jpeg_data = cached_entry->data;  // Copy jpeg data
+                jpeg_data.assign(cached_entry->bytes(),
+                                 cached_entry->bytes() + cached_entry->size());  // Copy jpeg data
                 util::Logger::debug("ArtworkWindow: Cache hit for " + artwork_hash.substr(0, 8) + "...");
             }
         }
@@ -468,9 +795,20 @@ void ArtworkWindow::worker_thread() {
             }
         }
 
+        // Extraction can outlive a reset(); bail before paying for the
+        // decode. No Failed entry is cached, so a fresh request for this
+        // album simply re-queues it.
+        if (decode_cancelled(req.generation)) {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            pending_paths_.erase(pending_key);
+            continue;
+        }
+
         // Decode jpeg to pixels
         if (!jpeg_data.empty()) {
-            auto decode_result = decode_jpeg(jpeg_data, req.target_width, req.target_height);
+            auto decode_result = decode_artwork(artwork_hash, jpeg_data,
+                                               req.target_width, req.target_height,
+                                               req.generation);
 
             if (decode_result.valid) {
                 // Use track_path for unique artwork (podcasts), album_dir otherwise
@@ -589,22 +927,90 @@ void ArtworkWindow::worker_thread() {
     util::Logger::debug("ArtworkWindow: Worker thread exiting");
 }
 
-ArtworkWindow::DecodeResult ArtworkWindow::decode_jpeg(const std::vector<uint8_t>& jpeg_data,
-                                                        int target_w, int target_h) {
+ArtworkWindow::DecodeResult ArtworkWindow::decode_artwork(const std::string& hash,
+                                                          const std::vector<uint8_t>& jpeg_data,
+                                                          int target_w, int target_h,
+                                                          uint64_t request_generation) {
+    auto& thumbs = backend::ThumbnailStore::instance();
+
+    // Steady state: resize a pre-scaled tier instead of decoding and
+    // downscaling the original every session
+    if (!hash.empty()) {
+        int needed = std::max(target_w, target_h);
+        if (const auto* thumb = thumbs.get(hash, needed)) {
+            util::Logger::debug("ArtworkWindow: Thumb tier hit for " + hash.substr(0, 8) +
+                               "... (" + std::to_string(thumb->width) + "x" +
+                               std::to_string(thumb->height) + ")");
+            return scale_to_target(thumb->bytes(), thumb->width, thumb->height,
+                                   target_w, target_h);
+        }
+    }
+
     DecodeResult result;
     result.valid = false;
 
-    int w, h, channels;
-    unsigned char* pixels = stbi_load_from_memory(
-        jpeg_data.data(), static_cast<int>(jpeg_data.size()),
-        &w, &h, &channels, 3
-    );
+    // Decode floor: tier generation below works from this decode, so it
+    // can't be DCT-scaled under the largest tier on first sight of a hash
+    int decode_px = std::max(target_w, target_h);
+    if (!hash.empty() && !thumbs.has(hash)) {
+        decode_px = std::max(decode_px, backend::ThumbnailStore::TIERS.back());
+    }
+
+    int w = 0, h = 0;
+    unsigned char* pixels = nullptr;
+#ifdef OUROBOROS_HAVE_TURBOJPEG
+    pixels = turbo_decode_jpeg(jpeg_data.data(), jpeg_data.size(), decode_px, w, h);
+#endif
+    if (!pixels) {
+        int channels;
+        pixels = stbi_load_from_memory(
+            jpeg_data.data(), static_cast<int>(jpeg_data.size()),
+            &w, &h, &channels, 3
+        );
+    }
 
     if (!pixels) {
         util::Logger::warn("ArtworkWindow: Failed to decode jpeg");
         return result;
     }
 
+    // First full-resolution decode of this hash: generate the tiers now
+    // so every later session (and other dimensions this session) works
+    // from them. Tiers at or above the original size are skipped - the
+    // original is already cheap to decode then. Skipped entirely when
+    // cancelled mid-decode: a partial tier set would look complete to
+    // has(), so the next decode of this hash regenerates from scratch.
+    if (!hash.empty() && !thumbs.has(hash) && !decode_cancelled(request_generation)) {
+        int max_dim = std::max(w, h);
+        for (int tier : backend::ThumbnailStore::TIERS) {
+            if (tier >= max_dim) break;
+            float scale = static_cast<float>(tier) / max_dim;
+            int tw = std::max(1, static_cast<int>(w * scale));
+            int th = std::max(1, static_cast<int>(h * scale));
+            std::vector<uint8_t> tier_rgb(static_cast<size_t>(tw) * th * 3);
+            stbir_resize(pixels, w, h, 0, tier_rgb.data(), tw, th, 0,
+                         STBIR_RGB, STBIR_TYPE_UINT8, STBIR_EDGE_CLAMP, STBIR_FILTER_MITCHELL);
+            thumbs.store(hash, tier, tw, th, std::move(tier_rgb));
+        }
+    }
+
+    // Last phase boundary before the resize pass
+    if (decode_cancelled(request_generation)) {
+        stbi_image_free(pixels);
+        return result;
+    }
+
+    result = scale_to_target(pixels, w, h, target_w, target_h);
+    stbi_image_free(pixels);
+    return result;
+}
+
+ArtworkWindow::DecodeResult ArtworkWindow::scale_to_target(const unsigned char* pixels,
+                                                           int w, int h,
+                                                           int target_w, int target_h) {
+    DecodeResult result;
+    result.valid = false;
+
     // Check aspect ratio (>5% off from square needs letterboxing)
     float aspect_ratio = static_cast<float>(w) / static_cast<float>(h);
     bool needs_letterbox = (aspect_ratio < 0.95f || aspect_ratio > 1.05f);
@@ -617,13 +1023,13 @@ ArtworkWindow::DecodeResult ArtworkWindow::decode_jpeg(const std::vector<uint8_t
         int scaled_h = std::max(1, std::min(static_cast<int>(h * scale), target_h));
 
         // Resize to scaled dimensions
-        std::vector<unsigned char> scaled_rgb(scaled_w * scaled_h * 3);
+        auto scaled_rgb = pixel_pool_.acquire(static_cast<size_t>(scaled_w) * scaled_h * 3);
         stbir_resize(pixels, w, h, 0, scaled_rgb.data(), scaled_w, scaled_h, 0,
                      STBIR_RGB, STBIR_TYPE_UINT8, STBIR_EDGE_CLAMP, STBIR_FILTER_MITCHELL);
-        stbi_image_free(pixels);
 
         // Create RGBA canvas with transparent letterbox borders (alpha=0)
-        std::vector<unsigned char> rgba(target_w * target_h * 4, 0);
+        auto rgba = pixel_pool_.acquire(static_cast<size_t>(target_w) * target_h * 4);
+        std::memset(rgba.data(), 0, rgba.size());
 
         // Center the scaled image on transparent canvas
         int offset_x = (target_w - scaled_w) / 2;
@@ -639,6 +1045,8 @@ ArtworkWindow::DecodeResult ArtworkWindow::decode_jpeg(const std::vector<uint8_t
             }
         }
 
+        pixel_pool_.release(std::move(scaled_rgb));
+
         result.pixels = std::move(rgba);
         result.width = target_w;
         result.height = target_h;
@@ -646,10 +1054,9 @@ ArtworkWindow::DecodeResult ArtworkWindow::decode_jpeg(const std::vector<uint8_t
         result.valid = true;
     } else {
         // Square or nearly-square: direct resize to RGB
-        std::vector<unsigned char> output(target_w * target_h * 3);
+        auto output = pixel_pool_.acquire(static_cast<size_t>(target_w) * target_h * 3);
         stbir_resize(pixels, w, h, 0, output.data(), target_w, target_h, 0,
                      STBIR_RGB, STBIR_TYPE_UINT8, STBIR_EDGE_CLAMP, STBIR_FILTER_MITCHELL);
-        stbi_image_free(pixels);
 
         result.pixels = std::move(output);
         result.width = target_w;
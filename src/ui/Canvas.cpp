@@ -1,6 +1,8 @@
 #include "ui/Canvas.hpp"
+#include "ui/Formatting.hpp"
 #include <algorithm>
-#include <stdexcept>
+#include <cstdlib>
+#include <cstring>
 #include <wchar.h>
 
 namespace ouroboros::ui {
@@ -28,32 +30,274 @@ static int utf8_to_wchar(const char* s, size_t len, wchar_t* out) {
 }
 
 Canvas::Canvas(int width, int height) : width_(width), height_(height) {
-    buffer_.resize(width * height);
+    glyphs_.resize(static_cast<size_t>(width) * height);
+    styles_.resize(static_cast<size_t>(width) * height);
+    clear();
 }
 
-Cell& Canvas::at(int x, int y) {
-    if (!is_in_bounds(x, y)) {
-        static Cell dummy;
-        return dummy; 
+uint32_t Canvas::encode_glyph(std::string_view grapheme) {
+    if (grapheme.size() <= sizeof(uint32_t)) {
+        uint32_t word = 0;
+        if (!grapheme.empty()) {
+            std::memcpy(&word, grapheme.data(), grapheme.size());
+        }
+        return word;
+    }
+
+    // Rare >4-byte cluster: spill to the overflow table. Dedup by
+    // linear scan - the table holds a handful of entries per frame.
+    size_t idx = overflow_.size();
+    for (size_t i = 0; i < overflow_.size(); ++i) {
+        if (overflow_[i] == grapheme) {
+            idx = i;
+            break;
+        }
+    }
+    if (idx == overflow_.size()) {
+        overflow_.emplace_back(grapheme);
     }
-    return buffer_[y * width_ + x];
+
+    unsigned char bytes[4] = {
+        OVERFLOW_TAG,
+        static_cast<unsigned char>(idx & 0xFF),
+        static_cast<unsigned char>((idx >> 8) & 0xFF),
+        static_cast<unsigned char>((idx >> 16) & 0xFF),
+    };
+    uint32_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return word;
 }
 
-const Cell& Canvas::at(int x, int y) const {
-    if (!is_in_bounds(x, y)) {
-        static Cell dummy;
-        return dummy;
+std::string_view Canvas::decode_glyph(const uint32_t& word) const {
+    const char* bytes = reinterpret_cast<const char*>(&word);
+    if (is_overflow(word)) {
+        const unsigned char* b = reinterpret_cast<const unsigned char*>(bytes);
+        size_t idx = b[1] | (static_cast<size_t>(b[2]) << 8) |
+                     (static_cast<size_t>(b[3]) << 16);
+        return overflow_[idx];
+    }
+    size_t len = 0;
+    while (len < sizeof(uint32_t) && bytes[len] != '\0') len++;
+    return {bytes, len};
+}
+
+Cell Canvas::cell_at(int x, int y) const {
+    if (!is_in_bounds(x, y)) return Cell{};
+    size_t idx = static_cast<size_t>(y) * width_ + x;
+    return Cell{std::string(decode_glyph(glyphs_[idx])), styles_[idx]};
+}
+
+std::string_view Canvas::glyph_at(int x, int y) const {
+    if (!is_in_bounds(x, y)) return {};
+    return decode_glyph(glyphs_[static_cast<size_t>(y) * width_ + x]);
+}
+
+Style Canvas::style_at(int x, int y) const {
+    if (!is_in_bounds(x, y)) return {};
+    return styles_[static_cast<size_t>(y) * width_ + x];
+}
+
+bool Canvas::cell_differs(const Canvas& other, int x, int y) const {
+    if (other.width_ != width_ || other.height_ != height_) return true;
+    size_t idx = static_cast<size_t>(y) * width_ + x;
+    const uint32_t& a = glyphs_[idx];
+    const uint32_t& b = other.glyphs_[idx];
+
+    if (is_overflow(a) || is_overflow(b)) {
+        // Overflow table indices aren't stable across canvases;
+        // compare the text itself
+        if (decode_glyph(a) != other.decode_glyph(b)) return true;
+    } else if (a != b) {
+        return true;
+    }
+    return styles_[idx] != other.styles_[idx];
+}
+
+bool Canvas::row_differs(const Canvas& other, int y) const {
+    if (other.width_ != width_ || other.height_ != height_) return true;
+    if (y < 0 || y >= height_) return false;
+    size_t row = static_cast<size_t>(y) * width_;
+
+    if (std::memcmp(&glyphs_[row], &other.glyphs_[row],
+                    width_ * sizeof(uint32_t)) != 0) {
+        return true;
+    }
+    // Style padding bytes can differ between logically equal values; a
+    // mismatch here only costs a per-cell re-check, never a wrong skip
+    if (std::memcmp(&styles_[row], &other.styles_[row],
+                    width_ * sizeof(Style)) != 0) {
+        for (int x = 0; x < width_; ++x) {
+            if (styles_[row + x] != other.styles_[row + x]) return true;
+        }
+    }
+    // Words match, but overflow words carry table indices, not text -
+    // the tables themselves may differ between the two canvases
+    for (int x = 0; x < width_; ++x) {
+        const uint32_t& word = glyphs_[row + x];
+        if (is_overflow(word) &&
+            decode_glyph(word) != other.decode_glyph(other.glyphs_[row + x])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Canvas::changed_spans(const Canvas& other, int y,
+                           std::vector<std::pair<int, int>>& spans) const {
+    spans.clear();
+    if (other.width_ != width_ || other.height_ != height_) {
+        if (y >= 0 && y < height_ && width_ > 0) spans.emplace_back(0, width_);
+        return;
+    }
+    if (y < 0 || y >= height_) return;
+
+    const size_t row = static_cast<size_t>(y) * width_;
+    const uint32_t* ga = &glyphs_[row];
+    const uint32_t* gb = &other.glyphs_[row];
+    const Style* sa = &styles_[row];
+    const Style* sb = &other.styles_[row];
+
+    // Byte-equal block => logically equal, except overflow words, whose
+    // table indices aren't stable across canvases (same caveat as
+    // row_differs); a byte mismatch may still be style padding noise,
+    // which the per-cell check below dismisses
+    constexpr int BLOCK = 16;
+    auto block_clean = [&](int x) {
+        if (std::memcmp(ga + x, gb + x, BLOCK * sizeof(uint32_t)) != 0) return false;
+        if (std::memcmp(sa + x, sb + x, BLOCK * sizeof(Style)) != 0) return false;
+        for (int i = x; i < x + BLOCK; ++i) {
+            if (is_overflow(ga[i]) && decode_glyph(ga[i]) != other.decode_glyph(gb[i])) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto differs = [&](int i) {
+        if (is_overflow(ga[i]) || is_overflow(gb[i])) {
+            if (decode_glyph(ga[i]) != other.decode_glyph(gb[i])) return true;
+        } else if (ga[i] != gb[i]) {
+            return true;
+        }
+        return sa[i] != sb[i];
+    };
+
+    int x = 0;
+    while (x < width_) {
+        while (x + BLOCK <= width_ && block_clean(x)) x += BLOCK;
+        if (x >= width_) break;
+        if (!differs(x)) {
+            ++x;
+            continue;
+        }
+        int begin = x;
+        while (x < width_ && differs(x)) ++x;
+        spans.emplace_back(begin, x);
+    }
+}
+
+bool Canvas::span_matches(const Canvas& other, int y_this, int y_other,
+                          int x0, int x1) const {
+    if (other.width_ != width_) return false;
+    if (y_this < 0 || y_this >= height_) return false;
+    if (y_other < 0 || y_other >= other.height_) return false;
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, width_);
+    if (x0 >= x1) return true;
+
+    const size_t a = static_cast<size_t>(y_this) * width_ + x0;
+    const size_t b = static_cast<size_t>(y_other) * width_ + x0;
+    const size_t span = static_cast<size_t>(x1 - x0);
+
+    if (std::memcmp(&glyphs_[a], &other.glyphs_[b],
+                    span * sizeof(uint32_t)) != 0) {
+        // May still be logically equal if only overflow indices differ
+        for (size_t i = 0; i < span; ++i) {
+            const uint32_t& wa = glyphs_[a + i];
+            const uint32_t& wb = other.glyphs_[b + i];
+            if (is_overflow(wa) || is_overflow(wb)) {
+                if (decode_glyph(wa) != other.decode_glyph(wb)) return false;
+            } else if (wa != wb) {
+                return false;
+            }
+        }
+    } else {
+        // Byte-equal words, but overflow indices point at different tables
+        for (size_t i = 0; i < span; ++i) {
+            const uint32_t& word = glyphs_[a + i];
+            if (is_overflow(word) &&
+                decode_glyph(word) != other.decode_glyph(other.glyphs_[b + i])) {
+                return false;
+            }
+        }
+    }
+    // Style padding bytes can differ between logically equal values
+    if (std::memcmp(&styles_[a], &other.styles_[b],
+                    span * sizeof(Style)) != 0) {
+        for (size_t i = 0; i < span; ++i) {
+            if (styles_[a + i] != other.styles_[b + i]) return false;
+        }
+    }
+    return true;
+}
+
+void Canvas::scroll_rows(int top, int bottom, int delta) {
+    top = std::max(top, 0);
+    bottom = std::min(bottom, height_);
+    if (delta == 0 || top >= bottom) return;
+
+    const int region = bottom - top;
+    const int d = std::min(std::abs(delta), region);
+    const int moved = region - d;
+
+    if (moved > 0) {
+        // Rows are contiguous, so the whole shift is one memmove per
+        // array. Overflow indices reference our own table and survive.
+        const size_t src = static_cast<size_t>(delta > 0 ? top + d : top) * width_;
+        const size_t dst = static_cast<size_t>(delta > 0 ? top : top + d) * width_;
+        const size_t cells = static_cast<size_t>(moved) * width_;
+        std::memmove(&glyphs_[dst], &glyphs_[src], cells * sizeof(uint32_t));
+        std::memmove(&styles_[dst], &styles_[src], cells * sizeof(Style));
+    }
+
+    // The terminal fills exposed rows with default-style blanks; mirror that
+    const int blank_top = delta > 0 ? bottom - d : top;
+    const size_t idx = static_cast<size_t>(blank_top) * width_;
+    const size_t cells = static_cast<size_t>(d) * width_;
+    std::fill_n(&glyphs_[idx], cells, encode_glyph(" "));
+    std::fill_n(&styles_[idx], cells, Style{});
+}
+
+void Canvas::copy_row_from(const Canvas& other, int y) {
+    if (other.width_ != width_ || other.height_ != height_) return;
+    if (y < 0 || y >= height_) return;
+
+    const size_t row = static_cast<size_t>(y) * width_;
+    std::memcpy(&glyphs_[row], &other.glyphs_[row], width_ * sizeof(uint32_t));
+    std::memcpy(&styles_[row], &other.styles_[row], width_ * sizeof(Style));
+
+    // Copied overflow words index other's table; re-encode the text
+    // into this canvas's table so decode_glyph stays coherent
+    for (int x = 0; x < width_; ++x) {
+        uint32_t& word = glyphs_[row + x];
+        if (is_overflow(word)) {
+            word = encode_glyph(other.decode_glyph(other.glyphs_[row + x]));
+        }
     }
-    return buffer_[y * width_ + x];
 }
 
 void Canvas::clear(const Cell& fill_cell) {
-    std::fill(buffer_.begin(), buffer_.end(), fill_cell);
+    overflow_.clear();
+    uint32_t word = encode_glyph(fill_cell.content);
+    std::fill(glyphs_.begin(), glyphs_.end(), word);
+    std::fill(styles_.begin(), styles_.end(), fill_cell.style);
 }
 
-void Canvas::put(int x, int y, const std::string& grapheme, Style style) {
+void Canvas::put(int x, int y, std::string_view grapheme, Style style) {
     if (is_in_bounds(x, y)) {
-        buffer_[y * width_ + x] = Cell{grapheme, style};
+        size_t idx = static_cast<size_t>(y) * width_ + x;
+        glyphs_[idx] = encode_glyph(grapheme);
+        styles_[idx] = style;
     }
 }
 
@@ -61,12 +305,13 @@ void Canvas::resize(int width, int height) {
     if (width_ == width && height_ == height) return;
     width_ = width;
     height_ = height;
-    buffer_.clear();
-    buffer_.resize(width * height);
+    glyphs_.resize(static_cast<size_t>(width) * height);
+    styles_.resize(static_cast<size_t>(width) * height);
+    clear();
 }
 
 // Simple UTF-8 decoding helper to iterate characters
-// This is a naive implementation; a full grapheme cluster library is ideal 
+// This is a naive implementation; a full grapheme cluster library is ideal
 // but we stick to standard C++23 constraints and simple UTF-8.
 static size_t utf8_char_len(char c) {
     if ((c & 0x80) == 0) return 1;
@@ -91,7 +336,7 @@ int Canvas::draw_text(int x, int y, std::string_view text, Style initial_style)
 
     int current_x = x;
     Style current_style = initial_style;
-    
+
     size_t i = 0;
     while (i < text.length()) {
         if (current_x >= width_) break;
@@ -99,11 +344,11 @@ int Canvas::draw_text(int x, int y, std::string_view text, Style initial_style)
         // Check for ANSI escape sequence
         if (text[i] == '\033' && i + 1 < text.length() && text[i+1] == '[') {
             const char* p = text.data() + i + 2; // Skip \033[
-            
+
             // Parse parameters
             while (true) {
                 int code = parse_int(p);
-                
+
                 // Apply SGR code to current_style
                 switch (code) {
                     case 0: // Reset
@@ -171,18 +416,18 @@ int Canvas::draw_text(int x, int y, std::string_view text, Style initial_style)
                         }
                         break;
                 }
-                
+
                 if (*p == ';') {
                     p++; // Continue to next param
                 } else {
                     break; // End of sequence (usually 'm')
                 }
             }
-            
+
             // Skip until 'm' or end
             while (*p && *p != 'm') p++;
             if (*p == 'm') p++;
-            
+
             // Update index
             i = p - text.data();
             continue; // Don't draw anything for the escape code
@@ -191,18 +436,16 @@ int Canvas::draw_text(int x, int y, std::string_view text, Style initial_style)
         size_t len = utf8_char_len(text[i]);
         if (i + len > text.length()) break; // Incomplete char
 
-        std::string grapheme(text.substr(i, len));
-
-        // Get display width using wcwidth
+        // Get display width from the process-wide cache
         wchar_t wc;
         int char_width = 1;
         if (utf8_to_wchar(text.data() + i, len, &wc) > 0) {
-            int w = wcwidth(wc);
+            int w = codepoint_width(wc);
             if (w > 0) char_width = w;
         }
 
         if (current_x >= 0 && current_x < width_) {
-            put(current_x, y, grapheme, current_style);
+            put(current_x, y, text.substr(i, len), current_style);
 
             // For double-width characters, mark the next cell as continuation
             if (char_width == 2 && current_x + 1 < width_) {
@@ -239,12 +482,20 @@ void Canvas::draw_rect(int x, int y, int w, int h, Style style) {
 }
 
 void Canvas::fill_rect(int x, int y, int w, int h, const Cell& cell) {
-    for (int cy = y; cy < y + h; ++cy) {
-        for (int cx = x; cx < x + w; ++cx) {
-            if (is_in_bounds(cx, cy)) {
-                buffer_[cy * width_ + cx] = cell;
-            }
-        }
+    // Clamp once, then fill whole row segments: two contiguous fills
+    // per row (vector stores) instead of a bounds check per cell
+    int x0 = std::max(x, 0);
+    int x1 = std::min(x + w, width_);
+    int y0 = std::max(y, 0);
+    int y1 = std::min(y + h, height_);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    uint32_t word = encode_glyph(cell.content);
+    size_t span = static_cast<size_t>(x1 - x0);
+    for (int cy = y0; cy < y1; ++cy) {
+        size_t idx = static_cast<size_t>(cy) * width_ + x0;
+        std::fill_n(&glyphs_[idx], span, word);
+        std::fill_n(&styles_[idx], span, cell.style);
     }
 }
 
@@ -253,19 +504,31 @@ void Canvas::blit(const Canvas& source, int dest_x, int dest_y) {
 }
 
 void Canvas::blit(const Canvas& source, int dest_x, int dest_y, int src_x, int src_y, int w, int h) {
+    // Intersect the requested rectangle with both canvases up front so
+    // each row copies as one memcpy of glyph words plus one of styles
+    int lead = std::max({0, -src_x, -dest_x});
+    int dx0 = dest_x + lead;
+    int sx0 = src_x + lead;
+    int span = std::min({w - lead, source.width_ - sx0, width_ - dx0});
+    if (span <= 0) return;
+
     for (int dy = 0; dy < h; ++dy) {
-        for (int dx = 0; dx < w; ++dx) {
-            int sx = src_x + dx;
-            int sy = src_y + dy;
-            int tx = dest_x + dx;
-            int ty = dest_y + dy;
-
-            if (is_in_bounds(tx, ty)) {
-                // In C++23 we can access source safely if we trust caller or add bounds check
-                // For performance in inner loop, we do minimal checks
-                if (sx >= 0 && sx < source.width() && sy >= 0 && sy < source.height()) {
-                    buffer_[ty * width_ + tx] = source.at(sx, sy);
-                }
+        int sy = src_y + dy;
+        int ty = dest_y + dy;
+        if (sy < 0 || sy >= source.height_ || ty < 0 || ty >= height_) continue;
+
+        size_t sidx = static_cast<size_t>(sy) * source.width_ + sx0;
+        size_t tidx = static_cast<size_t>(ty) * width_ + dx0;
+        std::memcpy(&glyphs_[tidx], &source.glyphs_[sidx],
+                    static_cast<size_t>(span) * sizeof(uint32_t));
+        std::copy_n(&source.styles_[sidx], span, &styles_[tidx]);
+
+        // Overflow words carry indices into the SOURCE's table; re-home
+        // the rare cluster in ours after the bulk copy
+        for (int i = 0; i < span; ++i) {
+            uint32_t& word = glyphs_[tidx + i];
+            if (is_overflow(word)) {
+                word = encode_glyph(source.decode_glyph(source.glyphs_[sidx + i]));
             }
         }
     }
@@ -1,9 +1,104 @@
 #include "ui/Formatting.hpp"
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <wchar.h>
 
 namespace ouroboros::ui {
 
+// ═══ Compile-time SGR table ═══
+// The named-color style space is small and closed, so every escape the
+// flush path can emit (minus truecolor) is baked into .rodata at build
+// time. Index layout: (fg * 17 + bg) * 8 + attr bits, where the attr
+// bits are Bold|Dim|Underline - the three attributes the renderer
+// actually emits; Blink/Reverse/Hidden are masked off, matching the
+// old runtime formatter.
+namespace {
+
+constexpr int SGR_COLORS = 17;       // Default + 8 normal + 8 bright
+constexpr int SGR_ATTR_COMBOS = 8;   // Bold/Dim/Underline subsets
+constexpr size_t SGR_TABLE_SIZE =
+    static_cast<size_t>(SGR_COLORS) * SGR_COLORS * SGR_ATTR_COMBOS;
+
+constexpr void sgr_append_code(SgrSequence& s, int code) {
+    s.text[s.len++] = '\033';
+    s.text[s.len++] = '[';
+    if (code >= 100) s.text[s.len++] = static_cast<char>('0' + code / 100);
+    if (code >= 10) s.text[s.len++] = static_cast<char>('0' + (code / 10) % 10);
+    s.text[s.len++] = static_cast<char>('0' + code % 10);
+    s.text[s.len++] = 'm';
+}
+
+constexpr std::array<SgrSequence, SGR_TABLE_SIZE> build_sgr_table() {
+    std::array<SgrSequence, SGR_TABLE_SIZE> table{};
+    for (int fg = 0; fg < SGR_COLORS; ++fg) {
+        for (int bg = 0; bg < SGR_COLORS; ++bg) {
+            for (int a = 0; a < SGR_ATTR_COMBOS; ++a) {
+                SgrSequence& s =
+                    table[(static_cast<size_t>(fg) * SGR_COLORS + bg) * SGR_ATTR_COMBOS + a];
+                if (fg != 0) {
+                    int code = 30 + (fg - 1) % 8;
+                    if (fg > 8) code += 60;  // Bright colors
+                    sgr_append_code(s, code);
+                }
+                if (bg != 0) {
+                    int code = 40 + (bg - 1) % 8;
+                    if (bg > 8) code += 60;
+                    sgr_append_code(s, code);
+                }
+                if (a & static_cast<int>(Attribute::Bold)) sgr_append_code(s, 1);
+                if (a & static_cast<int>(Attribute::Dim)) sgr_append_code(s, 2);
+                if (a & static_cast<int>(Attribute::Underline)) sgr_append_code(s, 4);
+            }
+        }
+    }
+    return table;
+}
+
+constexpr auto SGR_TABLE = build_sgr_table();
+
+}  // namespace
+
+const SgrSequence* sgr_lookup(const Style& style) {
+    if (is_truecolor(style.fg) || is_truecolor(style.bg)) return nullptr;
+    const size_t attrs = static_cast<uint8_t>(style.attr) & (SGR_ATTR_COMBOS - 1);
+    const size_t idx = (static_cast<size_t>(style.fg) * SGR_COLORS +
+                        static_cast<size_t>(style.bg)) * SGR_ATTR_COMBOS + attrs;
+    return &SGR_TABLE[idx];
+}
+
+int codepoint_width(wchar_t wc) {
+    const uint32_t cp = static_cast<uint32_t>(wc);
+
+    // Hot range (ASCII, Latin-1, Latin Extended): flat table, filled
+    // once from wcwidth on first use
+    constexpr uint32_t FLAT_LIMIT = 0x300;
+    static const auto flat = [] {
+        std::array<int8_t, FLAT_LIMIT> table{};
+        for (uint32_t c = 0; c < FLAT_LIMIT; ++c) {
+            table[c] = static_cast<int8_t>(wcwidth(static_cast<wchar_t>(c)));
+        }
+        return table;
+    }();
+    if (cp < FLAT_LIMIT) return flat[cp];
+
+    // Long tail: direct-mapped cache of packed (codepoint, width+2)
+    // entries. One relaxed load serves a hit; a collision just
+    // recomputes and overwrites - no locks, safe from any thread.
+    constexpr uint32_t TAIL_SLOTS = 2048;  // Power of two
+    static std::array<std::atomic<uint32_t>, TAIL_SLOTS> tail{};
+    std::atomic<uint32_t>& slot = tail[cp & (TAIL_SLOTS - 1)];
+    const uint32_t entry = slot.load(std::memory_order_relaxed);
+    if ((entry >> 4) == cp) {
+        return static_cast<int>(entry & 0xF) - 2;
+    }
+    const int w = wcwidth(wc);
+    // width+2 is 1..4, so a populated entry is never the empty 0
+    slot.store((cp << 4) | static_cast<uint32_t>(w + 2), std::memory_order_relaxed);
+    return w;
+}
+
 // Helper: decode UTF-8 character to wchar_t, return bytes consumed (0 on error)
 static int utf8_to_wchar(const char* s, size_t len, wchar_t* out) {
     if (len == 0 || !s) return 0;
@@ -59,12 +154,12 @@ int display_cols(const std::string& s) {
             }
         }
 
-        // Decode UTF-8 and use wcwidth for proper display width
+        // Decode UTF-8 and use the cached width for proper display width
         wchar_t wc;
         int len = utf8_to_wchar(s.c_str() + i, s.size() - i, &wc);
         if (len > 0) {
-            int w = wcwidth(wc);
-            cols += (w > 0) ? w : 1;  // wcwidth returns -1 for non-printable, use 1
+            int w = codepoint_width(wc);
+            cols += (w > 0) ? w : 1;  // -1 for non-printable, use 1
             i += len;
         } else {
             // Invalid UTF-8, skip byte
@@ -120,7 +215,7 @@ std::string take_cols(const std::string& s, int cols) {
         wchar_t wc;
         int len = utf8_to_wchar(s.c_str() + i, s.size() - i, &wc);
         if (len > 0) {
-            int w = wcwidth(wc);
+            int w = codepoint_width(wc);
             if (w < 0) w = 1;  // Non-printable, assume 1
 
             // Don't exceed requested columns (important for wide chars)
@@ -2,14 +2,19 @@
 #include "ui/Terminal.hpp"
 #include <sstream>
 #include <fstream>
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <chrono>
+#include <filesystem>
+#include <optional>
 #include <vector>
 #include <unistd.h>
 #include <sys/ioctl.h>
 #include <cstdlib>
 #include <termios.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 
 // stb_image_resize2 for Sixel/iTerm2 resizing
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
@@ -19,6 +24,50 @@
 
 namespace ouroboros::ui {
 
+namespace {
+
+// Capability cache: each detection query below costs an escape write
+// plus a select() wait on the reply, paid on every launch even though
+// the terminal rarely changes. The detected protocol is persisted keyed
+// by the terminal-identity environment; a key match skips the round
+// trips entirely and a mismatch (different terminal, upgraded version)
+// re-runs the real detection.
+std::filesystem::path capability_cache_path() {
+    const char* home = std::getenv("HOME");
+    if (!home) return {};
+    return std::filesystem::path(home) / ".cache" / "ouroboros" / "termcaps.cache";
+}
+
+std::string capability_cache_key() {
+    auto env_or_empty = [](const char* name) {
+        const char* value = std::getenv(name);
+        return std::string(value ? value : "");
+    };
+    return "TERM=" + env_or_empty("TERM") +
+           "|PROG=" + env_or_empty("TERM_PROGRAM") +
+           "|VER=" + env_or_empty("TERM_PROGRAM_VERSION");
+}
+
+std::string protocol_name(ImageProtocol protocol) {
+    switch (protocol) {
+        case ImageProtocol::Kitty:  return "kitty";
+        case ImageProtocol::Sixel:  return "sixel";
+        case ImageProtocol::ITerm2: return "iterm2";
+        case ImageProtocol::None:   return "none";
+    }
+    return "none";
+}
+
+std::optional<ImageProtocol> protocol_from_name(const std::string& name) {
+    if (name == "kitty")  return ImageProtocol::Kitty;
+    if (name == "sixel")  return ImageProtocol::Sixel;
+    if (name == "iterm2") return ImageProtocol::ITerm2;
+    if (name == "none")   return ImageProtocol::None;
+    return std::nullopt;
+}
+
+}  // namespace
+
 ImageRenderer& ImageRenderer::instance() {
     static ImageRenderer instance;
     return instance;
@@ -58,27 +107,51 @@ void ImageRenderer::detect_protocol() {
         }
     }
 
-    if (query_kitty_support()) {
-        protocol_ = ImageProtocol::Kitty;
-        return;
+    // Cached detection: a stored result for this exact terminal identity
+    // answers without any escape round trip
+    const std::string cache_key = capability_cache_key();
+    const std::filesystem::path cache_path = capability_cache_path();
+    if (!cache_path.empty()) {
+        std::ifstream in(cache_path);
+        std::string stored_key, stored_name;
+        if (in && std::getline(in, stored_key) && std::getline(in, stored_name) &&
+            stored_key == cache_key) {
+            if (auto cached = protocol_from_name(stored_name)) {
+                protocol_ = *cached;
+                ouroboros::util::Logger::info(
+                    "ImageRenderer: Using cached protocol '" + stored_name + "'");
+                return;
+            }
+        }
     }
 
-    if (query_sixel_support()) {
+    if (query_kitty_support()) {
+        protocol_ = ImageProtocol::Kitty;
+    } else if (query_sixel_support()) {
         protocol_ = ImageProtocol::Sixel;
-        return;
-    }
-
-    std::string da1 = query_da1();
-
-    if (da1.find("iTerm") != std::string::npos) {
+    } else if (query_da1().find("iTerm") != std::string::npos) {
         protocol_ = ImageProtocol::ITerm2;
-        return;
+    } else {
+        protocol_ = ImageProtocol::None;
     }
 
-    protocol_ = ImageProtocol::None;
+    // Persist for the next launch in this terminal
+    if (!cache_path.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(cache_path.parent_path(), ec);
+        std::ofstream out(cache_path, std::ios::trunc);
+        if (out) {
+            out << cache_key << '\n' << protocol_name(protocol_) << '\n';
+        }
+    }
 }
 
 void ImageRenderer::detect_terminal_type() {
+    // Shared memory transmission only works when the terminal runs on
+    // this machine; over SSH the object names mean nothing to it
+    const bool local_session =
+        !std::getenv("SSH_CONNECTION") && !std::getenv("SSH_TTY");
+
     // 1. Check TERM_PROGRAM (most reliable for modern terminals)
     const char* term_prog = std::getenv("TERM_PROGRAM");
     if (term_prog) {
@@ -86,6 +159,7 @@ void ImageRenderer::detect_terminal_type() {
             terminal_type_ = TerminalType::Ghostty;
             terminal_respects_image_ids_ = false;
             terminal_supports_temp_file_ = false;
+            terminal_supports_shm_ = local_session;
             ouroboros::util::Logger::info("ImageRenderer: Detected Ghostty terminal");
             return;
         }
@@ -96,6 +170,7 @@ void ImageRenderer::detect_terminal_type() {
         terminal_type_ = TerminalType::Kitty;
         terminal_respects_image_ids_ = true;
         terminal_supports_temp_file_ = true;
+        terminal_supports_shm_ = local_session;
         ouroboros::util::Logger::info("ImageRenderer: Detected Kitty terminal");
         return;
     }
@@ -109,6 +184,7 @@ void ImageRenderer::detect_terminal_type() {
             terminal_type_ = TerminalType::Ghostty;
             terminal_respects_image_ids_ = false;
             terminal_supports_temp_file_ = false;
+            terminal_supports_shm_ = local_session;
             ouroboros::util::Logger::info("ImageRenderer: Detected Ghostty terminal via TERM");
             return;
         }
@@ -117,12 +193,15 @@ void ImageRenderer::detect_terminal_type() {
             terminal_type_ = TerminalType::Kitty;
             terminal_respects_image_ids_ = true;
             terminal_supports_temp_file_ = true;
+            terminal_supports_shm_ = local_session;
             ouroboros::util::Logger::info("ImageRenderer: Detected Kitty terminal via TERM");
             return;
         }
     }
 
-    // 4. Default: assume Other terminal with standard behavior
+    // 4. Default: assume Other terminal with standard behavior.
+    // t=s stays off: terminals that merely emulate the Kitty protocol
+    // (WezTerm etc.) often skip the shared memory mode.
     terminal_type_ = TerminalType::Other;
     terminal_respects_image_ids_ = true;
     terminal_supports_temp_file_ = true;
@@ -362,12 +441,39 @@ uint32_t ImageRenderer::render_image(
         }
     }
 
+    const bool cropped = (visible_rows > 0 && visible_rows < height_rows);
+
     if (protocol_ == ImageProtocol::Kitty) {
-        encoded = render_kitty(data, render_size, width_cols, render_rows, data_hash, content_hash, out_id, format);
+        // Placement reuse: if this image's pixel data is already
+        // resident in the terminal at the right size, re-show it with a
+        // tiny a=p escape instead of re-uploading. Cropped renders
+        // (grid bottom edge) always retransmit - the resident data is
+        // the full image and r= would squash it rather than crop.
+        uint32_t size_key = (static_cast<uint32_t>(width_cols) << 16) |
+                            static_cast<uint32_t>(height_rows & 0xFFFF);
+        if (!cropped && expected_id != 0) {
+            auto it = transmitted_data_.find(expected_id);
+            if (it != transmitted_data_.end() && it->second == size_key) {
+                encoded = place_kitty(expected_id, width_cols, height_rows);
+                out_id = expected_id;
+                note_transmitted(expected_id, width_cols, height_rows);
+            }
+        }
+
+        if (encoded.empty()) {
+            encoded = render_kitty(data, render_size, width_cols, render_rows, data_hash, content_hash, out_id, format);
+            if (out_id != 0 && expected_id != 0 && !cropped) {
+                note_transmitted(out_id, width_cols, height_rows);
+            } else if (out_id != 0) {
+                // A cropped upload replaced any resident full-size data
+                // under this id; drop it from the reuse cache
+                transmitted_data_.erase(out_id);
+            }
+        }
     } else if (protocol_ == ImageProtocol::ITerm2) {
         encoded = render_iterm2(data, data_width, data_height, width_cols, render_rows);
     } else if (protocol_ == ImageProtocol::Sixel) {
-        encoded = render_sixel(data, data_width, data_height, width_cols, render_rows);
+        encoded = render_sixel(data, data_width, data_height, width_cols, render_rows, content_hash);
     }
 
     if (!encoded.empty()) {
@@ -405,8 +511,6 @@ void ImageRenderer::delete_image(const std::string& content_hash) {
 void ImageRenderer::delete_image_by_id(uint32_t image_id) {
     if (protocol_ != ImageProtocol::Kitty || image_id == 0) return;
 
-    transmitted_ids_.erase(image_id);
-
     for (auto it = displayed_at_position_.begin(); it != displayed_at_position_.end(); ) {
         if (it->second == image_id) {
             it = displayed_at_position_.erase(it);
@@ -415,6 +519,10 @@ void ImageRenderer::delete_image_by_id(uint32_t image_id) {
         }
     }
 
+    // Lowercase d=i removes this image's placements but leaves the
+    // transmitted pixel data resident, so re-showing it later (scroll
+    // back, filter cleared) is a placement escape, not a re-upload.
+    // Eviction of the data itself is note_transmitted's job.
     auto& term = Terminal::instance();
     std::string cmd = "\033_Ga=d,d=i,i=" + std::to_string(image_id) + "\033\\";
     term.write_raw(cmd);
@@ -426,8 +534,9 @@ void ImageRenderer::clear_image(int x, int y, int width_cols, int height_rows) {
     auto& term = Terminal::instance();
 
     if (protocol_ == ImageProtocol::Kitty) {
+        // Lowercase a=d clears every placement but keeps transmitted
+        // data resident for placement reuse on the next view
         term.write_raw("\033_Ga=d\033\\");
-        transmitted_ids_.clear();
         displayed_at_position_.clear();
     } else {
         for (int row = 0; row < height_rows; ++row) {
@@ -438,33 +547,104 @@ void ImageRenderer::clear_image(int x, int y, int width_cols, int height_rows) {
 }
 
 std::string ImageRenderer::rgb_to_sixel(const unsigned char* rgb, int w, int h) {
-    std::ostringstream ss;
-    ss << "\033Pq";
-    ss << "\"1;1";
-    ss << "#0;2;0;0;0";
-    ss << "#1;2;100;100;100";
+    // 6x6x6 color cube (216 registers). Quantization to a uniform cube
+    // is a closed-form nearest-color lookup - three shifts per pixel
+    // instead of a distance search over the palette.
+    std::string out;
+    out.reserve(static_cast<size_t>(w) * ((h + 5) / 6) / 2 + 4096);
+    out += "\033Pq\"1;1";
+
+    char reg[32];
+    for (int i = 0; i < 216; ++i) {
+        int r = i / 36, g = (i / 6) % 6, b = i % 6;
+        std::snprintf(reg, sizeof(reg), "#%d;2;%d;%d;%d", i, r * 20, g * 20, b * 20);
+        out += reg;
+    }
+
+    std::vector<uint8_t> band_idx(static_cast<size_t>(w) * 6);
 
     for (int y = 0; y < h; y += 6) {
-        ss << "#1";
-        for (int x = 0; x < w; ++x) {
-            unsigned char mask = 0;
-            for (int dy = 0; dy < 6 && (y + dy) < h; ++dy) {
-                int idx = ((y + dy) * w + x) * 3;
-                int lum = (rgb[idx] * 299 + rgb[idx+1] * 587 + rgb[idx+2] * 114) / 1000;
-                if (lum > 127) mask |= (1 << dy);
+        int band_h = std::min(6, h - y);
+
+        // Quantize the band once and note which registers it uses
+        bool used[216] = {};
+        for (int dy = 0; dy < band_h; ++dy) {
+            const unsigned char* row = rgb + (static_cast<size_t>(y + dy) * w) * 3;
+            uint8_t* dst = band_idx.data() + static_cast<size_t>(dy) * w;
+            for (int x = 0; x < w; ++x) {
+                int r = (row[x * 3] * 6) >> 8;
+                int g = (row[x * 3 + 1] * 6) >> 8;
+                int b = (row[x * 3 + 2] * 6) >> 8;
+                uint8_t idx = static_cast<uint8_t>(r * 36 + g * 6 + b);
+                dst[x] = idx;
+                used[idx] = true;
             }
-            ss << (char)(63 + mask);
         }
-        ss << "$-";
+
+        // One pass per register used in this band, run-length encoded
+        bool first_color = true;
+        for (int color = 0; color < 216; ++color) {
+            if (!used[color]) continue;
+            if (!first_color) out += '$';  // Carriage return within band
+            first_color = false;
+
+            out += '#';
+            out += std::to_string(color);
+
+            int run_len = 0;
+            char run_ch = 0;
+            for (int x = 0; x < w; ++x) {
+                unsigned char mask = 0;
+                for (int dy = 0; dy < band_h; ++dy) {
+                    if (band_idx[static_cast<size_t>(dy) * w + x] == color) {
+                        mask |= (1 << dy);
+                    }
+                }
+                char ch = static_cast<char>(63 + mask);
+                if (ch == run_ch) {
+                    ++run_len;
+                    continue;
+                }
+                if (run_len > 3) {
+                    out += '!';
+                    out += std::to_string(run_len);
+                    out += run_ch;
+                } else {
+                    for (int i = 0; i < run_len; ++i) out += run_ch;
+                }
+                run_ch = ch;
+                run_len = 1;
+            }
+            if (run_len > 3) {
+                out += '!';
+                out += std::to_string(run_len);
+                out += run_ch;
+            } else {
+                for (int i = 0; i < run_len; ++i) out += run_ch;
+            }
+        }
+        out += '-';  // Next band
     }
-    ss << "\033\\";
-    return ss.str();
+    out += "\033\\";
+    return out;
 }
 
-std::string ImageRenderer::render_sixel(const unsigned char* data, int w, int h, int cols, int rows) {
+std::string ImageRenderer::render_sixel(const unsigned char* data, int w, int h, int cols, int rows,
+                                        const std::string& content_hash) {
     int target_w = cols * cell_width_;
     int target_h = rows * cell_height_;
 
+    // Quantize+encode once per (content, size); re-displaying the same
+    // artwork replays the cached payload
+    std::string cache_key;
+    if (!content_hash.empty()) {
+        cache_key = content_hash + ":" + std::to_string(cols) + "x" + std::to_string(rows);
+        auto it = sixel_cache_.find(cache_key);
+        if (it != sixel_cache_.end()) {
+            return it->second;
+        }
+    }
+
     // Resize if needed
     std::vector<unsigned char> resized;
     const unsigned char* rgb_data = data;
@@ -474,7 +654,20 @@ std::string ImageRenderer::render_sixel(const unsigned char* data, int w, int h,
         rgb_data = resized.data();
     }
 
-    return rgb_to_sixel(rgb_data, target_w, target_h);
+    std::string payload = rgb_to_sixel(rgb_data, target_w, target_h);
+
+    if (!cache_key.empty()) {
+        // Oldest-first eviction keeps the cache bounded; payloads are
+        // a few hundred KB each at NowPlaying sizes
+        if (sixel_cache_order_.size() >= SIXEL_CACHE_ENTRIES) {
+            sixel_cache_.erase(sixel_cache_order_.front());
+            sixel_cache_order_.pop_front();
+        }
+        sixel_cache_[cache_key] = payload;
+        sixel_cache_order_.push_back(std::move(cache_key));
+    }
+
+    return payload;
 }
 
 std::string ImageRenderer::write_to_temp_file(const unsigned char* data, size_t len) {
@@ -527,6 +720,55 @@ std::string ImageRenderer::write_to_temp_file(const unsigned char* data, size_t
     );
 }
 
+std::string ImageRenderer::write_to_shm(const unsigned char* data, size_t len) {
+    // The terminal shm_unlinks the object after reading (t=s contract),
+    // but clean up stragglers ourselves like write_to_temp_file does in
+    // case a transmission gets dropped
+    static std::vector<std::pair<std::string, std::chrono::steady_clock::time_point>> pending_objects;
+    static uint32_t shm_counter = 0;
+
+    auto now = std::chrono::steady_clock::now();
+    auto cutoff = now - std::chrono::milliseconds(500);
+
+    auto it = pending_objects.begin();
+    while (it != pending_objects.end()) {
+        if (it->second < cutoff) {
+            shm_unlink(it->first.c_str());
+            it = pending_objects.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    std::string name = "/ouroboros-art-" + std::to_string(getpid()) + "-" +
+                       std::to_string(shm_counter++);
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd == -1) {
+        ouroboros::util::Logger::error("ImageRenderer: shm_open failed for " + name);
+        return "";
+    }
+
+    size_t written = 0;
+    while (written < len) {
+        ssize_t ret = write(fd, data + written, len - written);
+        if (ret < 0) {
+            ouroboros::util::Logger::error("ImageRenderer: Failed to write shm object");
+            close(fd);
+            shm_unlink(name.c_str());
+            return "";
+        }
+        written += ret;
+    }
+
+    close(fd);
+    pending_objects.emplace_back(name, std::chrono::steady_clock::now());
+
+    return encode_base64(
+        reinterpret_cast<const unsigned char*>(name.c_str()),
+        name.length()
+    );
+}
+
 std::string ImageRenderer::render_kitty(const unsigned char* data, size_t len, int cols, int rows, size_t data_hash, const std::string& content_hash, uint32_t& out_id, CachedFormat format) {
     int img_w = cols * cell_width_;
     int img_h = rows * cell_height_;
@@ -551,7 +793,35 @@ std::string ImageRenderer::render_kitty(const unsigned char* data, size_t len, i
         ss << "\033_G";
     }
 
-    if (terminal_supports_temp_file_) {
+    if (terminal_supports_shm_) {
+        // Shared memory transmission: the escape sequence carries only
+        // the object name, so a full-screen image costs a memcpy into
+        // shm instead of megabytes of base64 through the PTY
+        std::string b64_name = write_to_shm(data, len);
+        if (b64_name.empty()) {
+            return "";
+        }
+
+        if (format == CachedFormat::PNG) {
+            ss << "a=T,t=s,f=100,i=" << image_id
+               << ",c=" << cols << ",r=" << rows
+               << ",q=1,z=1,C=1";
+        } else {
+            int f = (format == CachedFormat::RGBA) ? 32 : 24;
+            ss << "a=T,t=s,f=" << f << ",i=" << image_id
+               << ",s=" << img_w << ",v=" << img_h
+               << ",c=" << cols << ",r=" << rows
+               << ",q=1,z=1,C=1";
+        }
+        ss << ";";
+        ss << b64_name;
+
+        std::string format_str = (format == CachedFormat::PNG) ? "PNG" : (format == CachedFormat::RGBA) ? "RGBA" : "RGB";
+        std::string hash_info = content_hash.empty() ? "ptr-hash" : ("SHA-256: " + content_hash.substr(0, 8) + "...");
+        ouroboros::util::Logger::debug("ImageRenderer: Uploaded via shared memory (t=s), format=" + format_str +
+                                       ", image_id=" + std::to_string(image_id) +
+                                       " (" + hash_info + ")");
+    } else if (terminal_supports_temp_file_) {
         std::string b64_path = write_to_temp_file(data, len);
         if (b64_path.empty()) {
             return "";
@@ -609,6 +879,60 @@ std::string ImageRenderer::render_kitty(const unsigned char* data, size_t len, i
     return ss.str();
 }
 
+std::string ImageRenderer::place_kitty(uint32_t image_id, int cols, int rows) {
+    static bool in_tmux = (std::getenv("TMUX") != nullptr);
+
+    std::ostringstream ss;
+    ss << (in_tmux ? "\033Ptmux;\033\033_G" : "\033_G");
+    ss << "a=p,i=" << image_id
+       << ",c=" << cols << ",r=" << rows
+       << ",q=1,z=1,C=1";
+    ss << (in_tmux ? "\033\033\\\033\\" : "\033\\");
+    return ss.str();
+}
+
+void ImageRenderer::note_transmitted(uint32_t image_id, int cols, int rows) {
+    uint32_t size_key = (static_cast<uint32_t>(cols) << 16) |
+                        static_cast<uint32_t>(rows & 0xFFFF);
+
+    auto it = transmitted_data_.find(image_id);
+    if (it != transmitted_data_.end()) {
+        it->second = size_key;
+        auto pos = std::find(transmitted_order_.begin(), transmitted_order_.end(), image_id);
+        if (pos != transmitted_order_.end()) transmitted_order_.erase(pos);
+        transmitted_order_.push_back(image_id);
+        return;
+    }
+
+    // Evict oldest resident images past the cap with d=I (frees the
+    // terminal's copy of the data). Ids still on screen are skipped -
+    // freeing one would blank its cells - so scan each entry at most
+    // once per insertion.
+    auto& term = Terminal::instance();
+    size_t scanned = 0;
+    const size_t scan_limit = transmitted_order_.size();
+    while (transmitted_data_.size() >= KITTY_DATA_CACHE_ENTRIES &&
+           scanned++ < scan_limit && !transmitted_order_.empty()) {
+        uint32_t victim = transmitted_order_.front();
+        transmitted_order_.pop_front();
+
+        bool on_screen = false;
+        for (const auto& [pos_key, id] : displayed_at_position_) {
+            if (id == victim) { on_screen = true; break; }
+        }
+        if (on_screen) {
+            transmitted_order_.push_back(victim);
+            continue;
+        }
+
+        transmitted_data_.erase(victim);
+        term.write_raw("\033_Ga=d,d=I,i=" + std::to_string(victim) + "\033\\");
+    }
+
+    transmitted_data_[image_id] = size_key;
+    transmitted_order_.push_back(image_id);
+}
+
 std::string ImageRenderer::render_iterm2(const unsigned char* data, int w, int h, int cols, int rows) {
     int target_w = cols * cell_width_;
     int target_h = rows * cell_height_;
@@ -6,8 +6,12 @@
 #include "ui/InputEvent.hpp"
 #include "events/EventBus.hpp"
 #include "config/UIConfig.hpp"
+#include "util/FrameArena.hpp"
 #include "util/Logger.hpp"
+#include "util/PerfCounters.hpp"
 #include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <format>
 #include <fstream>
 #include <utility>
@@ -60,6 +64,18 @@ namespace {
             default: std::unreachable();
         }
     }
+
+    // Per-frame render budget. Half of the 16ms input-burst poll tick
+    // (see main's adaptive pacing), leaving the other half for the
+    // image passes and the next poll. A frame that can't diff and emit
+    // everything in time ships what it has and defers the rest - the
+    // deferred rows are caught up within a tick or two, and the input
+    // the user is waiting on never queues behind a wall of escapes.
+    constexpr auto FRAME_BUDGET = std::chrono::milliseconds(8);
+
+    // Clock-probe stride for the flush loop: a steady_clock read per
+    // row would cost more than the memcmps on a clean row
+    constexpr int DEADLINE_CHECK_ROWS = 8;
 }
 
 Renderer::Renderer(std::shared_ptr<backend::SnapshotPublisher> publisher)
@@ -72,6 +88,7 @@ Renderer::Renderer(std::shared_ptr<backend::SnapshotPublisher> publisher)
     queue_ = std::make_unique<widgets::Queue>();
     album_browser_ = std::make_unique<widgets::AlbumBrowser>();
     help_overlay_ = std::make_unique<widgets::HelpOverlay>();
+    perf_hud_ = std::make_unique<widgets::PerfHud>();
     global_search_box_ = std::make_unique<widgets::SearchBox>();
 
     // Initialize image renderer
@@ -82,6 +99,17 @@ Renderer::Renderer(std::shared_ptr<backend::SnapshotPublisher> publisher)
 Renderer::~Renderer() = default;
 
 void Renderer::compute_layout(int cols, int rows) {
+    // Memoized: terminal size and the album-view flag are the only
+    // inputs (widget constraints are constant), so the flex pass runs
+    // on resize and view toggles, not every frame
+    if (cols == layout_cols_ && rows == layout_rows_ &&
+        show_album_view_ == layout_album_view_) {
+        return;
+    }
+    layout_cols_ = cols;
+    layout_rows_ = rows;
+    layout_album_view_ = show_album_view_;
+
     // RESPONSIVE LAYOUT: Adapts to terminal size like mobile/desktop web
 
     // Content area fills entire screen
@@ -190,77 +218,257 @@ void Renderer::render_search_overlay(const LayoutRect& rect, const model::Snapsh
     global_search_box_->render(canvas_, search_rect, snap);
 }
 
-void Renderer::flush_canvas() {
+void Renderer::flush_canvas(std::chrono::steady_clock::time_point deadline) {
     auto& terminal = Terminal::instance();
 
-    // OPTIMIZATION: Only update changed cells
-    for (int y = 0; y < canvas_.height(); ++y) {
-        for (int x = 0; x < canvas_.width(); ++x) {
-            const auto& cell = canvas_.at(x, y);
-            const auto& prev = prev_canvas_.at(x, y);
-
-            if (cell != prev) {
-                terminal.move_cursor(x, y);
-
-                // Convert Style to ANSI codes and print
-                std::string output;
-
-                // Foreground color
-                if (cell.style.fg != Color::Default) {
-                    if (is_truecolor(cell.style.fg)) {
-                        output += std::format("\033[38;2;{};{};{}m",
-                            color_r(cell.style.fg), color_g(cell.style.fg), color_b(cell.style.fg));
-                    } else {
-                        int fg_code = 30 + (static_cast<int>(cell.style.fg) - 1) % 8;
-                        if (static_cast<int>(cell.style.fg) > 8) {
-                            fg_code += 60;  // Bright colors
-                        }
-                        output += "\033[" + std::to_string(fg_code) + "m";
-                    }
-                }
+    // OPTIMIZATION: Only update changed cells, coalesced into runs.
+    // Consecutive changed cells sharing a style become one cursor move
+    // + one SGR + one text run, the whole frame accumulates in a single
+    // arena-backed buffer, and one write_raw hands it to the writer -
+    // previously every changed cell enqueued its own move and
+    // SGR+glyph+reset strings. All composition goes through the frame
+    // arena - the steady-state loop does zero heap allocation.
+    util::ArenaString output = util::make_arena_string();
+
+    // Convert Style to ANSI SGR codes; returns whether anything was
+    // emitted (a run of default-styled text needs no trailing reset)
+    auto append_sgr = [&output](const Style& style) -> bool {
+        // Named-color styles hit the compile-time table: one index, one
+        // memcpy, zero digit formatting. Only truecolor falls through.
+        if (const SgrSequence* seq = sgr_lookup(style)) {
+            output.append(seq->text, seq->len);
+            return seq->len != 0;
+        }
 
-                // Background color
-                if (cell.style.bg != Color::Default) {
-                    if (is_truecolor(cell.style.bg)) {
-                        output += std::format("\033[48;2;{};{};{}m",
-                            color_r(cell.style.bg), color_g(cell.style.bg), color_b(cell.style.bg));
-                    } else {
-                        int bg_code = 40 + (static_cast<int>(cell.style.bg) - 1) % 8;
-                        if (static_cast<int>(cell.style.bg) > 8) {
-                            bg_code += 60;
-                        }
-                        output += "\033[" + std::to_string(bg_code) + "m";
-                    }
+        bool styled = false;
+
+        // Foreground color
+        if (style.fg != Color::Default) {
+            styled = true;
+            if (is_truecolor(style.fg)) {
+                output += "\033[38;2;";
+                util::append_int(output, color_r(style.fg));
+                output += ';';
+                util::append_int(output, color_g(style.fg));
+                output += ';';
+                util::append_int(output, color_b(style.fg));
+                output += 'm';
+            } else {
+                int fg_code = 30 + (static_cast<int>(style.fg) - 1) % 8;
+                if (static_cast<int>(style.fg) > 8) {
+                    fg_code += 60;  // Bright colors
                 }
+                output += "\033[";
+                util::append_int(output, fg_code);
+                output += 'm';
+            }
+        }
 
-                // Attributes
-                if (has_attribute(cell.style.attr, Attribute::Bold)) {
-                    output += "\033[1m";
-                }
-                if (has_attribute(cell.style.attr, Attribute::Dim)) {
-                    output += "\033[2m";
+        // Background color
+        if (style.bg != Color::Default) {
+            styled = true;
+            if (is_truecolor(style.bg)) {
+                output += "\033[48;2;";
+                util::append_int(output, color_r(style.bg));
+                output += ';';
+                util::append_int(output, color_g(style.bg));
+                output += ';';
+                util::append_int(output, color_b(style.bg));
+                output += 'm';
+            } else {
+                int bg_code = 40 + (static_cast<int>(style.bg) - 1) % 8;
+                if (static_cast<int>(style.bg) > 8) {
+                    bg_code += 60;
                 }
-                if (has_attribute(cell.style.attr, Attribute::Underline)) {
-                    output += "\033[4m";
+                output += "\033[";
+                util::append_int(output, bg_code);
+                output += 'm';
+            }
+        }
+
+        // Attributes
+        if (has_attribute(style.attr, Attribute::Bold)) {
+            styled = true;
+            output += "\033[1m";
+        }
+        if (has_attribute(style.attr, Attribute::Dim)) {
+            styled = true;
+            output += "\033[2m";
+        }
+        if (has_attribute(style.attr, Attribute::Underline)) {
+            styled = true;
+            output += "\033[4m";
+        }
+        return styled;
+    };
+
+    // Damage spans per row: clean stretches are dismissed by block
+    // compares inside changed_spans (an empty result is a clean row),
+    // so the per-cell work below only ever touches changed cells.
+    // Each emitted row is committed to prev_canvas_ individually -
+    // rows the deadline cuts off below keep their old cells and stay
+    // dirty for the next diff.
+    // Phase accounting for the HUD: emission time is clocked per
+    // DAMAGED row only (clean rows stay clock-free, same frugality as
+    // the deadline stride), and whatever else the flush spent before
+    // the write is the damage scan
+    const auto flush_start = std::chrono::steady_clock::now();
+    uint64_t emit_ns = 0;
+
+    std::vector<std::pair<int, int>> spans;
+    auto flush_row = [&](int y) {
+        canvas_.changed_spans(prev_canvas_, y, spans);
+        if (spans.empty()) return;
+        const auto emit_start = std::chrono::steady_clock::now();
+
+        for (const auto& [span_begin, span_end] : spans) {
+            int x = span_begin;
+            while (x < span_end) {
+                // Start of a run: one cursor move + one SGR for every
+                // consecutive changed cell with this style
+                const Style run_style = canvas_.style_at(x, y);
+                output += "\033[";
+                util::append_int(output, y + 1);
+                output += ';';
+                util::append_int(output, x + 1);
+                output += 'H';
+                bool styled = append_sgr(run_style);
+
+                while (x < span_end && canvas_.style_at(x, y) == run_style) {
+                    output += canvas_.glyph_at(x, y);
+                    ++x;
                 }
 
-                output += cell.content;
-                output += "\033[0m";  // Reset
+                if (styled) output += "\033[0m";  // Reset
+            }
+        }
+        prev_canvas_.copy_row_from(canvas_, y);
+        emit_ns += static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - emit_start).count());
+    };
 
-                terminal.print(x, y, output);
+    const int height = canvas_.height();
+
+    // SCROLLED-REGION FAST PATH: when a list viewport moved, the cell
+    // diff degenerates to full-region emission - every row changed. If
+    // the row compare confirms the region really is last frame's cells
+    // displaced by the reported delta, emit one DECSTBM scroll and let
+    // the diff below pick up only the newly exposed rows. The terminal
+    // scrolls full-width lines, so prev_canvas_ mirrors the shift across
+    // the whole row and the ordinary diff repairs whatever the scroll
+    // dragged along outside the widget (side panes, borders) - correct
+    // on any terminal, profitable when the widget owns most of the width.
+    for (const auto& hint : scroll_hints_) {
+        int top = std::clamp(hint.top, 0, height);
+        int bottom = std::clamp(hint.bottom, top, height);
+        // Kitty/sixel artwork scrolls along with the text it overlaps;
+        // keep the margins below the NowPlaying art so images never move
+        if (ImageRenderer::instance().images_supported()) {
+            top = std::max(top, header_rect_.y + header_rect_.height);
+        }
+        const int region = bottom - top;
+        const int d = std::abs(hint.delta);
+        if (d == 0 || d >= region) continue;
+        // Side-pane repairs eat the savings when the scrolled widget
+        // doesn't own most of the terminal width
+        if ((hint.right - hint.left) * 2 < canvas_.width()) continue;
+
+        // The shift is real if almost every row in the region matches
+        // last frame's cells displaced by delta over the widget's own
+        // columns; the slack covers the selection bar having moved
+        int mismatches = 0;
+        const int allowed = region / 8 + 2;
+        for (int y = top; y < bottom - d && mismatches <= allowed; ++y) {
+            const int y_new = hint.delta > 0 ? y : y + d;
+            const int y_old = hint.delta > 0 ? y + d : y;
+            if (!canvas_.span_matches(prev_canvas_, y_new, y_old,
+                                      hint.left, hint.right)) {
+                ++mismatches;
             }
         }
+        if (mismatches > allowed) continue;
+
+        // One scroll escape: reset SGR (CSI S fills with the current
+        // background), set margins, scroll, reset margins
+        output += "\033[0m\033[";
+        util::append_int(output, top + 1);
+        output += ';';
+        util::append_int(output, bottom);
+        output += "r\033[";
+        util::append_int(output, d);
+        output += hint.delta > 0 ? 'S' : 'T';
+        output += "\033[r";
+
+        // Mirror what the terminal now shows; the exposed rows and the
+        // dragged side-pane columns fall out of the diff as usual
+        prev_canvas_.scroll_rows(top, bottom, hint.delta);
+    }
+    scroll_hints_.clear();
+
+    // Input echo ships regardless of budget: the search box is the one
+    // region where the user watches their own keystrokes, and a
+    // deferred echo reads as dropped input
+    int echo_begin = height, echo_end = height;
+    if (focus_ == Focus::Search) {
+        echo_begin = std::clamp(browser_rect_.y + browser_rect_.height - 3, 0, height);
+        echo_end = std::clamp(echo_begin + 3, echo_begin, height);
+        for (int y = echo_begin; y < echo_end; ++y) {
+            flush_row(y);
+        }
+    }
+
+    // Body rows resume where the last partial flush stopped and wrap,
+    // so a deferred region is first in line next frame instead of the
+    // top of the screen starving the bottom under sustained load
+    if (flush_resume_row_ >= height) flush_resume_row_ = 0;
+    bool deferred = false;
+    int rows_done = 0;
+    for (int i = 0; i < height; ++i) {
+        const int y = (flush_resume_row_ + i) % height;
+        if (y >= echo_begin && y < echo_end) continue;  // Already shipped
+        flush_row(y);
+
+        if (++rows_done % DEADLINE_CHECK_ROWS == 0 &&
+            std::chrono::steady_clock::now() >= deadline && i + 1 < height) {
+            flush_resume_row_ = (y + 1) % height;
+            deferred = true;
+            break;
+        }
     }
+    flush_incomplete_ = deferred;
+    if (!deferred) flush_resume_row_ = 0;
 
+    const auto write_start = std::chrono::steady_clock::now();
+    if (!output.empty()) {
+        terminal.write_raw(output);
+    }
     terminal.flush();
 
-    // Save for next diff
-    prev_canvas_ = canvas_;
+    auto& pc = util::PerfCounters::instance();
+    const uint64_t total_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            write_start - flush_start).count());
+    pc.flush_emit.record(emit_ns);
+    pc.flush_diff.record(total_ns > emit_ns ? total_ns - emit_ns : 0);
+    pc.flush_write.record(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - write_start).count()));
+
+    // Frame over: recycle everything allocated from the arena this frame
+    util::frame_arena().reset();
 }
 
 void Renderer::render(bool force_redraw) {
     if (!publisher_) return;
 
+    // Wait-free frame-time probe feeding the perf HUD
+    util::ScopedTimer frame_timer(util::PerfCounters::instance().frame_render);
+
+    // Deadline for this frame: composition runs to completion (widgets
+    // draw into the canvas, not the terminal), the flush honors it
+    const auto frame_deadline = std::chrono::steady_clock::now() + FRAME_BUDGET;
+
     auto snap = publisher_->get_current();
     if (!snap) return;
 
@@ -284,37 +492,106 @@ void Renderer::render(bool force_redraw) {
         terminal.clear_screen();
         last_cols = cols;
         last_rows = rows;
+        // Deferred rows from the old geometry are meaningless now
+        flush_resume_row_ = 0;
+        flush_incomplete_ = false;
     }
 
-    // Clear canvas
-    canvas_.clear();
-
     // Compute layout
     compute_layout(cols, rows);
 
-    // RENDER WIDGETS TO CANVAS
-    // Help view replaces browser content; otherwise toggle Browser/AlbumBrowser
-    if (help_overlay_->is_visible()) {
-        help_overlay_->render(canvas_, browser_rect_, *snap);
-    } else if (show_album_view_) {
-        album_browser_->set_search_active(focus_ == Focus::Search);
-        album_browser_->render(canvas_, browser_rect_, *snap, focus_ == Focus::Browser);
-    } else {
-        browser_->render(canvas_, browser_rect_, *snap, focus_ == Focus::Browser);
+    // SELECTIVE RENDERING: the publish path tags which snapshot sections
+    // each update touched. Anything beyond a pure player tick - library,
+    // queue or UI changes, input, resize, overlays, scan animation, an
+    // in-flight filter - takes the full path below. A Player-only frame
+    // (the steady state: position timer ticking) redraws just the
+    // NowPlaying region; the canvas keeps last frame's cells everywhere
+    // else, so flush_canvas sees them as clean rows.
+    using backend::SnapshotPublisher;
+    uint32_t dirty = publisher_->consume_dirty_sections();
+    if (input_since_render_) {
+        dirty = SnapshotPublisher::SectionAll;
+        input_since_render_ = false;
+    }
+    // While playing, no publishes arrive for the position timer - the
+    // display position is interpolated from the anchor at render time,
+    // so the NowPlaying region is implicitly dirty every frame
+    if (snap->player.state == model::PlaybackState::Playing) {
+        dirty |= SnapshotPublisher::SectionPlayer;
+    }
+    bool full_frame = force_redraw || size_changed ||
+                      (dirty & ~SnapshotPublisher::SectionPlayer) != 0 ||
+                      show_album_view_ || help_overlay_->is_visible() ||
+                      perf_hud_->is_visible() || snap->scan_progress.is_scanning ||
+                      browser_->has_pending_filter();
+
+    if (!full_frame && dirty == 0) {
+        // Nothing newly dirty, but a partial flush may have left rows
+        // behind: the canvas already holds the composed frame, so skip
+        // straight to emission and catch them up
+        if (flush_incomplete_) {
+            flush_canvas(frame_deadline);
+        }
+        return;
     }
 
-    header_->render(canvas_, header_rect_, *snap);
+    if (full_frame) {
+        // Clear canvas
+        canvas_.clear();
+
+        // RENDER WIDGETS TO CANVAS
+        // Help view replaces browser content; otherwise toggle Browser/AlbumBrowser
+        // Each widget under its own probe, so a budget-blowing frame
+        // names its culprit in the HUD instead of just "frame slow"
+        auto& pc = util::PerfCounters::instance();
+        if (help_overlay_->is_visible()) {
+            help_overlay_->render(canvas_, browser_rect_, *snap);
+        } else if (show_album_view_) {
+            util::ScopedTimer t(pc.widget_album_browser);
+            album_browser_->set_search_active(focus_ == Focus::Search);
+            album_browser_->render(canvas_, browser_rect_, *snap, focus_ == Focus::Browser);
+        } else {
+            util::ScopedTimer t(pc.widget_browser);
+            browser_->render(canvas_, browser_rect_, *snap, focus_ == Focus::Browser);
+            // The list's viewport delta (inside its box border) feeds
+            // the flush's scrolled-region fast path
+            if (int delta = browser_->take_scroll_delta(); delta != 0) {
+                scroll_hints_.push_back({browser_rect_.y + 1,
+                                         browser_rect_.y + browser_rect_.height - 1,
+                                         browser_rect_.x + 1,
+                                         browser_rect_.x + browser_rect_.width - 1,
+                                         delta});
+            }
+        }
+
+        {
+            util::ScopedTimer t(pc.widget_now_playing);
+            header_->render(canvas_, header_rect_, *snap);
+        }
 
-    // Only render Queue if visible (hidden in compact mode)
-    if (queue_rect_.height > 0) {
-        queue_->render(canvas_, queue_rect_, *snap, focus_ == Focus::Queue);
-    }
+        // Only render Queue if visible (hidden in compact mode)
+        if (queue_rect_.height > 0) {
+            util::ScopedTimer t(pc.widget_queue);
+            queue_->render(canvas_, queue_rect_, *snap, focus_ == Focus::Queue);
+        }
 
-    // Global Search Overlay
-    render_search_overlay({0, 0, canvas_.width(), canvas_.height()}, *snap);
+        // Global Search Overlay
+        render_search_overlay({0, 0, canvas_.width(), canvas_.height()}, *snap);
+
+        // Perf HUD (top-right corner, above everything except search)
+        perf_hud_->render(canvas_, {0, 0, canvas_.width(), canvas_.height()}, *snap);
+    } else {
+        // Player tick only: NowPlaying is the one widget that reads
+        // PlayerState (Queue and Browser do not), so clear and redraw
+        // its rect alone
+        util::ScopedTimer t(util::PerfCounters::instance().widget_now_playing);
+        canvas_.fill_rect(header_rect_.x, header_rect_.y,
+                          header_rect_.width, header_rect_.height, Cell{" ", {}});
+        header_->render(canvas_, header_rect_, *snap);
+    }
 
     // FLUSH CANVAS TO TERMINAL
-    flush_canvas();
+    flush_canvas(frame_deadline);
 
     // Render album art using actual widget dimensions
     // Force render if track changed (not just terminal resize)
@@ -368,6 +645,8 @@ void Renderer::handle_input() {
 }
 
 void Renderer::handle_input_event(const InputEvent& event) {
+    input_since_render_ = true;
+
     ouroboros::util::Logger::debug("handle_input_event: key=" + std::to_string(event.key) +
         " (char='" + std::string(1, static_cast<char>(event.key)) + "') name=" + event.key_name);
 
@@ -492,6 +771,12 @@ void Renderer::handle_input_event(const InputEvent& event) {
         return;
     }
 
+    // Perf HUD (from TOML: perf_hud)
+    if (!input_captured && matches_keybind(event, "perf_hud")) {
+        perf_hud_->set_visible(!perf_hud_->is_visible());
+        return;
+    }
+
     // When help is visible, route scrolling input to it; Escape also closes
     if (help_overlay_->is_visible()) {
         if (event.key_name == "escape" || event.key == 27) {
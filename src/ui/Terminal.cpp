@@ -1,4 +1,5 @@
 #include "ui/Terminal.hpp"
+#include "util/FrameArena.hpp"
 #include "util/Logger.hpp"
 #include <unistd.h>
 #include <sys/ioctl.h>
@@ -8,6 +9,10 @@
 #include <signal.h>
 #include <cerrno>
 #include <poll.h>
+#include <sys/uio.h>
+#include <limits.h>
+#include <vector>
+#include <algorithm>
 #include <format>
 #include <atomic>
 
@@ -88,27 +93,53 @@ bool Terminal::is_initialized() const {
 }
 
 void Terminal::writer_loop() {
+    std::vector<std::string> batch;
+    std::vector<struct iovec> iov;
+
     while (running_) {
-        std::string chunk;
+        batch.clear();
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
             queue_cv_.wait(lock, [this] { return !write_queue_.empty() || !running_; });
-            
-            if (!write_queue_.empty()) {
-                chunk = std::move(write_queue_.front());
+
+            // Drain everything queued: one gathered writev per wakeup
+            // instead of one write per enqueued string
+            while (!write_queue_.empty()) {
+                batch.emplace_back(std::move(write_queue_.front()));
                 write_queue_.pop_front();
             }
         }
 
-        if (!chunk.empty()) {
+        if (!batch.empty()) {
+            iov.clear();
+            size_t total = 0;
+            for (auto& s : batch) {
+                if (s.empty()) continue;
+                iov.push_back({s.data(), s.size()});
+                total += s.size();
+            }
+
             size_t written = 0;
-            while (written < chunk.size()) {
-                ssize_t n = write(STDOUT_FILENO, chunk.data() + written, chunk.size() - written);
+            size_t idx = 0;  // First iovec not yet fully written
+            while (written < total) {
+                int cnt = static_cast<int>(std::min(iov.size() - idx,
+                                                    static_cast<size_t>(IOV_MAX)));
+                ssize_t n = writev(STDOUT_FILENO, iov.data() + idx, cnt);
                 if (n > 0) {
                     written += n;
+                    // Advance past fully written iovecs, trim a partial one
+                    size_t adv = static_cast<size_t>(n);
+                    while (idx < iov.size() && adv >= iov[idx].iov_len) {
+                        adv -= iov[idx].iov_len;
+                        ++idx;
+                    }
+                    if (idx < iov.size() && adv > 0) {
+                        iov[idx].iov_base = static_cast<char*>(iov[idx].iov_base) + adv;
+                        iov[idx].iov_len -= adv;
+                    }
                 } else if (n < 0) {
                     if (errno == EINTR) continue;
-                    
+
                     // Handle non-blocking stdout (likely sharing status with stdin)
                     if (errno == EAGAIN || errno == EWOULDBLOCK) {
                         struct pollfd pfd = {STDOUT_FILENO, POLLOUT, 0};
@@ -121,20 +152,22 @@ void Terminal::writer_loop() {
                     break;
                 }
             }
-            if (chunk.size() > 100) {
+            if (total > 100) {
                 // PHASE #3: Modern format for logging
                 ouroboros::util::Logger::debug(std::format("Terminal: Wrote {} bytes to stdout", written));
             }
         } else if (!running_ && write_queue_.empty()) {
-            break; 
+            break;
         }
     }
 }
 
-void Terminal::write_raw(const std::string& text) {
+void Terminal::write_raw(std::string_view text) {
     {
+        // The async writer thread outlives the frame, so the queue owns
+        // a heap copy here; callers may pass arena-backed scratch.
         std::lock_guard<std::mutex> lock(queue_mutex_);
-        write_queue_.push_back(text);
+        write_queue_.emplace_back(text);
     }
     queue_cv_.notify_one();
 }
@@ -150,16 +183,48 @@ void Terminal::move_cursor(int x, int y) {
     write_raw(std::format("\033[{};{}H", y + 1, x + 1));
 }
 
-void Terminal::print(int x, int y, const std::string& text) {
+void Terminal::print(int x, int y, std::string_view text) {
     // Construct the full sequence to atomicize the cursor move + text
-    // This reduces cursor jumping artifacts and unnecessary intermediate strings
-    write_raw(std::format("\033[{};{}H{}", y + 1, x + 1, text));
+    // This reduces cursor jumping artifacts and unnecessary intermediate strings.
+    // Composed in the frame arena: print() runs per changed cell, so a
+    // heap string here would undo flush_canvas()'s zero-malloc loop.
+    auto seq = util::make_arena_string();
+    seq += "\033[";
+    util::append_int(seq, y + 1);
+    seq += ';';
+    util::append_int(seq, x + 1);
+    seq += 'H';
+    seq += text;
+    write_raw(seq);
 }
 
 void Terminal::flush() {
     // No-op in async model
 }
 
+bool Terminal::fill_input_buffer() {
+    if (input_pos_ < input_len_) return true;
+
+    ssize_t n;
+    // Retry on EINTR (signal interruption); stdin is non-blocking so an
+    // empty backlog returns EAGAIN immediately
+    do {
+        n = read(STDIN_FILENO, input_buf_, sizeof(input_buf_));
+    } while (n < 0 && errno == EINTR);
+
+    if (n <= 0) {
+        if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+            ouroboros::util::Logger::debug(std::format("read_input: read() returned {}, errno={}", n, errno));
+        }
+        input_pos_ = input_len_ = 0;
+        return false;
+    }
+
+    input_len_ = static_cast<size_t>(n);
+    input_pos_ = 0;
+    return true;
+}
+
 InputEvent Terminal::read_input() {
     // PHASE #3: Check safe flag
     if (g_resize_pending) {
@@ -168,59 +233,36 @@ InputEvent Terminal::read_input() {
         return {InputEvent::Type::Resize, 0, "resize"};
     }
 
-    char c;
-    ssize_t n;
-
-    // Retry on EINTR (signal interruption)
-    do {
-        n = read(STDIN_FILENO, &c, 1);
-    } while (n < 0 && errno == EINTR);
-
-    // Debug: log what read() returned (only on error/weirdness)
-    if (n != 1) {
-        if (errno != EAGAIN && errno != EWOULDBLOCK) {
-             ouroboros::util::Logger::debug(std::format("read_input: read() returned {}, errno={} ({})", n, errno, EAGAIN));
-        }
+    if (!fill_input_buffer()) {
+        return {InputEvent::Type::KeyPress, 0, ""};
     }
 
-    if (n == 1) {
-        if (c == '\033') {
-            char seq[3];
-            ssize_t n2;
-            // Read with EINTR retry
-            do {
-                n2 = read(STDIN_FILENO, &seq[0], 1);
-            } while (n2 < 0 && errno == EINTR);
-
-            if (n2 == 1) {
-                if (seq[0] == '[') {
-                    ssize_t n3;
-                    do {
-                        n3 = read(STDIN_FILENO, &seq[1], 1);
-                    } while (n3 < 0 && errno == EINTR);
-
-                    if (n3 == 1) {
-                        switch (seq[1]) {
-                            case 'A': return {InputEvent::Type::KeyPress, 0, "up"};
-                            case 'B': return {InputEvent::Type::KeyPress, 0, "down"};
-                            case 'C': return {InputEvent::Type::KeyPress, 0, "right"};
-                            case 'D': return {InputEvent::Type::KeyPress, 0, "left"};
-                        }
-                    }
+    char c = input_buf_[input_pos_++];
+
+    if (c == '\033') {
+        // A CSI sequence may straddle a buffer boundary, so allow one
+        // refill per continuation byte; a bare Escape keypress has no
+        // continuation (refill hits EAGAIN) and falls through
+        if (fill_input_buffer() && input_buf_[input_pos_] == '[') {
+            ++input_pos_;
+            if (fill_input_buffer()) {
+                switch (input_buf_[input_pos_++]) {
+                    case 'A': return {InputEvent::Type::KeyPress, 0, "up"};
+                    case 'B': return {InputEvent::Type::KeyPress, 0, "down"};
+                    case 'C': return {InputEvent::Type::KeyPress, 0, "right"};
+                    case 'D': return {InputEvent::Type::KeyPress, 0, "left"};
                 }
             }
-            return {InputEvent::Type::KeyPress, 27, "escape"};
-        }
-        
-        if (c == '\n' || c == '\r') {
-            return {InputEvent::Type::KeyPress, c, "enter"};
         }
-        
-        std::string key_name(1, c);
-        return {InputEvent::Type::KeyPress, c, key_name};
+        return {InputEvent::Type::KeyPress, 27, "escape"};
     }
-    
-    return {InputEvent::Type::KeyPress, 0, ""};
+
+    if (c == '\n' || c == '\r') {
+        return {InputEvent::Type::KeyPress, c, "enter"};
+    }
+
+    std::string key_name(1, c);
+    return {InputEvent::Type::KeyPress, c, key_name};
 }
 
 int Terminal::get_terminal_width() const {
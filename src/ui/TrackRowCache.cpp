@@ -0,0 +1,99 @@
+#include "ui/TrackRowCache.hpp"
+#include "ui/Formatting.hpp"
+#include "config/UIConfig.hpp"
+#include <iomanip>
+#include <sstream>
+
+namespace ouroboros::ui {
+
+TrackRowCache& TrackRowCache::instance() {
+    static TrackRowCache instance;
+    return instance;
+}
+
+// Byte-based truncation matching Component::truncate_text, so cached
+// segments are identical to what the widgets used to draw
+static std::string truncate_bytes(const std::string& text, int max_width) {
+    if (static_cast<int>(text.length()) <= max_width) {
+        return text;
+    }
+    if (max_width <= 3) {
+        return text.substr(0, max_width);
+    }
+    return text.substr(0, max_width - 3) + "...";
+}
+
+const TrackRowCache::Row& TrackRowCache::row_for(const model::Track& track,
+                                                 int track_index, int width,
+                                                 const void* library_identity) {
+    // A new library state invalidates everything; widths coexist in the
+    // key, so pane resizes only grow the map until the next state swap
+    // or the size cap
+    if (library_identity != library_identity_) {
+        cache_.clear();
+        library_identity_ = library_identity;
+    }
+
+    const uint64_t key = make_key(track_index, width);
+    auto it = cache_.find(key);
+    if (it != cache_.end()) return it->second;
+
+    // Scrolling end-to-end through a huge library must not hoard every
+    // row ever formatted; one viewport refill after a clear is cheap
+    if (cache_.size() >= MAX_ROWS) {
+        cache_.clear();
+    }
+
+    const auto& uc = config::ui_config();
+    Row row;
+
+    // Format: [Artist] [Album]: [Track Number] [Song]
+    std::ostringstream oss;
+    if (!track.artist.empty()) {
+        oss << track.artist;
+    } else {
+        oss << "Unknown Artist";
+    }
+    if (!track.album.empty()) {
+        oss << " " << track.album;
+    }
+    oss << ": ";
+    if (track.track_number > 0) {
+        oss << std::setfill('0') << std::setw(2) << track.track_number << " ";
+    }
+    if (!track.title.empty()) {
+        oss << track.title;
+    } else {
+        oss << "Untitled";
+    }
+    row.body = oss.str();
+
+    // Pre-truncated colored segments for the normal (unhighlighted) row
+    int x = 0;
+    int remaining_w = width;
+    auto add_part = [&](const std::string& text, Style s) {
+        if (remaining_w <= 0 || text.empty()) return;
+        std::string t = truncate_bytes(text, remaining_w);
+        int len = display_cols(t);
+        row.parts.push_back({x, std::move(t), s});
+        x += len;
+        remaining_w -= len;
+    };
+
+    add_part("  ", uc.muted);
+    add_part(!track.artist.empty() ? track.artist : "Unknown Artist", uc.artist);
+    if (!track.album.empty()) {
+        add_part(" " + track.album, uc.album);
+    }
+    add_part(": ", uc.separator);
+    if (track.track_number > 0) {
+        std::ostringstream num_oss;
+        num_oss << std::setfill('0') << std::setw(2) << track.track_number << " ";
+        add_part(num_oss.str(), uc.muted);
+    }
+    add_part(!track.title.empty() ? track.title : "Untitled", uc.title);
+
+    return cache_.emplace(key, std::move(row)).first->second;
+}
+
+}  // namespace ouroboros::ui
@@ -16,7 +16,6 @@
 #include <cmath>
 #include <filesystem>
 #include <vector>
-#include <numeric>
 #include <set>
 #include <unordered_map>
 
@@ -112,24 +111,99 @@ void AlbumBrowser::set_filter(const std::string& query) {
         filter_query_ = query;
         filter_dirty_ = true;
         prefetch_completed_ = false; // Reset prefetch on filter change
+        speculative_completed_ = false;
+
+        // Drop queued and in-flight decodes for the now-hidden albums;
+        // the next render re-requests whatever the filter left visible
+        ArtworkWindow::instance().reset();
+    }
+}
+
+// Leading character of the album's position in the sorted grid,
+// mirroring album_sort_key: scattered albums sort by title, unified by
+// artist with the same "The "/bracket prefix stripping the sort applied.
+// The normalized strings are already case-folded, so the result is the
+// lowercase initial; anything outside a-z buckets under '#'.
+static char album_initial(const model::AlbumGroup& album) {
+    const auto& config = backend::Config::instance();
+    std::string_view s = album.is_scattered ? std::string_view(album.normalized_title)
+                                            : std::string_view(album.normalized_artist);
+    if (!album.is_scattered) {
+        if (config.sort_ignore_the_prefix && s.size() >= 4 && s.substr(0, 4) == "the ") {
+            s.remove_prefix(4);
+        }
+        if (config.sort_ignore_bracket_prefix && !s.empty() && s.front() == '[') {
+            s.remove_prefix(1);
+        }
     }
+    if (s.empty()) return '#';
+    char c = s.front();
+    return (c >= 'a' && c <= 'z') ? c : '#';
+}
+
+void AlbumBrowser::rebuild_letter_index() {
+    letter_sections_.clear();
+    const int total = filtered_count();
+    letter_sections_.reserve(27);
+    char prev = '\0';
+    for (int i = 0; i < total; ++i) {
+        char initial = album_initial(albums()[filtered_index(i)]);
+        if (initial != prev) {
+            letter_sections_.push_back({initial, i});
+            prev = initial;
+        }
+    }
+}
+
+void AlbumBrowser::jump_to_adjacent_letter(int direction) {
+    if (letter_sections_.empty()) return;
+
+    // Binary search for the section holding the selection; sections are
+    // ordered by first_index, and the first one always starts at 0
+    auto it = std::upper_bound(
+        letter_sections_.begin(), letter_sections_.end(), selected_index_,
+        [](int idx, const LetterSection& s) { return idx < s.first_index; });
+    size_t current = static_cast<size_t>(std::distance(letter_sections_.begin(), it)) - 1;
+
+    size_t target;
+    if (direction > 0) {
+        if (current + 1 >= letter_sections_.size()) return;
+        target = current + 1;
+    } else if (selected_index_ != letter_sections_[current].first_index) {
+        // Mid-section: snap back to this section's first album, like
+        // prev-track restarting the current song
+        target = current;
+    } else if (current > 0) {
+        target = current - 1;
+    } else {
+        return;
+    }
+
+    selected_index_ = letter_sections_[target].first_index;
+    ouroboros::util::Logger::debug(std::string("AlbumBrowser: Letter jump to '") +
+                                   letter_sections_[target].initial + "' (index " +
+                                   std::to_string(selected_index_) + ")");
 }
 
 void AlbumBrowser::update_filtered_albums() {
     filtered_album_indices_.clear();
+    filter_identity_ = filter_query_.empty();
 
-    if (filter_query_.empty()) {
-        filtered_album_indices_.resize(albums_.size());
-        std::iota(filtered_album_indices_.begin(), filtered_album_indices_.end(), 0);
+    // No query: every album matches, and filtered_index() virtualizes
+    // the identity mapping, so no index vector is materialized
+    if (filter_identity_) {
+        rebuild_letter_index();
         return;
     }
 
+    const auto& album_list = albums();
+
     // Normalize query once for Unicode-aware search (bjork matches Björk)
     std::string normalized_query = util::normalize_for_search(filter_query_);
     util::BoyerMooreSearch searcher(normalized_query);
 
-    for (size_t i = 0; i < albums_.size(); ++i) {
-        const auto& album = albums_[i];
+    for (size_t i = 0; i < album_list.size(); ++i) {
+        const auto& album = album_list[i];
 
         // Search in pre-computed normalized strings (no allocation per album)
         if (searcher.search(album.normalized_title) != -1 ||
@@ -143,41 +217,28 @@ void AlbumBrowser::update_filtered_albums() {
         selected_index_ = 0;
     }
 
+    rebuild_letter_index();
     content_changed_ = true;
 
-    ouroboros::util::Logger::debug("AlbumBrowser: Filtered " + std::to_string(albums_.size()) +
+    ouroboros::util::Logger::debug("AlbumBrowser: Filtered " + std::to_string(album_list.size()) +
                                    " -> " + std::to_string(filtered_album_indices_.size()) + " albums");
 }
 
 void AlbumBrowser::refresh_cache(const model::Snapshot& snap) {
-    // Albums are pre-computed at library load time (async) - just copy when ready
+    // Albums are pre-computed at library load time (async) and immutable
+    // once published; adopting the shared_ptr references them in place -
+    // no per-album copies, regardless of library size
     if (snap.library->albums.empty()) {
         // Albums still computing in background - will refresh on next snapshot update
         return;
     }
 
-    albums_.clear();
-    albums_.reserve(snap.library->albums.size());
+    album_source_ = snap.library;
 
-    // Copy album groups from snapshot (they use model::AlbumGroup, we use local AlbumGroup)
-    for (const auto& album : snap.library->albums) {
-        AlbumGroup g;
-        g.title = album.title;
-        g.artist = album.artist;
-        g.year = album.year;
-        g.track_indices = album.track_indices;
-        g.representative_track_path = album.representative_track_path;
-        g.album_directory = album.album_directory;
-        g.normalized_title = album.normalized_title;
-        g.normalized_artist = album.normalized_artist;
-        g.is_scattered = album.is_scattered;
-        albums_.push_back(std::move(g));
-    }
-
-    // Initial update of filtered indices (matches all)
+    // Re-run the active filter against the adopted state
     update_filtered_albums();
 
-    ouroboros::util::Logger::info("AlbumBrowser: Loaded " + std::to_string(albums_.size()) +
+    ouroboros::util::Logger::info("AlbumBrowser: Adopted " + std::to_string(albums().size()) +
                                   " pre-computed albums from snapshot");
 }
 
@@ -199,8 +260,9 @@ void AlbumBrowser::render(Canvas& canvas, const LayoutRect& rect, const model::S
         return;
     }
 
-    // Refresh cache if library changed (albums now available)
-    if (albums_.empty() && !snap.library->albums.empty()) {
+    // Adopt the snapshot's album state when it changes (first load or a
+    // library rescan); pointer identity makes the steady-state check free
+    if (album_source_ != snap.library && !snap.library->albums.empty()) {
         refresh_cache(snap);
     }
 
@@ -246,7 +308,7 @@ void AlbumBrowser::render(Canvas& canvas, const LayoutRect& rect, const model::S
     int x_offset = (content_rect.width - grid_width) / 2;
 
     // Use filtered indices for rendering
-    int total_albums = util::narrow_cast<int>(filtered_album_indices_.size());
+    int total_albums = filtered_count();
     if (total_albums == 0) {
         canvas.draw_text(content_rect.x + 2, content_rect.y + 2,
                         filter_query_.empty() ? "No albums." : "No matching album found.",
@@ -291,8 +353,7 @@ void AlbumBrowser::render(Canvas& canvas, const LayoutRect& rect, const model::S
             if (idx >= total_albums) break;
 
             // Lookup actual album from filtered list
-            size_t album_idx = filtered_album_indices_[idx];
-            const auto& album = albums_[album_idx];
+            const auto& album = albums()[filtered_index(idx)];
             bool is_selected = (idx == selected_index_);
 
             // Calculate cell position
@@ -369,9 +430,9 @@ void AlbumBrowser::render(Canvas& canvas, const LayoutRect& rect, const model::S
     std::string title = "LIBRARY";
     if (!filter_query_.empty()) {
         title += " SEARCH: \"" + filter_query_ + "\", ";
-        title += std::to_string(filtered_album_indices_.size()) + "/" + std::to_string(albums_.size()) + " ALBUMS";
+        title += std::to_string(filtered_count()) + "/" + std::to_string(albums().size()) + " ALBUMS";
     } else {
-        title += ": " + std::to_string(albums_.size()) + " ALBUMS";
+        title += ": " + std::to_string(albums().size()) + " ALBUMS";
     }
 
     draw_box_border(canvas, rect, title, is_focused);
@@ -385,8 +446,8 @@ void AlbumBrowser::handle_input(const InputEvent& event) {
         return;
     }
 
-    if (albums_.empty()) return;
-    int total_albums = util::narrow_cast<int>(filtered_album_indices_.size());
+    if (albums().empty()) return;
+    int total_albums = filtered_count();
     if (total_albums == 0) return;
 
     // Track old selection for change detection
@@ -405,6 +466,15 @@ void AlbumBrowser::handle_input(const InputEvent& event) {
     else if (matches_keybind(event, "nav_up")) {
         if (selected_index_ - cols_ >= 0) selected_index_ -= cols_;
     }
+    // Alphabet jumps: hop between initial-letter sections via the
+    // precomputed index (the big-jump check below resets the artwork
+    // window for us when the hop crosses enough rows)
+    else if (matches_keybind(event, "jump_next_letter")) {
+        jump_to_adjacent_letter(1);
+    }
+    else if (matches_keybind(event, "jump_prev_letter")) {
+        jump_to_adjacent_letter(-1);
+    }
 
     // If selection moved significantly (more than 2 rows), clear cache and reload
     int jump_threshold = cols_ * 2;  // Allow normal row navigation
@@ -418,7 +488,7 @@ void AlbumBrowser::handle_input(const InputEvent& event) {
 
     if (matches_keybind(event, "select")) {
         // Lookup actual album from filtered list
-        size_t album_idx = filtered_album_indices_[selected_index_];
+        size_t album_idx = filtered_index(selected_index_);
 
         // If searching: jump to album in unfiltered view
         if (!filter_query_.empty()) {
@@ -436,7 +506,7 @@ void AlbumBrowser::handle_input(const InputEvent& event) {
         }
 
         auto& bus = events::EventBus::instance();
-        const auto& album = albums_[album_idx];
+        const auto& album = albums()[album_idx];
 
         for (int idx : album.track_indices) {
             if (idx >= 0 && idx < util::narrow_cast<int>(g_current_snapshot->library->tracks.size())) {
@@ -511,8 +581,19 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
             was_scrolling_ = true;
         }
 
+        // Live direction + velocity for the decode gate and for the
+        // directional prefetch after the session ends
+        scroll_direction_ = (scroll_offset_ > last_scroll_offset_) ? 1 : -1;
+        {
+            auto session_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - scroll_start_time_).count();
+            int session_distance = std::abs(scroll_offset_ - scroll_start_offset_);
+            scroll_velocity_ = session_distance / ((session_ms > 0 ? session_ms : 1) / 1000.0);
+        }
+
         last_scroll_time_ = now;
         prefetch_completed_ = false;
+        speculative_completed_ = false;
         last_scroll_offset_ = scroll_offset_;
 
     } else if (was_scrolling_) {
@@ -524,6 +605,7 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
         // Velocity = rows per second (avoid div by zero)
         double time_seconds = (elapsed_ms > 0 ? elapsed_ms : 1) / 1000.0;
         double velocity = distance / time_seconds;
+        scroll_velocity_ = velocity;  // Retained for the directional prefetch below
 
         // Big jump if: (distance >= 8 AND velocity > 10) OR distance > 25
         bool is_big_jump = (distance >= 8 && velocity > 10.0) || (distance > HUGE_JUMP_ROWS);
@@ -599,7 +681,7 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
     int start_row = scroll_offset_;
     int end_row = start_row + visible_rows_grid + 1;
 
-    int total_filtered = util::narrow_cast<int>(filtered_album_indices_.size());
+    int total_filtered = filtered_count();
 
     // Calculate selected album's grid position for Manhattan distance calculation
     int selected_row = selected_index_ / cols_available;
@@ -616,13 +698,22 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
     static constexpr int MAX_NEW_REQUESTS_PER_FRAME = 8;
     int new_requests_this_frame = 0;
 
+    // While flying past rows (holding page-down), decoding them is
+    // wasted work - the viewport will have moved on before the worker
+    // gets there. Skip new requests entirely; slots stay Empty and get
+    // requested normally once the user slows down or stops.
+    bool fast_scrolling = was_scrolling_ && scroll_velocity_ > FAST_SCROLL_ROWS_PER_SEC;
+    if (fast_scrolling) {
+        ouroboros::util::Logger::debug("AlbumBrowser: Fast scroll (" +
+            std::to_string(scroll_velocity_).substr(0, 4) + " r/s), skipping decode requests");
+    }
+
     for (int r = start_row; r < end_row && r < total_filtered / cols_available + 1; ++r) {
         for (int c = 0; c < cols_available; ++c) {
             int idx = r * cols_available + c;
             if (idx >= total_filtered) continue;
 
-            size_t album_idx = filtered_album_indices_[idx];
-            auto& album = albums_[album_idx];
+            const auto& album = albums()[filtered_index(idx)];
 
             // Calculate visible row for slot index
             int visible_row = r - start_row;
@@ -659,7 +750,7 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
                     " track=" + filename);
             }
 
-            if (!album.representative_track_path.empty() && needs_request) {
+            if (!album.representative_track_path.empty() && needs_request && !fast_scrolling) {
                 // Progressive batching: limit requests per frame
                 if (new_requests_this_frame >= MAX_NEW_REQUESTS_PER_FRAME) {
                     ouroboros::util::Logger::debug("AlbumBrowser: BATCH LIMIT slot=" + std::to_string(slot_idx) +
@@ -706,8 +797,7 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
             // Skip if already ready
             if (state == SlotState::Ready) continue;
 
-            size_t album_idx = filtered_album_indices_[idx];
-            auto& album = albums_[album_idx];
+            const auto& album = albums()[filtered_index(idx)];
             if (album.representative_track_path.empty()) continue;
 
             // Query ArtworkWindow for decoded pixels
@@ -882,7 +972,24 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
 
     if (time_since_scroll >= PREFETCH_DELAY_MS && !prefetch_completed_ && enough_visible_ready) {
         const int PREFETCH_ITEMS = 20;
-        int prefetch_rows_count = (PREFETCH_ITEMS + cols_available - 1) / cols_available;
+
+        // Directional window: split the budget toward where we were
+        // heading, and widen the leading edge after sustained movement
+        // (the user who just paged down three screens will likely keep
+        // going). Symmetric when we haven't moved yet this session.
+        int lead_items = PREFETCH_ITEMS / 2;
+        int trail_items = PREFETCH_ITEMS / 2;
+        if (scroll_direction_ != 0) {
+            lead_items = (PREFETCH_ITEMS * 3) / 4;
+            trail_items = PREFETCH_ITEMS - lead_items;
+            if (scroll_velocity_ > SUSTAINED_SCROLL_ROWS_PER_SEC) {
+                lead_items *= 2;
+            }
+        }
+        int above_items = (scroll_direction_ >= 0) ? trail_items : lead_items;
+        int below_items = (scroll_direction_ >= 0) ? lead_items : trail_items;
+        int rows_above = (above_items + cols_available - 1) / cols_available;
+        int rows_below = (below_items + cols_available - 1) / cols_available;
 
         auto process_prefetch = [&](int r) {
             if (r < 0) return;
@@ -891,8 +998,7 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
                 int idx = r * cols_available + c;
                 if (idx >= total_filtered) continue;
 
-                size_t album_idx = filtered_album_indices_[idx];
-                auto& album = albums_[album_idx];
+                const auto& album = albums()[filtered_index(idx)];
 
                 if (album.representative_track_path.empty()) continue;
 
@@ -907,10 +1013,61 @@ void AlbumBrowser::render_images_if_needed(const LayoutRect& rect, bool force_re
             }
         };
 
-        for (int r = start_row - prefetch_rows_count; r < start_row; ++r) process_prefetch(r);
-        for (int r = end_row; r < end_row + prefetch_rows_count; ++r) process_prefetch(r);
+        for (int r = start_row - rows_above; r < start_row; ++r) process_prefetch(r);
+        for (int r = end_row; r < end_row + rows_below; ++r) process_prefetch(r);
         artwork_window.flush_requests();
         prefetch_completed_ = true;
+
+        ouroboros::util::Logger::debug("AlbumBrowser: Prefetch " + std::to_string(rows_above) +
+                                      " rows above / " + std::to_string(rows_below) +
+                                      " below (dir=" + std::to_string(scroll_direction_) +
+                                      ", vel=" + std::to_string(scroll_velocity_).substr(0, 4) + " r/s)");
+    }
+
+    // ========================================================================
+    // PHASE 6: SPECULATIVE WARM (deep idle)
+    // The prefetch landed and the decode workers have drained - spend
+    // the idle time warming a couple of viewports each side, so the
+    // first page-down after sitting still hits an entirely warm cache.
+    // Requests for albums already decoded are dropped in the flush, and
+    // memory stays bounded by ArtworkWindow's eviction limit.
+    // ========================================================================
+
+    if (time_since_scroll >= SPECULATIVE_DELAY_MS && prefetch_completed_ &&
+        !speculative_completed_ && artwork_window.pending_count() == 0) {
+        const int page_rows = std::max(1, end_row - start_row);
+        const int span_rows = page_rows * SPECULATIVE_PAGES;
+
+        auto process_speculative = [&](int r) {
+            if (r < 0) return;
+            for (int c = 0; c < cols_available; ++c) {
+                int idx = r * cols_available + c;
+                if (idx >= total_filtered) continue;
+
+                const auto& album = albums()[filtered_index(idx)];
+                if (album.representative_track_path.empty()) continue;
+
+                // Far behind every visible (distance-priority) and
+                // prefetch (+1000) request: the workers only reach
+                // these once nothing else is queued
+                int distance = std::abs(r - selected_row);
+                artwork_window.request(
+                    album.representative_track_path,
+                    distance + 5000,
+                    art_cols,
+                    art_rows,
+                    false
+                );
+            }
+        };
+
+        for (int r = start_row - span_rows; r < start_row; ++r) process_speculative(r);
+        for (int r = end_row; r < end_row + span_rows; ++r) process_speculative(r);
+        artwork_window.flush_requests();
+        speculative_completed_ = true;
+
+        ouroboros::util::Logger::debug("AlbumBrowser: Speculative warm of " +
+                                      std::to_string(span_rows) + " rows each side");
     }
 
     ouroboros::util::Logger::info("AlbumBrowser: " +
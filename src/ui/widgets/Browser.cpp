@@ -1,12 +1,18 @@
 #include "ui/widgets/Browser.hpp"
 #include "ui/Formatting.hpp"
+#include "ui/TrackRowCache.hpp"
 #include "ui/InputEvent.hpp"
 #include "config/UIConfig.hpp"
 #include "events/EventBus.hpp"
 #include "util/Logger.hpp"
 #include "util/BoyerMoore.hpp"
+#include "util/FuzzyMatch.hpp"
+#include "util/TaskPool.hpp"
+#include "util/TrigramIndex.hpp"
+#include "util/UnicodeUtils.hpp"
 #include "util/Platform.hpp"
 #include <algorithm>
+#include <optional>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -17,45 +23,250 @@ namespace ouroboros::ui::widgets {
 // This prevents dangling pointer issues when snap reference goes out of scope
 static std::shared_ptr<const model::Snapshot> g_current_snapshot = nullptr;
 
+namespace {
+
+// One filter pass over one immutable library state. Runs on a TaskPool
+// worker so a worst-case query never eats into the frame budget; the
+// caller owns generation checking and result adoption.
+struct FilterOutcome {
+    std::vector<int> indices;
+    bool fuzzy = false;
+};
+
+FilterOutcome run_filter(const model::LibraryState& library,
+                         const std::string& query,
+                         const std::vector<int>* refine_base) {
+    const auto& tracks = library.tracks;
+    FilterOutcome outcome;
+
+    // Match against the precomputed search_key (normalized once per
+    // library snapshot) with a case-sensitive byte scan. Tracks from the
+    // fast tracks-only publish have no key yet; fall back to a
+    // case-insensitive scan of the raw fields for those.
+    std::string normalized_query = util::normalize_for_search(query);
+    ouroboros::util::BoyerMooreSearch key_searcher(normalized_query, true);
+    ouroboros::util::BoyerMooreSearch raw_searcher(query, false);
+    auto matches_track = [&](const model::Track& t) {
+        if (!t.search_key.empty()) {
+            return key_searcher.search(t.search_key) != -1;
+        }
+        return raw_searcher.search(t.artist) != -1 ||
+               raw_searcher.search(t.album) != -1 ||
+               raw_searcher.search(t.title) != -1;
+    };
+
+    if (refine_base) {
+        // Per-keystroke cost proportional to the previous match count,
+        // not the library size
+        for (int idx : *refine_base) {
+            if (matches_track(tracks[idx])) {
+                outcome.indices.push_back(idx);
+            }
+        }
+        // Literal matches exhausted: fall through to the full path so
+        // the fuzzy fallback gets a chance
+        if (!outcome.indices.empty()) {
+            ouroboros::util::Logger::debug("Browser: Refined " + std::to_string(refine_base->size()) +
+                                          " -> " + std::to_string(outcome.indices.size()) +
+                                          " tracks (query: '" + query + "')");
+            return outcome;
+        }
+    }
+
+    outcome.indices.clear();
+
+    // Literal search. When the enriched state carries a trigram index,
+    // intersect posting lists to a candidate set and verify only those
+    // tracks; otherwise scan every track.
+    const auto* index = library.track_search_index.get();
+    if (index && !index->empty() &&
+        normalized_query.size() >= ouroboros::util::TrigramIndex::MIN_QUERY_BYTES) {
+        std::vector<int> candidate_set;
+        index->candidates(normalized_query, candidate_set);
+        // Index entries always carry a search key, so the verify pass is
+        // one batched byte scan over the candidates
+        key_searcher.search_batch(candidate_set, [&](int idx) {
+            return std::string_view(tracks[idx].search_key);
+        });
+        outcome.indices = std::move(candidate_set);
+    } else {
+        outcome.indices.reserve(tracks.size());
+        for (size_t i = 0; i < tracks.size(); ++i) {
+            if (matches_track(tracks[i])) {
+                outcome.indices.push_back(i);
+            }
+        }
+    }
+
+    // No literal match -> fzf-style fuzzy fallback. Scores subsequence
+    // alignments over the precomputed keys and ranks best first, so
+    // "blckstr" still lands on "blackstar" instead of an empty list.
+    // Literal hits always win; this only runs when there are none.
+    if (outcome.indices.empty() && normalized_query.size() >= 2) {
+        util::FuzzyMatcher fuzzy(normalized_query);
+        std::vector<std::pair<int, int>> scored;  // (score, track index)
+        for (size_t i = 0; i < tracks.size(); ++i) {
+            const auto& key = tracks[i].search_key;
+            if (key.empty()) continue;  // pre-enrichment state, no basis to score
+            if (auto match_score = fuzzy.score(key)) {
+                scored.emplace_back(*match_score, static_cast<int>(i));
+            }
+        }
+        std::sort(scored.begin(), scored.end(), [](const auto& a, const auto& b) {
+            return a.first != b.first ? a.first > b.first : a.second < b.second;
+        });
+        for (const auto& [match_score, idx] : scored) {
+            outcome.indices.push_back(idx);
+        }
+        outcome.fuzzy = !outcome.indices.empty();
+    }
+
+    ouroboros::util::Logger::debug("Browser: Filtered " + std::to_string(tracks.size()) +
+                                  " -> " + std::to_string(outcome.indices.size()) +
+                                  (outcome.fuzzy ? " tracks, fuzzy (query: '" : " tracks (query: '") +
+                                  query + "')");
+    return outcome;
+}
+
+}  // namespace
+
+void Browser::set_filter(const std::string& query) {
+    if (filter_query_ == query) return;
+
+    // Any in-flight search is now answering yesterday's question;
+    // bumping the generation keeps its result from being adopted
+    filter_slot_->generation.fetch_add(1, std::memory_order_relaxed);
+
+    if (query.size() > filter_query_.size() && query.starts_with(filter_query_)) {
+        // Appended characters: the new matches are a subset of the
+        // current ones, so the next update refines the result list in
+        // place. Snapshot the current result first for backspace.
+        // Fuzzy results are not literal matches of the query - they can
+        // neither seed a refinement nor serve as a backspace snapshot.
+        if (!filter_dirty_ && !filter_fuzzy_) {
+            if (!filter_query_.empty()) {
+                if (filter_history_.size() == MAX_FILTER_HISTORY) {
+                    filter_history_.erase(filter_history_.begin());
+                }
+                filter_history_.push_back({filter_query_, filtered_indices_});
+            }
+            filter_refine_ = true;
+        }
+        // With an update already pending, filtered_indices_ matches an
+        // even older prefix - refining from that superset is still valid
+    } else {
+        // Shrunk or rewritten query: restore a snapshot if one matches,
+        // otherwise fall back to a full rescan
+        filter_refine_ = false;
+        for (size_t i = filter_history_.size(); i-- > 0;) {
+            if (filter_history_[i].query == query) {
+                filtered_indices_ = std::move(filter_history_[i].indices);
+                filter_history_.resize(i);
+                filter_query_ = query;
+                filter_dirty_ = false;
+                filter_fuzzy_ = false;
+                selected_index_ = 0;
+                scroll_offset_ = 0;
+                return;
+            }
+        }
+        filter_history_.clear();
+    }
+
+    filter_query_ = query;
+    filter_dirty_ = true;
+    selected_index_ = 0;
+    scroll_offset_ = 0;
+}
+
 void Browser::update_filtered_indices(const model::Snapshot& snap) {
     const auto& tracks = snap.library->tracks;
-    filtered_indices_.clear();
-    filtered_indices_.reserve(tracks.size());
 
-    // Case 1: No filter -> All tracks
+    // Library changed shape: the current result and all snapshots are
+    // stale, take the full-rescan path
+    if (tracks.size() != last_library_size_) {
+        filter_refine_ = false;
+        filter_history_.clear();
+        filter_dirty_ = true;
+        // The current results were computed against the old state and
+        // stay on screen until the background pass lands; drop any rows
+        // the new state no longer has so they cannot index past it
+        std::erase_if(filtered_indices_, [&](int idx) {
+            return idx >= static_cast<int>(tracks.size());
+        });
+    }
+
+    // Adopt a finished background result if it is still current: same
+    // generation (no newer keystroke) and same library it was computed
+    // against, so the indices cannot dangle
+    {
+        std::lock_guard lock(filter_slot_->mutex);
+        if (filter_slot_->result) {
+            auto& result = *filter_slot_->result;
+            bool current_gen =
+                result.generation == filter_slot_->generation.load(std::memory_order_relaxed);
+            if (current_gen && result.library_size == tracks.size()) {
+                filtered_indices_ = std::move(result.indices);
+                filter_fuzzy_ = result.fuzzy;
+                filter_dirty_ = false;
+                filter_job_pending_ = false;
+                last_library_size_ = tracks.size();
+                if (selected_index_ >= static_cast<int>(filtered_indices_.size())) {
+                    selected_index_ = 0;
+                    scroll_offset_ = 0;
+                }
+            } else if (current_gen) {
+                // Finished, but against a library that has since changed
+                // shape - unusable, so let the relaunch below rerun it
+                filter_job_pending_ = false;
+            }
+            filter_slot_->result.reset();
+        }
+    }
+
+    if (!filter_dirty_) return;
+
+    // Empty query is the identity - fill synchronously, no search needed
     if (filter_query_.empty()) {
+        // A stale in-flight result must not overwrite this
+        filter_slot_->generation.fetch_add(1, std::memory_order_relaxed);
+        filtered_indices_.resize(tracks.size());
         for (size_t i = 0; i < tracks.size(); ++i) {
-            filtered_indices_.push_back(i);
+            filtered_indices_[i] = static_cast<int>(i);
         }
+        filter_fuzzy_ = false;
         filter_dirty_ = false;
+        filter_job_pending_ = false;
         last_library_size_ = tracks.size();
         return;
     }
 
-    // Case 2: Filter active -> Search
-    ouroboros::util::BoyerMooreSearch searcher(filter_query_, false); // Case-insensitive
-    
-    for (size_t i = 0; i < tracks.size(); ++i) {
-        const auto& t = tracks[i];
-        bool match = false;
-        
-        // Search in Artist, Album, Title
-        if (searcher.search(t.artist) != -1) match = true;
-        else if (searcher.search(t.album) != -1) match = true;
-        else if (searcher.search(t.title) != -1) match = true;
-        
-        if (match) {
-            filtered_indices_.push_back(i);
-        }
+    // Kick a background search unless one for this exact query is
+    // already running; a newer launch supersedes an older one by
+    // generation, so a slow stale search can never clobber fresh results
+    if (filter_job_pending_ && inflight_query_ == filter_query_) return;
+
+    uint64_t generation = filter_slot_->generation.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto slot = filter_slot_;
+    auto library = snap.library;  // shared_ptr keeps the searched state alive
+    std::string query = filter_query_;
+    std::shared_ptr<std::vector<int>> refine_base;
+    if (filter_refine_) {
+        refine_base = std::make_shared<std::vector<int>>(filtered_indices_);
+        filter_refine_ = false;
     }
-
-    filter_dirty_ = false;
-    last_library_size_ = tracks.size();
-    
-    // Log filter results
-    ouroboros::util::Logger::debug("Browser: Filtered " + std::to_string(tracks.size()) + 
-                                  " -> " + std::to_string(filtered_indices_.size()) + 
-                                  " tracks (query: '" + filter_query_ + "')");
+    filter_job_pending_ = true;
+    inflight_query_ = query;
+
+    util::TaskPool::instance().submit(util::TaskPool::Priority::High,
+        [slot, generation, library, query, refine_base]() {
+            FilterOutcome outcome = run_filter(*library, query, refine_base.get());
+            std::lock_guard lock(slot->mutex);
+            if (generation == slot->generation.load(std::memory_order_relaxed)) {
+                slot->result = FilterResult{generation, library->tracks.size(),
+                                            std::move(outcome.indices), outcome.fuzzy};
+            }
+        });
 }
 
 void Browser::render(Canvas& canvas, const LayoutRect& rect, const model::Snapshot& snap) {
@@ -90,7 +301,7 @@ void Browser::render(Canvas& canvas, const LayoutRect& rect, const model::Snapsh
 
     // Empty library - show loading indicator if scanning
     if (tracks.empty()) {
-        if (snap.library->is_scanning) {
+        if (snap.scan_progress.is_scanning) {
             render_loading_indicator(canvas, inner_rect, snap);
         }
         return;
@@ -125,6 +336,13 @@ void Browser::render(Canvas& canvas, const LayoutRect& rect, const model::Snapsh
     }
     if (scroll_offset_ < 0) scroll_offset_ = 0;
 
+    // Record how far the viewport moved since the last rendered frame;
+    // the renderer picks this up as a scroll hint for its flush
+    if (render_scroll_base_ >= 0) {
+        render_scroll_delta_ = scroll_offset_ - render_scroll_base_;
+    }
+    render_scroll_base_ = scroll_offset_;
+
     // Render visible tracks
     int end_index = std::min(total_items, scroll_offset_ + available_lines);
     int y = inner_rect.y;
@@ -133,84 +351,24 @@ void Browser::render(Canvas& canvas, const LayoutRect& rect, const model::Snapsh
         // Map visual index 'i' to real track index
         int real_index = filtered_indices_[i];
         const auto& track = tracks[real_index];
-        
+        const auto& row = TrackRowCache::instance().row_for(
+            track, real_index, inner_rect.width, snap.library.get());
+
         bool is_cursor = (i == selected_index_);
         bool is_marked = is_selected(real_index);
 
         // If cursor or marked, highlight the entire line with single color
         if (is_cursor || is_marked) {
-            // Build single-color line
             std::string prefix = is_cursor ? "▶ " : "  ";
-            std::ostringstream oss;
-            oss << prefix;
-
-            // Format: [Artist] [Album]: [Track Number] [Song]
-            if (!track.artist.empty()) {
-                oss << track.artist;
-            } else {
-                oss << "Unknown Artist";
-            }
-
-            if (!track.album.empty()) {
-                oss << " " << track.album;
-            }
-
-            oss << ": ";
-
-            if (track.track_number > 0) {
-                oss << std::setfill('0') << std::setw(2) << track.track_number << " ";
-            }
-
-            if (!track.title.empty()) {
-                oss << track.title;
-            } else {
-                oss << "Untitled";
-            }
-
             Style style = is_cursor ? uc.selection : uc.marked;
-
-            // Truncate the entire line to fit width
-            std::string full_line = oss.str();
-            canvas.draw_text(inner_rect.x, y++, truncate_text(full_line, inner_rect.width), style);
+            canvas.draw_text(inner_rect.x, y++,
+                             truncate_text(prefix + row.body, inner_rect.width), style);
         } else {
-            // Normal: multi-color rendering
-            int x = inner_rect.x;
+            // Normal: replay the cached multi-color segments
             int line_y = y++;
-            int remaining_w = inner_rect.width;
-
-            // Helper to draw and advance
-            auto draw_part = [&](const std::string& text, Style s) {
-                if (remaining_w <= 0) return;
-                std::string t = truncate_text(text, remaining_w);
-                canvas.draw_text(x, line_y, t, s);
-                int len = display_cols(t);
-                x += len;
-                remaining_w -= len;
-            };
-
-            // Prefix
-            draw_part("  ", uc.muted);
-
-            // Artist
-            draw_part(!track.artist.empty() ? track.artist : "Unknown Artist", uc.artist);
-
-            // Album
-            if (!track.album.empty()) {
-                draw_part(" " + track.album, uc.album);
+            for (const auto& part : row.parts) {
+                canvas.draw_text(inner_rect.x + part.x_offset, line_y, part.text, part.style);
             }
-
-            // Separator
-            draw_part(": ", uc.separator);
-
-            // Track number
-            if (track.track_number > 0) {
-                std::ostringstream num_oss;
-                num_oss << std::setfill('0') << std::setw(2) << track.track_number << " ";
-                draw_part(num_oss.str(), uc.muted);
-            }
-
-            // Title
-            draw_part(!track.title.empty() ? track.title : "Untitled", uc.title);
         }
 
         if (y >= inner_rect.y + inner_rect.height) break;
@@ -251,9 +409,9 @@ void Browser::render_loading_indicator(Canvas& canvas, const LayoutRect& content
     // Show progress count if available (below main message)
     int progress_y = center_y + 2;
 
-    if (snap.library->total_count > 0) {
-        std::string progress = "[" + std::to_string(snap.library->scanned_count) + "/" +
-                              std::to_string(snap.library->total_count) + " TRACKS LOADED...]";
+    if (snap.scan_progress.total_count > 0) {
+        std::string progress = "[" + std::to_string(snap.scan_progress.scanned_count) + "/" +
+                              std::to_string(snap.scan_progress.total_count) + " TRACKS LOADED...]";
         int progress_x = content_rect.x + (content_rect.width / 2) - (progress.length() / 2);
 
         canvas.draw_text(progress_x, progress_y, progress,
@@ -261,9 +419,9 @@ void Browser::render_loading_indicator(Canvas& canvas, const LayoutRect& content
 
         // Calculate and display estimated completion time
         auto elapsed_seconds = duration_cast<seconds>(elapsed).count();
-        if (elapsed_seconds > 0 && snap.library->scanned_count > 0) {
-            int remaining = snap.library->total_count - snap.library->scanned_count;
-            double tracks_per_second = static_cast<double>(snap.library->scanned_count) / elapsed_seconds;
+        if (elapsed_seconds > 0 && snap.scan_progress.scanned_count > 0) {
+            int remaining = snap.scan_progress.total_count - snap.scan_progress.scanned_count;
+            double tracks_per_second = static_cast<double>(snap.scan_progress.scanned_count) / elapsed_seconds;
 
             if (tracks_per_second > 0 && remaining > 0) {
                 int eta_seconds = static_cast<int>(remaining / tracks_per_second);
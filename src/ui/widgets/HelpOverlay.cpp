@@ -34,6 +34,7 @@ void HelpOverlay::build_content() {
     kv("Shift+J / Shift+K","Multi-select (select and navigate)");
     kv("Tab",              "Switch focus (Browser <-> Queue)");
     kv("g / G",            "Jump to top / bottom");
+    kv("[ / ]",            "Jump to previous / next letter (album grid)");
     blank();
 
     subheading("Playback");
@@ -124,6 +125,7 @@ void HelpOverlay::build_content() {
     kv("~/.cache/ouroboros/library.bin",  "Library metadata cache");
     kv("~/.cache/ouroboros/dirs/",        "Per-directory metadata caches");
     kv("~/.cache/ouroboros/artwork.cache", "Content-addressed artwork storage");
+    kv("~/.cache/ouroboros/thumbs.cache", "Pre-scaled artwork thumbnail tiers");
     kv("/tmp/ouroboros_debug.log",        "Debug log file");
     blank();
     divider();
@@ -1,4 +1,5 @@
 #include "ui/widgets/NowPlaying.hpp"
+#include "audio/SpectrumAnalyzer.hpp"
 #include "ui/Formatting.hpp"
 #include "ui/ImageRenderer.hpp"
 #include "ui/ArtworkWindow.hpp"
@@ -6,6 +7,7 @@
 #include "config/UIConfig.hpp"
 #include "util/Logger.hpp"
 #include "util/Platform.hpp"
+#include <chrono>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
@@ -101,9 +103,17 @@ void NowPlaying::render(Canvas& canvas, const LayoutRect& rect, const model::Sna
 
     std::string format_str = format_line.str();
 
+    // SPECTRUM: one extra row of band levels below the statusline, once
+    // the analyzer has audio and the widget is tall enough to spare it
+    const bool show_spectrum =
+        snap.player.state == model::PlaybackState::Playing &&
+        audio::SpectrumAnalyzer::instance().active() &&
+        content_rect.height >= 10;
+    spectrum_row_visible_ = show_spectrum;
+
     // Calculate layout: artwork takes most space, metadata + statusline at bottom
     // Reserve 3 lines at bottom for track info, format, and statusline
-    int metadata_lines = 3;
+    int metadata_lines = 3 + (show_spectrum ? 1 : 0);
 
     // Calculate artwork dimensions to align text with artwork left edge
     int content_width = content_rect.width;
@@ -151,7 +161,7 @@ void NowPlaying::render(Canvas& canvas, const LayoutRect& rect, const model::Sna
 
     // Position text anchored to BOTTOM
     // This ensures consistent bottom padding (0) and keeps statusline fixed
-    int lines_needed = 2 + (!format_str.empty() ? 1 : 0);
+    int lines_needed = 2 + (!format_str.empty() ? 1 : 0) + (show_spectrum ? 1 : 0);
     int y = content_rect.y + content_rect.height - lines_needed;
 
     // Track info line: ARTIST ALBUM YEAR TRACK_NUMBER SONG (multi-color like Browser)
@@ -273,12 +283,22 @@ void NowPlaying::render(Canvas& canvas, const LayoutRect& rect, const model::Sna
     }
     draw_status_part(std::string(state_icon) + " ", uc.nowplaying_info);
 
-    // Progress bar and time
+    // Progress bar and time. Display position is interpolated from the
+    // published anchor at render time - the collector only publishes on
+    // state changes (start/seek/pause/resume) plus a slow drift
+    // correction, not per tick.
+    const int64_t now_steady_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t position_ms = snap.player.display_position_ms(now_steady_ms);
+    if (position_ms < 0) position_ms = 0;
+    if (track.duration_ms > 0 && position_ms > track.duration_ms) {
+        position_ms = track.duration_ms;
+    }
     int position_pct = 0;
     if (track.duration_ms > 0) {
-        position_pct = (snap.player.playback_position_ms * 100) / track.duration_ms;
+        position_pct = static_cast<int>(position_ms * 100 / track.duration_ms);
     }
-    int pos_sec = snap.player.playback_position_ms / 1000;
+    int pos_sec = static_cast<int>(position_ms / 1000);
     int dur_sec = track.duration_ms / 1000;
     std::string time_str = format_duration(pos_sec) + " / " + format_duration(dur_sec);
 
@@ -313,6 +333,23 @@ void NowPlaying::render(Canvas& canvas, const LayoutRect& rect, const model::Sna
     // Shuffle mode
     draw_status_part("SHUFFLE: ", uc.nowplaying_info);
     draw_status_part(snap.player.shuffle_enabled ? "ON" : "OFF", uc.nowplaying_info);
+
+    // SPECTRUM: band levels as block glyphs, stretched across the
+    // artwork width (each band repeats to fill its share of columns)
+    if (show_spectrum) {
+        auto levels = audio::SpectrumAnalyzer::instance().band_levels();
+        const int cols_per_band =
+            std::max(1, art_cols / static_cast<int>(levels.size()));
+        std::string spectrum;
+        for (int level : levels) {
+            const std::string block = blocks::percentage_to_block_8(level);
+            for (int c = 0; c < cols_per_band; ++c) {
+                spectrum += block;
+            }
+        }
+        canvas.draw_text(statusline_x, y, truncate_text(spectrum, art_cols),
+                         uc.nowplaying_info);
+    }
 }
 
 void NowPlaying::render_image_if_needed(const LayoutRect& widget_rect, bool /*force_render*/) {
@@ -337,7 +374,8 @@ void NowPlaying::render_image_if_needed(const LayoutRect& widget_rect, bool /*fo
     int content_height = widget_rect.height - 2;
 
     // Calculate layout: artwork takes most space, metadata + statusline at bottom
-    int metadata_lines = 3;
+    // (plus the spectrum row when render() reserved one)
+    int metadata_lines = 3 + (spectrum_row_visible_ ? 1 : 0);
     int available_artwork_height = content_height - metadata_lines;
 
     // ALGORITHM FOR SYMMETRY WITH PADDING
@@ -0,0 +1,105 @@
+#include "ui/widgets/PerfHud.hpp"
+#include "config/UIConfig.hpp"
+#include "util/MemoryBudget.hpp"
+#include "util/PerfCounters.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace ouroboros::ui::widgets {
+
+namespace {
+
+// ns -> "1.23ms" / "456us" (fixed width keeps the HUD from jittering).
+// Named so it can never collide with Component::format_duration(int
+// seconds) - unqualified lookup in a member finds the base-class
+// helper first and would happily format a nanosecond count as MM:SS.
+std::string format_ns(uint64_t ns) {
+    if (ns >= 1'000'000) {
+        uint64_t whole = ns / 1'000'000;
+        uint64_t frac = (ns % 1'000'000) / 10'000;  // two decimals
+        return std::to_string(whole) + "." + (frac < 10 ? "0" : "") + std::to_string(frac) + "ms";
+    }
+    return std::to_string(ns / 1'000) + "us";
+}
+
+}  // namespace
+
+void PerfHud::render(Canvas& canvas, const LayoutRect& rect, const model::Snapshot& snap) {
+    (void)snap;
+    if (!visible_) return;
+
+    const auto& uc = config::ui_config();
+    auto& pc = util::PerfCounters::instance();
+
+    // Small box anchored to the top-right corner of the given rect
+    constexpr int kWidth = 34;
+    constexpr int kHeight = 13;
+    LayoutRect box{
+        std::max(rect.x, rect.x + rect.width - kWidth),
+        rect.y,
+        std::min(kWidth, rect.width),
+        std::min(kHeight, rect.height),
+    };
+    if (box.width < 20 || box.height < 4) return;
+
+    auto inner = draw_box_border(canvas, box, "PERF", false);
+
+    auto line = [&](int row, const std::string& label, const std::string& value) {
+        if (row >= inner.height) return;
+        canvas.draw_text(inner.x + 1, inner.y + row, label, uc.muted);
+        canvas.draw_text(inner.x + 8, inner.y + row, value, uc.title);
+    };
+
+    const auto& frame = pc.frame_render;
+    const auto& publish = pc.publish_hold;
+    line(0, "FRAME", format_ns(frame.last_ns.load(std::memory_order_relaxed)) +
+                     " avg " + format_ns(frame.avg_ns()) +
+                     " max " + format_ns(frame.max_ns.load(std::memory_order_relaxed)));
+    line(1, "PUBLSH", format_ns(publish.last_ns.load(std::memory_order_relaxed)) +
+                      " avg " + format_ns(publish.avg_ns()));
+    line(2, "RING", std::to_string(pc.ring_fill_percent.get()) + "% full");
+    line(3, "DECODE", std::to_string(pc.decode_queue_depth.get()) + " jobs queued");
+    const auto& audio = pc.audio_callback;
+    line(4, "AUDIO", format_ns(audio.last_ns.load(std::memory_order_relaxed)) +
+                     " avg " + format_ns(audio.avg_ns()) +
+                     " max " + format_ns(audio.max_ns.load(std::memory_order_relaxed)));
+    const auto& occ = pc.audio_ring_occupancy;
+    line(5, "XRUN", std::to_string(pc.audio_underruns.get()) +
+                    (occ.empty() ? std::string{}
+                                 : " ring " +
+                                   std::to_string(occ.min.load(std::memory_order_relaxed)) + "-" +
+                                   std::to_string(occ.max.load(std::memory_order_relaxed)) + "%"));
+
+    // Per-widget composition and flush-phase breakdown (last frame) -
+    // when FRAME spikes, these say which widget or phase ate it
+    auto last = [](const util::PerfCounters::Metric& m) {
+        return format_ns(m.last_ns.load(std::memory_order_relaxed));
+    };
+    line(6, "DRAW", "br " + last(pc.widget_browser) +
+                    " np " + last(pc.widget_now_playing));
+    line(7, "", "qu " + last(pc.widget_queue) +
+                " al " + last(pc.widget_album_browser));
+    line(8, "FLUSH", "d " + last(pc.flush_diff) +
+                     " e " + last(pc.flush_emit) +
+                     " w " + last(pc.flush_write));
+
+    // Cache residency against the global budget (gauges refreshed by
+    // the main loop's enforce pass, so these lag by one cycle)
+    auto& mb = util::MemoryBudget::instance();
+    auto mbs = [](size_t bytes) {
+        return std::to_string(bytes / (1024 * 1024)) + "M";
+    };
+    using Tier = util::MemoryBudget::Tier;
+    line(9, "MEM", mbs(mb.total_bytes()) + " of " + mbs(mb.budget()));
+    line(10, "", "px " + mbs(mb.tier_bytes(Tier::ArtworkPixels)) +
+                 " rw " + mbs(mb.tier_bytes(Tier::ArtworkRaw)) +
+                 " th " + mbs(mb.tier_bytes(Tier::Thumbnails)) +
+                 " md " + mbs(mb.tier_bytes(Tier::Metadata)));
+}
+
+SizeConstraints PerfHud::get_constraints() const {
+    return SizeConstraints{};
+}
+
+}  // namespace ouroboros::ui::widgets
@@ -1,5 +1,6 @@
 #include "ui/widgets/Queue.hpp"
 #include "ui/Formatting.hpp"
+#include "ui/TrackRowCache.hpp"
 #include "ui/VisualBlocks.hpp"
 #include "ui/InputEvent.hpp"
 #include "config/UIConfig.hpp"
@@ -80,83 +81,23 @@ void Queue::render(Canvas& canvas, const LayoutRect& rect, const model::Snapshot
         }
         const auto& track = snap.library->tracks[track_idx];
 
-        // Match Browser formatting: Artist Album: TrackNum Title
+        // Browser formatting (Artist Album: TrackNum Title) via the
+        // shared row cache - a track showing in both panes is formatted
+        // once per library state
+        const auto& row = TrackRowCache::instance().row_for(
+            track, track_idx, content_rect.width, snap.library.get());
+
         if (is_current) {
             // Current track: single-color highlight (BrightYellow + Bold)
-            std::string prefix = "▶ ";
-            std::ostringstream oss;
-            oss << prefix;
-
-            // Artist
-            if (!track.artist.empty()) {
-                oss << track.artist;
-            } else {
-                oss << "Unknown Artist";
-            }
-
-            // Album
-            if (!track.album.empty()) {
-                oss << " " << track.album;
-            }
-
-            oss << ": ";
-
-            // Track number
-            if (track.track_number > 0) {
-                oss << std::setfill('0') << std::setw(2) << track.track_number << " ";
-            }
-
-            // Title
-            if (!track.title.empty()) {
-                oss << track.title;
-            } else {
-                oss << "Untitled";
-            }
-
-            std::string line = oss.str();
-            Style style = uc.selection;
-            canvas.draw_text(content_rect.x, y++, truncate_text(line, content_rect.width), style);
+            canvas.draw_text(content_rect.x, y++,
+                             truncate_text("▶ " + row.body, content_rect.width),
+                             uc.selection);
         } else {
-            // Normal track: multi-color rendering (matches Browser)
-            int x = content_rect.x;
+            // Normal track: replay the cached multi-color segments
             int line_y = y++;
-            int remaining_w = content_rect.width;
-
-            // Helper to draw and advance
-            auto draw_part = [&](const std::string& text, Style s) {
-                if (remaining_w <= 0) return;
-                std::string t = truncate_text(text, remaining_w);
-                canvas.draw_text(x, line_y, t, s);
-                int len = display_cols(t);
-                x += len;
-                remaining_w -= len;
-            };
-
-            // Prefix
-            draw_part("  ", uc.muted);
-
-            // Artist (Cyan)
-            draw_part(!track.artist.empty() ? track.artist : "Unknown Artist",
-                     uc.artist);
-
-            // Album (Default)
-            if (!track.album.empty()) {
-                draw_part(" " + track.album, uc.album);
+            for (const auto& part : row.parts) {
+                canvas.draw_text(content_rect.x + part.x_offset, line_y, part.text, part.style);
             }
-
-            // Separator
-            draw_part(": ", uc.separator);
-
-            // Track number (Dim)
-            if (track.track_number > 0) {
-                std::ostringstream num_oss;
-                num_oss << std::setfill('0') << std::setw(2) << track.track_number << " ";
-                draw_part(num_oss.str(), uc.muted);
-            }
-
-            // Title (BrightWhite)
-            draw_part(!track.title.empty() ? track.title : "Untitled",
-                     uc.title);
         }
 
         if (y >= content_rect.y + content_rect.height) break;
@@ -1,8 +1,17 @@
 #include "util/ArtworkHasher.hpp"
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <iomanip>
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
 namespace ouroboros::util {
 
 // SHA-256 constants (first 32 bits of the fractional parts of the cube roots of the first 64 primes)
@@ -45,45 +54,148 @@ constexpr uint32_t ArtworkHasher::gamma1(uint32_t x) {
     return rotr(x, 17) ^ rotr(x, 19) ^ (x >> 10);
 }
 
-std::vector<uint8_t> ArtworkHasher::sha256(const uint8_t* data, size_t len) {
-    // Initial hash values (first 32 bits of the fractional parts of the square roots of the first 8 primes)
-    uint32_t H[8] = {
-        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
-        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+namespace {
+
+#if defined(__x86_64__)
+
+// SHA-NI compression: sha256rnds2 does two rounds per issue, with the
+// message schedule running ahead via sha256msg1/msg2. The state lives
+// in two registers in the ABEF/CDGH layout the instruction expects.
+// Compiled with the sha target attribute regardless of the build's
+// baseline; only reached after the runtime CPU check in compress().
+__attribute__((target("sha,sse4.1")))
+void compress_shani(uint32_t* state, const uint8_t* data, size_t count) {
+    const __m128i MASK =
+        _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // Load H0..H7 and transpose to ABEF/CDGH
+    __m128i TMP = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    __m128i STATE1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    TMP = _mm_shuffle_epi32(TMP, 0xB1);                // CDAB
+    STATE1 = _mm_shuffle_epi32(STATE1, 0x1B);          // EFGH
+    __m128i STATE0 = _mm_alignr_epi8(TMP, STATE1, 8);  // ABEF
+    STATE1 = _mm_blend_epi16(STATE1, TMP, 0xF0);       // CDGH
+
+    // K packed as little-endian u64 pairs, one entry per four rounds
+    static const uint64_t KP[16][2] = {
+        {0x71374491428A2F98ULL, 0xE9B5DBA5B5C0FBCFULL},
+        {0x59F111F13956C25BULL, 0xAB1C5ED5923F82A4ULL},
+        {0x12835B01D807AA98ULL, 0x550C7DC3243185BEULL},
+        {0x80DEB1FE72BE5D74ULL, 0xC19BF1749BDC06A7ULL},
+        {0xEFBE4786E49B69C1ULL, 0x240CA1CC0FC19DC6ULL},
+        {0x4A7484AA2DE92C6FULL, 0x76F988DA5CB0A9DCULL},
+        {0xA831C66D983E5152ULL, 0xBF597FC7B00327C8ULL},
+        {0xD5A79147C6E00BF3ULL, 0x1429296706CA6351ULL},
+        {0x2E1B213827B70A85ULL, 0x53380D134D2C6DFCULL},
+        {0x766A0ABB650A7354ULL, 0x92722C8581C2C92EULL},
+        {0xA81A664BA2BFE8A1ULL, 0xC76C51A3C24B8B70ULL},
+        {0xD6990624D192E819ULL, 0x106AA070F40E3585ULL},
+        {0x1E376C0819A4C116ULL, 0x34B0BCB52748774CULL},
+        {0x4ED8AA4A391C0CB3ULL, 0x682E6FF35B9CCA4FULL},
+        {0x78A5636F748F82EEULL, 0x8CC7020884C87814ULL},
+        {0xA4506CEB90BEFFFAULL, 0xC67178F2BEF9A3F7ULL},
     };
 
-    // Pre-processing: adding padding
-    size_t msg_len = len;
-    size_t bit_len = msg_len * 8;
+    while (count > 0) {
+        const __m128i ABEF_SAVE = STATE0;
+        const __m128i CDGH_SAVE = STATE1;
+
+        // Four message registers covering W[0..15], byte-swapped to
+        // big-endian word order
+        __m128i M[4];
+        for (int i = 0; i < 4; ++i) {
+            M[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i)),
+                MASK);
+        }
+
+        for (int t = 0; t < 16; ++t) {
+            __m128i MSG = _mm_add_epi32(
+                M[t & 3],
+                _mm_set_epi64x(static_cast<long long>(KP[t][1]),
+                               static_cast<long long>(KP[t][0])));
+            // Schedule W[4(t+4) .. 4(t+4)+3] while these rounds run
+            if (t < 12) {
+                __m128i tmp = _mm_alignr_epi8(M[(t + 3) & 3], M[(t + 2) & 3], 4);
+                M[t & 3] = _mm_sha256msg2_epu32(
+                    _mm_add_epi32(_mm_sha256msg1_epu32(M[t & 3], M[(t + 1) & 3]), tmp),
+                    M[(t + 3) & 3]);
+            }
+            STATE1 = _mm_sha256rnds2_epu32(STATE1, STATE0, MSG);
+            MSG = _mm_shuffle_epi32(MSG, 0x0E);
+            STATE0 = _mm_sha256rnds2_epu32(STATE0, STATE1, MSG);
+        }
 
-    // Calculate padded length (multiple of 512 bits = 64 bytes)
-    size_t padded_len = msg_len + 1; // +1 for the '1' bit
-    while ((padded_len % 64) != 56) {  // Leave room for 64-bit length
-        padded_len++;
+        STATE0 = _mm_add_epi32(STATE0, ABEF_SAVE);
+        STATE1 = _mm_add_epi32(STATE1, CDGH_SAVE);
+        data += 64;
+        count--;
     }
-    padded_len += 8;  // Add 64-bit length
 
-    std::vector<uint8_t> padded(padded_len);
-    std::memcpy(padded.data(), data, msg_len);
+    // Transpose ABEF/CDGH back to H0..H7 and store
+    TMP = _mm_shuffle_epi32(STATE0, 0x1B);        // FEBA
+    STATE1 = _mm_shuffle_epi32(STATE1, 0xB1);     // DCHG
+    STATE0 = _mm_blend_epi16(TMP, STATE1, 0xF0);  // DCBA
+    STATE1 = _mm_alignr_epi8(STATE1, TMP, 8);     // HGFE
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), STATE0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), STATE1);
+}
 
-    // Append '1' bit (0x80 in byte form)
-    padded[msg_len] = 0x80;
+#elif defined(__aarch64__)
 
-    // Append length in bits as 64-bit big-endian
-    for (int i = 0; i < 8; ++i) {
-        padded[padded_len - 1 - i] = (bit_len >> (i * 8)) & 0xFF;
+// ARMv8 sha2 extension: vsha256hq/vsha256h2q perform four rounds per
+// pair, su0/su1 run the message schedule. Guarded by the HWCAP_SHA2
+// runtime check in compress().
+__attribute__((target("+sha2")))
+void compress_armv8(uint32_t* state, const uint8_t* data, size_t count) {
+    uint32x4_t s0 = vld1q_u32(&state[0]);
+    uint32x4_t s1 = vld1q_u32(&state[4]);
+
+    while (count > 0) {
+        const uint32x4_t save0 = s0;
+        const uint32x4_t save1 = s1;
+
+        uint32x4_t m[4];
+        for (int i = 0; i < 4; ++i) {
+            m[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+        }
+
+        for (int t = 0; t < 16; ++t) {
+            const uint32x4_t wk = vaddq_u32(m[t & 3], vld1q_u32(&K[4 * t]));
+            if (t < 12) {
+                m[t & 3] = vsha256su1q_u32(
+                    vsha256su0q_u32(m[t & 3], m[(t + 1) & 3]),
+                    m[(t + 2) & 3], m[(t + 3) & 3]);
+            }
+            const uint32x4_t tmp = s0;
+            s0 = vsha256hq_u32(s0, s1, wk);
+            s1 = vsha256h2q_u32(s1, tmp, wk);
+        }
+
+        s0 = vaddq_u32(s0, save0);
+        s1 = vaddq_u32(s1, save1);
+        data += 64;
+        count--;
     }
 
-    // Process message in 512-bit chunks
-    for (size_t chunk = 0; chunk < padded_len; chunk += 64) {
+    vst1q_u32(&state[0], s0);
+    vst1q_u32(&state[4], s1);
+}
+
+#endif
+
+}  // namespace
+
+void ArtworkHasher::compress_scalar(uint32_t* state, const uint8_t* data, size_t count) {
+    for (size_t block = 0; block < count; ++block, data += SHA256_BLOCK_SIZE) {
         uint32_t W[64];
 
         // Prepare message schedule
         for (int t = 0; t < 16; ++t) {
-            W[t] = (padded[chunk + t * 4] << 24) |
-                   (padded[chunk + t * 4 + 1] << 16) |
-                   (padded[chunk + t * 4 + 2] << 8) |
-                   (padded[chunk + t * 4 + 3]);
+            W[t] = (data[t * 4] << 24) |
+                   (data[t * 4 + 1] << 16) |
+                   (data[t * 4 + 2] << 8) |
+                   (data[t * 4 + 3]);
         }
 
         for (int t = 16; t < 64; ++t) {
@@ -91,8 +203,8 @@ std::vector<uint8_t> ArtworkHasher::sha256(const uint8_t* data, size_t len) {
         }
 
         // Initialize working variables
-        uint32_t a = H[0], b = H[1], c = H[2], d = H[3];
-        uint32_t e = H[4], f = H[5], g = H[6], h = H[7];
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
 
         // Main loop
         for (int t = 0; t < 64; ++t) {
@@ -109,22 +221,103 @@ std::vector<uint8_t> ArtworkHasher::sha256(const uint8_t* data, size_t len) {
         }
 
         // Add compressed chunk to current hash value
-        H[0] += a; H[1] += b; H[2] += c; H[3] += d;
-        H[4] += e; H[5] += f; H[6] += g; H[7] += h;
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
     }
+}
 
-    // Produce final hash (big-endian)
-    std::vector<uint8_t> hash(32);
+void ArtworkHasher::compress(uint32_t* state, const uint8_t* blocks, size_t count) {
+#if defined(__x86_64__)
+    static const bool has_sha = __builtin_cpu_supports("sha");
+    if (has_sha) {
+        compress_shani(state, blocks, count);
+        return;
+    }
+#elif defined(__aarch64__)
+    static const bool has_sha = (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+    if (has_sha) {
+        compress_armv8(state, blocks, count);
+        return;
+    }
+#endif
+    compress_scalar(state, blocks, count);
+}
+
+ArtworkHasher::Sha256::Sha256() {
+    // Initial hash values (first 32 bits of the fractional parts of the square roots of the first 8 primes)
+    static constexpr uint32_t H0[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    std::memcpy(state_, H0, sizeof(state_));
+}
+
+void ArtworkHasher::Sha256::update(const uint8_t* data, size_t len) {
+    total_len_ += len;
+
+    // Top up a partial block left from the previous call
+    if (buffered_ > 0) {
+        size_t take = std::min(SHA256_BLOCK_SIZE - buffered_, len);
+        std::memcpy(buffer_ + buffered_, data, take);
+        buffered_ += take;
+        data += take;
+        len -= take;
+        if (buffered_ == SHA256_BLOCK_SIZE) {
+            compress(state_, buffer_, 1);
+            buffered_ = 0;
+        }
+    }
+
+    // Whole blocks compress straight from the caller's memory
+    size_t blocks = len / SHA256_BLOCK_SIZE;
+    if (blocks > 0) {
+        compress(state_, data, blocks);
+        data += blocks * SHA256_BLOCK_SIZE;
+        len -= blocks * SHA256_BLOCK_SIZE;
+    }
+
+    if (len > 0) {
+        std::memcpy(buffer_, data, len);
+        buffered_ = len;
+    }
+}
+
+std::vector<uint8_t> ArtworkHasher::Sha256::finish() {
+    // Padding: '1' bit, zeros to 56 mod 64, 64-bit big-endian bit length
+    uint64_t bit_len = total_len_ * 8;
+    buffer_[buffered_++] = 0x80;
+    if (buffered_ > SHA256_BLOCK_SIZE - 8) {
+        std::memset(buffer_ + buffered_, 0, SHA256_BLOCK_SIZE - buffered_);
+        compress(state_, buffer_, 1);
+        buffered_ = 0;
+    }
+    std::memset(buffer_ + buffered_, 0, SHA256_BLOCK_SIZE - 8 - buffered_);
     for (int i = 0; i < 8; ++i) {
-        hash[i * 4]     = (H[i] >> 24) & 0xFF;
-        hash[i * 4 + 1] = (H[i] >> 16) & 0xFF;
-        hash[i * 4 + 2] = (H[i] >> 8) & 0xFF;
-        hash[i * 4 + 3] = H[i] & 0xFF;
+        buffer_[SHA256_BLOCK_SIZE - 1 - i] = (bit_len >> (i * 8)) & 0xFF;
     }
+    compress(state_, buffer_, 1);
 
+    // Produce final hash (big-endian)
+    std::vector<uint8_t> hash(SHA256_HASH_SIZE);
+    for (int i = 0; i < 8; ++i) {
+        hash[i * 4]     = (state_[i] >> 24) & 0xFF;
+        hash[i * 4 + 1] = (state_[i] >> 16) & 0xFF;
+        hash[i * 4 + 2] = (state_[i] >> 8) & 0xFF;
+        hash[i * 4 + 3] = state_[i] & 0xFF;
+    }
     return hash;
 }
 
+std::string ArtworkHasher::Sha256::finish_hex() {
+    return to_hex(finish());
+}
+
+std::vector<uint8_t> ArtworkHasher::sha256(const uint8_t* data, size_t len) {
+    Sha256 stream;
+    stream.update(data, len);
+    return stream.finish();
+}
+
 std::string ArtworkHasher::to_hex(const std::vector<uint8_t>& bytes) {
     std::ostringstream oss;
     oss << std::hex << std::setfill('0');
@@ -143,6 +336,25 @@ std::string ArtworkHasher::hash_artwork(const std::vector<uint8_t>& data) {
     return to_hex(hash_bytes);
 }
 
+std::string ArtworkHasher::hash_and_copy(const uint8_t* src, size_t len,
+                                         std::vector<uint8_t>& out) {
+    out.resize(len);
+    if (len == 0) {
+        return "";
+    }
+
+    // Copy and hash chunkwise so the hash reads lines the copy just
+    // warmed instead of streaming the blob through cache twice
+    constexpr size_t CHUNK = 64 * 1024;
+    Sha256 stream;
+    for (size_t off = 0; off < len; off += CHUNK) {
+        size_t n = std::min(CHUNK, len - off);
+        std::memcpy(out.data() + off, src + off, n);
+        stream.update(out.data() + off, n);
+    }
+    return stream.finish_hex();
+}
+
 size_t ArtworkHasher::fast_hash(const std::vector<uint8_t>& data) {
     // FNV-1a hash (same algorithm as ImageRenderer for consistency)
     size_t hash = 14695981039346656037ULL;  // FNV offset basis
@@ -29,19 +29,61 @@ void BoyerMooreSearch::compute_bad_char() {
         unsigned char c = normalize_char(static_cast<unsigned char>(pattern_[i]));
         bad_char_[c] = pattern_len_ - 1 - i;
     }
+
+    last_char_shift_ =
+        bad_char_[normalize_char(static_cast<unsigned char>(pattern_[pattern_len_ - 1]))];
 }
 
 int BoyerMooreSearch::search(const std::string& text, int start_pos) const {
-    int text_len = static_cast<int>(text.length());
+    return search_impl(text.data(), static_cast<int>(text.length()), start_pos);
+}
+
+void BoyerMooreSearch::search_batch(std::vector<int>& indices,
+                                    const std::function<std::string_view(int)>& text_at) const {
+    size_t kept = 0;
+    for (int idx : indices) {
+        std::string_view text = text_at(idx);
+        if (search_impl(text.data(), static_cast<int>(text.size()), 0) != -1) {
+            indices[kept++] = idx;
+        }
+    }
+    indices.resize(kept);
+}
+
+int BoyerMooreSearch::search_impl(const char* text, int n, int start_pos) const {
     int m = pattern_len_;
-    int n = text_len;
 
     // Validation
     if (m == 0 || start_pos < 0 || start_pos >= n || m > n) {
         return -1;
     }
 
-    // Boyer-Moore-Horspool algorithm
+    if (case_sensitive_) {
+        // memchr-accelerated Horspool: let glibc's vectorized memchr
+        // (16/32 bytes per compare) hunt for the pattern's last byte and
+        // only verify the window on a hit. Sublinear skips come for free
+        // because a miss region is crossed at SIMD speed.
+        const char last = pattern_[m - 1];
+        int i = start_pos;
+        while (i <= n - m) {
+            const char* hit = static_cast<const char*>(
+                memchr(text + i + m - 1, last, static_cast<size_t>(n - i - m + 1)));
+            if (!hit) {
+                return -1;
+            }
+            i = static_cast<int>(hit - text) - (m - 1);
+            if (m == 1 || memcmp(text + i, pattern_.data(), m - 1) == 0) {
+                return i;
+            }
+            // Window's last byte matched, so the Horspool shift is the
+            // precomputed distance to its previous occurrence
+            i += last_char_shift_;
+        }
+        return -1;
+    }
+
+    // Case-insensitive: scalar Boyer-Moore-Horspool (per-byte tolower
+    // makes a vectorized scan a wash)
     int i = start_pos;
     while (i <= n - m) {
         int j = m - 1;
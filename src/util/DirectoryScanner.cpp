@@ -1,6 +1,9 @@
 #include "util/DirectoryScanner.hpp"
 #include "util/ArtworkHasher.hpp"
 #include "util/Logger.hpp"
+#include "util/Platform.hpp"
+#include "util/ScanGovernor.hpp"
+#include "util/UringStatBatcher.hpp"
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/syscall.h>
@@ -9,6 +12,11 @@
 #include <dirent.h>
 #include <cstring>
 #include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace ouroboros::util {
 
@@ -26,15 +34,122 @@ constexpr uint8_t DT_UNKNOWN = 0;
 constexpr uint8_t DT_REG = 8;     // Regular file
 constexpr uint8_t DT_DIR = 4;     // Directory
 
+// ═══════════════════════════════════════════════════════════════════════════
+// SWAR extension matching
+//
+// The classic strrchr + per-extension string compares were the inner
+// loop of the scan (one call per getdents64 entry, 3000+ entries per
+// buffer). Since every audio extension fits in 8 bytes and includes
+// its leading dot, packing the tail of the name into one word and
+// comparing against masked patterns is both branch-free and exactly
+// equivalent: the dot in the pattern anchors the match the same way
+// strrchr did.
+// ═══════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+struct ExtPattern {
+    uint64_t pattern;  // Extension bytes in the high end of the word (LE)
+    uint64_t mask;
+    size_t len;
+};
+
+consteval ExtPattern make_ext_pattern(std::string_view ext) {
+    ExtPattern p{0, 0, ext.size()};
+    for (size_t i = 0; i < ext.size(); i++) {
+        size_t byte = 8 - ext.size() + i;  // Right-align in the window
+        p.pattern |= static_cast<uint64_t>(static_cast<uint8_t>(ext[i])) << (byte * 8);
+        p.mask |= uint64_t{0xFF} << (byte * 8);
+    }
+    return p;
+}
+
+constexpr std::array<ExtPattern, 6> EXT_PATTERNS = {
+    make_ext_pattern(".dsf"), make_ext_pattern(".flac"), make_ext_pattern(".m4a"),
+    make_ext_pattern(".mp3"), make_ext_pattern(".ogg"),  make_ext_pattern(".wav"),
+};
+
+// Pack the last min(len, 8) bytes of the name into a word, last byte
+// in the most significant position.
+inline uint64_t pack_name_tail(const char* name, size_t len) {
+    uint64_t window = 0;
+    if (len >= 8) {
+        std::memcpy(&window, name + len - 8, 8);
+    } else {
+        std::memcpy(reinterpret_cast<char*>(&window) + (8 - len), name, len);
+    }
+    return window;
+}
+
+inline bool match_tail(uint64_t window, size_t len) {
+    bool hit = false;
+    for (const auto& p : EXT_PATTERNS) {
+        hit |= (len >= p.len) & ((window & p.mask) == p.pattern);
+    }
+    return hit;
+}
+
+}  // namespace
+
+void DirectoryScanner::ScanResult::merge(ScanResult&& other) {
+    if (arena.empty() && files.empty() && dirs.empty()) {
+        // Adopt wholesale: three buffer moves, no rebasing
+        uint64_t combined = tree_hash ^ other.tree_hash;
+        *this = std::move(other);
+        tree_hash = combined;
+        return;
+    }
+    const uint32_t base = static_cast<uint32_t>(arena.size());
+    arena += other.arena;
+    for (FileRecord r : other.files) {
+        r.path_off += base;
+        files.push_back(r);
+    }
+    for (DirRecord r : other.dirs) {
+        r.path_off += base;
+        dirs.push_back(r);
+    }
+    tree_hash ^= other.tree_hash;
+}
+
+void DirectoryScanner::ScanResult::finalize() {
+    auto by_path = [this](const auto& a, const auto& b) {
+        return path_of(a) < path_of(b);
+    };
+    std::sort(files.begin(), files.end(), by_path);
+    std::sort(dirs.begin(), dirs.end(), by_path);
+}
+
+const DirectoryScanner::ScanResult::FileRecord*
+DirectoryScanner::ScanResult::find_file(std::string_view abs_path) const {
+    auto it = std::lower_bound(files.begin(), files.end(), abs_path,
+        [this](const FileRecord& r, std::string_view p) { return path_of(r) < p; });
+    if (it != files.end() && path_of(*it) == abs_path) return &*it;
+    return nullptr;
+}
+
+const DirectoryScanner::ScanResult::DirRecord*
+DirectoryScanner::ScanResult::find_dir(std::string_view rel_path) const {
+    auto it = std::lower_bound(dirs.begin(), dirs.end(), rel_path,
+        [this](const DirRecord& r, std::string_view p) { return path_of(r) < p; });
+    if (it != dirs.end() && path_of(*it) == rel_path) return &*it;
+    return nullptr;
+}
+
 bool DirectoryScanner::is_audio_extension(const char* filename) {
-    const char* ext = strrchr(filename, '.');
-    if (!ext) return false;
+    size_t len = strlen(filename);
+    return match_tail(pack_name_tail(filename, len), len);
+}
 
-    std::string_view sv(ext);
-    for (const auto& ae : AUDIO_EXTENSIONS) {
-        if (ae == sv) return true;
+void DirectoryScanner::match_audio_extensions(
+    const char* const* names,
+    const size_t* name_lens,
+    size_t count,
+    uint8_t* out_is_audio
+) {
+    for (size_t i = 0; i < count; i++) {
+        out_is_audio[i] = match_tail(pack_name_tail(names[i], name_lens[i]), name_lens[i]);
     }
-    return false;
 }
 
 DirectoryScanner::ScanResult DirectoryScanner::scan_directory(
@@ -49,13 +164,95 @@ DirectoryScanner::ScanResult DirectoryScanner::scan_directory(
     }
     util::Logger::info("DirectoryScanner: Starting getdents64 scan of " + root_str);
 
-    scan_directory_recursive(root_str, root_str, result);
+    // Parallel work-queue traversal: discovered subdirectories become
+    // stealable tasks so a large tree spreads across all cores instead
+    // of walking on one. Workers own private ScanResult shards (and
+    // their own io_uring stat batcher) and never contend on the output;
+    // shards are merged once at the end, same as the per-thread album
+    // grouping merge in LibraryCollector.
+    unsigned num_workers = std::max(1u, std::thread::hardware_concurrency());
+
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<std::string> dir_queue;
+    size_t active_workers = 0;
+    dir_queue.push_back(root_str);
+
+    std::vector<ScanResult> shards(num_workers);
+
+    auto worker = [&](ScanResult& shard, size_t slot) {
+        // Batch mtime stats through io_uring where the kernel supports
+        // it; serial per-file stats dominate scan time on network mounts.
+        UringStatBatcher stat_batcher;
+        std::vector<std::string> subdirs;
+
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        while (true) {
+            queue_cv.wait(lock, [&] {
+                return !dir_queue.empty() || active_workers == 0;
+            });
+            if (dir_queue.empty()) break;  // Queue drained and nobody can refill it
+
+            std::string dir = std::move(dir_queue.front());
+            dir_queue.pop_front();
+            active_workers++;
+            lock.unlock();
+
+            // Shed parallelism while playback headroom is low; slot 0
+            // is always allowed, so the scan keeps making progress
+            ScanGovernor::instance().throttle(slot, num_workers);
+
+            subdirs.clear();
+            scan_one_directory(dir, root_str, shard, stat_batcher, subdirs);
+
+            lock.lock();
+            active_workers--;
+            if (!subdirs.empty()) {
+                for (auto& sd : subdirs) {
+                    dir_queue.push_back(std::move(sd));
+                }
+                queue_cv.notify_all();
+            } else if (active_workers == 0 && dir_queue.empty()) {
+                queue_cv.notify_all();  // Wake the others so they can exit
+            }
+        }
+        lock.unlock();
+        stat_batcher.flush();
+    };
+
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(num_workers - 1);
+        for (unsigned i = 1; i < num_workers; i++) {
+            // Spawned shards run idle-class so a scan can't preempt
+            // playback; the calling thread keeps its own class
+            threads.emplace_back([&worker, i](ScanResult& shard) {
+                Platform::set_current_thread_role(Platform::ThreadRole::BulkWorker);
+                worker(shard, i);
+            }, std::ref(shards[i]));
+        }
+        worker(shards[0], 0);  // Calling thread participates
+        for (auto& t : threads) t.join();
+    }
+
+    for (auto& shard : shards) {
+        result.merge(std::move(shard));
+    }
 
-    // Compute tree hash for TIER 0 validation
-    result.tree_hash = compute_tree_hash(result.audio_files);
+    // TIER 0 tree hash: XOR of the per-directory hashes. XOR makes the
+    // combine order-independent (shards merge in any order) and lets
+    // validation rebuild the same value from stored per-dir hashes plus
+    // re-hashes of just the dirty directories. Audio-less dirs carry
+    // hash 0, a no-op in the XOR.
+    result.tree_hash = 0;
+    for (const auto& d : result.dirs) {
+        result.tree_hash ^= d.hash;
+    }
 
-    util::Logger::info("DirectoryScanner: Found " + std::to_string(result.audio_files.size()) +
-                      " audio files in " + std::to_string(result.dir_mtimes.size()) + " directories");
+    result.finalize();
+
+    util::Logger::info("DirectoryScanner: Found " + std::to_string(result.files.size()) +
+                      " audio files in " + std::to_string(result.dirs.size()) + " directories");
 
     return result;
 }
@@ -79,10 +276,12 @@ std::unordered_map<std::string, std::time_t> DirectoryScanner::scan_directories_
     return dir_mtimes;
 }
 
-void DirectoryScanner::scan_directory_recursive(
+void DirectoryScanner::scan_one_directory(
     const std::string& dir_path,
     const std::string& root_path,
-    ScanResult& result
+    ScanResult& result,
+    UringStatBatcher& stat_batcher,
+    std::vector<std::string>& subdirs
 ) {
     // Open directory for reading
     int fd = open(dir_path.c_str(), O_RDONLY | O_DIRECTORY);
@@ -91,20 +290,38 @@ void DirectoryScanner::scan_directory_recursive(
         return;
     }
 
-    // Get directory mtime
-    struct stat dir_stat;
-    if (fstat(fd, &dir_stat) == 0) {
-        std::string rel_path = dir_path;
-        if (rel_path.starts_with(root_path)) {
-            rel_path = rel_path.substr(root_path.length());
-            if (rel_path.empty()) rel_path = "/";
+    std::string rel_path = dir_path;
+    if (rel_path.starts_with(root_path)) {
+        rel_path = rel_path.substr(root_path.length());
+        if (rel_path.empty()) rel_path = "/";
+    }
+
+    // Directory record (mtime batched through io_uring when available;
+    // deque elements stay referenceable across appends)
+    result.dirs.push_back({result.add_path(rel_path),
+                           static_cast<uint32_t>(rel_path.size()), 0, 0});
+    const size_t dir_index = result.dirs.size() - 1;
+    if (stat_batcher.available()) {
+        stat_batcher.queue(dir_path, result.dirs.back().mtime);
+    } else {
+        struct stat dir_stat;
+        if (fstat(fd, &dir_stat) == 0) {
+            result.dirs.back().mtime = dir_stat.st_mtime;
         }
-        result.dir_mtimes[rel_path] = dir_stat.st_mtime;
     }
 
+    // Remember where this directory's files start in the shard so the
+    // per-directory hash can cover exactly its own entries
+    const size_t audio_start = result.files.size();
+
     // Allocate large buffer for getdents64
     char buffer[BUFFER_SIZE];
 
+    // Batch scratch reused across getdents64 buffers
+    std::vector<const char*> reg_names;
+    std::vector<size_t> reg_lens;
+    std::vector<uint8_t> reg_is_audio;
+
     while (true) {
         // Call getdents64 syscall directly
         long nread = syscall(SYS_getdents64, fd, buffer, BUFFER_SIZE);
@@ -119,51 +336,81 @@ void DirectoryScanner::scan_directory_recursive(
             break;
         }
 
-        // Process all entries in buffer
+        // Pass 1: handle directories / unknowns, gather regular-file
+        // names for the batch extension classifier
+        reg_names.clear();
+        reg_lens.clear();
         for (long pos = 0; pos < nread;) {
             auto* d = reinterpret_cast<linux_dirent64*>(buffer + pos);
+            pos += d->d_reclen;
 
             // Skip . and ..
             if (strcmp(d->d_name, ".") == 0 || strcmp(d->d_name, "..") == 0) {
-                pos += d->d_reclen;
                 continue;
             }
 
-            std::string full_path = dir_path + "/" + d->d_name;
-
             if (d->d_type == DT_REG) {
-                // Regular file - check if audio
-                if (is_audio_extension(d->d_name)) {
-                    result.audio_files.push_back(full_path);
-
-                    // Get file mtime using fstatat (efficient - no path lookup)
-                    struct stat file_stat;
-                    if (fstatat(fd, d->d_name, &file_stat, 0) == 0) {
-                        result.file_mtimes[full_path] = file_stat.st_mtime;
-                    }
-                }
+                reg_names.push_back(d->d_name);
+                reg_lens.push_back(strlen(d->d_name));
             } else if (d->d_type == DT_DIR) {
-                // Recurse into subdirectory
-                scan_directory_recursive(full_path, root_path, result);
+                // Subdirectory becomes a work-queue task
+                subdirs.push_back(dir_path + "/" + d->d_name);
             } else if (d->d_type == DT_UNKNOWN) {
                 // Filesystem doesn't support d_type, fall back to stat
+                std::string full_path = dir_path + "/" + d->d_name;
                 struct stat entry_stat;
                 if (fstatat(fd, d->d_name, &entry_stat, 0) == 0) {
                     if (S_ISREG(entry_stat.st_mode)) {
                         if (is_audio_extension(d->d_name)) {
-                            result.audio_files.push_back(full_path);
-                            result.file_mtimes[full_path] = entry_stat.st_mtime;
+                            result.files.push_back({result.add_path(full_path),
+                                                    static_cast<uint32_t>(full_path.size()),
+                                                    entry_stat.st_mtime});
                         }
                     } else if (S_ISDIR(entry_stat.st_mode)) {
-                        scan_directory_recursive(full_path, root_path, result);
+                        subdirs.push_back(full_path);
                     }
                 }
             }
+        }
 
-            pos += d->d_reclen;
+        // Pass 2: classify the whole buffer's filenames at once
+        reg_is_audio.resize(reg_names.size());
+        match_audio_extensions(reg_names.data(), reg_lens.data(),
+                               reg_names.size(), reg_is_audio.data());
+
+        for (size_t i = 0; i < reg_names.size(); i++) {
+            if (!reg_is_audio[i]) continue;
+
+            std::string full_path = dir_path + "/" + reg_names[i];
+            result.files.push_back({result.add_path(full_path),
+                                    static_cast<uint32_t>(full_path.size()), 0});
+
+            if (stat_batcher.available()) {
+                // Queue the statx; mtime lands on batch flush
+                stat_batcher.queue(full_path, result.files.back().mtime);
+            } else {
+                // Get file mtime using fstatat (efficient - no path lookup)
+                struct stat file_stat;
+                if (fstatat(fd, reg_names[i], &file_stat, 0) == 0) {
+                    result.files.back().mtime = file_stat.st_mtime;
+                }
+            }
         }
     }
 
+    // Per-directory hash over just this directory's audio paths. Only
+    // dirs that contain audio get a non-zero hash, so the tree hash is
+    // the XOR of exactly these entries. Views are taken after the last
+    // arena append for this directory, so they can't be invalidated.
+    if (result.files.size() > audio_start) {
+        std::vector<std::string_view> dir_audio_paths;
+        dir_audio_paths.reserve(result.files.size() - audio_start);
+        for (size_t i = audio_start; i < result.files.size(); ++i) {
+            dir_audio_paths.push_back(result.path_of(result.files[i]));
+        }
+        result.dirs[dir_index].hash = hash_paths(std::move(dir_audio_paths));
+    }
+
     close(fd);
 }
 
@@ -224,8 +471,11 @@ void DirectoryScanner::scan_directories_recursive(
 }
 
 uint64_t DirectoryScanner::compute_tree_hash(const std::vector<std::string>& paths) {
-    // Sort paths for deterministic hashing
-    std::vector<std::string> sorted_paths = paths;
+    return hash_paths({paths.begin(), paths.end()});
+}
+
+uint64_t DirectoryScanner::hash_paths(std::vector<std::string_view> sorted_paths) {
+    // Sort views for deterministic hashing without copying the strings
     std::sort(sorted_paths.begin(), sorted_paths.end());
 
     // Concatenate all paths with newlines
@@ -248,4 +498,43 @@ uint64_t DirectoryScanner::compute_tree_hash(const std::vector<std::string>& pat
     return result;
 }
 
+uint64_t DirectoryScanner::hash_directory_files(const std::string& dir_path) {
+    int fd = open(dir_path.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return 0;
+
+    std::vector<std::string> audio_paths;
+    char buffer[BUFFER_SIZE];
+
+    while (true) {
+        long nread = syscall(SYS_getdents64, fd, buffer, BUFFER_SIZE);
+        if (nread <= 0) break;
+
+        for (long pos = 0; pos < nread;) {
+            auto* d = reinterpret_cast<linux_dirent64*>(buffer + pos);
+            pos += d->d_reclen;
+
+            if (strcmp(d->d_name, ".") == 0 || strcmp(d->d_name, "..") == 0) {
+                continue;
+            }
+
+            if (d->d_type == DT_REG) {
+                if (is_audio_extension(d->d_name)) {
+                    audio_paths.push_back(dir_path + "/" + d->d_name);
+                }
+            } else if (d->d_type == DT_UNKNOWN) {
+                // Filesystem doesn't support d_type, fall back to stat
+                struct stat entry_stat;
+                if (fstatat(fd, d->d_name, &entry_stat, 0) == 0 &&
+                    S_ISREG(entry_stat.st_mode) && is_audio_extension(d->d_name)) {
+                    audio_paths.push_back(dir_path + "/" + d->d_name);
+                }
+            }
+        }
+    }
+
+    close(fd);
+    return audio_paths.empty() ? 0
+                               : hash_paths({audio_paths.begin(), audio_paths.end()});
+}
+
 }  // namespace ouroboros::util
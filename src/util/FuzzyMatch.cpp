@@ -0,0 +1,66 @@
+#include "util/FuzzyMatch.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ouroboros::util {
+
+FuzzyMatcher::FuzzyMatcher(std::string_view pattern) : pattern_(pattern) {
+    for (unsigned char c : pattern_) {
+        charset_[c >> 6] |= uint64_t(1) << (c & 63);
+    }
+}
+
+bool FuzzyMatcher::charset_contains_all(std::string_view text) const {
+    // Cheap pre-filter: collect the bytes the text contains and check
+    // the pattern's charset is a subset. Ignores order and counts, but
+    // one pass over the row rejects almost every non-match before the
+    // alignment runs.
+    uint64_t seen[4] = {0, 0, 0, 0};
+    for (unsigned char c : text) {
+        seen[c >> 6] |= uint64_t(1) << (c & 63);
+    }
+    for (int w = 0; w < 4; ++w) {
+        if ((charset_[w] & ~seen[w]) != 0) return false;
+    }
+    return true;
+}
+
+std::optional<int> FuzzyMatcher::score(std::string_view text) const {
+    if (pattern_.empty()) return 0;
+    if (pattern_.size() > text.size() || !charset_contains_all(text)) {
+        return std::nullopt;
+    }
+
+    auto is_boundary = [](char c) {
+        return c == ' ' || c == '\n' || c == '/' || c == '-' || c == '_' ||
+               c == '(' || c == '[' || c == '.';
+    };
+
+    int score = 0;
+    int prev_match = -2;  // never adjacent to position 0
+    size_t pos = 0;
+    for (char pc : pattern_) {
+        const char* hit = static_cast<const char*>(
+            std::memchr(text.data() + pos, pc, text.size() - pos));
+        if (!hit) return std::nullopt;
+
+        int i = static_cast<int>(hit - text.data());
+        if (i == prev_match + 1) {
+            score += SCORE_CONSECUTIVE;
+        } else if (i == 0 || is_boundary(text[i - 1])) {
+            score += SCORE_BOUNDARY;
+        } else {
+            score += SCORE_MATCH;
+        }
+        if (prev_match >= 0) {
+            score -= std::min(i - prev_match - 1, MAX_GAP_PENALTY);
+        }
+
+        prev_match = i;
+        pos = static_cast<size_t>(i) + 1;
+    }
+    return score;
+}
+
+}  // namespace ouroboros::util
@@ -1,6 +1,7 @@
 #include "util/ImageDecoderPool.hpp"
 #include "util/Logger.hpp"
-#include <thread>
+#include "util/PerfCounters.hpp"
+#include "util/TaskPool.hpp"
 
 namespace ouroboros::util {
 
@@ -9,102 +10,124 @@ ImageDecoderPool& ImageDecoderPool::instance() {
     return pool;
 }
 
-ImageDecoderPool::ImageDecoderPool() {
-    // Use ALL CPU cores for true parallel processing (like library scanner)
-    size_t num_threads = std::thread::hardware_concurrency();
-    if (num_threads == 0) num_threads = 4; // Fallback
-
-    Logger::info("ImageDecoderPool: Initializing with " + std::to_string(num_threads) + " worker threads");
-
-    // Create worker threads
-    for (size_t i = 0; i < num_threads; ++i) {
-        workers_.emplace_back([this]() {
-            worker_thread();
-        });
+size_t ImageDecoderPool::total_queued_locked() const {
+    size_t total = 0;
+    for (const auto& lane : lanes_) {
+        total += lane.size();
     }
+    return total;
 }
 
-ImageDecoderPool::~ImageDecoderPool() {
-    Logger::info("ImageDecoderPool: Shutting down");
+// Makes room for a job in `lane` by dropping the oldest job from the
+// least urgent non-empty lane below it. Returns false when everything
+// queued is at least as urgent as the newcomer.
+bool ImageDecoderPool::evict_below_locked(Lane lane) {
+    for (size_t l = NUM_LANES - 1; l > static_cast<size_t>(lane); --l) {
+        auto& victims = lanes_[l];
+        if (!victims.empty()) {
+            queued_keys_.erase(victims.front().key);
+            victims.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
 
-    // Signal all threads to stop
+bool ImageDecoderPool::submit_job(const std::string& key, Lane lane, DecodeJob job) {
     {
         std::lock_guard<std::mutex> lock(queue_mutex_);
-        stop_ = true;
-    }
-    cv_.notify_all();
 
-    // Wait for all threads to complete
-    for (auto& worker : workers_) {
-        if (worker.joinable()) {
-            worker.join();
+        // Already queued: keep the original job, move it to the new lane
+        auto it = queued_keys_.find(key);
+        if (it != queued_keys_.end()) {
+            if (it->second != lane) {
+                auto& from = lanes_[static_cast<size_t>(it->second)];
+                for (auto qit = from.begin(); qit != from.end(); ++qit) {
+                    if (qit->key == key) {
+                        lanes_[static_cast<size_t>(lane)].push_back(std::move(*qit));
+                        from.erase(qit);
+                        break;
+                    }
+                }
+                it->second = lane;
+            }
+            return true;
         }
+
+        // Limit queue size to prevent memory explosion during fast
+        // scrolling; urgent work evicts stale speculative work first
+        if (total_queued_locked() >= MAX_QUEUE_SIZE && !evict_below_locked(lane)) {
+            Logger::debug("ImageDecoderPool: Queue full of equally urgent jobs, dropping " + key);
+            return false;
+        }
+
+        lanes_[static_cast<size_t>(lane)].push_back({key, std::move(job)});
+        queued_keys_.emplace(key, lane);
+        PerfCounters::instance().decode_queue_depth.set(
+            static_cast<int64_t>(total_queued_locked()));
     }
 
-    Logger::info("ImageDecoderPool: Shutdown complete");
+    // Execute on the shared pool; visible artwork preempts background
+    // scan/grouping work, the rest queues behind it
+    TaskPool::instance().submit(
+        lane == Lane::Visible ? TaskPool::Priority::High : TaskPool::Priority::Low,
+        [this]() { run_one(); });
+    return true;
 }
 
 bool ImageDecoderPool::submit_job(DecodeJob job) {
+    std::string key;
     {
         std::lock_guard<std::mutex> lock(queue_mutex_);
+        key = "#" + std::to_string(unkeyed_seq_++);
+    }
+    return submit_job(key, Lane::Prefetch, std::move(job));
+}
 
-        // Limit queue size to prevent memory explosion during fast scrolling
-        if (job_queue_.size() >= MAX_QUEUE_SIZE) {
-            Logger::debug("ImageDecoderPool: Queue full (" + std::to_string(job_queue_.size()) +
-                         " jobs), dropping job");
-            return false;
+bool ImageDecoderPool::cancel(const std::string& key) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    auto it = queued_keys_.find(key);
+    if (it == queued_keys_.end()) return false;
+
+    auto& lane = lanes_[static_cast<size_t>(it->second)];
+    for (auto qit = lane.begin(); qit != lane.end(); ++qit) {
+        if (qit->key == key) {
+            lane.erase(qit);
+            break;
         }
-
-        job_queue_.push(std::move(job));
     }
-
-    // Notify one worker thread
-    cv_.notify_one();
+    queued_keys_.erase(it);
+    PerfCounters::instance().decode_queue_depth.set(
+        static_cast<int64_t>(total_queued_locked()));
     return true;
 }
 
 size_t ImageDecoderPool::get_queue_size() const {
     std::lock_guard<std::mutex> lock(queue_mutex_);
-    return job_queue_.size();
+    return total_queued_locked();
 }
 
-void ImageDecoderPool::worker_thread() {
-    Logger::debug("ImageDecoderPool: Worker thread " +
-                  std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) +
-                  " started");
-
-    while (!stop_) {
-        DecodeJob job;
-
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-
-            // Wait for job or stop signal
-            cv_.wait(lock, [this]() {
-                return stop_ || !job_queue_.empty();
-            });
-
-            // Check stop condition after wake up
-            if (stop_ && job_queue_.empty()) {
+void ImageDecoderPool::run_one() {
+    DecodeJob job;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        // Most urgent lane first; a ticket posted for an evicted or
+        // cancelled job may find nothing, which is fine
+        for (auto& lane : lanes_) {
+            if (!lane.empty()) {
+                job = std::move(lane.front().job);
+                queued_keys_.erase(lane.front().key);
+                lane.pop_front();
                 break;
             }
-
-            // Get next job
-            if (!job_queue_.empty()) {
-                job = std::move(job_queue_.front());
-                job_queue_.pop();
-            }
-        }
-
-        // Execute job outside the lock (true parallel processing)
-        if (job) {
-            job();
         }
+        PerfCounters::instance().decode_queue_depth.set(
+            static_cast<int64_t>(total_queued_locked()));
     }
 
-    Logger::debug("ImageDecoderPool: Worker thread " +
-                  std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) +
-                  " stopped");
+    if (job) {
+        job();
+    }
 }
 
 } // namespace ouroboros::util
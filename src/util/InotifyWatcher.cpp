@@ -0,0 +1,128 @@
+#include "util/InotifyWatcher.hpp"
+#include "util/DirectoryScanner.hpp"
+#include "util/Logger.hpp"
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+
+namespace ouroboros::util {
+
+namespace {
+constexpr uint32_t WATCH_MASK =
+    IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_TO | IN_MOVED_FROM;
+}
+
+InotifyWatcher::InotifyWatcher(const std::vector<std::filesystem::path>& roots) {
+    fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_ < 0) {
+        util::Logger::warn("InotifyWatcher: inotify_init1 failed - live rescans disabled");
+        return;
+    }
+
+    for (const auto& root : roots) {
+        std::string s = root.string();
+        while (s.length() > 1 && s.back() == '/') s.pop_back();
+        add_watch_recursive(s, nullptr);
+    }
+    util::Logger::info("InotifyWatcher: Watching " + std::to_string(wd_to_dir_.size()) +
+                       " directories");
+}
+
+InotifyWatcher::~InotifyWatcher() {
+    if (fd_ >= 0) close(fd_);
+}
+
+void InotifyWatcher::add_watch_recursive(const std::string& dir, Changes* report_contents) {
+    int wd = inotify_add_watch(fd_, dir.c_str(), WATCH_MASK);
+    if (wd < 0) {
+        util::Logger::debug("InotifyWatcher: Failed to watch " + dir);
+        return;
+    }
+    wd_to_dir_[wd] = dir;
+
+    // Enumerate children: subdirectories need their own watches, and
+    // when reporting (newly created subtree) any files that landed
+    // before the watch became active must be surfaced too.
+    std::error_code ec;
+    for (auto it = std::filesystem::directory_iterator(dir, ec);
+         !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+        const auto& entry = *it;
+        if (entry.is_directory(ec)) {
+            add_watch_recursive(entry.path().string(), report_contents);
+        } else if (report_contents && entry.is_regular_file(ec)) {
+            std::string path = entry.path().string();
+            if (DirectoryScanner::is_audio_extension(path.c_str())) {
+                report_contents->changed_files.push_back(std::move(path));
+            }
+        }
+    }
+}
+
+void InotifyWatcher::remove_watches_under(const std::string& dir) {
+    for (auto it = wd_to_dir_.begin(); it != wd_to_dir_.end();) {
+        const std::string& watched = it->second;
+        bool under = watched == dir ||
+                     (watched.size() > dir.size() && watched.starts_with(dir) &&
+                      watched[dir.size()] == '/');
+        if (under) {
+            inotify_rm_watch(fd_, it->first);
+            it = wd_to_dir_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool InotifyWatcher::poll(Changes& out, int timeout_ms) {
+    if (fd_ < 0) return false;
+
+    struct pollfd pfd = {fd_, POLLIN, 0};
+    int ready = ::poll(&pfd, 1, timeout_ms);
+    if (ready <= 0) return false;
+
+    bool any = false;
+    alignas(inotify_event) char buffer[64 * 1024];
+    while (true) {
+        ssize_t n = read(fd_, buffer, sizeof(buffer));
+        if (n <= 0) break;  // EAGAIN: drained
+
+        for (ssize_t pos = 0; pos < n;) {
+            const auto* ev = reinterpret_cast<const inotify_event*>(buffer + pos);
+            pos += sizeof(inotify_event) + ev->len;
+
+            auto dir_it = wd_to_dir_.find(ev->wd);
+            if (dir_it == wd_to_dir_.end() || ev->len == 0) continue;
+
+            std::string full_path = dir_it->second + "/" + ev->name;
+
+            if (ev->mask & IN_ISDIR) {
+                if (ev->mask & (IN_CREATE | IN_MOVED_TO)) {
+                    // New album directory: watch it and report whatever
+                    // is already inside
+                    add_watch_recursive(full_path, &out);
+                    any = true;
+                } else if (ev->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                    remove_watches_under(full_path);
+                    out.deleted_dirs.push_back(std::move(full_path));
+                    any = true;
+                }
+                continue;
+            }
+
+            if (!DirectoryScanner::is_audio_extension(ev->name)) continue;
+
+            if (ev->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                out.changed_files.push_back(std::move(full_path));
+                any = true;
+            } else if (ev->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                out.deleted_files.push_back(std::move(full_path));
+                any = true;
+            }
+        }
+    }
+
+    return any;
+}
+
+}  // namespace ouroboros::util
@@ -2,53 +2,190 @@
 
 #ifdef OUROBOROS_ENABLE_LOGGING
 
-#include <iostream>
-#include <fstream>
-#include <iomanip>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
 #include <ctime>
-#include <mutex>
 #include <format>
+#include <fstream>
+#include <mutex>
+#include <thread>
 
 namespace ouroboros::util {
 
-static std::mutex log_mutex;
-static std::ofstream log_file;  // Keep file open for performance
+namespace {
 
-void Logger::init() {
-    std::lock_guard<std::mutex> lock(log_mutex);
-    // Close existing file if open
-    if (log_file.is_open()) {
-        log_file.close();
+// Async pipeline: callers claim a cell in a bounded lock-free MPSC ring
+// (Vyukov-style sequence numbers) and return immediately; one writer
+// thread drains the ring, formats timestamps and flushes in batches.
+// The old implementation formatted and fsync'd under a global mutex at
+// every call site - including the decode loop.
+constexpr size_t RING_SIZE = 2048;  // Power of two
+constexpr size_t RING_MASK = RING_SIZE - 1;
+constexpr size_t BATCH_MAX = 256;   // Cells drained per write/flush
+
+struct Cell {
+    std::atomic<size_t> seq;
+    Logger::Level level;
+    std::time_t wall;
+    std::string text;
+};
+
+std::atomic<int> min_level{static_cast<int>(Logger::Level::Debug)};
+
+std::string_view level_tag(Logger::Level level) {
+    switch (level) {
+        case Logger::Level::Debug: return "[DEBUG] ";
+        case Logger::Level::Info:  return "[INFO]  ";
+        case Logger::Level::Warn:  return "[WARN]  ";
+        case Logger::Level::Error: return "[ERROR] ";
     }
-    // Open log file once
-    log_file.open("/tmp/ouroboros_debug.log", std::ios::trunc);
+    return "[?????] ";
 }
 
-void Logger::log(Level level, const std::string& message) {
-    std::lock_guard<std::mutex> lock(log_mutex);
-    if (!log_file.is_open()) {
-        // Fallback: open if not initialized
-        log_file.open("/tmp/ouroboros_debug.log", std::ios::app);
+struct LogCore {
+    Cell ring[RING_SIZE];
+    std::atomic<size_t> head{0};  // Producers claim via CAS
+    size_t tail = 0;              // Writer thread only
+    std::atomic<size_t> dropped{0};
+    std::atomic<bool> stop{false};
+    std::atomic<bool> sleeping{false};
+    std::mutex wake_mutex;
+    std::condition_variable wake_cv;
+    std::ofstream file;
+    std::thread writer;
+
+    LogCore() {
+        for (size_t i = 0; i < RING_SIZE; ++i) {
+            ring[i].seq.store(i, std::memory_order_relaxed);
+        }
     }
-    if (!log_file) return;
 
-    // Timestamp
-    auto now = std::time(nullptr);
-    auto tm = *std::localtime(&now);
+    // Static-destruction flush: drain whatever is queued, then stop
+    ~LogCore() {
+        stop.store(true, std::memory_order_release);
+        wake_cv.notify_one();
+        if (writer.joinable()) {
+            writer.join();
+        }
+    }
 
-    std::string_view level_str;
-    switch (level) {
-        case Level::Debug: level_str = "[DEBUG] "; break;
-        case Level::Info:  level_str = "[INFO]  "; break;
-        case Level::Warn:  level_str = "[WARN]  "; break;
-        case Level::Error: level_str = "[ERROR] "; break;
+    void start(bool truncate) {
+        file.open("/tmp/ouroboros_debug.log",
+                  truncate ? std::ios::trunc : std::ios::app);
+        writer = std::thread([this] { run(); });
+    }
+
+    bool enqueue(Logger::Level level, const std::string& message) {
+        for (;;) {
+            size_t pos = head.load(std::memory_order_relaxed);
+            Cell& cell = ring[pos & RING_MASK];
+            size_t seq = cell.seq.load(std::memory_order_acquire);
+            auto dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (dif == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.level = level;
+                    cell.wall = std::time(nullptr);
+                    cell.text = message;
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (dif < 0) {
+                return false;  // Ring full: drop rather than block the caller
+            }
+            // dif > 0: another producer won the cell; retry at new head
+        }
+    }
+
+    // Drain up to BATCH_MAX cells into one buffer; returns entries taken
+    size_t drain(std::string& batch) {
+        size_t taken = 0;
+        while (taken < BATCH_MAX) {
+            Cell& cell = ring[tail & RING_MASK];
+            size_t seq = cell.seq.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail + 1) != 0) {
+                break;  // Cell not published yet
+            }
+
+            char tbuf[16];
+            std::tm tm{};
+            localtime_r(&cell.wall, &tm);
+            std::strftime(tbuf, sizeof(tbuf), "[%H:%M:%S] ", &tm);
+            batch += tbuf;
+            batch += std::format("{}{}\n", level_tag(cell.level), cell.text);
+
+            cell.text.clear();
+            cell.text.shrink_to_fit();
+            cell.seq.store(tail + RING_SIZE, std::memory_order_release);
+            ++tail;
+            ++taken;
+        }
+        return taken;
     }
 
-    // PHASE #1: Mix legacy time formatting (for robust std::tm support)
-    // with C++20 std::format for the message body (efficient allocation).
-    log_file << std::put_time(&tm, "[%H:%M:%S] ");
-    log_file << std::format("{}{}\n", level_str, message);
-    log_file.flush();  // Ensure writes are visible immediately
+    void run() {
+        std::string batch;
+        batch.reserve(16 * 1024);
+        for (;;) {
+            size_t taken = drain(batch);
+
+            if (size_t lost = dropped.exchange(0, std::memory_order_relaxed)) {
+                batch += std::format("[WARN]  Logger: dropped {} messages (ring full)\n", lost);
+            }
+
+            if (!batch.empty() && file.is_open()) {
+                file << batch;
+                file.flush();
+            }
+            batch.clear();
+
+            if (taken == 0) {
+                if (stop.load(std::memory_order_acquire)) {
+                    break;  // Final drain above already ran empty
+                }
+                sleeping.store(true, std::memory_order_release);
+                std::unique_lock<std::mutex> lock(wake_mutex);
+                wake_cv.wait_for(lock, std::chrono::milliseconds(100));
+                sleeping.store(false, std::memory_order_release);
+            }
+        }
+    }
+};
+
+std::once_flag core_started;
+LogCore& core(bool truncate = false) {
+    static LogCore instance;
+    std::call_once(core_started, [&] { instance.start(truncate); });
+    return instance;
+}
+
+}  // namespace
+
+void Logger::init() {
+    // First caller decides truncate-vs-append; init before any logging
+    // gets the fresh file the old synchronous logger produced
+    core(true);
+}
+
+void Logger::set_min_level(Level level) {
+    min_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+void Logger::log(Level level, const std::string& message) {
+    // Single atomic branch: suppressed levels pay no time lookup, no
+    // formatting and no ring traffic
+    if (static_cast<int>(level) < min_level.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    LogCore& c = core();
+    if (!c.enqueue(level, message)) {
+        c.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (c.sleeping.load(std::memory_order_acquire)) {
+        c.wake_cv.notify_one();
+    }
 }
 
 void Logger::debug(const std::string& message) { log(Level::Debug, message); }
@@ -64,6 +201,7 @@ void Logger::error(const std::string& message) { log(Level::Error, message); }
 namespace ouroboros::util {
 
 void Logger::init() {}
+void Logger::set_min_level(Level) {}
 void Logger::log(Level, const std::string&) {}
 void Logger::debug(const std::string&) {}
 void Logger::info(const std::string&) {}
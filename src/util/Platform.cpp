@@ -2,6 +2,11 @@
 #include "util/Logger.hpp"
 #include <cstdlib>
 #include <algorithm>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 namespace ouroboros::util {
 
@@ -68,4 +73,56 @@ std::string Platform::get_audio_format(const std::filesystem::path& path) {
     return "";
 }
 
+void Platform::set_current_thread_role(ThreadRole role) {
+    switch (role) {
+        case ThreadRole::AudioDecode: {
+            // FIFO 10 sits below PipeWire's RT threads (typically 20+)
+            // but above every normal-class thread in the process
+            sched_param sp{};
+            sp.sched_priority = 10;
+            if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp) == 0) {
+                Logger::info("Platform: Audio decode thread running SCHED_FIFO(10)");
+                return;
+            }
+            // No RT privilege (the common case without rtkit/limits
+            // setup): a negative nice still wins every CFS contest
+            // against the idle-class bulk workers
+            if (setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), -10) == 0) {
+                Logger::info("Platform: Audio decode thread running nice -10 (no RT privilege)");
+            } else {
+                Logger::debug("Platform: No scheduling privilege; audio decode thread at default priority");
+            }
+            break;
+        }
+        case ThreadRole::BulkWorker: {
+            sched_param sp{};  // SCHED_IDLE requires priority 0
+            if (pthread_setschedparam(pthread_self(), SCHED_IDLE, &sp) != 0) {
+                // Should not happen (SCHED_IDLE needs no privilege);
+                // a positive nice is the next best thing
+                setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), 15);
+            }
+            // Idle I/O class: scan reads yield the queue to playback
+            // reads entirely. No glibc wrapper, so raw syscall;
+            // class 3 = IOPRIO_CLASS_IDLE, shifted into bits 15-13.
+            constexpr int IOPRIO_WHO_PROCESS = 1;
+            constexpr int IOPRIO_CLASS_IDLE_VALUE = 3 << 13;
+            syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, 0, IOPRIO_CLASS_IDLE_VALUE);
+            break;
+        }
+    }
+}
+
+bool Platform::pin_current_thread_to_cpu(int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        Logger::warn("Platform: Failed to pin thread to CPU " + std::to_string(cpu));
+        return false;
+    }
+    Logger::info("Platform: Thread pinned to CPU " + std::to_string(cpu));
+    return true;
+}
+
 }  // namespace ouroboros::util
@@ -0,0 +1,119 @@
+#include "util/TaskPool.hpp"
+#include "util/Logger.hpp"
+
+namespace ouroboros::util {
+
+TaskPool& TaskPool::instance() {
+    static TaskPool pool;
+    return pool;
+}
+
+TaskPool::TaskPool() {
+    size_t num_threads = std::thread::hardware_concurrency();
+    if (num_threads == 0) num_threads = 4;
+
+    Logger::info("TaskPool: Starting " + std::to_string(num_threads) + " shared workers");
+
+    workers_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back([this]() { worker_thread(); });
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    Logger::info("TaskPool: Shutdown complete");
+}
+
+void TaskPool::submit(Priority priority, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (priority == Priority::High) {
+            high_queue_.push_back(std::move(task));
+        } else {
+            low_queue_.push_back(std::move(task));
+        }
+    }
+    cv_.notify_one();
+}
+
+void TaskPool::run_parallel(size_t count, const std::function<void(size_t)>& fn,
+                            Priority priority) {
+    if (count == 0) return;
+
+    // Shared claim index + completion count; helpers and the caller all
+    // pull from the same index so load balances automatically.
+    auto work_index = std::make_shared<std::atomic<size_t>>(0);
+    auto completed = std::make_shared<std::atomic<size_t>>(0);
+    auto done_mutex = std::make_shared<std::mutex>();
+    auto done_cv = std::make_shared<std::condition_variable>();
+
+    auto drain = [count, &fn, work_index, completed, done_mutex, done_cv]() {
+        size_t local_done = 0;
+        while (true) {
+            size_t idx = work_index->fetch_add(1, std::memory_order_relaxed);
+            if (idx >= count) break;
+            fn(idx);
+            local_done++;
+        }
+        if (local_done > 0 &&
+            completed->fetch_add(local_done, std::memory_order_acq_rel) + local_done == count) {
+            std::lock_guard<std::mutex> lock(*done_mutex);
+            done_cv->notify_all();
+        }
+    };
+
+    // One helper per worker is enough: each loops until the index runs out.
+    size_t helpers = std::min(worker_count(), count > 0 ? count - 1 : 0);
+    for (size_t i = 0; i < helpers; ++i) {
+        submit(priority, drain);
+    }
+
+    // Caller participates, then waits for helpers still mid-item.
+    drain();
+
+    std::unique_lock<std::mutex> lock(*done_mutex);
+    done_cv->wait(lock, [&]() {
+        return completed->load(std::memory_order_acquire) == count;
+    });
+}
+
+void TaskPool::worker_thread() {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            cv_.wait(lock, [this]() {
+                return stop_ || !high_queue_.empty() || !low_queue_.empty();
+            });
+
+            if (stop_ && high_queue_.empty() && low_queue_.empty()) {
+                break;
+            }
+
+            // High-priority work always preempts background batches
+            if (!high_queue_.empty()) {
+                task = std::move(high_queue_.front());
+                high_queue_.pop_front();
+            } else if (!low_queue_.empty()) {
+                task = std::move(low_queue_.front());
+                low_queue_.pop_front();
+            }
+        }
+
+        if (task) {
+            task();
+        }
+    }
+}
+
+}  // namespace ouroboros::util
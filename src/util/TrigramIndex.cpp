@@ -0,0 +1,63 @@
+#include "util/TrigramIndex.hpp"
+
+#include <algorithm>
+
+namespace ouroboros::util {
+
+void TrigramIndex::build(size_t item_count,
+                         const std::function<std::string_view(size_t)>& key_at) {
+    postings_.clear();
+    item_count_ = item_count;
+
+    for (size_t i = 0; i < item_count; ++i) {
+        std::string_view key = key_at(i);
+        if (key.size() < MIN_QUERY_BYTES) continue;
+
+        for (size_t pos = 0; pos + MIN_QUERY_BYTES <= key.size(); ++pos) {
+            auto& list = postings_[pack(key.data() + pos)];
+            // Keys repeat trigrams ("banana"); items arrive in order,
+            // so a duplicate can only be the last entry
+            if (list.empty() || list.back() != static_cast<int>(i)) {
+                list.push_back(static_cast<int>(i));
+            }
+        }
+    }
+}
+
+bool TrigramIndex::candidates(std::string_view query, std::vector<int>& out) const {
+    out.clear();
+    if (query.size() < MIN_QUERY_BYTES) return false;
+
+    // Collect the posting list of every distinct query trigram; one
+    // miss means no key contains the query
+    std::vector<const std::vector<int>*> lists;
+    lists.reserve(query.size());
+    for (size_t pos = 0; pos + MIN_QUERY_BYTES <= query.size(); ++pos) {
+        auto it = postings_.find(pack(query.data() + pos));
+        if (it == postings_.end()) return true;
+        lists.push_back(&it->second);
+    }
+    // Rarest first; pointer tie-break groups repeated trigrams for unique()
+    std::sort(lists.begin(), lists.end(), [](const auto* a, const auto* b) {
+        return a->size() != b->size() ? a->size() < b->size() : a < b;
+    });
+    lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+    // Start from the rarest list and narrow it against the others; the
+    // candidate set only shrinks, so each pass binary-searches the next
+    // list for the few survivors rather than walking it
+    out = *lists.front();
+    for (size_t l = 1; l < lists.size() && !out.empty(); ++l) {
+        const auto& list = *lists[l];
+        size_t kept = 0;
+        for (int idx : out) {
+            if (std::binary_search(list.begin(), list.end(), idx)) {
+                out[kept++] = idx;
+            }
+        }
+        out.resize(kept);
+    }
+    return true;
+}
+
+}  // namespace ouroboros::util
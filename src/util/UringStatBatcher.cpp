@@ -0,0 +1,187 @@
+#include "util/UringStatBatcher.hpp"
+#include "util/Logger.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include <atomic>
+#include <cstring>
+
+namespace ouroboros::util {
+
+namespace {
+
+long uring_setup(unsigned entries, io_uring_params* params) {
+    return syscall(SYS_io_uring_setup, entries, params);
+}
+
+long uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+    return syscall(SYS_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0);
+}
+
+}  // namespace
+
+UringStatBatcher::UringStatBatcher() {
+    io_uring_params params{};
+    long fd = uring_setup(QUEUE_DEPTH, &params);
+    if (fd < 0) {
+        // Old kernel or seccomp; callers fall back to fstatat
+        return;
+    }
+
+    // Map the SQ ring, CQ ring and SQE array. With FEAT_SINGLE_MMAP the
+    // SQ and CQ rings share one mapping.
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap && cq_ring_size_ > sq_ring_size_) {
+        sq_ring_size_ = cq_ring_size_;
+    }
+
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+        sq_ring_ = nullptr;
+        close(static_cast<int>(fd));
+        return;
+    }
+
+    if (single_mmap) {
+        cq_ring_ = sq_ring_;
+    } else {
+        cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (cq_ring_ == MAP_FAILED) {
+            cq_ring_ = nullptr;
+            munmap(sq_ring_, sq_ring_size_);
+            sq_ring_ = nullptr;
+            close(static_cast<int>(fd));
+            return;
+        }
+    }
+
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(mmap(nullptr, sqes_size_,
+                                            PROT_READ | PROT_WRITE,
+                                            MAP_SHARED | MAP_POPULATE, fd,
+                                            IORING_OFF_SQES));
+    if (sqes_ == MAP_FAILED) {
+        sqes_ = nullptr;
+        if (cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+        munmap(sq_ring_, sq_ring_size_);
+        sq_ring_ = cq_ring_ = nullptr;
+        close(static_cast<int>(fd));
+        return;
+    }
+
+    auto* sq_base = static_cast<char*>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.array);
+
+    auto* cq_base = static_cast<char*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+
+    pending_.reserve(QUEUE_DEPTH);
+    ring_fd_ = static_cast<int>(fd);
+}
+
+UringStatBatcher::~UringStatBatcher() {
+    teardown();
+}
+
+void UringStatBatcher::teardown() {
+    if (sqes_) munmap(sqes_, sqes_size_);
+    if (cq_ring_ && cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+    if (sq_ring_) munmap(sq_ring_, sq_ring_size_);
+    sqes_ = nullptr;
+    sq_ring_ = cq_ring_ = nullptr;
+    if (ring_fd_ >= 0) {
+        close(ring_fd_);
+        ring_fd_ = -1;
+    }
+}
+
+void UringStatBatcher::queue(const std::string& abs_path, std::time_t& out_mtime) {
+    if (pending_.size() >= QUEUE_DEPTH) {
+        flush();
+    }
+    Pending& p = pending_.emplace_back();
+    p.path = abs_path;
+    p.dest = &out_mtime;
+}
+
+void UringStatBatcher::flush() {
+    if (pending_.empty() || ring_fd_ < 0) return;
+
+    const unsigned count = static_cast<unsigned>(pending_.size());
+    const unsigned mask = *sq_mask_;
+    unsigned tail = *sq_tail_;
+
+    for (unsigned i = 0; i < count; i++) {
+        Pending& p = pending_[i];
+        unsigned idx = tail & mask;
+        io_uring_sqe& sqe = sqes_[idx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_STATX;
+        sqe.fd = AT_FDCWD;
+        sqe.addr = reinterpret_cast<uint64_t>(p.path.c_str());
+        sqe.len = STATX_MTIME;
+        sqe.off = reinterpret_cast<uint64_t>(p.statx_buf);
+        sqe.statx_flags = 0;
+        sqe.user_data = i;
+        sq_array_[idx] = idx;
+        tail++;
+    }
+
+    // Publish the new tail before the kernel reads it
+    std::atomic_ref<unsigned>(*sq_tail_).store(tail, std::memory_order_release);
+
+    unsigned completed = 0;
+    bool submitted = false;
+    while (completed < count) {
+        long ret = uring_enter(ring_fd_, submitted ? 0 : count,
+                               count - completed, IORING_ENTER_GETEVENTS);
+        if (ret < 0) {
+            if (errno == EINTR) continue;
+            util::Logger::error("UringStatBatcher: io_uring_enter failed, "
+                                "falling back to synchronous statx");
+            // Service the remainder synchronously so no mtime is left stale
+            for (unsigned i = 0; i < count; i++) {
+                struct stat st;
+                if (pending_[i].dest && stat(pending_[i].path.c_str(), &st) == 0) {
+                    *pending_[i].dest = st.st_mtime;
+                }
+            }
+            teardown();
+            pending_.clear();
+            return;
+        }
+        submitted = true;
+
+        // Drain completions
+        unsigned head = std::atomic_ref<unsigned>(*cq_head_).load(std::memory_order_relaxed);
+        unsigned cq_tail = std::atomic_ref<unsigned>(*cq_tail_).load(std::memory_order_acquire);
+        while (head != cq_tail) {
+            const io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+            if (cqe.user_data < count && cqe.res == 0) {
+                Pending& p = pending_[static_cast<size_t>(cqe.user_data)];
+                const auto* stx = reinterpret_cast<const struct statx*>(p.statx_buf);
+                *p.dest = static_cast<std::time_t>(stx->stx_mtime.tv_sec);
+            }
+            head++;
+            completed++;
+        }
+        std::atomic_ref<unsigned>(*cq_head_).store(head, std::memory_order_release);
+    }
+
+    pending_.clear();
+}
+
+}  // namespace ouroboros::util
@@ -0,0 +1,235 @@
+// Microbenchmarks for the algorithmic cores. Run via the bench_core
+// target; compare ns/op between runs on the same machine to catch
+// regressions. Keep cases deterministic (fixed seeds, fixed sizes).
+
+#include "../framework/SimpleBench.hpp"
+
+#include "backend/SnapshotBuffers.hpp"
+#include "audio/AudioRingBuffer.hpp"
+#include "audio/SampleConvert.hpp"
+#include "ui/Canvas.hpp"
+#include "util/BoyerMoore.hpp"
+#include "util/DirectoryScanner.hpp"
+#include "util/TimSort.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ouroboros;
+
+namespace {
+
+std::vector<int> make_random_ints(size_t n, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> v(n);
+    for (auto& x : v) x = static_cast<int>(rng());
+    return v;
+}
+
+// Synthetic library-shaped text: repeated words with the needle absent
+// until the very end (worst-ish case for the skip loop).
+std::string make_haystack(size_t size) {
+    static const char* words[] = {"album", "artist", "track", "genre", "year", "flac"};
+    std::string s;
+    s.reserve(size + 16);
+    size_t i = 0;
+    while (s.size() < size) {
+        s += words[i++ % 6];
+        s += ' ';
+    }
+    s += "needle";
+    return s;
+}
+
+}  // namespace
+
+// ─── parallel_timsort ───────────────────────────────────────────────────
+
+BENCH_CASE(bench_timsort_random_100k) {
+    auto base = make_random_ints(100'000, 42);
+    state.set_items_per_op(base.size());
+    while (state.keep_running()) {
+        auto v = base;
+        util::timsort(v, std::less<int>());
+    }
+}
+
+BENCH_CASE(bench_parallel_timsort_random_100k) {
+    auto base = make_random_ints(100'000, 42);
+    state.set_items_per_op(base.size());
+    while (state.keep_running()) {
+        auto v = base;
+        util::parallel_timsort(v, std::less<int>());
+    }
+}
+
+BENCH_CASE(bench_parallel_timsort_presorted_100k) {
+    auto base = make_random_ints(100'000, 42);
+    std::sort(base.begin(), base.end());
+    state.set_items_per_op(base.size());
+    while (state.keep_running()) {
+        auto v = base;
+        util::parallel_timsort(v, std::less<int>());
+    }
+}
+
+// ─── BoyerMooreSearch ───────────────────────────────────────────────────
+
+BENCH_CASE(bench_boyer_moore_1mb_late_match) {
+    auto haystack = make_haystack(1 << 20);
+    util::BoyerMooreSearch searcher("needle");
+    state.set_bytes_per_op(haystack.size());
+    while (state.keep_running()) {
+        volatile int pos = searcher.search(haystack);
+        (void)pos;
+    }
+}
+
+BENCH_CASE(bench_boyer_moore_1mb_no_match) {
+    auto haystack = make_haystack(1 << 20);
+    util::BoyerMooreSearch searcher("zzqxv");
+    state.set_bytes_per_op(haystack.size());
+    while (state.keep_running()) {
+        volatile int pos = searcher.search(haystack);
+        (void)pos;
+    }
+}
+
+// ─── DirectoryScanner ───────────────────────────────────────────────────
+
+BENCH_CASE(bench_directory_scan_1k_files) {
+    // Build a temp tree once: 32 dirs x 32 files
+    auto root = std::filesystem::temp_directory_path() / "ouroboros_bench_scan";
+    if (!std::filesystem::exists(root)) {
+        for (int d = 0; d < 32; ++d) {
+            auto dir = root / ("dir" + std::to_string(d));
+            std::filesystem::create_directories(dir);
+            for (int f = 0; f < 32; ++f) {
+                std::ofstream(dir / ("track" + std::to_string(f) + ".mp3")) << "x";
+            }
+        }
+    }
+    state.set_items_per_op(32 * 32);
+    while (state.keep_running()) {
+        auto result = util::DirectoryScanner::scan_directory(root);
+        if (result.files.size() != 32 * 32) {
+            std::fprintf(stderr, "scan returned %zu files\n", result.files.size());
+        }
+    }
+}
+
+// ─── SnapshotBuffers::publish ───────────────────────────────────────────
+
+BENCH_CASE(bench_snapshot_publish) {
+    backend::SnapshotBuffers buffers;
+
+    // Realistic payload: a shared library with 10k tracks. publish()
+    // must stay O(1) in this - the whole point of the COW design.
+    auto lib = std::make_shared<model::LibraryState>();
+    std::vector<model::Track> tracks(10'000);
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        tracks[i].path = "/music/album/track" + std::to_string(i) + ".flac";
+        tracks[i].artist = "Artist";
+        tracks[i].album = "Album";
+    }
+    lib->tracks = std::move(tracks);
+    buffers.back().library = lib;
+    buffers.publish();
+
+    while (state.keep_running()) {
+        buffers.back().player.playback_position_ms++;
+        buffers.publish();
+    }
+}
+
+// ─── Canvas frame diff ──────────────────────────────────────────────────
+
+BENCH_CASE(bench_canvas_diff_300x80_one_dirty_row) {
+    // The steady-state flush: a position timer changed one row of a
+    // 300x80 terminal. row_differs must dismiss the other 79 rows with
+    // block compares; changed_spans walks only the damaged one.
+    ui::Canvas prev(300, 80), cur(300, 80);
+    for (int y = 0; y < 80; ++y) {
+        for (int x = 0; x < 300; x += 3) {
+            cur.put(x, y, "a", {});
+            prev.put(x, y, "a", {});
+        }
+    }
+    cur.draw_text(10, 40, "03:14 / 05:12", {});
+
+    std::vector<std::pair<int, int>> spans;
+    state.set_items_per_op(300 * 80);
+
+    while (state.keep_running()) {
+        for (int y = 0; y < 80; ++y) {
+            if (!cur.row_differs(prev, y)) continue;
+            spans.clear();
+            cur.changed_spans(prev, y, spans);
+        }
+    }
+}
+
+// ─── AudioRingBuffer ────────────────────────────────────────────────────
+
+BENCH_CASE(bench_ring_buffer_write_read_512f) {
+    audio::AudioRingBuffer ring;
+    ring.init(8192, 2);
+
+    std::vector<float> in(512 * 2, 0.5f);
+    std::vector<float> out(512 * 2);
+    state.set_bytes_per_op(in.size() * sizeof(float));
+
+    while (state.keep_running()) {
+        ring.write(in.data(), 512);
+        ring.read(out.data(), 512);
+    }
+}
+
+// ─── SampleConvert ──────────────────────────────────────────────────────
+
+BENCH_CASE(bench_s16_to_float_8k_samples) {
+    std::mt19937 rng(99);
+    std::vector<short> in(8192);
+    for (auto& s : in) s = static_cast<short>(rng());
+    std::vector<float> out(in.size());
+    state.set_bytes_per_op(in.size() * sizeof(short));
+
+    while (state.keep_running()) {
+        audio::convert_s16_to_float(in.data(), out.data(), in.size());
+    }
+}
+
+BENCH_CASE(bench_interleave_stereo_4k_frames) {
+    std::vector<float> left(4096, 0.25f);
+    std::vector<float> right(4096, -0.25f);
+    std::vector<float> out(4096 * 2);
+    const float* planes[2] = {left.data(), right.data()};
+    state.set_bytes_per_op(out.size() * sizeof(float));
+
+    while (state.keep_running()) {
+        audio::interleave_planar_float(planes, 2, out.data(), 4096);
+    }
+}
+
+BENCH_CASE(bench_dot_product_424_taps) {
+    // DSD256 decimation filter length
+    std::vector<float> taps(424), window(424);
+    for (size_t i = 0; i < taps.size(); ++i) {
+        taps[i] = static_cast<float>(i % 7) * 0.01f;
+        window[i] = (i % 2) ? 1.0f : -1.0f;
+    }
+    state.set_bytes_per_op(taps.size() * 2 * sizeof(float));
+
+    while (state.keep_running()) {
+        volatile float s = audio::dot_product(taps.data(), window.data(), taps.size());
+        (void)s;
+    }
+}
+
+int main(int argc, char** argv) {
+    return ouroboros::bench::BenchRunner::instance().run_all(argc, argv);
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace ouroboros::bench {
+
+// Microbenchmark harness in the SimpleTest.hpp mold: self-registering
+// cases, no external dependencies, plain-text report.
+//
+// Each case receives a BenchState and loops `while (state.keep_running())`;
+// the harness calibrates the iteration count to hit a target wall time,
+// then reports ns/op and (when the case sets bytes/items per op)
+// throughput. Results are for comparing runs on the SAME machine -
+// absolute numbers vary with hardware and governor settings.
+class BenchState {
+public:
+    explicit BenchState(uint64_t iterations) : remaining_(iterations), total_(iterations) {}
+
+    bool keep_running() {
+        if (started_ == false) {
+            started_ = true;
+            start_ = std::chrono::steady_clock::now();
+        }
+        if (remaining_ == 0) {
+            end_ = std::chrono::steady_clock::now();
+            return false;
+        }
+        remaining_--;
+        return true;
+    }
+
+    // Optional: per-op volume for throughput reporting
+    void set_bytes_per_op(uint64_t bytes) { bytes_per_op_ = bytes; }
+    void set_items_per_op(uint64_t items) { items_per_op_ = items; }
+
+    [[nodiscard]] uint64_t iterations() const { return total_; }
+    [[nodiscard]] uint64_t bytes_per_op() const { return bytes_per_op_; }
+    [[nodiscard]] uint64_t items_per_op() const { return items_per_op_; }
+    [[nodiscard]] std::chrono::nanoseconds elapsed() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(end_ - start_);
+    }
+
+private:
+    uint64_t remaining_;
+    uint64_t total_;
+    uint64_t bytes_per_op_ = 0;
+    uint64_t items_per_op_ = 0;
+    bool started_ = false;
+    std::chrono::steady_clock::time_point start_{};
+    std::chrono::steady_clock::time_point end_{};
+};
+
+class BenchRunner {
+public:
+    static BenchRunner& instance() {
+        static BenchRunner instance;
+        return instance;
+    }
+
+    void register_bench(const std::string& name, std::function<void(BenchState&)> func) {
+        benches_.push_back({name, std::move(func)});
+    }
+
+    /// Informational run: print ns/op and throughput, never fail
+    int run_all() { return run_all(0, nullptr); }
+
+    /// Regression-gate run. Flags:
+    ///   --baseline <file>      compare against a stored baseline; a case
+    ///                          more than 15% slower fails the suite
+    ///   --baseline-dir <dir>   like --baseline with <dir>/<hostname>.txt,
+    ///                          so each machine commits its own file
+    ///   --write-baseline       rewrite the baseline from this run
+    /// Baselines are per-machine wall times; comparing across hosts (or
+    /// across governor settings) is meaningless, hence the hostname key.
+    int run_all(int argc, char** argv) {
+        std::string baseline_path;
+        bool write_baseline = false;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--baseline" && i + 1 < argc) {
+                baseline_path = argv[++i];
+            } else if (arg == "--baseline-dir" && i + 1 < argc) {
+                baseline_path = std::string(argv[++i]) + "/" + hostname() + ".txt";
+            } else if (arg == "--write-baseline") {
+                write_baseline = true;
+            } else {
+                std::cerr << "unknown flag: " << arg << std::endl;
+                return 2;
+            }
+        }
+
+        std::cout << "\n=== OUROBOROS BENCHMARK SUITE ===\n" << std::endl;
+        std::cout << std::left << std::setw(44) << "benchmark"
+                  << std::right << std::setw(12) << "iterations"
+                  << std::setw(14) << "ns/op"
+                  << "  throughput" << std::endl;
+
+        std::vector<Result> results;
+        results.reserve(benches_.size());
+        for (const auto& bench : benches_) {
+            results.push_back(run_one(bench));
+        }
+        std::cout << std::endl;
+
+        if (baseline_path.empty()) return 0;
+        if (write_baseline) return save_baseline(baseline_path, results);
+        return check_baseline(baseline_path, results);
+    }
+
+private:
+    struct BenchEntry {
+        std::string name;
+        std::function<void(BenchState&)> func;
+    };
+
+    struct Result {
+        std::string name;
+        double ns_per_op = 0.0;
+    };
+
+    // A case more than this much slower than its baseline fails the run
+    static constexpr double REGRESSION_TOLERANCE = 0.15;
+    // Best-of-N measured runs after calibration; the calibration passes
+    // double as warmup, and min-of-N discards scheduler noise
+    static constexpr int MEASURE_REPEATS = 3;
+
+    // Calibrate: grow iteration count until the case runs >= ~200ms,
+    // then take the best of MEASURE_REPEATS warm runs at that count
+    Result run_one(const BenchEntry& bench) {
+        uint64_t iterations = 1;
+        for (;;) {
+            BenchState state(iterations);
+            bench.func(state);
+            auto ns = state.elapsed().count();
+            if (ns >= 200'000'000 || iterations >= (1ull << 30)) break;
+            // Aim for the target with one refinement pass
+            uint64_t scaled = (ns > 0)
+                ? iterations * 250'000'000 / static_cast<uint64_t>(ns)
+                : iterations * 100;
+            iterations = std::max(iterations + 1, scaled);
+        }
+
+        BenchState best(0);
+        double best_ns_per_op = 0.0;
+        for (int r = 0; r < MEASURE_REPEATS; ++r) {
+            BenchState state(iterations);
+            bench.func(state);
+            double ns_per_op = static_cast<double>(state.elapsed().count()) /
+                               static_cast<double>(state.iterations());
+            if (r == 0 || ns_per_op < best_ns_per_op) {
+                best_ns_per_op = ns_per_op;
+                best = state;
+            }
+        }
+
+        report(bench.name, best, best_ns_per_op);
+        return {bench.name, best_ns_per_op};
+    }
+
+    void report(const std::string& name, const BenchState& state, double ns_per_op) {
+        std::cout << std::left << std::setw(44) << name
+                  << std::right << std::setw(12) << state.iterations()
+                  << std::setw(14) << std::fixed << std::setprecision(1) << ns_per_op;
+
+        if (state.bytes_per_op() > 0) {
+            double mbps = static_cast<double>(state.bytes_per_op()) * 1000.0 / ns_per_op;
+            std::cout << "  " << std::setprecision(1) << mbps << " MB/s";
+        } else if (state.items_per_op() > 0) {
+            double mops = static_cast<double>(state.items_per_op()) * 1000.0 / ns_per_op;
+            std::cout << "  " << std::setprecision(2) << mops << " Mitems/s";
+        }
+        std::cout << std::endl;
+    }
+
+    static std::string hostname() {
+        char buf[256] = {};
+        if (gethostname(buf, sizeof(buf) - 1) != 0) return "unknown-host";
+        return buf;
+    }
+
+    static int save_baseline(const std::string& path, const std::vector<Result>& results) {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out) {
+            std::cerr << "failed to write baseline: " << path << std::endl;
+            return 2;
+        }
+        out << "# ns/op per benchmark, recorded on " << hostname() << "\n";
+        out << "# regenerate with: bench_core --baseline <this file> --write-baseline\n";
+        for (const auto& r : results) {
+            out << r.name << " " << std::fixed << std::setprecision(1) << r.ns_per_op << "\n";
+        }
+        std::cout << "baseline written: " << path << " (" << results.size() << " cases)" << std::endl;
+        return 0;
+    }
+
+    static int check_baseline(const std::string& path, const std::vector<Result>& results) {
+        std::ifstream in(path);
+        if (!in) {
+            std::cout << "no baseline at " << path
+                      << " - run with --write-baseline to record one" << std::endl;
+            return 0;
+        }
+        std::map<std::string, double> baseline;
+        std::string name;
+        double ns;
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            std::istringstream fields(line);
+            if (fields >> name >> ns) baseline[name] = ns;
+        }
+
+        int regressions = 0;
+        for (const auto& r : results) {
+            auto it = baseline.find(r.name);
+            if (it == baseline.end()) {
+                std::cout << "[NEW ] " << r.name << " (no baseline entry)" << std::endl;
+                continue;
+            }
+            double delta = (r.ns_per_op - it->second) / it->second;
+            if (delta > REGRESSION_TOLERANCE) {
+                std::cout << "[SLOW] " << r.name << ": " << std::fixed << std::setprecision(1)
+                          << it->second << " -> " << r.ns_per_op << " ns/op (+"
+                          << std::setprecision(0) << delta * 100.0 << "%)" << std::endl;
+                regressions++;
+            } else if (delta < -REGRESSION_TOLERANCE) {
+                // Big improvements deserve a refreshed baseline so the
+                // gain is locked in, but they don't fail the run
+                std::cout << "[FAST] " << r.name << ": " << std::fixed << std::setprecision(1)
+                          << it->second << " -> " << r.ns_per_op
+                          << " ns/op (consider --write-baseline)" << std::endl;
+            }
+        }
+
+        if (regressions > 0) {
+            std::cout << regressions << " benchmark(s) regressed past "
+                      << static_cast<int>(REGRESSION_TOLERANCE * 100) << "% tolerance" << std::endl;
+            return 1;
+        }
+        std::cout << "all benchmarks within tolerance of " << path << std::endl;
+        return 0;
+    }
+
+    std::vector<BenchEntry> benches_;
+};
+
+struct BenchRegistrar {
+    BenchRegistrar(const std::string& name, std::function<void(BenchState&)> func) {
+        BenchRunner::instance().register_bench(name, std::move(func));
+    }
+};
+
+}  // namespace ouroboros::bench
+
+#define BENCH_CASE(name) \
+    void name(ouroboros::bench::BenchState& state); \
+    static ouroboros::bench::BenchRegistrar bench_reg_##name(#name, name); \
+    void name(ouroboros::bench::BenchState& state)
@@ -1,8 +1,14 @@
 #include "../framework/SimpleTest.hpp"
 #include "util/ArtworkHasher.hpp"
+#include "audio/AudioRingBuffer.hpp"
+#include "ui/Canvas.hpp"
+#include "audio/LoudnessAnalyzer.hpp"
+#include "audio/SampleConvert.hpp"
+#include <cmath>
 #include <vector>
 
 using namespace ouroboros::util;
+namespace ui = ouroboros::ui;
 
 TEST_CASE(test_artwork_hasher_basic) {
     std::vector<unsigned char> data = {0x01, 0x02, 0x03, 0x04};
@@ -21,6 +27,240 @@ TEST_CASE(test_artwork_hasher_empty) {
     ASSERT_EQ(hash, 14695981039346656037ULL);
 }
 
+TEST_CASE(test_sha256_known_vectors) {
+    // FIPS 180-2 test vectors; exercises whichever compression path
+    // (SHA-NI, ARMv8 sha2, or scalar) the host CPU dispatches to
+    std::vector<unsigned char> abc = {'a', 'b', 'c'};
+    ASSERT_EQ(ArtworkHasher::hash_artwork(abc),
+              std::string("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+
+    ArtworkHasher::Sha256 empty;
+    ASSERT_EQ(empty.finish_hex(),
+              std::string("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"));
+}
+
+TEST_CASE(test_sha256_streaming_matches_one_shot) {
+    // 1000 bytes split at awkward offsets must equal the one-shot hash
+    std::vector<unsigned char> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<unsigned char>((i * 131 + 17) & 0xFF);
+    }
+    std::string expected = ArtworkHasher::hash_artwork(data);
+
+    ArtworkHasher::Sha256 stream;
+    size_t splits[] = {1, 63, 64, 65, 7, 512, 288};
+    size_t off = 0;
+    for (size_t n : splits) {
+        stream.update(data.data() + off, n);
+        off += n;
+    }
+    ASSERT_EQ(off, data.size());
+    ASSERT_EQ(stream.finish_hex(), expected);
+
+    std::vector<unsigned char> copy;
+    ASSERT_EQ(ArtworkHasher::hash_and_copy(data.data(), data.size(), copy), expected);
+    ASSERT_EQ(copy, data);
+}
+
+TEST_CASE(test_sample_convert_s16_matches_scalar) {
+    // Sizes straddle the SIMD widths so both the vector body and the
+    // scalar tail are exercised
+    for (size_t n : {1u, 7u, 8u, 15u, 16u, 17u, 1000u}) {
+        std::vector<short> in(n);
+        for (size_t i = 0; i < n; ++i) in[i] = static_cast<short>(i * 2731 - 17000);
+        if (n >= 2) { in[0] = -32768; in[1] = 32767; }
+
+        std::vector<float> out(n);
+        audio::convert_s16_to_float(in.data(), out.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(out[i], in[i] / 32768.0f);
+        }
+    }
+}
+
+TEST_CASE(test_sample_convert_interleave_stereo) {
+    std::vector<float> left(19), right(19);
+    for (size_t i = 0; i < left.size(); ++i) {
+        left[i] = static_cast<float>(i);
+        right[i] = static_cast<float>(i) + 0.5f;
+    }
+    std::vector<float> out(left.size() * 2);
+    const float* planes[2] = {left.data(), right.data()};
+    audio::interleave_planar_float(planes, 2, out.data(), left.size());
+    for (size_t i = 0; i < left.size(); ++i) {
+        ASSERT_EQ(out[i * 2], left[i]);
+        ASSERT_EQ(out[i * 2 + 1], right[i]);
+    }
+}
+
+TEST_CASE(test_sample_convert_dot_product_matches_scalar) {
+    // 424 is the DSD256 filter length; the small sizes exercise the
+    // scalar tail. FMA reorders the accumulation, so compare with a
+    // tolerance instead of exact equality.
+    for (size_t n : {1u, 15u, 16u, 17u, 112u, 424u}) {
+        std::vector<float> a(n), b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<float>(i % 13) - 6.0f;
+            b[i] = (i % 2) ? 1.0f : -1.0f;
+        }
+        float expected = 0.0f;
+        for (size_t i = 0; i < n; ++i) expected += a[i] * b[i];
+        ASSERT_NEAR(audio::dot_product(a.data(), b.data(), n), expected, 1e-3f);
+    }
+}
+
+TEST_CASE(test_crossfade_mix_matches_scalar) {
+    // Odd size exercises the vector body plus the scalar tail; the ramp
+    // deliberately starts below 0 and runs past 1 to hit the clamps
+    const size_t n = 103;
+    std::vector<float> out(n), in(n), ref(n);
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = ref[i] = static_cast<float>(i % 7) - 3.0f;
+        in[i] = 3.0f - static_cast<float>(i % 5);
+    }
+    const float t0 = -0.1f;
+    const float dt = 1.3f / n;
+    for (size_t i = 0; i < n; ++i) {
+        float t = t0 + dt * static_cast<float>(i);
+        float tc = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        ref[i] = ref[i] * std::sqrt(1.0f - tc) + in[i] * std::sqrt(tc);
+    }
+    audio::crossfade_mix(out.data(), in.data(), n, t0, dt);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_NEAR(out[i], ref[i], 1e-5f);
+    }
+    // Endpoints: all-outgoing at t=0, all-incoming at t=1
+    ASSERT_EQ(out[0], static_cast<float>(0 % 7) - 3.0f);
+    ASSERT_NEAR(out[n - 1], in[n - 1], 1e-5f);
+}
+
+TEST_CASE(test_ring_buffer_reserve_commit_wrap) {
+    audio::AudioRingBuffer ring;
+    ring.init(8, 2);  // 16 samples
+
+    // Advance the positions so the next reservation wraps
+    std::vector<float> scratch(6 * 2, 0.0f);
+    ASSERT_EQ(ring.write(scratch.data(), 6), 6u);
+    ASSERT_EQ(ring.read(scratch.data(), 6), 6u);
+
+    auto region = ring.reserve(4);
+    ASSERT_EQ(region.total_frames(), 4u);
+    ASSERT_EQ(region.first_frames, 2u);
+    ASSERT_EQ(region.second_frames, 2u);
+
+    // Fill front to back, commit, and read it back in order
+    float v = 1.0f;
+    for (size_t i = 0; i < region.first_frames * 2; ++i) region.first[i] = v++;
+    for (size_t i = 0; i < region.second_frames * 2; ++i) region.second[i] = v++;
+    ring.commit(4);
+
+    std::vector<float> out(4 * 2);
+    ASSERT_EQ(ring.read(out.data(), 4), 4u);
+    for (size_t i = 0; i < out.size(); ++i) {
+        ASSERT_EQ(out[i], static_cast<float>(i + 1));
+    }
+
+    // Nothing committed = nothing visible
+    auto r2 = ring.reserve(2);
+    ASSERT_TRUE(r2.total_frames() >= 2u);
+    ASSERT_EQ(ring.read_available_frames(), 0u);
+}
+
+TEST_CASE(test_canvas_packed_glyphs_roundtrip) {
+    ui::Canvas c(8, 2);
+
+    // Inline glyphs: 1, 3 and 4 UTF-8 bytes all round-trip
+    c.put(0, 0, "A");
+    c.put(1, 0, "\xE2\x94\x80");          // U+2500 box drawing
+    c.put(2, 0, "\xF0\x9F\x8E\xB5");      // U+1F3B5 musical note
+    ASSERT_EQ(std::string(c.glyph_at(0, 0)), "A");
+    ASSERT_EQ(std::string(c.glyph_at(1, 0)), "\xE2\x94\x80");
+    ASSERT_EQ(std::string(c.glyph_at(2, 0)), "\xF0\x9F\x8E\xB5");
+
+    // >4-byte cluster spills to the overflow table and still round-trips
+    std::string zwj = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA4";
+    c.put(3, 0, zwj);
+    ASSERT_EQ(std::string(c.glyph_at(3, 0)), zwj);
+
+    // cell_at materializes glyph + style
+    c.put(4, 0, "x", ui::Style{ui::Color::Red, ui::Color::Default, ui::Attribute::Bold});
+    ui::Cell cell = c.cell_at(4, 0);
+    ASSERT_EQ(cell.content, "x");
+    ASSERT_TRUE(cell.style.fg == ui::Color::Red);
+}
+
+TEST_CASE(test_canvas_cell_differs) {
+    ui::Canvas a(4, 1), b(4, 1);
+    ASSERT_FALSE(a.cell_differs(b, 0, 0));
+
+    a.put(0, 0, "A");
+    ASSERT_TRUE(a.cell_differs(b, 0, 0));
+    b.put(0, 0, "A");
+    ASSERT_FALSE(a.cell_differs(b, 0, 0));
+
+    // Same glyph, different style
+    b.put(0, 0, "A", ui::Style{ui::Color::Blue, ui::Color::Default, ui::Attribute::None});
+    ASSERT_TRUE(a.cell_differs(b, 0, 0));
+
+    // Equal overflow clusters compare equal even when their table
+    // indices differ between the two canvases
+    std::string zwj = "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA4";
+    b.put(1, 0, "\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8");  // occupy b's slot 0
+    b.put(2, 0, zwj);
+    a.put(2, 0, zwj);
+    ASSERT_FALSE(a.cell_differs(b, 2, 0));
+
+    // Snapshot copy is identical everywhere
+    b = a;
+    for (int x = 0; x < 4; ++x) ASSERT_FALSE(a.cell_differs(b, x, 0));
+}
+
+TEST_CASE(test_canvas_row_differs) {
+    ui::Canvas a(6, 3), b(6, 3);
+    for (int y = 0; y < 3; ++y) ASSERT_FALSE(a.row_differs(b, y));
+
+    a.put(2, 1, "A");
+    ASSERT_FALSE(a.row_differs(b, 0));
+    ASSERT_TRUE(a.row_differs(b, 1));
+    ASSERT_FALSE(a.row_differs(b, 2));
+
+    // Style-only change is damage too
+    b.put(2, 1, "A");
+    b.put(0, 2, " ", ui::Style{ui::Color::Default, ui::Color::Blue, ui::Attribute::None});
+    ASSERT_FALSE(a.row_differs(b, 1));
+    ASSERT_TRUE(a.row_differs(b, 2));
+
+    // Identical overflow words whose tables hold different clusters
+    // must still register as damage
+    a.put(0, 0, "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x8E\xA4");
+    b.put(0, 0, "\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8");
+    ASSERT_TRUE(a.row_differs(b, 0));
+}
+
+TEST_CASE(test_loudness_analyzer_bs1770_reference) {
+    // BS.1770: a 0 dBFS 997 Hz sine on one channel of a stereo pair
+    // reads -3.01 LKFS
+    audio::LoudnessAnalyzer a;
+    a.init(48000, 2);
+    std::vector<float> buf(48000 * 2, 0.0f);
+    for (int sec = 0; sec < 5; sec++) {
+        for (int i = 0; i < 48000; i++) {
+            double t = (sec * 48000.0 + i) / 48000.0;
+            buf[i * 2] = static_cast<float>(std::sin(2.0 * M_PI * 997.0 * t));
+        }
+        a.process(buf.data(), 48000);
+    }
+    ASSERT_NEAR(a.integrated_lufs(), -3.01, 0.1);
+}
+
+TEST_CASE(test_loudness_analyzer_silence_gated_out) {
+    audio::LoudnessAnalyzer a;
+    a.init(44100, 2);
+    std::vector<float> silence(44100 * 2, 0.0f);
+    for (int i = 0; i < 5; i++) a.process(silence.data(), 44100);
+    ASSERT_EQ(a.integrated_lufs(), -HUGE_VAL);
+}
+
 int main() {
     return ouroboros::test::TestRunner::instance().run_all();
 }
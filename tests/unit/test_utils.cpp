@@ -1,6 +1,11 @@
 #include "../framework/SimpleTest.hpp"
 #include "util/TimSort.hpp"
 #include "util/BoyerMoore.hpp"
+#include "util/TrigramIndex.hpp"
+#include "util/FuzzyMatch.hpp"
+#include "util/FlatMap.hpp"
+#include "util/Lz4.hpp"
+#include <string>
 #include <vector>
 #include <algorithm>
 #include <random>
@@ -32,6 +37,63 @@ TEST_CASE(test_timsort_reverse_sorted) {
     ASSERT_EQ(v[4], 5);
 }
 
+TEST_CASE(test_parallel_timsort_sliced_merge) {
+    // Large enough that the merge phase splits pairs into slices; heavy
+    // duplication checks the merge-path split keeps the sort stable
+    std::mt19937 rng(7);
+    std::vector<std::pair<int, int>> v(50000);
+    for (int i = 0; i < (int)v.size(); ++i) {
+        v[i] = {(int)(rng() % 16), i};
+    }
+    parallel_timsort(v, [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (size_t i = 1; i < v.size(); ++i) {
+        ASSERT_TRUE(v[i - 1].first <= v[i].first);
+        if (v[i - 1].first == v[i].first) {
+            ASSERT_TRUE(v[i - 1].second < v[i].second);
+        }
+    }
+}
+
+TEST_CASE(test_timsort_by_key) {
+    // Key is extracted once per element; bytewise key order decides
+    struct Row { std::string artist; int n; };
+    std::vector<Row> rows = {
+        {"The Zutons", 0}, {"aphex twin", 1}, {"Aphex Twin", 2}, {"Boards", 3}
+    };
+    parallel_timsort_by_key(rows, [](const Row& r) {
+        std::string key = r.artist;
+        for (auto& c : key) c = (char)std::tolower((unsigned char)c);
+        return key;
+    });
+    // Stable: equal keys keep original relative order
+    ASSERT_EQ(rows[0].n, 1);
+    ASSERT_EQ(rows[1].n, 2);
+    ASSERT_EQ(rows[2].n, 3);
+    ASSERT_EQ(rows[3].n, 0);
+}
+
+TEST_CASE(test_timsort_by_key_prefix_ties) {
+    // Keys sharing their first 8 bytes must fall through the packed
+    // prefix to the full key; short keys sort before their extensions
+    std::vector<std::string> v = {"aaaaaaaab", "aaaaaaaa", "aaaaaaaaa", "aaaaaaa"};
+    parallel_timsort_by_key(v, [](const std::string& s) { return s; });
+    ASSERT_EQ(v[0], std::string("aaaaaaa"));
+    ASSERT_EQ(v[1], std::string("aaaaaaaa"));
+    ASSERT_EQ(v[2], std::string("aaaaaaaaa"));
+    ASSERT_EQ(v[3], std::string("aaaaaaaab"));
+
+    // Matches the comparator-based sort on random data
+    std::mt19937 rng(42);
+    std::vector<std::string> big(2000);
+    for (auto& s : big) {
+        for (int i = 0; i < (int)(rng() % 12); ++i) s += (char)('a' + rng() % 4);
+    }
+    auto expected = big;
+    std::stable_sort(expected.begin(), expected.end());
+    parallel_timsort_by_key(big, [](const std::string& s) { return s; });
+    ASSERT_TRUE(big == expected);
+}
+
 TEST_CASE(test_boyer_moore_search) {
     BoyerMooreSearch bms("needle");
     
@@ -67,6 +129,201 @@ TEST_CASE(test_boyer_moore_case_insensitive) {
     ASSERT_EQ(pos, 9);
 }
 
+TEST_CASE(test_boyer_moore_case_sensitive_fast_path) {
+    // Case-sensitive search takes the memchr-accelerated skip loop;
+    // cover the edges: match at start, at end, repeated last byte
+    // forcing verify failures, and single-byte patterns
+    BoyerMooreSearch bms("aba", true);
+    ASSERT_EQ(bms.search(std::string("abacus")), 0);
+    ASSERT_EQ(bms.search(std::string("scaraba")), 4);
+    ASSERT_EQ(bms.search(std::string("aca aba")), 4);
+    ASSERT_EQ(bms.search(std::string("ABA")), -1);
+    ASSERT_EQ(bms.search(std::string("aa aa aa")), -1);
+
+    BoyerMooreSearch single("x", true);
+    ASSERT_EQ(single.search(std::string("aaxaa")), 2);
+    ASSERT_EQ(single.search(std::string("aaaaa")), -1);
+}
+
+TEST_CASE(test_boyer_moore_search_batch) {
+    std::vector<std::string> rows = {
+        "daft punk\ndiscovery", "boards of canada", "disco inferno", "short"
+    };
+    BoyerMooreSearch bms("disco", true);
+
+    std::vector<int> indices = {0, 1, 2, 3};
+    bms.search_batch(indices, [&](int i) { return std::string_view(rows[i]); });
+    ASSERT_EQ(indices.size(), 2u);
+    ASSERT_EQ(indices[0], 0);
+    ASSERT_EQ(indices[1], 2);
+}
+
+TEST_CASE(test_trigram_index_candidates) {
+    std::vector<std::string> keys = {
+        "daft punk\ndiscovery\none more time",
+        "daft punk\ndiscovery\naerodynamic",
+        "boards of canada\ngeogaddi\ndandelion",
+        "",  // not yet enriched - must never be a candidate
+    };
+    TrigramIndex index;
+    index.build(keys.size(), [&](size_t i) { return std::string_view(keys[i]); });
+    ASSERT_FALSE(index.empty());
+
+    std::vector<int> out;
+    ASSERT_TRUE(index.candidates("discovery", out));
+    ASSERT_EQ(out.size(), 2u);
+    ASSERT_EQ(out[0], 0);
+    ASSERT_EQ(out[1], 1);
+
+    // Trigram containment is a superset of substring match: every
+    // trigram of "candel" occurs in key 2 ("can" in canada, "and"/
+    // "nde"/"del" in dandelion) even though "candel" does not - the
+    // caller's verify pass is what rejects it
+    ASSERT_TRUE(index.candidates("candel", out));
+    ASSERT_EQ(out.size(), 1u);
+    ASSERT_EQ(out[0], 2);
+    BoyerMooreSearch verify("candel", true);
+    ASSERT_EQ(verify.search(keys[out[0]]), -1);
+
+    // A trigram absent from every key empties the candidate set
+    ASSERT_TRUE(index.candidates("zzz", out));
+    ASSERT_TRUE(out.empty());
+
+    // Too short for the index - caller must fall back to a linear scan
+    ASSERT_FALSE(index.candidates("da", out));
+}
+
+TEST_CASE(test_trigram_index_repeated_trigrams) {
+    std::vector<std::string> keys = {"banana band", "cabana"};
+    TrigramIndex index;
+    index.build(keys.size(), [&](size_t i) { return std::string_view(keys[i]); });
+
+    // "ana" occurs twice in key 0; posting lists must stay deduplicated
+    std::vector<int> out;
+    ASSERT_TRUE(index.candidates("anana", out));
+    ASSERT_EQ(out.size(), 1u);
+    ASSERT_EQ(out[0], 0);
+
+    ASSERT_TRUE(index.candidates("ana", out));
+    ASSERT_EQ(out.size(), 2u);
+}
+
+TEST_CASE(test_fuzzy_match_subsequence) {
+    FuzzyMatcher m("blckstr");
+    ASSERT_TRUE(m.score("david bowie\nblackstar\nblackstar").has_value());
+    ASSERT_FALSE(m.score("david bowie\nlow\nsound and vision").has_value());
+    // In-order requirement: bytes present but reversed must not match
+    FuzzyMatcher rev("ba");
+    ASSERT_TRUE(rev.score("abba").has_value());
+    ASSERT_FALSE(rev.score("ab").has_value());
+}
+
+TEST_CASE(test_fuzzy_match_ranking) {
+    FuzzyMatcher m("disco");
+    // Consecutive run at a word start must outrank a scattered alignment
+    auto tight = m.score("daft punk\ndiscovery\none more time");
+    auto loose = m.score("dio\nsacred heart\nking of rock and roll");
+    ASSERT_TRUE(tight.has_value());
+    ASSERT_TRUE(loose.has_value());
+    ASSERT_TRUE(*tight > *loose);
+}
+
+TEST_CASE(test_flat_map_basic) {
+    FlatMap<std::string, int> m;
+    ASSERT_TRUE(m.empty());
+    m["a"] = 1;
+    m["b"] = 2;
+    m["a"] = 3;  // overwrite, not duplicate
+    ASSERT_EQ(m.size(), 2u);
+    ASSERT_EQ(m.find("a")->second, 3);
+    ASSERT_EQ(m.find("b")->second, 2);
+    ASSERT_TRUE(m.find("c") == m.end());
+
+    ASSERT_EQ(m.erase("a"), 1u);
+    ASSERT_EQ(m.erase("a"), 0u);
+    ASSERT_EQ(m.size(), 1u);
+    ASSERT_TRUE(m.find("a") == m.end());
+    ASSERT_EQ(m.find("b")->second, 2);
+}
+
+TEST_CASE(test_flat_map_growth_and_iteration) {
+    // Push through several rehashes and backward-shift deletions, then
+    // verify against the reference map
+    FlatMap<std::string, int> m;
+    m.reserve(100);
+    std::unordered_map<std::string, int> ref;
+    std::mt19937 rng(3);
+    for (int i = 0; i < 5000; ++i) {
+        std::string key = "track/" + std::to_string(rng() % 1000) + ".flac";
+        if (rng() % 4 == 0) {
+            ASSERT_EQ(m.erase(key), ref.erase(key));
+        } else if (rng() % 2 == 0) {
+            m.insert_or_assign(key, i);
+            ref[key] = i;
+        } else {
+            m[key] = i;
+            ref[key] = i;
+        }
+    }
+    ASSERT_EQ(m.size(), ref.size());
+    size_t visited = 0;
+    for (const auto& [key, value] : m) {
+        auto it = ref.find(key);
+        ASSERT_TRUE(it != ref.end());
+        ASSERT_EQ(value, it->second);
+        ++visited;
+    }
+    ASSERT_EQ(visited, ref.size());
+}
+
+TEST_CASE(test_lz4_roundtrip) {
+    auto roundtrip = [](const std::string& original) {
+        std::string compressed;
+        lz4::compress_block(original, compressed);
+        std::string restored(original.size(), '\0');
+        ASSERT_TRUE(lz4::decompress_block(compressed, restored.data(), restored.size()));
+        ASSERT_TRUE(restored == original);
+        return compressed.size();
+    };
+
+    roundtrip("");
+    roundtrip("short");
+    roundtrip(std::string(100000, 'a'));  // RLE / overlapping matches
+
+    // Cache-like redundancy: repeated path prefixes must compress well
+    std::string paths;
+    for (int i = 0; i < 2000; ++i) {
+        paths += "/home/user/Music/Some Artist/Some Album/" +
+                 std::to_string(i) + " - Track Title.flac\n";
+    }
+    ASSERT_TRUE(roundtrip(paths) < paths.size() / 3);
+
+    // Incompressible random bytes still roundtrip
+    std::mt19937 rng(11);
+    std::string noise(50000, '\0');
+    for (auto& c : noise) c = (char)(rng() & 0xFF);
+    roundtrip(noise);
+}
+
+TEST_CASE(test_lz4_rejects_corrupt_input) {
+    std::string compressed;
+    lz4::compress_block(std::string(5000, 'x') + "unique tail bytes", compressed);
+    std::string out(5017, '\0');
+
+    // Truncation and wrong output sizes must fail, never overrun
+    ASSERT_FALSE(lz4::decompress_block(
+        std::string_view(compressed).substr(0, compressed.size() / 2),
+        out.data(), out.size()));
+    ASSERT_FALSE(lz4::decompress_block(compressed, out.data(), out.size() - 1));
+
+    // An offset pointing before the start of the buffer must be caught
+    std::string bogus;
+    bogus += '\x04';          // 0 literals, match length 8
+    bogus += '\x10';          // offset 16 - but nothing decoded yet
+    bogus += '\x00';
+    ASSERT_FALSE(lz4::decompress_block(bogus, out.data(), 8));
+}
+
 int main() {
     return ouroboros::test::TestRunner::instance().run_all();
 }